@@ -0,0 +1,159 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/*********************** MPEG-H 3DA arithmetic decoder benchmark ****************
+
+   Author(s):
+
+   Description: Microbenchmark of CArco_DecodeArithData(). Decodes spectra of 1024
+                and 128 lines from a fixed-seed random buffer at random bit offsets,
+                every 7th with a context reset, and prints a hash of all decoded
+                lines and consumed bits to compare the output of two builds.
+
+*******************************************************************************/
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ac_arith_coder.h"
+#include "FDK_bitstream.h"
+
+#define BENCH_NUM_CALLS 400000
+#define BENCH_BUFFER_SIZE 65536 /* power of two, as required by FDK_BITSTREAM */
+
+static UINT benchRandom(UINT* seed) {
+  *seed = *seed * 1664525 + 1013904223;
+  return *seed >> 8;
+}
+
+static void benchHash(unsigned long long* hash, UINT value) {
+  *hash = (*hash ^ value) * 1099511628211ULL;
+}
+
+int main(int argc, char** argv) {
+  static UCHAR buffer[BENCH_BUFFER_SIZE];
+  static FIXP_DBL spectrum[1024];
+  const long numCalls = (argc > 1) ? atol(argv[1]) : BENCH_NUM_CALLS;
+  unsigned long long hash = 1469598103934665603ULL;
+  double ns = 0.0;
+  long bits = 0;
+  UINT seed = 7;
+
+  for (int i = 0; i < BENCH_BUFFER_SIZE; i++) {
+    buffer[i] = (UCHAR)benchRandom(&seed);
+  }
+
+  CArcoData* hArco = CArco_Create();
+  if (hArco == NULL) {
+    return 1;
+  }
+
+  for (long n = 0; n < numCalls; n++) {
+    FDK_BITSTREAM bs;
+    const int lg = (benchRandom(&seed) & 1) ? 1024 : 128;
+    const UINT start = benchRandom(&seed) % (BENCH_BUFFER_SIZE * 8 - 20000);
+
+    FDKinitBitStream(&bs, buffer, BENCH_BUFFER_SIZE, BENCH_BUFFER_SIZE * 8, BS_READER);
+    FDKpushFor(&bs, start);
+    const INT validBits = FDKgetValidBits(&bs);
+
+    /* Only the decoding itself is timed */
+    auto t0 = std::chrono::steady_clock::now();
+    ARITH_CODING_ERROR err = CArco_DecodeArithData(hArco, &bs, spectrum, lg, lg, (n % 7) == 0);
+    auto t1 = std::chrono::steady_clock::now();
+
+    ns += std::chrono::duration<double, std::nano>(t1 - t0).count();
+    bits += validBits - FDKgetValidBits(&bs);
+    for (int i = 0; i < lg; i++) {
+      benchHash(&hash, (UINT)spectrum[i]);
+    }
+    benchHash(&hash, (UINT)(FDKgetValidBits(&bs) * 31 + err));
+  }
+
+  CArco_Destroy(hArco);
+
+  printf("hash %016llx\n", hash);
+  printf("%ld calls: %.0f ns/call, %.2f ns/bit, %.1f Mbit/s\n", numCalls, ns / numCalls, ns / bits,
+         bits / ns * 1e3);
+  return 0;
+}
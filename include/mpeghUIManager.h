@@ -99,6 +99,8 @@ amm-info@iis.fraunhofer.de
  * \brief  MPEG-H UI Manager library interface header file.
  */
 
+#include <stddef.h>
+
 #include "mpeghexport.h"
 
 #ifdef __cplusplus
@@ -107,6 +109,19 @@ extern "C" {
 
 typedef struct MPEGH_UI_MANAGER* HANDLE_MPEGH_UI_MANAGER;
 
+/**
+ * @brief  Heap allocator callbacks for mpegh_UI_Manager_OpenWithAllocator().
+ */
+typedef struct MPEGH_UI_ALLOCATOR {
+  void* (*mallocFunc)(void* context, size_t size); /*!< Allocate size bytes. Mandatory. */
+  void* (*alignedAllocFunc)(void* context, size_t size,
+                            size_t alignment); /*!< Allocate size bytes aligned to alignment (a
+                                                    power of two). Optional, may be NULL. */
+  void (*freeFunc)(void* context, void* ptr);  /*!< Free a block returned by mallocFunc or
+                                                    alignedAllocFunc. Mandatory. */
+  void* context; /*!< Opaque pointer handed to each callback. */
+} MPEGH_UI_ALLOCATOR;
+
 #define MAX_NUMBER_SECONDARY_STREAMS 16
 
 typedef enum {
@@ -168,6 +183,18 @@ typedef enum {
  */
 MPEGHDEC_EXPORT HANDLE_MPEGH_UI_MANAGER mpegh_UI_Manager_Open(void);
 
+/**
+ * @brief  Open a mpegh UI manager instance that takes all of its memory from caller-supplied
+ *         allocator callbacks. The memory is returned through the same callbacks by
+ *         mpegh_UI_Manager_Close().
+ *
+ * @param[in] allocator  Allocator callbacks. NULL selects the C library allocator, same as
+ *                       mpegh_UI_Manager_Open().
+ * @return               UI manager handle
+ */
+MPEGHDEC_EXPORT HANDLE_MPEGH_UI_MANAGER
+mpegh_UI_Manager_OpenWithAllocator(const MPEGH_UI_ALLOCATOR* allocator);
+
 /**
  * @brief  De-allocate all resources of a mpegh UI manager instance.
  *
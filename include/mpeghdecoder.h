@@ -80,6 +80,7 @@ www.iis.fraunhofer.de/amm
 amm-info@iis.fraunhofer.de
 -----------------------------------------------------------------------------*/
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -187,6 +188,18 @@ typedef struct MPEGH_DECODER_OUTPUT_INFO {
   bool isConcealed;         /*!< Flag to signal if the decoded PCM audio signal is concealed. */
 } MPEGH_DECODER_OUTPUT_INFO;
 
+/**
+ * @brief  Read-only view into the decoder's internal output sample buffer. Because the buffer is
+ *         a ring, one output frame can be split into two contiguous spans. The interleaved PCM
+ *         samples of the frame are data[0][0 .. length[0]-1] followed by
+ *         data[1][0 .. length[1]-1]. All fields are read-only.
+ */
+typedef struct MPEGH_DECODER_SAMPLES_VIEW {
+  const int32_t* data[2]; /*!< Start of the first and second span. data[1] is NULL if the frame
+                               is not split. */
+  uint32_t length[2];     /*!< Number of samples (not samples per channel) in each span. */
+} MPEGH_DECODER_SAMPLES_VIEW;
+
 /**
  * @brief  Open an MPEG-H decoder instance.
  *
@@ -195,6 +208,331 @@ typedef struct MPEGH_DECODER_OUTPUT_INFO {
  */
 MPEGHDEC_EXPORT HANDLE_MPEGH_DECODER_CONTEXT mpeghdecoder_init(int32_t cicpSetup);
 
+/**
+ * @brief  Heap allocator callbacks. A decoder instance opened with
+ *         mpeghdecoder_initWithAllocator() takes all of its memory from these callbacks.
+ */
+typedef struct MPEGH_DECODER_ALLOCATOR {
+  void* (*mallocFunc)(void* context, size_t size); /*!< Allocate size bytes. Mandatory. */
+  void* (*alignedAllocFunc)(void* context, size_t size,
+                            size_t alignment); /*!< Allocate size bytes aligned to alignment (a
+                                                    power of two). Optional, may be NULL. */
+  void (*freeFunc)(void* context, void* ptr);  /*!< Free a block returned by mallocFunc or
+                                                    alignedAllocFunc. Mandatory. */
+  void* context; /*!< Opaque pointer handed to each callback, e.g. a memory pool or tenant. */
+} MPEGH_DECODER_ALLOCATOR;
+
+/**
+ * @brief  Open an MPEG-H decoder instance that uses caller-supplied allocator callbacks. The
+ *         callbacks are used for all allocations of the instance until it is destroyed, on
+ *         whichever thread the instance is called. They must be thread-safe if other instances
+ *         sharing the same context are driven from other threads.
+ *
+ * @param[in] cicpSetup  The CICP index of the desired target layout.
+ * @param[in] allocator  Allocator callbacks. The structure is copied. NULL selects the C library
+ *                       allocator, same as mpeghdecoder_init().
+ * @return               MPEG-H decoder handle.
+ */
+MPEGHDEC_EXPORT HANDLE_MPEGH_DECODER_CONTEXT
+mpeghdecoder_initWithAllocator(int32_t cicpSetup, const MPEGH_DECODER_ALLOCATOR* allocator);
+
+/**
+ * @brief  Heap memory of a decoder instance, see mpeghdecoder_getRequiredMemory().
+ */
+typedef struct MPEGH_DECODER_MEMORY_INFO {
+  size_t persistent; /*!< Bytes holding state of one instance between frames. */
+  size_t scratch;    /*!< Bytes of work buffers without state between frames. Instances decoding
+                          on the same thread can share them, see mpeghdecoder_setScratch(). */
+} MPEGH_DECODER_MEMORY_INFO;
+
+/**
+ * @brief  Query the heap memory of a decoder instance before creating it. The result is an upper
+ *         bound for any stream within the given limits, including the memory taken when the
+ *         stream configuration is applied. Allocator callbacks add their own overhead.\n
+ *         Parts of the decoder size their memory at run-time, so the function measures them by
+ *         opening and closing a short-lived instance with the current thread's allocator.
+ *
+ * @note   The call itself allocates the reported memory: while it runs, up to persistent plus
+ *         scratch bytes are taken from the current thread's allocator and freed again before it
+ *         returns. It fails with MPEGH_DEC_OUT_OF_MEMORY if they are not available. Hosts that
+ *         budget their heap per instance should query once per configuration and cache the
+ *         result instead of calling it on a tight heap.
+ *
+ * @param[in]  cicpSetup         The CICP index of the desired target layout.
+ * @param[in]  maxInputChannels  Maximum number of channel based signals of the stream.
+ * @param[in]  maxObjects        Maximum number of object signals of the stream.
+ * @param[out] info              Receives the memory requirement.
+ * @return                       Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_getRequiredMemory(
+    int32_t cicpSetup, int32_t maxInputChannels, int32_t maxObjects,
+    MPEGH_DECODER_MEMORY_INFO* info);
+
+/**
+ * @brief  Loudspeaker of a custom target layout, see mpeghdecoder_registerSpeakerLayout().
+ */
+typedef struct MPEGH_DECODER_SPEAKER {
+  int32_t azimuth;   /*!< Azimuth angle in degrees from -180 to 180, positive values to the
+                          left. */
+  int32_t elevation; /*!< Elevation angle in degrees from -90 to 90. */
+  bool isLfe;        /*!< Flag to signal an LFE loudspeaker. */
+} MPEGH_DECODER_SPEAKER;
+
+/**
+ * @brief  Object renderer setup of a custom target layout, see
+ *         mpeghdecoder_registerSpeakerLayout(). All fields are read-only.
+ */
+typedef struct MPEGH_DECODER_LAYOUT_INFO {
+  int32_t numTriangles;     /*!< Number of loudspeaker triangles used for panning objects. */
+  int32_t numGhostSpeakers; /*!< Number of ghost speakers added to close gaps of the layout. At
+                                 most 6, so the setup cost is bounded by the 24 loudspeakers. */
+  bool isShared;            /*!< Flag to signal that the setup was already built for the same
+                                 layout before and was reused. */
+  uint32_t setupTimeUs;     /*!< Time in microseconds taken by the registration. */
+} MPEGH_DECODER_LAYOUT_INFO;
+
+/**
+ * @brief  Register an arbitrary loudspeaker layout as target layout. The returned index can be
+ *         passed as cicpSetup to mpeghdecoder_init(), mpeghdecoder_initWithAllocator() and
+ *         mpeghdecoder_getRequiredMemory(). Objects are rendered to the loudspeakers directly, and
+ *         the triangulation of the layout is built here once for all instances of the process
+ *         instead of at decoder configuration. A layout matching a CICP layout gets the CICP
+ *         index, the same layout registered again gets the same index. Up to 8 custom layouts can
+ *         be registered per process.
+ *
+ * @param[in]  speakers     Array of numSpeakers loudspeakers in output channel order.
+ * @param[in]  numSpeakers  Number of loudspeakers including LFEs, at most 24.
+ * @param[out] cicpSetup    Receives the index of the target layout.
+ * @param[out] info         Receives the setup cost of the layout. May be NULL.
+ * @return                  Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_registerSpeakerLayout(
+    const MPEGH_DECODER_SPEAKER* speakers, int32_t numSpeakers, int32_t* cicpSetup,
+    MPEGH_DECODER_LAYOUT_INFO* info);
+
+/**
+ * @brief  Export the object renderer setup of a target layout (loudspeaker triangles, their
+ *         inverse matrices and the ghost speaker downmix) in binary form, e.g. to store it with
+ *         the application and import it with mpeghdecoder_importSpeakerMesh() at the next start.
+ *         The setup is built if no decoder instance of the process did so before. The data is
+ *         valid for builds of the same decoder version and byte order.
+ *
+ * @param[in]     cicpSetup  The CICP index or index of mpeghdecoder_registerSpeakerLayout().
+ * @param[out]    buffer     Receives the mesh. NULL to query the size only.
+ * @param[in,out] size       Size of buffer in bytes, receives the size of the mesh.
+ * @return                   Error code, MPEGH_DEC_BUFFER_ERROR if buffer is too small.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_exportSpeakerMesh(int32_t cicpSetup,
+                                                                   void* buffer, uint32_t* size);
+
+/**
+ * @brief  Import an object renderer setup of mpeghdecoder_exportSpeakerMesh(), so that decoder
+ *         instances and mpeghdecoder_registerSpeakerLayout() skip the triangulation of its target
+ *         layout. The setups of the last four target layouts are kept per process. Setups of custom
+ *         layouts are identified by their loudspeaker positions, not by their index.
+ *
+ * @param[in] buffer  Mesh of mpeghdecoder_exportSpeakerMesh().
+ * @param[in] size    Size of the mesh in bytes.
+ * @return            Error code, MPEGH_DEC_UNSUPPORTED_PARAM if buffer holds no mesh of this
+ *                    build.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_importSpeakerMesh(const void* buffer,
+                                                                   uint32_t size);
+
+/**
+ * @brief  Add a target layout rendered from the same decoding as the layout of hCtx. The stream is
+ *         parsed and decoded once, only format conversion, object rendering and limiting run per
+ *         target layout. The returned handle delivers the output of the added layout via
+ *         mpeghdecoder_getSamples(), mpeghdecoder_getSamplesView() and
+ *         mpeghdecoder_releaseSamples(), and can have its own output frame pool. All other
+ *         functions are called on hCtx only and act on all of its target layouts.\n
+ *         DRC and loudness normalization are selected for the layout of hCtx and applied to all
+ *         layouts. A downmix matrix transmitted in the stream applies to the layout of hCtx only.
+ *         Up to 3 target layouts can be added. Adding one to a configured decoder restarts it,
+ *         same as mpeghdecoder_flush(). The returned handle is destroyed together with hCtx.
+ *
+ * @param[in] hCtx       MPEG-H decoder handle of mpeghdecoder_init() or
+ *                       mpeghdecoder_initWithAllocator().
+ * @param[in] cicpSetup  The CICP index of the added target layout.
+ * @return               MPEG-H decoder handle of the target layout, NULL on failure.
+ */
+MPEGHDEC_EXPORT HANDLE_MPEGH_DECODER_CONTEXT
+mpeghdecoder_addTargetLayout(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t cicpSetup);
+
+typedef struct MPEGH_DECODER_SCRATCH* HANDLE_MPEGH_DECODER_SCRATCH;
+
+/**
+ * @brief  Allocate a set of work buffers that can be shared by several decoder instances. The
+ *         buffers only hold data during a single API call of an instance, so instances sharing
+ *         them must never be called concurrently, e.g. by driving all of them from one thread.
+ *
+ * @param[in] allocator  Allocator callbacks, see mpeghdecoder_initWithAllocator(). NULL selects
+ *                       the C library allocator.
+ * @return               Handle of the work buffers, NULL on failure.
+ */
+MPEGHDEC_EXPORT HANDLE_MPEGH_DECODER_SCRATCH
+mpeghdecoder_createScratch(const MPEGH_DECODER_ALLOCATOR* allocator);
+
+/**
+ * @brief  Free a set of shared work buffers. No decoder instance may be using them anymore.
+ *
+ * @param[in] hScratch  Handle of the work buffers.
+ */
+MPEGHDEC_EXPORT void mpeghdecoder_destroyScratch(HANDLE_MPEGH_DECODER_SCRATCH hScratch);
+
+/**
+ * @brief  Let a decoder instance use a set of shared work buffers instead of its own ones, which
+ *         are freed meanwhile. The work buffers can be changed between any two API calls.
+ *
+ * @param[in] hCtx      MPEG-H decoder handle.
+ * @param[in] hScratch  Handle of the work buffers. NULL switches back to work buffers owned by the
+ *                      instance.
+ * @return              Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_setScratch(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                                            HANDLE_MPEGH_DECODER_SCRATCH hScratch);
+
+/**
+ * @brief  Executor for the parallel parts of a decoder call, supplied by the application so that
+ *         the decoder can use its thread pool.
+ */
+typedef struct MPEGH_DECODER_TASK_EXECUTOR {
+  void (*execute)(void* context, void (*task)(void* taskData, int32_t taskIndex), void* taskData,
+                  int32_t numTasks); /*!< Run task(taskData, i) for every i in [0, numTasks),
+                                          possibly concurrently, and return when all of them have
+                                          finished. A task may wait for another task that is
+                                          already running. */
+  void* context;                     /*!< Opaque pointer handed to execute(). */
+  int32_t maxWorkers; /*!< Maximum number of tasks per execute() call, 1 disables parallel
+                           decoding. */
+} MPEGH_DECODER_TASK_EXECUTOR;
+
+/**
+ * @brief  Decode the channels of a frame in parallel tasks. The output is identical to serial
+ *         decoding. Every task beyond the first one takes additional work buffers of 40 kB.
+ *
+ * @param[in] hCtx      MPEG-H decoder handle.
+ * @param[in] executor  Task executor, the structure is copied. NULL selects serial decoding.
+ * @return              Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_setTaskExecutor(
+    HANDLE_MPEGH_DECODER_CONTEXT hCtx, const MPEGH_DECODER_TASK_EXECUTOR* executor);
+
+/**
+ * @brief  Render each frame while the next one is decoded, in parallel tasks if a task executor is
+ *         set. Output is delayed by one frame, which mpeghdecoder_flushAndGet() releases at the end
+ *         of the stream, and which mpeghdecoder_flush() discards like all other pending samples.
+ *         Apart from that delay the output is identical to serial decoding. Takes additional work
+ *         buffers of 614 kB.
+ *
+ * @param[in] hCtx    MPEG-H decoder handle.
+ * @param[in] enable  1 enables pipelined decoding, 0 disables it and drops a held back frame.
+ * @return            Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_setPipelinedDecoding(
+    HANDLE_MPEGH_DECODER_CONTEXT hCtx, int enable);
+
+/**
+ * @brief  Decoded signal before rendering, see MPEGH_DECODER_SIGNALS. All fields are read-only.
+ */
+typedef struct MPEGH_DECODER_SIGNAL {
+  const int32_t* samples; /*!< numSamplesPerSignal samples. Shifting them left by
+                               MPEGH_DECODER_SIGNALS::headroom bits with saturation gives full
+                               scale samples like the ones of mpeghdecoder_getSamples(). */
+  int16_t group;          /*!< Index of the signal group in MPEGH_DECODER_SIGNALS::groups. */
+  int16_t azimuth;        /*!< Azimuth of the loudspeaker of a channel signal in degrees, positive
+                               values to the left. 0 for other signals. */
+  int16_t elevation;      /*!< Elevation of the loudspeaker of a channel signal in degrees. */
+  int16_t isLfe;          /*!< 1 for an LFE channel signal, 0 otherwise. */
+} MPEGH_DECODER_SIGNAL;
+
+/**
+ * @brief  Signal group of the decoded audio scene, see MPEGH_DECODER_SIGNALS. All fields are
+ *         read-only.
+ */
+typedef struct MPEGH_DECODER_SIGNAL_GROUP {
+  uint8_t type;        /*!< 0: Channels, 1: Objects, 2: SAOC, 3: HOA. */
+  uint8_t cicpLayout;  /*!< CICP index of the loudspeaker layout of a channel signal group, 0 if
+                            the loudspeakers are listed individually by the signals. */
+  uint8_t firstSignal; /*!< Index of the first signal of the group in
+                            MPEGH_DECODER_SIGNALS::signals. */
+  uint8_t numSignals;  /*!< Number of signals of the group. */
+} MPEGH_DECODER_SIGNAL_GROUP;
+
+/**
+ * @brief  Object metadata of one object signal at one point in time, see MPEGH_DECODER_SIGNALS.
+ *         The object reaches these values at sampleOffset and is interpolated linearly from its
+ *         previous entry, like the object renderer of the decoder does. All fields are read-only.
+ */
+typedef struct MPEGH_DECODER_OBJECT_METADATA {
+  int32_t sampleOffset;  /*!< Sample position counted from the first sample of the signals of
+                              this frame. Positions beyond numSamplesPerSignal are reached during
+                              the next frame. */
+  uint16_t signal;       /*!< Index of the object signal in MPEGH_DECODER_SIGNALS::signals. */
+  int16_t azimuth;       /*!< Azimuth in 1/100 degrees from -18000 to 18000, positive values to
+                              the left. */
+  int16_t elevation;     /*!< Elevation in 1/100 degrees from -9000 to 9000. */
+  uint16_t radius;       /*!< Distance in 1/256 meters. */
+  uint16_t gain;         /*!< Linear gain, 4096 is 0 dB. */
+  uint16_t spreadWidth;  /*!< Spread width in 1/100 degrees. Applies to all dimensions if the
+                              object has a uniform spread. */
+  uint16_t spreadHeight; /*!< Spread height in 1/100 degrees, 0 for uniform spread. */
+  uint16_t spreadDepth;  /*!< Spread depth in 1/256 meters, 0 for uniform spread. */
+} MPEGH_DECODER_OBJECT_METADATA;
+
+/**
+ * @brief  Decoded signals and object metadata of one frame, handed to the callback set with
+ *         mpeghdecoder_setSignalsCallback(). All pointers are only valid during the callback.
+ */
+typedef struct MPEGH_DECODER_SIGNALS {
+  uint64_t pts;            /*!< The presentation timestamp in nano seconds of the frame. The
+                                signals lag it by delay samples. */
+  int sampleRate;          /*!< The sample rate in Hz of the signals, which is not converted to
+                                48 kHz. */
+  int numSamplesPerSignal; /*!< The number of samples of each signal. */
+  int delay;               /*!< Delay of the signals in samples, which the rendered output
+                                compensates at the start of the stream. */
+  int headroom;            /*!< Bits of headroom of the samples. */
+  bool isConcealed;        /*!< Flag to signal if the frame is concealed. */
+  int numSignals;          /*!< The number of active signals of the audio scene. */
+  const MPEGH_DECODER_SIGNAL* signals;       /*!< The signals, in signal group order. */
+  int numGroups;                             /*!< The number of active signal groups. */
+  const MPEGH_DECODER_SIGNAL_GROUP* groups;  /*!< The signal groups. */
+  int numObjectMetadata;                     /*!< The number of object metadata entries. */
+  const MPEGH_DECODER_OBJECT_METADATA* objectMetadata; /*!< The object metadata of all object
+                                                            signals, in ascending sampleOffset
+                                                            per object. */
+} MPEGH_DECODER_SIGNALS;
+
+/**
+ * @brief  Callback receiving the signals of each decoded frame, see
+ *         mpeghdecoder_setSignalsCallback().
+ */
+typedef void (*MPEGH_DECODER_SIGNALS_CALLBACK)(void* context,
+                                               const MPEGH_DECODER_SIGNALS* signals);
+
+/**
+ * @brief  Skip format conversion and object rendering and hand the decoded channel and object
+ *         signals together with the object metadata to a callback instead, e.g. for a binaural
+ *         or other external renderer. The callback is invoked by mpeghdecoder_process() and
+ *         mpeghdecoder_flushAndGet() once per decoded frame. The signals are not copied, they
+ *         point into the work buffers of the decoder. User interactivity and the DRC applied
+ *         before rendering are included, the 48 kHz resampling, the DRC and loudness
+ *         normalization applied after rendering, earcons and the limiter are not. No samples are
+ *         output by mpeghdecoder_getSamples() meanwhile.\n
+ *         Switching between rendering and the callback drops the samples pending for
+ *         mpeghdecoder_getSamples(). Not available while samples obtained with
+ *         mpeghdecoder_getSamplesView() are not released, together with pipelined decoding or with
+ *         added target layouts.
+ *
+ * @param[in] hCtx      MPEG-H decoder handle.
+ * @param[in] callback  Callback receiving the signals. NULL switches back to rendering.
+ * @param[in] context   Opaque pointer handed to the callback.
+ * @return              Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_setSignalsCallback(
+    HANDLE_MPEGH_DECODER_CONTEXT hCtx, MPEGH_DECODER_SIGNALS_CALLBACK callback, void* context);
+
 /**
  * @brief  Explicitly configure the decoder by passing the MHA config contained in a binary buffer.
  *         This is required for MPEG-H MHA format bitstreams which have no in-band config.
@@ -209,6 +547,31 @@ MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_setMhaConfig(HANDLE_MPEGH_DECOD
                                                               const uint8_t* config,
                                                               uint32_t configSize);
 
+/**
+ * @brief  Register a pool of caller-owned output frames. If a pool is registered, the decoder
+ *         writes each decoded frame directly into the next free pool frame instead of an internal
+ *         buffer, and only keeps track of which frames are in use. A pool frame becomes free
+ *         again once mpeghdecoder_getSamples() or mpeghdecoder_getSamplesView() has taken its
+ *         samples over into the internal output buffer, which happens as soon as the timestamp of
+ *         the next MHAS frame is known. The frames must stay valid until the pool is replaced or
+ *         the decoder instance is destroyed, and must not be accessed by the caller meanwhile.\n
+ *         mpeghdecoder_process() only accepts an MHAS frame while two pool frames are free, as a
+ *         sync error can force a concealed frame ahead of it. Otherwise it returns
+ *         ::MPEGH_DEC_BUFFER_ERROR and the samples have to be obtained first.\n
+ *         The pool can only be changed while no decoded samples are pending, i.e. directly after
+ *         mpeghdecoder_init() or mpeghdecoder_flush(). Passing numFrames = 0 unregisters the pool.
+ *
+ * @param[in] hCtx         MPEG-H decoder handle.
+ * @param[in] frames       Array of numFrames pointers to output frames.
+ * @param[in] numFrames    Number of frames in the pool, at least 4, or 0.
+ * @param[in] frameLength  Size of each frame in samples. Needs space to hold up to 3072 samples per
+ *                         rendered output channel.
+ * @return                 Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_setOutputFramePool(
+    HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* const* frames, uint32_t numFrames,
+    uint32_t frameLength);
+
 /**
  * @brief  De-allocate all resources of an MPEG-H decoder instance.
  *
@@ -222,7 +585,8 @@ MPEGHDEC_EXPORT void mpeghdecoder_destroy(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
  *         buffer and adds the corresponding timestamp to a timestamp queue. Furthermore, it
  *         decodes as many frames as possible and pushes the decoded samples into a samples queue.
  *         The decoded PCM samples can then be obtained by calling the mpeghdecoder_getSamples()
- *         function.
+ *         function. If the input buffer holds more frames than the samples queue can take, the
+ *         remaining frames stay in the internal input buffer and are decoded by the next call.
  *
  * @param[in] hCtx       MPEG-H decoder handle.
  * @param[in] inData     Pointer to external input buffer.
@@ -255,6 +619,87 @@ MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_processTimescale(HANDLE_MPEGH_D
                                                                   uint64_t timestamp,
                                                                   uint32_t timescale);
 
+/**
+ * @brief  Caller-owned part of an MHAS frame, see mpeghdecoder_processSpans().
+ */
+typedef struct MPEGH_DECODER_SPAN {
+  const uint8_t* data; /*!< Pointer to the bitstream data. */
+  uint32_t length;     /*!< Number of bytes of the MHAS frame at data. */
+  uint32_t capacity;   /*!< Number of readable bytes at data, not smaller than length, or 0. */
+} MPEGH_DECODER_SPAN;
+
+/**
+ * @brief  Same as mpeghdecoder_process(), but the MHAS frame is handed over as a list of up to 16
+ *         spans, e.g. network buffers the frame is split across. The spans are gathered into the
+ *         internal input buffer in one pass without concatenating them beforehand.\n
+ *         A frame in a single span whose capacity is a power of two is parsed in place without
+ *         any copy. The decoder may then read ahead up to capacity bytes from data, so the whole
+ *         capacity has to be readable. The spans only need to stay valid during the call.
+ *
+ * @param[in] hCtx       MPEG-H decoder handle.
+ * @param[in] spans      Spans holding one MHAS frame in bitstream order.
+ * @param[in] numSpans   Number of spans.
+ * @param[in] timestamp  Presentation timestamp of the MHAS frame (in nano seconds).
+ * @return               Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_processSpans(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                                              const MPEGH_DECODER_SPAN* spans,
+                                                              uint32_t numSpans,
+                                                              uint64_t timestamp);
+
+/**
+ * @brief  Entry of an MHAS packet index, see mpeghdecoder_scanMhas().
+ */
+typedef struct MPEGH_DECODER_MHAS_PACKET {
+  uint32_t offset;        /*!< Byte offset of the packet in the scanned data. */
+  uint32_t size;          /*!< Size of the packet in bytes including its header. */
+  uint32_t payloadLength; /*!< Size of the packet payload in bytes. */
+  uint32_t label;         /*!< MHAS packet label. */
+  uint16_t type;          /*!< MHAS packet type, e.g. 1: MPEGH3DACFG, 2: MPEGH3DAFRAME,
+                               3: AUDIOSCENEINFO, 6: SYNC. */
+  bool isRap;             /*!< Flag to signal a random access point: configuration, audio scene info
+                               and sync packets, and frames decodable without the previous one. */
+} MPEGH_DECODER_MHAS_PACKET;
+
+/**
+ * @brief  Index the MHAS packets of a byte buffer without decoding them, e.g. to validate or
+ *         split a stream. Only the packet headers are read, no decoder instance or memory besides
+ *         the index is needed. The data has to start at a packet boundary.
+ *
+ * @param[in]  data          MHAS stream data.
+ * @param[in]  length        Size of the MHAS stream data in bytes.
+ * @param[out] packets       Index entries of the complete packets found.
+ * @param[in]  maxPackets    Number of entries of packets.
+ * @param[out] numPackets    Number of packets indexed.
+ * @param[out] bytesScanned  Number of bytes of the indexed packets, i.e. the offset to resume
+ *                           scanning at.
+ * @return                   MPEGH_DEC_OK if the scan stopped at the end of the data or after
+ *                           maxPackets packets, MPEGH_DEC_FEED_DATA if the data ends within a
+ *                           packet and MPEGH_DEC_PROCESS_ERROR at an invalid packet.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_scanMhas(const uint8_t* data, uint32_t length,
+                                                          MPEGH_DECODER_MHAS_PACKET* packets,
+                                                          uint32_t maxPackets, uint32_t* numPackets,
+                                                          uint32_t* bytesScanned);
+
+/**
+ * @brief  Same as mpeghdecoder_process(), but the MHAS frame is given as packets of data indexed
+ *         by mpeghdecoder_scanMhas(). Packets left out of the list, e.g. fill data or packets of
+ *         other labels, are not passed to the decoder. Adjacent packets are handed over in one
+ *         span, up to 16 spans are supported.
+ *
+ * @param[in] hCtx        MPEG-H decoder handle.
+ * @param[in] data        MHAS stream data the packets were indexed from.
+ * @param[in] packets     Packets of one MHAS frame in bitstream order, ending with its
+ *                        MPEGH3DAFRAME packet.
+ * @param[in] numPackets  Number of packets.
+ * @param[in] timestamp   Presentation timestamp of the MHAS frame (in nano seconds).
+ * @return                Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_processPackets(
+    HANDLE_MPEGH_DECODER_CONTEXT hCtx, const uint8_t* data,
+    const MPEGH_DECODER_MHAS_PACKET* packets, uint32_t numPackets, uint64_t timestamp);
+
 /**
  * @brief  Get a decoded audio frame
  *
@@ -273,6 +718,36 @@ MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER
                                                             int32_t* outData, uint32_t outLength,
                                                             MPEGH_DECODER_OUTPUT_INFO* outInfo);
 
+/**
+ * @brief  Get a decoded audio frame without copying it to an external buffer. The returned view
+ *         points into the decoder's internal output buffer and stays valid until
+ *         mpeghdecoder_releaseSamples() is called. Until then, further calls to
+ *         mpeghdecoder_getSamples() or mpeghdecoder_getSamplesView() return
+ *         ::MPEGH_DEC_BUFFER_ERROR. So does everything that restarts the decoder and would drop
+ *         the viewed samples: mpeghdecoder_flush(), mpeghdecoder_setMhaConfig(), adding a target
+ *         layout to a configured decoder, and processing a frame whose timestamp jumps by more
+ *         than 200 ms. Such a frame can be passed again after the release.
+ *
+ * @param[in]  hCtx     MPEG-H decoder handle.
+ * @param[out] view     Pointer to a SAMPLES_VIEW structure receiving the location of the decoded
+ *                      PCM samples.
+ * @param[out] outInfo  Pointer to an OUTPUT_INFO structure holding information about the current
+ *                      output frame.
+ * @return              Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_getSamplesView(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                                                MPEGH_DECODER_SAMPLES_VIEW* view,
+                                                                MPEGH_DECODER_OUTPUT_INFO* outInfo);
+
+/**
+ * @brief  Release the audio frame obtained by the last call to mpeghdecoder_getSamplesView(). The
+ *         view must not be accessed anymore after this call.
+ *
+ * @param[in] hCtx  MPEG-H decoder handle.
+ * @return          Error code.
+ */
+MPEGHDEC_EXPORT MPEGH_DECODER_ERROR mpeghdecoder_releaseSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
+
 /**
  * @brief  Flush the decoder and push the flushed PCM samples into a samples queue. The decoded PCM
  *         samples can then be obtained by calling the mpeghdecoder_getSamples() function. This
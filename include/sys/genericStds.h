@@ -376,6 +376,32 @@ char* mpegh_FDKstrncpy(char* dest, const char* src, const UINT n);
 
 #define FDK_MAX_OVERLAYS 9 /**< Maximum number of memory overlays. */
 
+/**
+ *  Heap allocator callbacks. All heap memory of the library is requested from the allocator that
+ *  is current for the calling thread, see mpegh_FDKsetAllocator(). Each memory block remembers the
+ *  allocator it was taken from, so it can be released on any thread.
+ */
+typedef struct {
+  void* (*mallocFunc)(void* context, size_t size); /*!< Allocate \c size bytes. NULL selects the
+                                                        C library allocator. */
+  void* (*alignedAllocFunc)(void* context, size_t size,
+                            size_t alignment); /*!< Allocate \c size bytes aligned to \c alignment.
+                                                  Optional, may be NULL. */
+  void (*freeFunc)(void* context,
+                   void* ptr); /*!< Free a block returned by mallocFunc or alignedAllocFunc. */
+  void* context;               /*!< Opaque pointer handed to each callback. */
+} FDK_ALLOCATOR;
+
+/**
+ *  Make an allocator the current one of the calling thread.
+ *
+ * \param pAllocator  Allocator to be used for subsequent allocations of the calling thread, NULL
+ *                    selects the C library allocator. The structure must stay valid until it is
+ *                    replaced.
+ * \return            Previously current allocator, to be restored by the caller.
+ */
+const FDK_ALLOCATOR* mpegh_FDKsetAllocator(const FDK_ALLOCATOR* pAllocator);
+
 void* mpegh_FDKcalloc(const UINT n, const UINT size);
 void* mpegh_FDKmalloc(const UINT size);
 void mpegh_FDKfree(void* ptr);
@@ -428,6 +454,44 @@ void mpegh_FDKfree_L(void* ptr);
  */
 void mpegh_FDKafree_L(void* ptr);
 
+/**
+ *  Linear memory arena. One aligned and cleared heap block from which several buffers are
+ *  carved in sequence. Buffers are not released individually, the whole block is released
+ *  at once with mpegh_FDKarenaDestroy().
+ */
+typedef struct {
+  UCHAR* pBase; /*!< Aligned base address, NULL if the arena is not allocated. */
+  UINT size;    /*!< Usable size of the arena in bytes. */
+  UINT offset;  /*!< Amount of bytes already handed out. */
+} FDK_MEM_ARENA;
+
+/** Amount of arena bytes occupied by a buffer of \c a bytes. */
+#define ARENA_ALGN_SIZE(a) ((UINT)ALGN_SIZE_EXTRES(a))
+
+/**
+ *  Allocate the memory block of an arena.
+ *
+ * \param pArena  Arena to be set up. Must not hold a memory block.
+ * \param size    Size of the arena in bytes. Use ARENA_ALGN_SIZE() for each buffer to be carved.
+ * \return        0 on success, -1 if the memory could not be allocated.
+ */
+INT mpegh_FDKarenaCreate(FDK_MEM_ARENA* pArena, const UINT size);
+
+/**
+ *  Carve a buffer out of an arena. The returned address is aligned to ::ALIGNMENT_DEFAULT and
+ *  the memory is cleared.
+ *
+ * \param pArena  Arena to carve the buffer from.
+ * \param size    Size of the requested buffer in bytes.
+ * \return        Pointer to the buffer, or NULL if the arena is exhausted.
+ */
+void* mpegh_FDKarenaAlloc(FDK_MEM_ARENA* pArena, const UINT size);
+
+/**
+ *  Release the memory block of an arena. All buffers carved from it become invalid.
+ */
+void mpegh_FDKarenaDestroy(FDK_MEM_ARENA* pArena);
+
 /**
  * Copy memory. Source and destination memory must not overlap.
  * Either use implementation from a Standard Library, or, if no Standard Library
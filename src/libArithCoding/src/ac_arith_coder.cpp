@@ -90,6 +90,7 @@ amm-info@iis.fraunhofer.de
 *******************************************************************************/
 
 #include "ac_arith_coder.h"
+#include "FDK_bitreader.h"
 
 #define cbitsnew 16
 #define stat_bitsnew 14
@@ -121,135 +122,874 @@ H_ALLOC_MEM(ArcoData, CArcoData)
     Dimension: 1                                                                        */
 C_ALLOC_MEM(ArcoData, CArcoData, 1)
 
-/* 16 bytes qucik lookup for ari_merged_hash_ps */
-static const ULONG ari_merged_hash_ps_ext[4] = {0x0A340401UL, 0x1613100DUL, 0x251F1212UL,
-                                                0x2E252525UL};
-
-static const ULONG ari_merged_hash_ps[742] = {
-    0x00001044UL, 0x00003D0AUL, 0x00005350UL, 0x000074D6UL, 0x0000A49FUL, 0x0000F96EUL,
-    0x00111000UL, 0x01111E83UL, 0x01113146UL, 0x01114036UL, 0x01116863UL, 0x011194E9UL,
-    0x0111F7EEUL, 0x0112269BUL, 0x01124775UL, 0x01126DA1UL, 0x0112D912UL, 0x01131AF0UL,
-    0x011336DDUL, 0x01135CF5UL, 0x01139DF8UL, 0x01141A5BUL, 0x01144773UL, 0x01146CF5UL,
-    0x0114FDE9UL, 0x01166CF5UL, 0x0116FDE4UL, 0x01174CF3UL, 0x011FFDCFUL, 0x01211CC2UL,
-    0x01213B2DUL, 0x01214036UL, 0x01216863UL, 0x012194D2UL, 0x0122197FUL, 0x01223AADUL,
-    0x01224036UL, 0x01226878UL, 0x0122A929UL, 0x0122F4ABUL, 0x01232B2DUL, 0x012347B6UL,
-    0x01237DF8UL, 0x0123B929UL, 0x012417DDUL, 0x01245D76UL, 0x01249DF8UL, 0x0124F912UL,
-    0x01255D75UL, 0x0125FDE9UL, 0x01265D75UL, 0x012B8DF7UL, 0x01311E2AUL, 0x01313B5EUL,
-    0x0131687BUL, 0x01321A6DUL, 0x013237BCUL, 0x01326863UL, 0x0132F4EEUL, 0x01332B5EUL,
-    0x01335DA1UL, 0x01338E24UL, 0x01341A5EUL, 0x01343DB6UL, 0x01348DF8UL, 0x01351935UL,
-    0x01355DB7UL, 0x0135FE12UL, 0x01376DF7UL, 0x013FFE29UL, 0x01400024UL, 0x01423821UL,
-    0x014318F6UL, 0x01433821UL, 0x0143F8E5UL, 0x01443DA1UL, 0x01486E38UL, 0x014FF929UL,
-    0x01543EE3UL, 0x015FF912UL, 0x016F298CUL, 0x018A5A69UL, 0x021007F1UL, 0x02112C2CUL,
-    0x02114B48UL, 0x02117353UL, 0x0211F4AEUL, 0x02122FEAUL, 0x02124B48UL, 0x02127850UL,
-    0x0212F72EUL, 0x02133A9EUL, 0x02134036UL, 0x02138864UL, 0x021414ADUL, 0x0214379EUL,
-    0x02145DB6UL, 0x0214FE1FUL, 0x02166DB7UL, 0x02200DC4UL, 0x02212FEAUL, 0x022147A0UL,
-    0x02218369UL, 0x0221F7EEUL, 0x02222AADUL, 0x02224788UL, 0x02226863UL, 0x02229929UL,
-    0x0222F4ABUL, 0x02232A9EUL, 0x02234F08UL, 0x02237864UL, 0x0223A929UL, 0x022417DEUL,
-    0x02244F36UL, 0x02248863UL, 0x02251A74UL, 0x02256DA1UL, 0x0225FE12UL, 0x02263DB6UL,
-    0x02276DF7UL, 0x022FFE29UL, 0x0231186DUL, 0x023137BCUL, 0x02314020UL, 0x02319ED6UL,
-    0x0232196DUL, 0x023237BCUL, 0x02325809UL, 0x02329429UL, 0x023317EDUL, 0x02333F08UL,
-    0x02335809UL, 0x023378E4UL, 0x02341A7CUL, 0x02344221UL, 0x0234A8D3UL, 0x023514BCUL,
-    0x02354221UL, 0x0235F8DFUL, 0x02364861UL, 0x023FFE29UL, 0x02400024UL, 0x0241583BUL,
-    0x024214C8UL, 0x02424809UL, 0x02427EE6UL, 0x02431708UL, 0x02434809UL, 0x02436ED0UL,
-    0x02441A76UL, 0x02443821UL, 0x024458E3UL, 0x0244F91FUL, 0x02454863UL, 0x0246190AUL,
-    0x02464863UL, 0x024FF929UL, 0x02525ED0UL, 0x025314E1UL, 0x025348FBUL, 0x025419A1UL,
-    0x025458D0UL, 0x0254F4E5UL, 0x02552861UL, 0x025FF912UL, 0x02665993UL, 0x027F5A69UL,
-    0x029F1481UL, 0x02CF28A4UL, 0x03100AF0UL, 0x031120AAUL, 0x031147A0UL, 0x03118356UL,
-    0x031217ECUL, 0x03123B5EUL, 0x03124008UL, 0x03127350UL, 0x031314AAUL, 0x0313201EUL,
-    0x03134F08UL, 0x03136863UL, 0x03141A5EUL, 0x03143F3CUL, 0x03200847UL, 0x03212AADUL,
-    0x03214F20UL, 0x03218ED6UL, 0x032218ADUL, 0x032237BCUL, 0x03225809UL, 0x03229416UL,
-    0x032317EDUL, 0x03234F20UL, 0x03237350UL, 0x0323FA6BUL, 0x03243F08UL, 0x03246863UL,
-    0x0324F925UL, 0x03254221UL, 0x0325F8DFUL, 0x03264821UL, 0x032FFE29UL, 0x03311E47UL,
-    0x03313F08UL, 0x0331580DUL, 0x033214DEUL, 0x03323F08UL, 0x03324020UL, 0x03326350UL,
-    0x033294E9UL, 0x033317DEUL, 0x03333F08UL, 0x0333627BUL, 0x0333A9A9UL, 0x033417FCUL,
-    0x03343220UL, 0x0334627BUL, 0x0334A9A9UL, 0x0335148AUL, 0x03353220UL, 0x033588E4UL,
-    0x03361A4AUL, 0x03363821UL, 0x0336F8D2UL, 0x03376863UL, 0x03411939UL, 0x0341583BUL,
-    0x034214C8UL, 0x03424809UL, 0x03426ED0UL, 0x03431588UL, 0x03434809UL, 0x03436ED0UL,
-    0x03441A48UL, 0x0344480DUL, 0x03446ED0UL, 0x03451A4AUL, 0x03453809UL, 0x03455EFBUL,
-    0x034614CAUL, 0x03463849UL, 0x034F8924UL, 0x03500A69UL, 0x035252D0UL, 0x035314E0UL,
-    0x0353324DUL, 0x03535ED0UL, 0x035414E0UL, 0x0354324DUL, 0x03545ED0UL, 0x0354F4E8UL,
-    0x0355384DUL, 0x03555ED0UL, 0x0355F4DFUL, 0x03564350UL, 0x035969A6UL, 0x035FFA52UL,
-    0x036649A6UL, 0x036FFA52UL, 0x037F4F66UL, 0x039D7492UL, 0x03BF6892UL, 0x03DF8A1FUL,
-    0x04100B84UL, 0x04112107UL, 0x0411520DUL, 0x041214EAUL, 0x04124F20UL, 0x04131EDEUL,
-    0x04133F08UL, 0x04135809UL, 0x0413F42BUL, 0x04142F08UL, 0x04200847UL, 0x042121FCUL,
-    0x04214209UL, 0x04221407UL, 0x0422203CUL, 0x04224209UL, 0x04226350UL, 0x04231A7CUL,
-    0x04234209UL, 0x0423637BUL, 0x04241A7CUL, 0x04243220UL, 0x0424627BUL, 0x042514C8UL,
-    0x04254809UL, 0x042FF8E9UL, 0x04311E47UL, 0x04313220UL, 0x0431527BUL, 0x043214FCUL,
-    0x04323220UL, 0x04326250UL, 0x043315BCUL, 0x04333220UL, 0x0433527BUL, 0x04338413UL,
-    0x04341488UL, 0x04344809UL, 0x04346ED0UL, 0x04351F48UL, 0x0435527BUL, 0x0435F9A5UL,
-    0x04363809UL, 0x04375EFBUL, 0x043FF929UL, 0x04412E79UL, 0x0441427BUL, 0x044219B9UL,
-    0x04423809UL, 0x0442537BUL, 0x044314C8UL, 0x04432020UL, 0x0443527BUL, 0x044414CAUL,
-    0x04443809UL, 0x0444537BUL, 0x04448993UL, 0x0445148AUL, 0x04453809UL, 0x04455ED0UL,
-    0x0445F4E5UL, 0x0446384DUL, 0x045009A6UL, 0x045272D3UL, 0x045314A0UL, 0x0453324DUL,
-    0x04535ED0UL, 0x045415A0UL, 0x0454324DUL, 0x04545ED0UL, 0x04551F60UL, 0x0455324DUL,
-    0x04562989UL, 0x04564350UL, 0x045FF4D2UL, 0x04665993UL, 0x047FFF62UL, 0x048FF725UL,
-    0x049F44BDUL, 0x04BFB7E5UL, 0x04EF8A25UL, 0x04FFFB98UL, 0x051131F9UL, 0x051212C7UL,
-    0x05134209UL, 0x05200247UL, 0x05211007UL, 0x05213E60UL, 0x052212C7UL, 0x05224209UL,
-    0x052319BCUL, 0x05233220UL, 0x0523527BUL, 0x052414C8UL, 0x05243820UL, 0x053112F9UL,
-    0x05313E49UL, 0x05321439UL, 0x05323E49UL, 0x0532537BUL, 0x053314C8UL, 0x0533480DUL,
-    0x05337413UL, 0x05341488UL, 0x0534527BUL, 0x0534F4EBUL, 0x05353809UL, 0x05356ED0UL,
-    0x0535F4E5UL, 0x0536427BUL, 0x054119B9UL, 0x054212F9UL, 0x05423249UL, 0x05426ED3UL,
-    0x05431739UL, 0x05433249UL, 0x05435ED0UL, 0x0543F4EBUL, 0x05443809UL, 0x05445ED0UL,
-    0x0544F4E8UL, 0x0545324DUL, 0x054FF992UL, 0x055362D3UL, 0x0553F5ABUL, 0x05544350UL,
-    0x055514CAUL, 0x0555427BUL, 0x0555F4E5UL, 0x0556327BUL, 0x055FF4D2UL, 0x05665993UL,
-    0x05774F53UL, 0x059FF728UL, 0x05CC37FDUL, 0x05EFBA28UL, 0x05FFFB98UL, 0x061131F9UL,
-    0x06121407UL, 0x06133E60UL, 0x061A72E4UL, 0x06211E47UL, 0x06214E4BUL, 0x062214C7UL,
-    0x06223E60UL, 0x062312F9UL, 0x06233E60UL, 0x063112F9UL, 0x06313E4CUL, 0x063219B9UL,
-    0x06323E49UL, 0x06331439UL, 0x06333809UL, 0x06336EE6UL, 0x0633F5ABUL, 0x06343809UL,
-    0x0634F42BUL, 0x0635427BUL, 0x063FF992UL, 0x064342FBUL, 0x0643F4EBUL, 0x0644427BUL,
-    0x064524C9UL, 0x06655993UL, 0x0666170AUL, 0x066652E6UL, 0x067A6F56UL, 0x0698473DUL,
-    0x06CF67D2UL, 0x06EF3A26UL, 0x06FFFAD8UL, 0x071131CCUL, 0x07211307UL, 0x07222E79UL,
-    0x072292DCUL, 0x07234E4BUL, 0x073112F9UL, 0x07322339UL, 0x073632CBUL, 0x073FF992UL,
-    0x074432CBUL, 0x075549A6UL, 0x0776FF68UL, 0x07774350UL, 0x0788473DUL, 0x07CF4516UL,
-    0x07EF3A26UL, 0x07FFFAD8UL, 0x08222E79UL, 0x083112F9UL, 0x0834330BUL, 0x0845338BUL,
-    0x08756F5CUL, 0x0887F725UL, 0x08884366UL, 0x08AF649CUL, 0x08F00898UL, 0x08FFFAD8UL,
-    0x091111C7UL, 0x0932330BUL, 0x0945338BUL, 0x09774F7DUL, 0x0998C725UL, 0x09996416UL,
-    0x09EF87E5UL, 0x09FFFAD8UL, 0x0A34330BUL, 0x0A45338BUL, 0x0A77467DUL, 0x0AA9F52BUL,
-    0x0AAA6416UL, 0x0ABD67DFUL, 0x0AFFFA18UL, 0x0B33330BUL, 0x0B4443A6UL, 0x0B76467DUL,
-    0x0BB9751FUL, 0x0BBB59BDUL, 0x0BEF5892UL, 0x0BFFFAD8UL, 0x0C221339UL, 0x0C53338EUL,
-    0x0C76367DUL, 0x0CCAF52EUL, 0x0CCC6996UL, 0x0CFFFA18UL, 0x0D44438EUL, 0x0D64264EUL,
-    0x0DDCF52EUL, 0x0DDD5996UL, 0x0DFFFA18UL, 0x0E43338EUL, 0x0E68465CUL, 0x0EEE651CUL,
-    0x0EFFFA18UL, 0x0F33238EUL, 0x0F553659UL, 0x0F8F451CUL, 0x0FAFF8AEUL, 0x0FF00A2EUL,
-    0x0FFF1ACCUL, 0x0FFF33BDUL, 0x0FFF7522UL, 0x0FFFFAD8UL, 0x10002C72UL, 0x1111103EUL,
-    0x11121E83UL, 0x11131E9AUL, 0x1121115AUL, 0x11221170UL, 0x112316F0UL, 0x1124175DUL,
-    0x11311CC2UL, 0x11321182UL, 0x11331D42UL, 0x11411D48UL, 0x11421836UL, 0x11431876UL,
-    0x11441DF5UL, 0x1152287BUL, 0x12111903UL, 0x1212115AUL, 0x121316F0UL, 0x12211B30UL,
-    0x12221B30UL, 0x12231B02UL, 0x12311184UL, 0x12321D04UL, 0x12331784UL, 0x12411D39UL,
-    0x12412020UL, 0x12422220UL, 0x12511D89UL, 0x1252227BUL, 0x1258184AUL, 0x12832992UL,
-    0x1311171AUL, 0x13121B30UL, 0x1312202CUL, 0x131320AAUL, 0x132120AAUL, 0x132220ADUL,
-    0x13232FEDUL, 0x13312107UL, 0x13322134UL, 0x13332134UL, 0x13411D39UL, 0x13431E74UL,
-    0x13441834UL, 0x134812B4UL, 0x1352230BUL, 0x13611E4BUL, 0x136522E4UL, 0x141113C2UL,
-    0x141211C4UL, 0x143121F9UL, 0x143221F9UL, 0x143321CAUL, 0x14351D34UL, 0x14431E47UL,
-    0x14441E74UL, 0x144612B4UL, 0x1452230EUL, 0x14551E74UL, 0x1471130EUL, 0x151113C2UL,
-    0x152121F9UL, 0x153121F9UL, 0x153221F9UL, 0x15331007UL, 0x15522E4EUL, 0x15551E74UL,
-    0x1571130EUL, 0x161113C7UL, 0x162121F9UL, 0x163121F9UL, 0x16611E79UL, 0x16661334UL,
-    0x171113C7UL, 0x172121F9UL, 0x17451E47UL, 0x1771130CUL, 0x181113C7UL, 0x18211E47UL,
-    0x18511E4CUL, 0x1882130CUL, 0x191113C7UL, 0x19331E79UL, 0x1A111307UL, 0x1A311E79UL,
-    0x1F52230EUL, 0x200003C1UL, 0x20001027UL, 0x20004467UL, 0x200079E7UL, 0x2000E5EFUL,
-    0x21100BC0UL, 0x211129C0UL, 0x21114011UL, 0x211189E7UL, 0x2111F5EFUL, 0x21124011UL,
-    0x21127455UL, 0x211325C0UL, 0x21134011UL, 0x21137455UL, 0x211425C0UL, 0x21212440UL,
-    0x21213001UL, 0x2121F9EFUL, 0x21222540UL, 0x21226455UL, 0x2122F5EFUL, 0x21233051UL,
-    0x2123F56FUL, 0x21244451UL, 0x21312551UL, 0x21323451UL, 0x21332551UL, 0x21844555UL,
-    0x221125C0UL, 0x22113011UL, 0x2211F9EFUL, 0x22123051UL, 0x2212F9EFUL, 0x221329D1UL,
-    0x22212541UL, 0x22213011UL, 0x2221F9EFUL, 0x22223451UL, 0x2222F9EFUL, 0x22232551UL,
-    0x2223F56FUL, 0x22312551UL, 0x223229D1UL, 0x2232F56FUL, 0x22332551UL, 0x2233F56FUL,
-    0x22875555UL, 0x22DAB5D7UL, 0x23112BD1UL, 0x23115467UL, 0x231225D1UL, 0x232129D1UL,
-    0x232229D1UL, 0x2322F9EFUL, 0x23233451UL, 0x2323F9EFUL, 0x23312551UL, 0x233229D1UL,
-    0x2332F9EFUL, 0x2333F56FUL, 0x237FF557UL, 0x238569D5UL, 0x23D955D7UL, 0x24100BE7UL,
-    0x248789E7UL, 0x24E315D7UL, 0x24FFFBEFUL, 0x259869E7UL, 0x25DFF5EFUL, 0x25FFFBEFUL,
-    0x268789E7UL, 0x26DFA5D7UL, 0x26FFFBEFUL, 0x279649E7UL, 0x27E425D7UL, 0x27FFFBEFUL,
-    0x288879E7UL, 0x28EFF5EFUL, 0x28FFFBEFUL, 0x298439E7UL, 0x29F115EFUL, 0x29FFFBEFUL,
-    0x2A7659E7UL, 0x2AEF75D7UL, 0x2AFFFBEFUL, 0x2B7C89E7UL, 0x2BEF95D7UL, 0x2BFFFBEFUL,
-    0x2C6659E7UL, 0x2CD555D7UL, 0x2CFFFBEFUL, 0x2D6329E7UL, 0x2DDD55E7UL, 0x2DFFFBEBUL,
-    0x2E8479D7UL, 0x2EEE35E7UL, 0x2EFFFBEFUL, 0x2F5459E7UL, 0x2FCF85D7UL, 0x2FFEFBEBUL,
-    0x2FFFA5EFUL, 0x2FFFEBEFUL, 0x30001AE7UL, 0x30002001UL, 0x311129C0UL, 0x31221015UL,
-    0x31232000UL, 0x31332451UL, 0x32112540UL, 0x32131027UL, 0x32212440UL, 0x33452455UL,
-    0x4000F9D7UL, 0x4122F9D7UL, 0x43F65555UL, 0x43FFF5D7UL, 0x44F55567UL, 0x44FFF5D7UL,
-    0x45F00557UL, 0x45FFF5D7UL, 0x46F659D7UL, 0x471005E7UL, 0x47F449E7UL, 0x481005E7UL,
-    0x48EFA9D5UL, 0x48FFF5EFUL, 0x49F449E7UL, 0x49FFF5EFUL, 0x4AEA79E7UL, 0x4AFFF5EFUL,
-    0x4BE9C9D5UL, 0x4BFFF5EFUL, 0x4CE549E7UL, 0x4CFFF5EFUL, 0x4DE359E7UL, 0x4DFFF5D7UL,
-    0x4EE469E7UL, 0x4EFFF5D7UL, 0x4FEF39E7UL, 0x4FFFF5EFUL, 0x6000F9E7UL, 0x69FFF557UL,
-    0x6FFFF9D7UL, 0x811009D7UL, 0x8EFFF555UL, 0xFFFFF9E7UL};
+/*
+ * Probability model index lookup, q.v. the ari_merged_hash_ps search of the standard. The 20 bit
+ * context s selects a page with s >> 8, a block of that page with bits 7..4 and the model index
+ * of that block with bits 3..0. Identical pages and blocks are stored once.
+ */
+static const UCHAR ari_ctx_page[4096] = {
+    0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 11, 11, 11, 11,
+    11, 11, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 21, 22, 23, 23, 23, 23, 24, 25, 26, 27, 28,
+    29, 30, 19, 31, 21, 32, 33, 34, 35, 35, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 11, 45, 33, 33,
+    46, 47, 48, 49, 50, 51, 52, 53, 41, 54, 55, 56, 11, 11, 57, 33, 58, 47, 48, 59, 60, 61, 62, 63,
+    64, 65, 55, 66, 11, 11, 67, 33, 68, 69, 48, 70, 71, 72, 73, 74, 75, 76, 77, 78, 78, 78, 79, 33,
+    68, 69, 80, 80, 81, 82, 83, 75, 75, 84, 85, 19, 86, 21, 21, 21, 21, 87, 48, 88, 89, 90, 83, 75,
+    75, 91, 55, 92, 11, 11, 11, 11, 93, 69, 89, 89, 89, 94, 95, 96, 96, 97, 78, 78, 98, 99, 33, 33,
+    33, 100, 89, 89, 89, 101, 102, 96, 96, 103, 78, 78, 78, 104, 21, 21, 105, 69, 89, 89, 106, 107,
+    107, 108, 96, 109, 78, 78, 78, 78, 110, 33, 33, 100, 107, 107, 107, 107, 111, 96, 112, 78, 78,
+    78, 78, 78, 78, 113, 33, 100, 107, 107, 107, 107, 108, 96, 114, 78, 78, 78, 78, 78, 78, 78, 115,
+    100, 107, 107, 107, 116, 96, 117, 78, 78, 118, 21, 119, 33, 33, 33, 33, 120, 121, 122, 122, 122,
+    122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 123, 124, 125, 126, 127, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 130, 131, 132, 133, 63, 63, 134, 55, 55,
+    55, 55, 55, 55, 55, 55, 135, 136, 137, 138, 139, 140, 141, 141, 141, 141, 141, 141, 141, 141,
+    141, 141, 142, 48, 143, 144, 145, 89, 146, 141, 141, 141, 141, 141, 141, 141, 141, 141, 147,
+    148, 149, 80, 150, 89, 146, 141, 141, 141, 141, 141, 141, 141, 141, 141, 151, 148, 152, 80, 80,
+    153, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 151, 152, 80, 154, 89, 89, 155, 141, 141,
+    141, 141, 141, 141, 141, 141, 141, 156, 157, 80, 80, 158, 89, 89, 159, 141, 141, 141, 141, 141,
+    141, 141, 141, 156, 80, 160, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 161, 80, 162,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 163, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 164,
+    165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 166, 167, 168,
+    169, 169, 169, 169, 170, 171, 171, 171, 171, 171, 171, 171, 171, 172, 173, 174, 169, 169, 169,
+    169, 175, 171, 171, 171, 171, 176, 165, 165, 165, 177, 178, 179, 169, 169, 169, 180, 181, 171,
+    171, 171, 171, 182, 165, 165, 165, 183, 183, 183, 183, 183, 183, 183, 184, 171, 171, 171, 171,
+    171, 185, 165, 183, 183, 183, 183, 183, 183, 183, 183, 183, 186, 171, 171, 171, 187, 165, 165,
+    183, 183, 183, 183, 183, 183, 183, 183, 184, 171, 171, 171, 171, 188, 165, 165, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 189, 171, 171, 171, 171, 190, 165, 183, 183, 183, 183, 183, 183,
+    183, 183, 191, 171, 171, 171, 171, 171, 187, 165, 183, 183, 183, 183, 183, 183, 183, 183, 192,
+    171, 171, 171, 171, 171, 171, 193, 183, 183, 183, 183, 183, 183, 183, 194, 171, 171, 171, 171,
+    171, 171, 195, 165, 183, 183, 183, 183, 183, 183, 183, 196, 171, 171, 171, 171, 171, 171, 197,
+    165, 183, 183, 183, 183, 183, 183, 194, 171, 171, 171, 171, 171, 171, 198, 165, 165, 183, 183,
+    183, 183, 183, 183, 199, 171, 171, 171, 171, 171, 171, 200, 165, 201, 183, 183, 183, 183, 183,
+    183, 183, 183, 202, 171, 171, 171, 171, 171, 203, 165, 183, 183, 183, 183, 183, 204, 171, 171,
+    171, 171, 171, 171, 205, 165, 165, 206, 207, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 208, 209, 210, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 211, 212, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+    213, 213, 213, 214, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 215, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 216, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 217, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 218, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 171, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 189, 171, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 219, 171, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 220, 187, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 221, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 222, 187, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 223, 187,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 224, 187, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 225, 171, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 202, 171, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 226, 187, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 227, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 180, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 228, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 229, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+    169, 169, 169, 169, 169, 169, 169, 169, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183,
+    183, 183, 183, 183, 183, 183, 183, 183, 183, 183, 183};
+
+static const USHORT ari_ctx_block[230][16] = {
+    {0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3},
+    {3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3},
+    {3, 4, 5, 6, 7, 8, 9, 10, 11, 11, 11, 11, 11, 11, 11, 12},
+    {8, 13, 14, 15, 16, 17, 18, 11, 11, 11, 11, 19, 20, 20, 20, 20},
+    {20, 21, 22, 23, 24, 25, 11, 26, 20, 20, 20, 20, 20, 20, 20, 27},
+    {28, 29, 30, 31, 32, 20, 20, 20, 33, 34, 34, 34, 34, 34, 34, 35},
+    {36, 36, 36, 36, 37, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 38},
+    {39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 40},
+    {41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 43, 43, 43, 43, 43},
+    {43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43},
+    {44, 45, 46, 47, 48, 49, 50, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {51, 52, 53, 54, 55, 56, 57, 26, 20, 20, 20, 20, 20, 20, 20, 27},
+    {58, 59, 60, 61, 62, 63, 64, 20, 20, 20, 20, 20, 20, 20, 20, 27},
+    {28, 65, 66, 67, 68, 69, 70, 34, 34, 34, 34, 34, 34, 34, 34, 35},
+    {36, 36, 71, 72, 73, 74, 34, 34, 34, 34, 34, 34, 34, 34, 34, 38},
+    {39, 39, 39, 39, 39, 39, 75, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 76},
+    {77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77},
+    {77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 78},
+    {79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79},
+    {79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 80},
+    {81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81},
+    {82, 83, 84, 85, 86, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58},
+    {87, 88, 89, 90, 91, 92, 93, 20, 20, 20, 20, 20, 20, 20, 20, 27},
+    {94, 95, 96, 97, 98, 99, 100, 101, 34, 34, 34, 34, 34, 34, 34, 34},
+    {34, 102, 103, 104, 105, 106, 107, 34, 34, 34, 34, 34, 34, 34, 34, 108},
+    {109, 110, 111, 112, 113, 114, 115, 39, 39, 116, 41, 41, 41, 41, 41, 117},
+    {39, 39, 39, 39, 39, 39, 118, 41, 41, 41, 41, 41, 41, 41, 41, 117},
+    {119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 120},
+    {77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 121, 79, 79},
+    {79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 122},
+    {123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123},
+    {123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 124},
+    {125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125},
+    {126, 127, 128, 129, 130, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58},
+    {131, 132, 133, 134, 135, 136, 137, 137, 137, 137, 137, 137, 137, 137, 137, 138},
+    {94, 139, 140, 141, 142, 143, 144, 145, 34, 34, 34, 34, 34, 34, 34, 35},
+    {94, 146, 147, 148, 149, 150, 151, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {152, 110, 153, 154, 155, 156, 157, 158, 158, 158, 158, 158, 158, 158, 158, 159},
+    {39, 39, 39, 39, 39, 39, 160, 119, 119, 119, 119, 119, 119, 119, 119, 119},
+    {119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 161},
+    {162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 163},
+    {77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 164},
+    {43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 165},
+    {123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 166},
+    {125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 167},
+    {131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131},
+    {131, 168, 169, 170, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171},
+    {172, 173, 174, 175, 176, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110},
+    {110, 177, 178, 179, 180, 181, 182, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 183, 184, 185, 186, 187, 39, 39, 39, 39, 39, 39, 39, 39, 39, 188},
+    {110, 110, 110, 189, 190, 191, 192, 158, 158, 158, 158, 158, 158, 158, 158, 159},
+    {119, 119, 119, 119, 119, 119, 119, 193, 162, 162, 162, 162, 162, 162, 162, 162},
+    {162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162},
+    {162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 194},
+    {43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 195, 123, 123, 123},
+    {123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 196},
+    {131, 197, 198, 199, 110, 110, 110, 110, 110, 110, 200, 94, 94, 94, 94, 94},
+    {94, 201, 202, 203, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110},
+    {110, 204, 205, 206, 207, 182, 39, 39, 39, 39, 39, 39, 39, 39, 39, 188},
+    {110, 110, 110, 208, 209, 210, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 39, 39, 39, 211, 212, 119, 119, 119, 119, 119, 119, 119, 119, 119},
+    {119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 213, 162, 162, 162, 162, 162},
+    {162, 162, 162, 162, 162, 162, 162, 162, 214, 43, 43, 43, 43, 43, 43, 43},
+    {43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 215},
+    {123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 216},
+    {81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 217},
+    {131, 218, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {219, 220, 221, 222, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110},
+    {110, 223, 224, 110, 110, 110, 225, 39, 39, 39, 39, 39, 39, 39, 39, 188},
+    {110, 110, 110, 110, 225, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 39, 39, 39, 226, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119},
+    {119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119},
+    {119, 119, 119, 119, 119, 119, 227, 228, 162, 162, 162, 162, 162, 162, 162, 162},
+    {162, 162, 162, 162, 162, 162, 162, 162, 229, 230, 230, 230, 230, 230, 230, 230},
+    {230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230},
+    {230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 231},
+    {94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94},
+    {94, 94, 232, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110},
+    {110, 223, 219, 219, 233, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234},
+    {234, 234, 234, 234, 234, 235, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119},
+    {119, 119, 119, 119, 119, 236, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162},
+    {162, 162, 162, 162, 162, 162, 162, 163, 237, 77, 77, 77, 77, 77, 77, 77},
+    {77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 238},
+    {239, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 217},
+    {131, 240, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {219, 219, 233, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234},
+    {119, 119, 119, 119, 119, 119, 119, 241, 162, 162, 162, 162, 162, 162, 162, 162},
+    {162, 162, 162, 162, 162, 162, 162, 162, 242, 243, 43, 43, 43, 43, 43, 43},
+    {43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 244},
+    {219, 219, 219, 219, 233, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234},
+    {234, 234, 234, 234, 234, 245, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},
+    {246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},
+    {246, 246, 246, 246, 246, 246, 246, 247, 230, 230, 230, 230, 230, 230, 230, 230},
+    {230, 230, 230, 230, 230, 230, 230, 230, 230, 248, 243, 43, 43, 43, 43, 43},
+    {43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 249, 123, 123},
+    {123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 250},
+    {219, 219, 219, 233, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234},
+    {234, 234, 234, 234, 251, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},
+    {246, 246, 246, 246, 246, 246, 247, 230, 230, 230, 230, 230, 230, 230, 230, 230},
+    {230, 230, 230, 230, 230, 230, 230, 230, 230, 252, 39, 253, 79, 79, 79, 79},
+    {79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 254},
+    {219, 219, 255, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234},
+    {234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234},
+    {234, 234, 234, 256, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},
+    {246, 246, 246, 246, 246, 246, 257, 230, 230, 230, 230, 230, 230, 230, 230, 230},
+    {230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 258, 39, 259, 123, 123, 123},
+    {234, 234, 234, 234, 260, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},
+    {246, 246, 246, 246, 261, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230},
+    {230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 258, 262, 123, 123},
+    {246, 246, 246, 246, 246, 246, 246, 246, 263, 230, 230, 230, 230, 230, 230, 230},
+    {230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 264, 123},
+    {234, 234, 234, 265, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},
+    {246, 246, 246, 246, 246, 266, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230},
+    {230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 267},
+    {79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 268},
+    {269, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 270},
+    {271, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {1, 272, 273, 274, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275},
+    {275, 276, 277, 278, 279, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8},
+    {8, 280, 281, 282, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283},
+    {283, 284, 285, 286, 287, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58},
+    {58, 58, 288, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34},
+    {34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34},
+    {34, 289, 290, 291, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292, 292},
+    {292, 293, 293, 294, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295, 295},
+    {295, 296, 297, 298, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299},
+    {299, 300, 301, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49},
+    {49, 302, 303, 58, 58, 58, 58, 58, 304, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 39, 305, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162},
+    {162, 306, 307, 308, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309, 309},
+    {309, 308, 310, 311, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126},
+    {126, 312, 313, 314, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299, 299},
+    {299, 315, 94, 316, 317, 318, 318, 318, 319, 219, 219, 219, 219, 219, 219, 219},
+    {219, 219, 320, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94},
+    {94, 321, 110, 110, 110, 322, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323},
+    {323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323},
+    {323, 324, 325, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131},
+    {131, 326, 326, 327, 299, 328, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94},
+    {94, 94, 94, 329, 330, 318, 319, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {219, 219, 331, 94, 94, 332, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {219, 333, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323},
+    {323, 324, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131},
+    {131, 326, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131},
+    {131, 326, 334, 335, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94},
+    {94, 94, 336, 94, 94, 332, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {323, 337, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131},
+    {131, 338, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94},
+    {94, 339, 219, 219, 219, 219, 340, 323, 323, 323, 323, 323, 323, 323, 323, 323},
+    {94, 94, 94, 94, 94, 341, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {219, 342, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323},
+    {323, 343, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94},
+    {94, 329, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94},
+    {94, 344, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {219, 219, 342, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323},
+    {94, 94, 94, 339, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {219, 220, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94},
+    {94, 339, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219},
+    {219, 219, 345, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323, 323},
+    {346, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347},
+    {347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347},
+    {348, 349, 350, 351, 352, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353},
+    {353, 354, 355, 356, 357, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 359, 360, 361, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 358, 358, 358, 362, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 364, 365, 366, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 367, 368, 369, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 370, 371, 369, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 358, 358, 358, 358, 358, 358, 372, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 373, 347, 347, 347, 347, 347},
+    {347, 374, 375, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},
+    {376, 377, 378, 368, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 370, 378, 379, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 380},
+    {376, 376, 376, 376, 376, 381, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 382, 347, 347, 347, 347, 347, 347},
+    {376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},
+    {376, 376, 376, 376, 376, 376, 376, 383, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 384, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347},
+    {376, 376, 376, 376, 376, 376, 376, 376, 385, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 386},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 387},
+    {376, 376, 376, 376, 376, 376, 388, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 363, 389, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347},
+    {376, 376, 376, 376, 376, 376, 376, 376, 390, 363, 363, 363, 363, 363, 363, 363},
+    {376, 376, 376, 376, 391, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 392, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347},
+    {376, 376, 376, 376, 376, 376, 393, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 394},
+    {376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 383, 363, 363, 363},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 395},
+    {363, 363, 363, 363, 363, 382, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347},
+    {376, 376, 376, 396, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 397, 347, 347},
+    {347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 398},
+    {376, 376, 376, 376, 385, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 399, 347},
+    {376, 376, 376, 376, 393, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 400},
+    {347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 398, 401},
+    {402, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},
+    {376, 403, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    {1, 1, 404, 405, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353},
+    {353, 353, 353, 406, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 407, 1, 408, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353},
+    {353, 409, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353},
+    {353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353},
+    {353, 353, 353, 353, 353, 410, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},
+    {411, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},
+    {376, 376, 411, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {358, 358, 358, 358, 358, 358, 372, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {358, 358, 358, 358, 358, 412, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {376, 376, 376, 376, 388, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 413},
+    {376, 376, 376, 376, 388, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 386},
+    {376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 390, 363, 363, 363, 363, 363},
+    {376, 376, 376, 376, 376, 376, 376, 376, 376, 414, 363, 363, 363, 363, 363, 363},
+    {376, 376, 376, 376, 376, 388, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {376, 376, 376, 393, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363},
+    {376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 391},
+    {376, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358},
+    {376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376, 411},
+    {415, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358}};
+
+static const UCHAR ari_ctx_pki[416][16] = {
+    {1, 4, 52, 10, 13, 16, 19, 22, 18, 18, 31, 37, 37, 37, 37, 46},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58},
+    {58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58},
+    {58, 3, 5, 6, 54, 33, 35, 19, 19, 41, 31, 31, 31, 31, 31, 46},
+    {26, 26, 27, 29, 53, 54, 33, 36, 36, 36, 36, 36, 36, 18, 43, 43},
+    {43, 48, 27, 29, 51, 53, 55, 55, 55, 56, 41, 41, 41, 41, 41, 41},
+    {41, 27, 29, 29, 51, 51, 53, 55, 55, 55, 55, 55, 55, 55, 55, 41},
+    {51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51},
+    {51, 51, 51, 51, 51, 51, 53, 55, 55, 55, 55, 55, 55, 55, 55, 36},
+    {51, 51, 51, 51, 51, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55},
+    {55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55},
+    {55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 15},
+    {51, 2, 44, 45, 54, 33, 35, 19, 19, 18, 37, 37, 37, 37, 37, 37},
+    {37, 63, 42, 45, 54, 33, 56, 36, 36, 36, 41, 18, 18, 18, 18, 43},
+    {44, 44, 45, 30, 54, 55, 55, 56, 36, 36, 36, 41, 31, 31, 31, 31},
+    {31, 29, 53, 53, 53, 54, 55, 55, 55, 56, 36, 36, 36, 36, 36, 18},
+    {53, 53, 53, 53, 53, 53, 55, 55, 55, 55, 55, 55, 55, 55, 55, 41},
+    {53, 53, 53, 53, 53, 53, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55},
+    {55, 55, 55, 55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56},
+    {56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56},
+    {56, 42, 45, 30, 33, 33, 59, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 45, 30, 60, 33, 33, 35, 19, 19, 19, 19, 19, 19, 19, 19, 46},
+    {45, 45, 30, 54, 54, 33, 56, 56, 36, 41, 41, 41, 41, 41, 41, 41},
+    {41, 30, 54, 54, 55, 55, 55, 55, 56, 36, 36, 36, 36, 36, 36, 36},
+    {36, 53, 54, 54, 54, 55, 56, 56, 56, 56, 56, 56, 56, 56, 56, 18},
+    {55, 55, 55, 55, 55, 55, 55, 56, 56, 56, 56, 56, 56, 56, 56, 56},
+    {56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 41},
+    {36, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32},
+    {32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32},
+    {32, 32, 32, 33, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35},
+    {35, 54, 32, 33, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 37},
+    {54, 54, 54, 33, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56},
+    {56, 56, 56, 56, 56, 56, 56, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 41},
+    {59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59},
+    {59, 59, 59, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 18},
+    {38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 38, 12, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 41, 41, 41, 41, 41, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31},
+    {31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31},
+    {49, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48},
+    {48, 48, 44, 45, 8, 13, 13, 19, 18, 18, 18, 18, 18, 18, 18, 46},
+    {63, 63, 42, 45, 8, 33, 33, 16, 28, 28, 28, 28, 28, 28, 28, 46},
+    {42, 42, 42, 30, 54, 33, 33, 33, 36, 18, 18, 18, 18, 18, 18, 18},
+    {18, 45, 30, 30, 54, 54, 56, 56, 56, 56, 56, 56, 56, 56, 56, 31},
+    {54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54},
+    {54, 54, 54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55},
+    {4, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63},
+    {63, 63, 42, 30, 32, 13, 13, 13, 41, 31, 31, 31, 31, 31, 31, 46},
+    {42, 42, 45, 30, 8, 33, 35, 36, 36, 41, 18, 18, 18, 18, 18, 43},
+    {42, 42, 30, 60, 8, 33, 33, 36, 36, 36, 41, 31, 31, 31, 31, 31},
+    {31, 30, 60, 60, 54, 33, 33, 33, 35, 41, 41, 41, 41, 41, 41, 41},
+    {41, 52, 54, 54, 54, 54, 33, 56, 56, 56, 56, 56, 56, 56, 56, 18},
+    {54, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55},
+    {33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33},
+    {33, 45, 30, 60, 32, 59, 59, 59, 59, 22, 37, 37, 37, 37, 37, 37},
+    {37, 45, 30, 60, 32, 9, 16, 16, 16, 41, 31, 31, 31, 31, 31, 31},
+    {31, 45, 60, 8, 32, 9, 35, 36, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 60, 8, 8, 33, 35, 35, 35, 35, 35, 19, 18, 18, 18, 18, 18},
+    {18, 60, 8, 8, 33, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 31},
+    {33, 33, 33, 33, 33, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56},
+    {32, 32, 32, 32, 32, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 8, 32, 32, 9, 59, 59, 38, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 8, 32, 32, 9, 59, 16, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 54, 32, 33, 35, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 31},
+    {33, 33, 33, 33, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {36, 10, 33, 33, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {59, 59, 59, 59, 59, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 33, 35, 35, 59, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 33, 35, 35, 35, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 37},
+    {33, 33, 33, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {38, 38, 38, 38, 38, 19, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 41, 41, 41, 41, 41, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18},
+    {18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18},
+    {18, 1, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34},
+    {34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34},
+    {34, 34, 36, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43},
+    {43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43},
+    {48, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    {2, 2, 42, 30, 32, 13, 13, 13, 22, 31, 31, 31, 31, 31, 31, 31},
+    {31, 44, 45, 30, 8, 13, 13, 16, 18, 18, 18, 18, 18, 18, 18, 18},
+    {18, 42, 30, 60, 8, 33, 35, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 30, 60, 60, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33},
+    {7, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42},
+    {42, 42, 45, 60, 32, 59, 59, 59, 22, 34, 34, 34, 34, 34, 34, 34},
+    {34, 45, 30, 60, 32, 9, 16, 16, 16, 22, 31, 31, 31, 31, 31, 31},
+    {31, 45, 60, 60, 32, 13, 13, 16, 41, 41, 41, 41, 41, 41, 41, 43},
+    {60, 60, 60, 8, 33, 33, 35, 36, 36, 36, 36, 36, 36, 36, 36, 37},
+    {8, 8, 8, 8, 33, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 31},
+    {32, 32, 32, 32, 33, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56},
+    {57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 7, 60, 8, 32, 13, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 30, 60, 8, 32, 13, 16, 19, 19, 41, 31, 31, 31, 31, 31, 31},
+    {31, 30, 60, 8, 9, 9, 59, 38, 38, 38, 41, 31, 31, 31, 31, 31},
+    {31, 60, 8, 32, 9, 9, 59, 38, 38, 38, 41, 18, 18, 18, 18, 18},
+    {18, 10, 8, 32, 35, 35, 35, 35, 36, 41, 41, 41, 41, 41, 41, 41},
+    {41, 10, 32, 33, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 18},
+    {33, 33, 33, 33, 33, 33, 35, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {36, 57, 32, 32, 32, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 8, 32, 32, 9, 59, 16, 22, 22, 22, 22, 22, 22, 22, 22, 22},
+    {22, 8, 32, 32, 9, 59, 16, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 8, 32, 32, 13, 59, 16, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 10, 32, 9, 59, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 10, 33, 9, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {36, 36, 36, 36, 36, 36, 36, 36, 36, 41, 41, 41, 41, 41, 41, 41},
+    {41, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 11, 11, 11, 11, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 32, 9, 13, 59, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 32, 9, 13, 59, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 40},
+    {33, 33, 33, 13, 59, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 31},
+    {13, 13, 13, 13, 16, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 38, 38, 38, 38, 38, 38, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 18},
+    {38, 38, 38, 38, 38, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61},
+    {61, 61, 61, 61, 38, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18},
+    {18, 18, 18, 18, 18, 18, 18, 18, 34, 34, 34, 34, 34, 34, 34, 34},
+    {34, 34, 34, 34, 34, 34, 18, 40, 40, 40, 40, 40, 40, 40, 40, 40},
+    {40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40},
+    {40, 40, 40, 40, 40, 40, 40, 40, 31, 46, 46, 46, 46, 46, 46, 46},
+    {46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46},
+    {4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4},
+    {4, 4, 7, 8, 8, 13, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 42, 60, 60, 32, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59},
+    {59, 30, 60, 8, 32, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 43},
+    {60, 60, 8, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33},
+    {7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7},
+    {7, 7, 60, 8, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16},
+    {16, 7, 60, 8, 9, 13, 16, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 60, 8, 8, 9, 13, 59, 41, 41, 41, 41, 41, 41, 41, 41, 41},
+    {41, 60, 8, 32, 9, 9, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 8, 32, 32, 9, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35},
+    {35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35},
+    {35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 41},
+    {57, 7, 8, 32, 9, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 60, 8, 32, 9, 9, 16, 22, 22, 22, 22, 22, 22, 22, 22, 22},
+    {22, 60, 8, 32, 9, 59, 16, 16, 19, 18, 18, 18, 18, 18, 18, 18},
+    {18, 8, 32, 32, 9, 59, 16, 61, 61, 61, 61, 61, 61, 61, 61, 61},
+    {61, 8, 9, 9, 9, 59, 38, 38, 38, 38, 38, 38, 38, 38, 38, 37},
+    {32, 32, 32, 9, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59},
+    {59, 59, 59, 59, 59, 59, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {57, 57, 57, 9, 59, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 57, 32, 9, 13, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 8, 32, 9, 9, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 10, 32, 9, 13, 59, 38, 38, 19, 18, 18, 18, 18, 18, 18, 18},
+    {18, 10, 32, 9, 59, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 37},
+    {33, 33, 33, 13, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 11, 11, 11, 11, 11, 11, 19, 18, 18, 18, 18, 18, 18, 18, 18},
+    {18, 32, 9, 13, 59, 16, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22},
+    {22, 32, 9, 13, 59, 16, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61},
+    {61, 32, 9, 13, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 38, 9, 13, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 18},
+    {38, 38, 38, 38, 38, 19, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61},
+    {61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 34},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 37},
+    {18, 18, 18, 18, 61, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31},
+    {31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 37, 40, 40, 40, 40},
+    {40, 40, 40, 40, 40, 40, 40, 40, 37, 46, 46, 46, 46, 46, 46, 46},
+    {46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 24},
+    {7, 7, 7, 57, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8},
+    {8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9},
+    {9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 57, 32, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 7, 8, 8, 9, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 60, 8, 32, 9, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 8, 32, 32, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 57, 57, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16},
+    {16, 57, 57, 9, 13, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 8, 32, 32, 13, 16, 16, 19, 18, 18, 18, 18, 18, 18, 18, 18},
+    {18, 8, 9, 9, 9, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 43},
+    {32, 32, 32, 9, 59, 59, 16, 19, 19, 19, 19, 19, 19, 19, 19, 37},
+    {9, 9, 9, 9, 59, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 57, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 57, 9, 9, 59, 59, 19, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 57, 9, 9, 59, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 43},
+    {32, 32, 32, 9, 59, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 40},
+    {9, 9, 9, 13, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 18},
+    {11, 11, 11, 11, 11, 11, 19, 22, 22, 22, 22, 22, 22, 22, 22, 43},
+    {13, 13, 13, 13, 16, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 10, 9, 9, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 37},
+    {9, 9, 9, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {61, 61, 61, 61, 19, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 40},
+    {31, 31, 31, 61, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40},
+    {40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 46, 46, 46, 46},
+    {7, 7, 7, 57, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16},
+    {16, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 57, 57, 32, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 11, 11, 11, 11, 11, 11, 36, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 7, 57, 57, 11, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 7, 57, 32, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 57, 57, 32, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 57, 57, 12, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 57, 57, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16},
+    {16, 57, 32, 9, 59, 59, 38, 22, 22, 22, 22, 22, 22, 22, 22, 43},
+    {32, 32, 32, 9, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 43},
+    {11, 11, 11, 11, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 43},
+    {9, 9, 9, 9, 59, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19},
+    {19, 19, 9, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 38, 38, 38, 38, 19, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 10, 11, 11, 11, 38, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61},
+    {61, 61, 61, 61, 61, 61, 22, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 61, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31},
+    {31, 31, 31, 31, 31, 31, 18, 40, 40, 40, 40, 40, 40, 40, 40, 40},
+    {40, 40, 40, 38, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43},
+    {43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 24},
+    {7, 7, 7, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+    {12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+    {12, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 57, 57, 11, 11, 11, 11, 11, 11, 28, 57, 57, 57, 57, 57, 57},
+    {57, 57, 57, 57, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 57, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+    {12, 12, 57, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 11, 11, 11, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 38, 38, 38, 38, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61},
+    {61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 40},
+    {13, 13, 13, 13, 16, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 61, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20},
+    {20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20},
+    {20, 20, 20, 20, 22, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40},
+    {57, 57, 57, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {12, 12, 12, 11, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14},
+    {14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14},
+    {14, 14, 14, 11, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61},
+    {61, 61, 61, 61, 61, 61, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {13, 13, 13, 13, 38, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18},
+    {18, 18, 18, 18, 18, 18, 28, 34, 34, 34, 34, 34, 34, 34, 34, 34},
+    {24, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43},
+    {7, 7, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+    {61, 61, 61, 61, 61, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 37, 16, 16, 16},
+    {16, 16, 16, 16, 16, 16, 22, 31, 31, 31, 31, 31, 31, 31, 31, 31},
+    {31, 31, 31, 31, 31, 31, 31, 31, 37, 43, 43, 43, 43, 43, 43, 43},
+    {14, 14, 14, 11, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25},
+    {25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25},
+    {25, 25, 25, 25, 61, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20},
+    {20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 43},
+    {31, 31, 31, 31, 31, 31, 31, 40, 40, 40, 40, 40, 40, 40, 40, 40},
+    {40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 24},
+    {14, 14, 14, 14, 38, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25},
+    {20, 20, 20, 20, 20, 20, 20, 31, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 38, 38, 38, 38, 61, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34},
+    {34, 34, 34, 34, 34, 18, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43},
+    {12, 57, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14},
+    {14, 14, 14, 14, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25},
+    {25, 25, 25, 61, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20},
+    {20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 46},
+    {38, 38, 38, 38, 38, 38, 22, 40, 40, 40, 40, 40, 40, 40, 40, 40},
+    {14, 14, 14, 14, 14, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25},
+    {25, 25, 14, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20},
+    {38, 38, 38, 38, 38, 22, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40},
+    {25, 25, 25, 25, 28, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20},
+    {20, 20, 20, 20, 20, 20, 28, 40, 40, 40, 40, 40, 40, 40, 40, 40},
+    {14, 14, 14, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25},
+    {25, 25, 25, 25, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20},
+    {20, 20, 20, 20, 28, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34},
+    {34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 46},
+    {46, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43},
+    {43, 12, 14, 61, 20, 20, 20, 34, 43, 43, 43, 43, 43, 43, 43, 24},
+    {49, 49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 62, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58},
+    {58, 3, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58},
+    {58, 26, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5},
+    {5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5},
+    {5, 26, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5},
+    {5, 48, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27},
+    {27, 48, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29},
+    {29, 29, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51},
+    {51, 2, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6},
+    {6, 2, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53},
+    {53, 2, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53},
+    {53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53},
+    {53, 8, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32},
+    {32, 54, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33},
+    {33, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55},
+    {55, 53, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33},
+    {33, 33, 59, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36},
+    {36, 3, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5},
+    {5, 26, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27},
+    {27, 48, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {44, 48, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {44, 2, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6},
+    {6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6},
+    {6, 4, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52},
+    {52, 4, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30},
+    {30, 4, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52},
+    {52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52},
+    {52, 57, 32, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8},
+    {8, 8, 32, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54},
+    {54, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9},
+    {9, 9, 59, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33},
+    {33, 10, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {38, 38, 18, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {28, 26, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44},
+    {44, 48, 44, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    {2, 2, 42, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    {2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+    {2, 2, 45, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63},
+    {63, 63, 45, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4},
+    {4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4},
+    {4, 4, 52, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4},
+    {4, 4, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52},
+    {52, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 52, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32},
+    {32, 52, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {10, 52, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+    {12, 12, 11, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11},
+    {11, 11, 36, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15},
+    {15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15},
+    {15, 2, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7},
+    {7, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7},
+    {7, 7, 57, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7},
+    {7, 7, 10, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52},
+    {52, 52, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 52, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10},
+    {12, 12, 14, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 52, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+    {12, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15},
+    {7, 7, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 57, 14, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {15, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7},
+    {7, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 57, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+    {12, 52, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15},
+    {57, 7, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+    {12, 12, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15},
+    {15, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57},
+    {57, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12},
+    {12, 12, 14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15},
+    {1, 39, 17, 17, 39, 39, 39, 39, 23, 23, 23, 23, 23, 23, 47, 47},
+    {47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47},
+    {0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 0, 0, 17, 39, 39, 39, 39, 23, 23, 23, 23, 23, 23, 47},
+    {0, 0, 0, 0, 17, 17, 17, 21, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 0, 0, 17, 17, 17, 21, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17},
+    {17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17},
+    {17, 17, 0, 1, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47},
+    {21, 21, 0, 17, 17, 17, 21, 23, 23, 23, 23, 23, 23, 23, 23, 47},
+    {1, 1, 1, 17, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 47},
+    {17, 17, 17, 17, 17, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17},
+    {17, 17, 17, 17, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 17, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 21, 21, 21, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 0, 17, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47},
+    {1, 1, 1, 17, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47},
+    {39, 39, 17, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 1, 17, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47},
+    {17, 17, 17, 17, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47},
+    {21, 21, 17, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 47},
+    {21, 21, 17, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 17, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 47},
+    {21, 21, 21, 21, 21, 21, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 47, 47, 47, 47},
+    {47, 47, 17, 17, 17, 39, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 17, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 17, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 17, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 47},
+    {21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 23},
+    {39, 39, 39, 39, 39, 39, 21, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 23, 23, 23, 23, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47},
+    {39, 39, 39, 39, 39, 39, 39, 39, 39, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47},
+    {39, 39, 39, 39, 39, 39, 39, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 47},
+    {23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 47, 47, 47, 47, 47},
+    {39, 39, 39, 39, 39, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 23, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47},
+    {39, 39, 39, 39, 39, 39, 39, 39, 23, 23, 23, 23, 23, 23, 23, 23},
+    {39, 39, 39, 39, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47},
+    {39, 39, 39, 39, 39, 39, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 23, 23, 23, 23, 23, 23, 47, 47, 47, 47, 47, 47, 47, 47},
+    {23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 47, 47, 47, 47, 47, 47},
+    {39, 39, 39, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {23, 23, 23, 23, 23, 39, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47},
+    {47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 43},
+    {23, 23, 23, 39, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47},
+    {23, 23, 23, 23, 23, 23, 23, 23, 23, 47, 47, 47, 47, 47, 47, 47},
+    {23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 47, 47, 47, 47, 47, 43},
+    {43, 39, 1, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17},
+    {17, 17, 17, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21},
+    {21, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 39, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17},
+    {17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17},
+    {17, 17, 21, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39},
+    {39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 23},
+    {21, 21, 21, 21, 21, 39, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23},
+    {39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 21, 23, 23, 23, 23, 23},
+    {39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 21, 23, 23, 23},
+    {23, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21}};
 
 static const SHORT ari_pk[64][17] = {
     {708, 706, 579, 569, 568, 567, 479, 469, 297, 138, 97, 91, 72, 52, 38, 34, 0},
@@ -360,7 +1100,9 @@ static inline INT mul_sbc_14bits(INT r, INT c) {
   return (((INT)r) * ((INT)c)) >> stat_bitsnew;
 }
 
-INT ari_decode_14bits(HANDLE_FDK_BITSTREAM hBs, Tastat* s, const SHORT* RESTRICT c_freq, int cfl) {
+/* Interval search and update of ari_decode_14bits(), without renormalisation. */
+static FDK_FORCEINLINE INT ari_decode_symbol_14bits(Tastat* s, const SHORT* RESTRICT c_freq,
+                                                    int cfl) {
   INT symbol;
   INT low, high, range, value;
   INT c;
@@ -435,26 +1177,57 @@ INT ari_decode_14bits(HANDLE_FDK_BITSTREAM hBs, Tastat* s, const SHORT* RESTRICT
 
   low += mul_sbc_14bits(range, c_freq[symbol]);
 
-  USHORT us_high = (USHORT)high;
-  USHORT us_low = (USHORT)low;
-  while (1) {
-    if (us_high & 0x8000) {
-      if (!(us_low & 0x8000)) {
-        if (us_low & 0x4000 && !(us_high & 0x4000)) {
-          us_low -= 0x4000;
-          us_high -= 0x4000;
-          value -= 0x4000;
-        } else
-          break;
-      }
-    }
-    us_low = us_low << 1;
-    us_high = (us_high << 1) | 1;
-    value = (value << 1) | FDKreadBit(hBs);
-  }
-  s->low = (int)us_low;
-  s->high = (int)us_high;
-  s->vobf = value & 0xFFFF;
+  s->low = low;
+  s->high = high;
+
+  return symbol;
+}
+
+/*
+ * Renormalisation of the interval after a symbol, all steps at once: n1 shifts of the leading bits
+ * that low and high have in common, followed by k shifts that also subtract ari_q1new from low,
+ * high and the code value. Modulo 2^16 each of the latter toggles bit 14 before the shift, which
+ * adds up to the mask ((1 << k) - 1) << 15 after all n1 + k shifts. Returns n1 + k, the number of
+ * bits to shift into the code value.
+ */
+static FDK_FORCEINLINE INT ari_renorm_14bits(Tastat* s, UINT* pMask) {
+  UINT low = (UINT)s->low;
+  UINT high = (UINT)s->high;
+  INT n1, k;
+
+  n1 = fixnormz_D((LONG)(((low ^ high) << 16) | 0x8000));
+  low = (low << n1) & 0xFFFF;
+  high = ((high << n1) | ((1 << n1) - 1)) & 0xFFFF;
+
+  k = fixnormz_D((LONG) ~((low & ~high) << 17));
+  *pMask = ((1 << k) - 1) << 15;
+
+  s->low = (INT)(((low << k) ^ *pMask) & 0xFFFF);
+  s->high = (INT)((((high << k) | ((1 << k) - 1)) ^ *pMask) & 0xFFFF);
+
+  return n1 + k;
+}
+
+INT ari_decode_14bits(HANDLE_FDK_BITSTREAM hBs, Tastat* s, const SHORT* RESTRICT c_freq, int cfl) {
+  INT symbol = ari_decode_symbol_14bits(s, c_freq, cfl);
+  UINT value = (UINT)s->vobf;
+  UINT mask;
+  INT n = ari_renorm_14bits(s, &mask);
+
+  s->vobf = (INT)((((value << n) | FDKreadBits(hBs, n)) ^ mask) & 0xFFFF);
+
+  return symbol;
+}
+
+/* ari_decode_14bits() reading from a FDK_BITREADER. */
+static FDK_FORCEINLINE INT ari_decode_14bits_br(HANDLE_FDK_BITREADER hBr, Tastat* s,
+                                                const SHORT* RESTRICT c_freq, int cfl) {
+  INT symbol = ari_decode_symbol_14bits(s, c_freq, cfl);
+  UINT value = (UINT)s->vobf;
+  UINT mask;
+  INT n = ari_renorm_14bits(s, &mask);
+
+  s->vobf = (INT)((((value << n) | FDKbrReadBits(hBr, n)) ^ mask) & 0xFFFF);
 
   return symbol;
 }
@@ -503,94 +1276,11 @@ static inline void copyTableAmrwbArith2(UCHAR tab[], int sizeIn, int sizeOut) {
   }
 }
 
-static inline ULONG get_pk_v2(ULONG s) {
-  /* Bypass complex table search for s in range 0..0xF */
-  if (s <= (ULONG)0xF) return ((const UCHAR*)ari_merged_hash_ps_ext)[s];
-
-  const ULONG* p = ari_merged_hash_ps;
-  ULONG s12 = (s << 12) - 1;
-  if (s12 > p[485]) {
-    p += 486; /* 742 - 256 = 486 */
-  } else {
-    if (s12 > p[255]) p += 256;
-  }
-
-#ifndef __ARM_NEON__
-  if (s12 > p[127]) {
-    p += 128;
-  }
-  if (s12 > p[63]) {
-    p += 64;
-  }
-  if (s12 > p[31]) {
-    p += 32;
-  }
-  if (s12 > p[15]) {
-    p += 16;
-  }
-  if (s12 > p[7]) {
-    p += 8;
-  }
-  if (s12 > p[3]) {
-    p += 4;
-  }
-  if (s12 > p[1]) {
-    p += 2;
-  }
-  ULONG j = p[0];
-  if (s12 > j) j = p[1];
-  if (s != (j >> 12)) j >>= 6;
-  return (j & 0x3F);
-
-#else
-  /* This function part runs much better on Cortex-A9, saves 4 MHz from worstcase, is bitexact */
-  /* The idea: preload next 2 options for comparison, update wrong one, if needed */
-  ULONG p1 = p[127];
-  ULONG p2 = p[63];
-
-  if (s12 > p1) {
-    p2 = p[63 + 128];
-    p += 128;
-  }
-  p1 = p[31];
-  if (s12 > p2) {
-    p1 = p[31 + 64];
-    p += 64;
-  }
-  p2 = p[15];
-  if (s12 > p1) {
-    p2 = p[15 + 32];
-    p += 32;
-  }
-  p1 = p[7];
-  if (s12 > p2) {
-    p1 = p[7 + 16];
-    p += 16;
-  }
-  p2 = p[3];
-  if (s12 > p1) {
-    p2 = p[3 + 8];
-    p += 8;
-  }
-  p1 = p[1];
-  if (s12 > p2) {
-    p1 = p[1 + 4];
-    p += 4;
-  }
-
-  p2 = p[0];
-  if (s12 > p1) {
-    p2 = p[2];
-    p += 2;
-  }
-  if (s12 > p2) p2 = p[1];
-  if (s != (p2 >> 12)) p2 >>= 6;
-  return (p2 & 0x3F);
-
-#endif
+static FDK_FORCEINLINE ULONG get_pk_v2(ULONG s) {
+  return ari_ctx_pki[ari_ctx_block[ari_ctx_page[s >> 8]][(s >> 4) & 0xF]][s & 0xF];
 }
 
-static ARITH_CODING_ERROR decode2(HANDLE_FDK_BITSTREAM bbuf, UCHAR* RESTRICT c_prev,
+static ARITH_CODING_ERROR decode2(HANDLE_FDK_BITREADER hBr, UCHAR* RESTRICT c_prev,
                                   FIXP_DBL* RESTRICT pSpectralCoefficient, INT n, INT nt) {
   Tastat as;
   int i, l, r;
@@ -607,7 +1297,7 @@ static ARITH_CODING_ERROR decode2(HANDLE_FDK_BITSTREAM bbuf, UCHAR* RESTRICT c_p
   /* ari_start_decoding_14bits */
   as.low = 0;
   as.high = ari_q4new;
-  as.vobf = FDKreadBits(bbuf, cbitsnew);
+  as.vobf = FDKbrReadBits(hBr, cbitsnew);
 
   /* arith_map_context */
   state_inc = c_prev[0] << 12;
@@ -630,7 +1320,7 @@ static ARITH_CODING_ERROR decode2(HANDLE_FDK_BITSTREAM bbuf, UCHAR* RESTRICT c_p
     /* MSBs decoding */
     for (lev = esc_nb = 0;;) {
       pki = get_pk_v2(s + (esc_nb << (VAL_ESC + 1)));
-      r = ari_decode_14bits(bbuf, &as, ari_pk[pki], VAL_ESC + 1);
+      r = ari_decode_14bits_br(hBr, &as, ari_pk[pki], VAL_ESC + 1);
       if (r < VAL_ESC) {
         break;
       }
@@ -659,7 +1349,7 @@ static ARITH_CODING_ERROR decode2(HANDLE_FDK_BITSTREAM bbuf, UCHAR* RESTRICT c_p
       for (l = 0; l < lev; l++) {
         {
           int pidx = (a == 0) ? 1 : ((b == 0) ? 0 : 2);
-          r = ari_decode_14bits(bbuf, &as, ari_lsb2[pidx], 4);
+          r = ari_decode_14bits_br(hBr, &as, ari_lsb2[pidx], 4);
         }
         a = (a << 1) | (r & 1);
         b = (b << 1) | (r >> 1);
@@ -683,7 +1373,7 @@ static ARITH_CODING_ERROR decode2(HANDLE_FDK_BITSTREAM bbuf, UCHAR* RESTRICT c_p
 
   } /* for (i=0; i<n; i++) */
 
-  FDKpushBack(bbuf, cbitsnew - 2);
+  FDKbrPushBack(hBr, cbitsnew - 2);
 
   /* We need to run only from 0 to i-1 since all other q[i][1].a,b will be cleared later */
   int j = i;
@@ -693,7 +1383,7 @@ static ARITH_CODING_ERROR decode2(HANDLE_FDK_BITSTREAM bbuf, UCHAR* RESTRICT c_p
     if (pSpectralCoefficient[2 * i + 1] != (FIXP_DBL)0) bits++;
 
     if (bits) {
-      r = FDKreadBits(bbuf, bits);
+      r = FDKbrReadBits(hBr, bits);
       if (pSpectralCoefficient[2 * i] != (FIXP_DBL)0 && !(r >> (bits - 1))) {
         pSpectralCoefficient[2 * i] = -pSpectralCoefficient[2 * i];
       }
@@ -747,7 +1437,11 @@ ARITH_CODING_ERROR CArco_DecodeArithData(CArcoData* pArcoData, HANDLE_FDK_BITSTR
   pArcoData->m_numberLinesPrev = lg_max;
 
   if (lg > 0) {
-    ErrorStatus = decode2(hBs, pArcoData->c_prev + 2, mdctSpectrum, lg >> 1, lg_max >> 1);
+    FDK_BITREADER br;
+
+    FDKbrAttach(&br, hBs);
+    ErrorStatus = decode2(&br, pArcoData->c_prev + 2, mdctSpectrum, lg >> 1, lg_max >> 1);
+    FDKbrDetach(&br, hBs);
   } else {
     mpegh_FDKmemset(&pArcoData->c_prev[2], 1, sizeof(pArcoData->c_prev[2]) * (lg_max >> 1));
   }
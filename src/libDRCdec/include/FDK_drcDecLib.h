@@ -272,6 +272,14 @@ FDK_drcDec_ProcessFreq(HANDLE_DRC_DECODER hDrcDec, const int delaySamples,
                        const int processSingleTimeslot, FIXP_DBL** realBuffer,
                        FIXP_DBL** imagBuffer);
 
+/* Save the gain state that FDK_drcDec_Process...() update within a frame, to process the frame
+   more than once (e.g. for several output layouts), and restore it before the next processing. */
+DRC_DEC_ERROR
+FDK_drcDec_SaveProcessState(HANDLE_DRC_DECODER hDrcDec);
+
+DRC_DEC_ERROR
+FDK_drcDec_RestoreProcessState(HANDLE_DRC_DECODER hDrcDec);
+
 DRC_DEC_ERROR
 FDK_drcDec_ApplyDownmix(HANDLE_DRC_DECODER hDrcDec, int* reverseInChannelMap,
                         int* reverseOutChannelMap, FIXP_DBL* realBuffer, int* pNChannels);
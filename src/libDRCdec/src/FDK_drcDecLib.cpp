@@ -757,6 +757,26 @@ FDK_drcDec_ProcessFreq(HANDLE_DRC_DECODER hDrcDec, const int delaySamples,
   return DRC_DEC_OK;
 }
 
+DRC_DEC_ERROR
+FDK_drcDec_SaveProcessState(HANDLE_DRC_DECODER hDrcDec) {
+  if (hDrcDec == NULL) return DRC_DEC_NOT_OPENED;
+  if (!(hDrcDec->functionalRange & DRC_DEC_GAIN)) return DRC_DEC_NOT_OK;
+
+  drcDec_GainDecoder_SaveState(hDrcDec->hGainDec);
+
+  return DRC_DEC_OK;
+}
+
+DRC_DEC_ERROR
+FDK_drcDec_RestoreProcessState(HANDLE_DRC_DECODER hDrcDec) {
+  if (hDrcDec == NULL) return DRC_DEC_NOT_OPENED;
+  if (!(hDrcDec->functionalRange & DRC_DEC_GAIN)) return DRC_DEC_NOT_OK;
+
+  drcDec_GainDecoder_RestoreState(hDrcDec->hGainDec);
+
+  return DRC_DEC_OK;
+}
+
 DRC_DEC_ERROR
 FDK_drcDec_ApplyDownmix(HANDLE_DRC_DECODER hDrcDec, int* reverseInChannelMap,
                         int* reverseOutChannelMap, FIXP_DBL* realBuffer, int* pNChannels) {
@@ -447,6 +447,38 @@ drcDec_GainDecoder_ProcessSubbandDomain(
   return err;
 }
 
+void drcDec_GainDecoder_SaveState(HANDLE_DRC_GAIN_DECODER hGainDec) {
+  DRC_GAIN_DECODER_STATE* pState = &hGainDec->savedState;
+  int l, a, c;
+
+  mpegh_FDKmemcpy(pState->channelGainPrev, hGainDec->channelGainPrev, sizeof(pState->channelGainPrev));
+  for (l = 0; l < ACTIVE_DRC_LOCATIONS; l++) {
+    for (a = 0; a < MAX_ACTIVE_DRCS; a++) {
+      for (c = 0; c < 28; c++) {
+        pState->lnbIndexForChannel[l][a][c] =
+            hGainDec->activeDrc[l][a].lnbIndexForChannel[c][hGainDec->drcGainBuffers.lnbPointer];
+      }
+      pState->subbandGainsReady[l][a] = hGainDec->activeDrc[l][a].subbandGainsReady;
+    }
+  }
+}
+
+void drcDec_GainDecoder_RestoreState(HANDLE_DRC_GAIN_DECODER hGainDec) {
+  const DRC_GAIN_DECODER_STATE* pState = &hGainDec->savedState;
+  int l, a, c;
+
+  mpegh_FDKmemcpy(hGainDec->channelGainPrev, pState->channelGainPrev, sizeof(pState->channelGainPrev));
+  for (l = 0; l < ACTIVE_DRC_LOCATIONS; l++) {
+    for (a = 0; a < MAX_ACTIVE_DRCS; a++) {
+      for (c = 0; c < 28; c++) {
+        hGainDec->activeDrc[l][a].lnbIndexForChannel[c][hGainDec->drcGainBuffers.lnbPointer] =
+            pState->lnbIndexForChannel[l][a][c];
+      }
+      hGainDec->activeDrc[l][a].subbandGainsReady = pState->subbandGainsReady[l][a];
+    }
+  }
+}
+
 DRC_ERROR
 drcDec_GainDecoder_SetLoudnessNormalizationGainDb(HANDLE_DRC_GAIN_DECODER hGainDec,
                                                   FIXP_DBL loudnessNormalizationGainDb) {
@@ -147,6 +147,13 @@ typedef struct {
   int subbandGainsReady;
 } ACTIVE_DRC;
 
+/* The state that the process functions update within a frame */
+typedef struct {
+  FIXP_DBL channelGainPrev[28];
+  int lnbIndexForChannel[ACTIVE_DRC_LOCATIONS][MAX_ACTIVE_DRCS][28]; /* at lnbPointer */
+  int subbandGainsReady[ACTIVE_DRC_LOCATIONS][MAX_ACTIVE_DRCS];
+} DRC_GAIN_DECODER_STATE;
+
 typedef struct {
   int deltaTminDefault;
   INT frameSize;
@@ -172,6 +179,7 @@ typedef struct {
   int timeDomainSupported;
   int startupMs; /* reverse counter active for time segment 2.5 seconds after startup */
   SUBBAND_DOMAIN_MODE subbandDomainSupported;
+  DRC_GAIN_DECODER_STATE savedState; /* see drcDec_GainDecoder_SaveState() */
 } DRC_GAIN_DECODER, *HANDLE_DRC_GAIN_DECODER;
 
 /* init functions */
@@ -224,6 +232,11 @@ drcDec_GainDecoder_ProcessSubbandDomain(HANDLE_DRC_GAIN_DECODER hGainDec, const
                                         FIXP_DBL* audioIOBufferReal[],
                                         FIXP_DBL* audioIOBufferImag[]);
 
+/* Save and restore the state that the process functions update, to process a frame more than once */
+void drcDec_GainDecoder_SaveState(HANDLE_DRC_GAIN_DECODER hGainDec);
+
+void drcDec_GainDecoder_RestoreState(HANDLE_DRC_GAIN_DECODER hGainDec);
+
 DRC_ERROR
 drcDec_GainDecoder_Conceal(HANDLE_DRC_GAIN_DECODER hGainDec, HANDLE_UNI_DRC_CONFIG hUniDrcConfig,
                            HANDLE_UNI_DRC_GAIN hUniDrcGain);
@@ -147,22 +147,10 @@ static inline int _compAssign(FIXP_SGL* dest, const FIXP_SGL src) {
   return diff;
 }
 
-typedef const SCHAR (*Huffman)[2];
-
-static int _decodeHuffmanCW(Huffman h,                /*!< pointer to huffman codebook table */
+static int _decodeHuffmanCW(const FDK_HUFF_LUT* h,    /*!< pointer to huffman codebook table */
                             HANDLE_FDK_BITSTREAM hBs) /*!< Handle to bitbuffer */
 {
-  SCHAR index = 0;
-  int value, bit;
-
-  while (index >= 0) {
-    bit = FDKreadBits(hBs, 1);
-    index = h[index][bit];
-  }
-
-  value = index + 64; /* Add offset */
-
-  return value;
+  return FDKhuffDecodeBs(hBs, h) - 64; /* Remove offset */
 }
 
 /**********/
@@ -226,14 +214,14 @@ static int _decodeNNodes(HANDLE_FDK_BITSTREAM hBs) {
 static void _decodeGains(HANDLE_FDK_BITSTREAM hBs, const GAIN_CODING_PROFILE gainCodingProfile,
                          const int nNodes, GAIN_NODE* pNodes) {
   int k, deltaGain;
-  Huffman deltaGainCodebook;
+  const FDK_HUFF_LUT* deltaGainCodebook;
 
   pNodes[0].gainDb = _decodeGainInitial(hBs, gainCodingProfile);
 
   if (gainCodingProfile == GCP_CLIPPING_DUCKING) {
-    deltaGainCodebook = (Huffman)&deltaGain_codingProfile_2_huffman;
+    deltaGainCodebook = &deltaGain_codingProfile_2_huffman;
   } else {
-    deltaGainCodebook = (Huffman)&deltaGain_codingProfile_0_1_huffman;
+    deltaGainCodebook = &deltaGain_codingProfile_0_1_huffman;
   }
 
   for (k = 1; k < nNodes; k++) {
@@ -255,7 +243,7 @@ static void _decodeSlopes(HANDLE_FDK_BITSTREAM hBs,
   if (gainInterpolationType == GIT_SPLINE) {
     /* decode slope steepness */
     for (k = 0; k < nNodes; k++) {
-      _decodeHuffmanCW((Huffman)&slopeSteepness_huffman, hBs);
+      _decodeHuffmanCW(&slopeSteepness_huffman, hBs);
     }
   }
 }
@@ -91,18 +91,37 @@ amm-info@iis.fraunhofer.de
 #include "drcDec_types.h"
 #include "drcDec_rom.h"
 
-const SCHAR deltaGain_codingProfile_0_1_huffman[24][2] = {
-    {1, 2},    {3, 4},     {-63, -65}, {5, -66},   {-64, 6},  {-80, 7},  {8, 9},     {-68, 10},
-    {11, 12},  {-56, -67}, {-61, 13},  {-62, -69}, {14, 15},  {16, -72}, {-71, 17},  {-70, -60},
-    {18, -59}, {19, 20},   {21, -79},  {-57, -73}, {22, -58}, {-76, 23}, {-75, -74}, {-78, -77}};
-
-const SCHAR deltaGain_codingProfile_2_huffman[48][2] = {
-    {1, 2},    {3, 4},     {5, 6},     {7, 8},     {9, 10},    {11, 12},   {13, -65},  {14, -64},
-    {15, -66}, {16, -67},  {17, 18},   {19, -68},  {20, -63},  {-69, 21},  {-59, 22},  {-61, -62},
-    {-60, 23}, {24, -58},  {-70, -57}, {-56, -71}, {25, 26},   {27, -55},  {-72, 28},  {-54, 29},
-    {-53, 30}, {-73, -52}, {31, -74},  {32, 33},   {-75, 34},  {-76, 35},  {-51, 36},  {-78, 37},
-    {-77, 38}, {-96, 39},  {-48, 40},  {-50, -79}, {41, 42},   {-80, -81}, {-82, 43},  {44, -49},
-    {45, -84}, {-83, -89}, {-86, 46},  {-90, -85}, {-91, -93}, {-92, 47},  {-88, -87}, {-95, -94}};
+/* Huffman codebooks as lookup tables with 6 bit primary tables, q.v. FDK_huffman.h. The symbols
+ * are offset by 64, i.e. symbol 64 is a value of 0. */
+static const USHORT deltaGain_codingProfile_0_1_huffLut[114] = {
+    0x0604, 0x0604, 0x0604, 0x0604, 0x0785, 0x0785, 0x0866, 0x8405, 0x07C3, 0x07C3, 0x07C3, 0x07C3,
+    0x07C3, 0x07C3, 0x07C3, 0x07C3, 0x0803, 0x0803, 0x0803, 0x0803, 0x0803, 0x0803, 0x0803, 0x0803,
+    0x0846, 0x0766, 0x8604, 0x8701, 0x0905, 0x0905, 0x07A5, 0x07A5, 0x0822, 0x0822, 0x0822, 0x0822,
+    0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822, 0x0822,
+    0x07E2, 0x07E2, 0x07E2, 0x07E2, 0x07E2, 0x07E2, 0x07E2, 0x07E2, 0x07E2, 0x07E2, 0x07E2, 0x07E2,
+    0x07E2, 0x07E2, 0x07E2, 0x07E2, 0x0684, 0x0684, 0x0645, 0x0665, 0x0623, 0x0623, 0x0623, 0x0623,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x0701, 0x0701, 0x0701, 0x0701,
+    0x0701, 0x0701, 0x0701, 0x0701, 0x0701, 0x0701, 0x0701, 0x0701, 0x0701, 0x0701, 0x0701, 0x0701,
+    0x0721, 0x0721, 0x0721, 0x0721, 0x0721, 0x0721, 0x0721, 0x0721, 0x08E3, 0x08E3, 0x06E3, 0x06E3,
+    0x06A4, 0x06C4, 0x08C3, 0x08C3, 0x0741, 0x0881};
+
+const FDK_HUFF_LUT deltaGain_codingProfile_0_1_huffman = {deltaGain_codingProfile_0_1_huffLut, 6};
+
+static const USHORT deltaGain_codingProfile_2_huffLut[136] = {
+    0x08A5, 0x08A5, 0x0706, 0x8405, 0x0804, 0x0804, 0x0804, 0x0804, 0x0865, 0x0865, 0x0845, 0x0845,
+    0x07C4, 0x07C4, 0x07C4, 0x07C4, 0x0885, 0x0885, 0x0946, 0x8602, 0x07A4, 0x07A4, 0x07A4, 0x07A4,
+    0x0966, 0x8644, 0x08C5, 0x08C5, 0x0745, 0x0745, 0x08E5, 0x08E5, 0x0905, 0x0905, 0x0725, 0x0725,
+    0x0784, 0x0784, 0x0784, 0x0784, 0x06E6, 0x0986, 0x8742, 0x06C6, 0x0824, 0x0824, 0x0824, 0x0824,
+    0x0764, 0x0764, 0x0764, 0x0764, 0x8783, 0x8803, 0x0925, 0x0925, 0x07E3, 0x07E3, 0x07E3, 0x07E3,
+    0x07E3, 0x07E3, 0x07E3, 0x07E3, 0x06A1, 0x06A1, 0x06A1, 0x06A1, 0x06A1, 0x06A1, 0x06A1, 0x06A1,
+    0x06A1, 0x06A1, 0x06A1, 0x06A1, 0x06A1, 0x06A1, 0x06A1, 0x06A1, 0x0A02, 0x0A02, 0x0A02, 0x0A02,
+    0x0A02, 0x0A02, 0x0A02, 0x0A02, 0x0484, 0x0484, 0x0425, 0x0445, 0x0583, 0x0583, 0x0583, 0x0583,
+    0x0681, 0x0681, 0x09C2, 0x0622, 0x09A1, 0x09A1, 0x09A1, 0x09A1, 0x09A1, 0x09A1, 0x09A1, 0x09A1,
+    0x05A3, 0x05A3, 0x04E3, 0x04E3, 0x0543, 0x0543, 0x0504, 0x0524, 0x0641, 0x0641, 0x0602, 0x05E2,
+    0x0661, 0x0661, 0x0661, 0x0661, 0x05C2, 0x05C2, 0x04C3, 0x0563, 0x0401, 0x0401, 0x0401, 0x0401,
+    0x04A3, 0x0463, 0x09E2, 0x09E2};
+
+const FDK_HUFF_LUT deltaGain_codingProfile_2_huffman = {deltaGain_codingProfile_2_huffLut, 6};
 
 const FIXP_SGL slopeSteepness[] = {
     FL2FXCONST_SGL(-3.0518f / (float)(1 << 2)), FL2FXCONST_SGL(-1.2207f / (float)(1 << 2)),
@@ -114,9 +133,16 @@ const FIXP_SGL slopeSteepness[] = {
     FL2FXCONST_SGL(0.4883f / (float)(1 << 2)),  FL2FXCONST_SGL(1.2207f / (float)(1 << 2)),
     FL2FXCONST_SGL(3.0518f / (float)(1 << 2))};
 
-const SCHAR slopeSteepness_huffman[14][2] = {{1, -57},  {-58, 2},   {3, 4},    {5, 6},    {7, -56},
-                                             {8, -60},  {-61, -55}, {9, -59},  {10, -54}, {-64, 11},
-                                             {-51, 12}, {-62, -50}, {-63, 13}, {-52, -53}};
+static const USHORT slopeSteepness_huffLut[74] = {
+    0x08C2, 0x08C2, 0x08C2, 0x08C2, 0x08C2, 0x08C2, 0x08C2, 0x08C2, 0x08C2, 0x08C2, 0x08C2, 0x08C2,
+    0x08C2, 0x08C2, 0x08C2, 0x08C2, 0x8403, 0x0946, 0x0885, 0x0885, 0x0865, 0x0865, 0x0925, 0x0925,
+    0x0806, 0x8481, 0x08A5, 0x08A5, 0x0904, 0x0904, 0x0904, 0x0904, 0x08E1, 0x08E1, 0x08E1, 0x08E1,
+    0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1,
+    0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x08E1,
+    0x08E1, 0x08E1, 0x08E1, 0x08E1, 0x09A1, 0x09A1, 0x09A1, 0x09A1, 0x0822, 0x0822, 0x0983, 0x0963,
+    0x0841, 0x09C1};
+
+const FDK_HUFF_LUT slopeSteepness_huffman = {slopeSteepness_huffLut, 6};
 
 const FIXP_DBL downmixCoeff[] = {
     FL2FXCONST_DBL(1.0000000000 / (float)(1 << 2)), FL2FXCONST_DBL(0.9440608763 / (float)(1 << 2)),
@@ -91,11 +91,13 @@ amm-info@iis.fraunhofer.de
 #ifndef DRCDEC_ROM_H
 #define DRCDEC_ROM_H
 
-extern const SCHAR deltaGain_codingProfile_0_1_huffman[24][2];
-extern const SCHAR deltaGain_codingProfile_2_huffman[48][2];
+#include "FDK_huffman.h"
+
+extern const FDK_HUFF_LUT deltaGain_codingProfile_0_1_huffman;
+extern const FDK_HUFF_LUT deltaGain_codingProfile_2_huffman;
 
 extern const FIXP_SGL slopeSteepness[];
-extern const SCHAR slopeSteepness_huffman[14][2];
+extern const FDK_HUFF_LUT slopeSteepness_huffman;
 
 extern const FIXP_DBL downmixCoeff[];
 extern const FIXP_DBL downmixCoeffV1[];
@@ -102,6 +102,17 @@ amm-info@iis.fraunhofer.de
 #define __x86__
 #endif
 
+#if defined(__x86__)
+/* Detect and unify macros for x86 SIMD extensions selected at build time. MSVC does not define
+ * __SSE4_1__, but /arch:AVX and above imply it. */
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define __X86_SSE4_1__
+#endif
+#if defined(__AVX2__)
+#define __X86_AVX2__
+#endif
+#endif
+
 #if defined(_M_ARM) && !defined(__arm__) || defined(__aarch64__)
 #define __arm__
 #endif
@@ -0,0 +1,279 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************* Library for basic calculation routines ********************
+
+   Author(s):
+
+   Description: word-at-a-time bitstream reader for linear buffers
+
+*******************************************************************************/
+
+#ifndef FDK_BITREADER_H
+#define FDK_BITREADER_H
+
+#include "FDK_bitstream.h"
+#include "machine_type.h"
+
+/*
+ * The bit reader keeps up to 64 bits left aligned in CacheWord. As long as at least 8 bytes
+ * are left in the buffer, a refill loads one big-endian 64-bit word and tops the cache up to
+ * 56..63 bits without any branch or wrap-around masking. Only the last 7 bytes of a buffer go
+ * through the byte-wise FDKbrRefillSlow().
+ *
+ * The bits below BitsInCache are not cleared; they always hold the bits that follow in the
+ * stream, so or-ing in the next word is exact.
+ */
+typedef struct {
+  UINT64 CacheWord;     /*!< Left aligned cache, next bit is the MSB. */
+  UINT BitsInCache;     /*!< Number of valid bits in CacheWord. */
+  UINT ByteNdx;         /*!< Index of the next byte to load, unmasked. */
+  UINT ByteMask;        /*!< bufSize-1 for ring buffers, ~0 for linear buffers. */
+  UINT BitNdxStart;     /*!< Bit index of the first bit, for FDKbrGetBitCnt(). */
+  UINT bufSize;         /*!< Readable size of Buffer in bytes. */
+  const UCHAR* Buffer;
+} FDK_BITREADER;
+
+typedef FDK_BITREADER* HANDLE_FDK_BITREADER;
+
+/**
+ * \brief Refill the cache byte by byte near the end of the buffer. Bytes beyond the end of a
+ *        linear buffer read as zero, a ring buffer wraps around.
+ *
+ * \param hBr HANDLE_FDK_BITREADER handle
+ */
+void FDKbrRefillSlow(HANDLE_FDK_BITREADER hBr);
+
+/**
+ * \brief Rewind the reader by a number of bits already read.
+ *
+ * \param hBr           HANDLE_FDK_BITREADER handle
+ * \param numberOfBits  Number of bits to rewind, at most FDKbrGetBitCnt().
+ */
+void FDKbrPushBack(HANDLE_FDK_BITREADER hBr, const UINT numberOfBits);
+
+/**
+ * \brief Fill the cache with at least 56 bits.
+ *
+ * \param hBr HANDLE_FDK_BITREADER handle
+ */
+FDK_INLINE void FDKbrRefill(HANDLE_FDK_BITREADER hBr) {
+  UINT ndx = hBr->ByteNdx & hBr->ByteMask;
+
+  if (ndx + 8 <= hBr->bufSize) {
+    const UCHAR* p = &hBr->Buffer[ndx];
+    UINT64 word = ((UINT64)p[0] << 56) | ((UINT64)p[1] << 48) | ((UINT64)p[2] << 40) |
+                  ((UINT64)p[3] << 32) | ((UINT64)p[4] << 24) | ((UINT64)p[5] << 16) |
+                  ((UINT64)p[6] << 8) | (UINT64)p[7];
+
+    hBr->CacheWord |= word >> hBr->BitsInCache;
+    hBr->ByteNdx += (63 - hBr->BitsInCache) >> 3;
+    hBr->BitsInCache |= 56;
+  } else {
+    FDKbrRefillSlow(hBr);
+  }
+}
+
+/**
+ * \brief Initialize the reader on a linear buffer.
+ *
+ * \param hBr       HANDLE_FDK_BITREADER handle
+ * \param pBuffer   Pointer to the bitstream data.
+ * \param bufSize   Size of pBuffer in bytes. All bufSize bytes must be readable.
+ * \param bitOffset Bit index of the first bit to read.
+ */
+FDK_INLINE void FDKbrInit(HANDLE_FDK_BITREADER hBr, const UCHAR* pBuffer, UINT bufSize,
+                          UINT bitOffset) {
+  hBr->Buffer = pBuffer;
+  hBr->bufSize = bufSize;
+  hBr->ByteMask = ~(UINT)0;
+  hBr->BitNdxStart = bitOffset;
+  hBr->ByteNdx = bitOffset >> 3;
+  hBr->CacheWord = 0;
+  hBr->BitsInCache = 0;
+  FDKbrRefill(hBr);
+  hBr->CacheWord <<= bitOffset & 7;
+  hBr->BitsInCache -= bitOffset & 7;
+}
+
+/**
+ * \brief Continue reading an FDK_BITSTREAM with the bit reader. The bitstream must not be used
+ *        until FDKbrDetach() is called. Reads wrap around like FDKreadBits() does, but only the
+ *        rare refill that crosses the end of the ring buffer takes the masked path.
+ *
+ * \param hBr        HANDLE_FDK_BITREADER handle
+ * \param hBitStream HANDLE_FDK_BITSTREAM reader handle
+ */
+FDK_INLINE void FDKbrAttach(HANDLE_FDK_BITREADER hBr, HANDLE_FDK_BITSTREAM hBitStream) {
+  UINT bitNdx;
+
+  FDKsyncCache(hBitStream);
+  bitNdx = hBitStream->hBitBuf.BitNdx;
+
+  hBr->Buffer = hBitStream->hBitBuf.Buffer;
+  hBr->bufSize = hBitStream->hBitBuf.bufSize;
+  hBr->ByteMask = hBitStream->hBitBuf.bufSize - 1;
+  hBr->BitNdxStart = bitNdx;
+  hBr->ByteNdx = bitNdx >> 3;
+  hBr->CacheWord = 0;
+  hBr->BitsInCache = 0;
+  FDKbrRefill(hBr);
+  hBr->CacheWord <<= bitNdx & 7;
+  hBr->BitsInCache -= bitNdx & 7;
+}
+
+/**
+ * \brief Return the number of bits read since FDKbrInit() or FDKbrAttach().
+ *
+ * \param hBr HANDLE_FDK_BITREADER handle
+ * \return number of bits read
+ */
+FDK_INLINE UINT FDKbrGetBitCnt(HANDLE_FDK_BITREADER hBr) {
+  return (hBr->ByteNdx << 3) - hBr->BitsInCache - hBr->BitNdxStart;
+}
+
+/**
+ * \brief Advance an attached FDK_BITSTREAM by the bits read with the bit reader.
+ *
+ * \param hBr        HANDLE_FDK_BITREADER handle
+ * \param hBitStream HANDLE_FDK_BITSTREAM handle passed to FDKbrAttach()
+ */
+FDK_INLINE void FDKbrDetach(HANDLE_FDK_BITREADER hBr, HANDLE_FDK_BITSTREAM hBitStream) {
+  FDK_pushForward(&hBitStream->hBitBuf, FDKbrGetBitCnt(hBr), BS_READER);
+}
+
+/**
+ * \brief Return the next bits without consuming them.
+ *
+ * \param hBr           HANDLE_FDK_BITREADER handle
+ * \param numberOfBits  Number of bits to peek, 0..32.
+ * \return the requested bits, right aligned
+ */
+FDK_INLINE UINT FDKbrPeekBits(HANDLE_FDK_BITREADER hBr, const UINT numberOfBits) {
+  FDK_ASSERT(numberOfBits <= 32);
+  if (hBr->BitsInCache < numberOfBits) FDKbrRefill(hBr);
+
+  return (UINT)((hBr->CacheWord >> 1) >> (63 - numberOfBits));
+}
+
+/**
+ * \brief Consume bits that have been peeked.
+ *
+ * \param hBr           HANDLE_FDK_BITREADER handle
+ * \param numberOfBits  Number of bits to skip, at most the number of bits peeked before.
+ */
+FDK_INLINE void FDKbrSkipBits(HANDLE_FDK_BITREADER hBr, const UINT numberOfBits) {
+  FDK_ASSERT(numberOfBits <= hBr->BitsInCache);
+  hBr->CacheWord <<= numberOfBits;
+  hBr->BitsInCache -= numberOfBits;
+}
+
+/**
+ * \brief Read a number of bits, 0..32.
+ *
+ * \param hBr           HANDLE_FDK_BITREADER handle
+ * \param numberOfBits  Number of bits to read.
+ * \return the requested bits, right aligned
+ */
+FDK_INLINE UINT FDKbrReadBits(HANDLE_FDK_BITREADER hBr, const UINT numberOfBits) {
+  UINT bits = FDKbrPeekBits(hBr, numberOfBits);
+  FDKbrSkipBits(hBr, numberOfBits);
+
+  return bits;
+}
+
+/**
+ * \brief Read one bit.
+ *
+ * \param hBr HANDLE_FDK_BITREADER handle
+ * \return the bit
+ */
+FDK_INLINE UINT FDKbrReadBit(HANDLE_FDK_BITREADER hBr) {
+  if (hBr->BitsInCache == 0) FDKbrRefill(hBr);
+  UINT bit = (UINT)(hBr->CacheWord >> 63);
+  hBr->CacheWord <<= 1;
+  hBr->BitsInCache--;
+
+  return bit;
+}
+
+#endif /* FDK_BITREADER_H */
@@ -164,6 +164,10 @@ typedef enum {
 #define CICP2GEOMETRY_CICP_INVALID (-1000)
 #define CICP2GEOMETRY_CICP_VALID 0
 
+/* Indices handed out for registered custom loudspeaker layouts, beyond all CICP layout indices */
+#define CICP2GEOMETRY_CICP_CUSTOM_FIRST (1000)
+#define CICP2GEOMETRY_MAX_CUSTOM_LAYOUTS (8)
+
 /**********************************************************************/ /**
 
  **************************************************************************/
@@ -250,6 +254,31 @@ CICP2GEOMETRY_ERROR cicp2geometry_get_geometry_from_cicp_loudspeaker_index(
         AzElLfe /**< out:pointer to an array with CICP2GEOMETRY_CHANNEL_GEOMETRYs */
 );
 
+/**********************************************************************/ /**
+ cicp2geometry_register_custom_layout() makes an arbitrary loudspeaker layout
+ available under a layout index, so that it can be used wherever a cicpIndex
+ is expected. A layout matching a CICP layout gets the CICP index, registering
+ the same geometry again returns the same index. Loudspeakers are labeled with
+ the CICP loudspeaker index of their position, if there is one. Registered
+ layouts are shared by all instances of the process and are never removed.
+
+ \return returns 0 for no error, CICP2GEOMETRY_ALLOC_ERROR if all custom layout
+ indices are in use.
+ **************************************************************************/
+CICP2GEOMETRY_ERROR cicp2geometry_register_custom_layout(
+    const CICP2GEOMETRY_CHANNEL_GEOMETRY*
+        AzElLfe,          /**< in: pointer to an array with CICP2GEOMETRY_CHANNEL_GEOMETRYs, only Az,
+                             El and LFE are evaluated */
+    int numTotalChannels, /**< in: number of loudspeakers including LFEs */
+    int* cicpIndex        /**< out: layout index of this reproduction setup */
+);
+
+/**********************************************************************/ /**
+ cicp2geometry_is_custom_layout() tells whether cicpIndex was returned by
+ cicp2geometry_register_custom_layout() for a non-CICP layout.
+ **************************************************************************/
+int cicp2geometry_is_custom_layout(int cicpIndex);
+
 /*********************************************************************/ /**
                                                                          *************************************************************************/
 CICP2GEOMETRY_ERROR cicp2geometry_get_number_of_lfes(CICP2GEOMETRY_CHANNEL_GEOMETRY* AzElLfe,
@@ -0,0 +1,171 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************* Library for basic calculation routines ********************
+
+   Author(s):
+
+   Description: Run-time dispatch table for vector DSP primitives
+
+*******************************************************************************/
+
+#ifndef FDK_DSP_H
+#define FDK_DSP_H
+
+#include "common_fix.h"
+
+/** One output of FDK_DSP_FUNCS::addGainRampMulti(). */
+typedef struct {
+  INT offset;    /**< Offset of the output samples in pOut. */
+  FIXP_DBL gain; /**< Gain before the first sample, advanced by length steps. */
+  FIXP_DBL step; /**< Gain increment per sample, 0 for a static gain. */
+  INT shl;       /**< Left shift of the weighted samples. */
+  INT shr;       /**< Right shift of the weighted samples. */
+} FDK_GAIN_RAMP;
+
+/**
+ * \brief Table of vector DSP primitives.
+ *
+ * Holds the kernels of the hot vector loops of the decoder. The table is initialized with the
+ * generic C kernels. FDK_dspInit() replaces them by the fastest kernels supported by the CPU.
+ * All kernels of one entry are bit-exact with each other.
+ */
+typedef struct {
+  /** dst[i] = src[i] * 2^scalefactor, see mpegh_scaleValues(), dst may be equal to src. */
+  void (*scaleValues)(FIXP_DBL* dst, const FIXP_DBL* src, INT len, INT scalefactor);
+  /** dst[i] = scaleValueSaturate(src[i], scalefactor), dst may be equal to src. */
+  void (*scaleValuesSaturate)(FIXP_DBL* dst, const FIXP_DBL* src, INT len, INT scalefactor);
+  /** Headroom of a vector, see mpegh_getScalefactor(). */
+  INT (*getScalefactor)(const FIXP_DBL* vector, INT len);
+  /** Maximum value of a vector, len > 0. */
+  FIXP_DBL (*maxValue)(const FIXP_DBL* vector, UINT len);
+  /** Interleave channels of frameSize samples, see MPEGH_interleave(). */
+  void (*interleave)(const FIXP_DBL* pIn, LONG* pOut, UINT channels, UINT frameSize,
+                     UINT length);
+  /** pOut[i] += (fMult(pIn[i], scale + (i + 1) * step) << shl) >> shr */
+  void (*addGainRamp)(FIXP_DBL* pOut, const FIXP_DBL* pIn, UINT length, FIXP_DBL scale,
+                      FIXP_DBL step, INT shl, INT shr);
+  /** addGainRamp() of one input into numRamps outputs at pOut + ramps[n].offset. Advances
+      ramps[n].gain by length steps, outputs with step 0 take a constant gain path. */
+  void (*addGainRampMulti)(FIXP_DBL* pOut, const FIXP_DBL* pIn, UINT length, FDK_GAIN_RAMP* ramps,
+                           UINT numRamps);
+  /** pOut[i] = fAddSaturate(pOut[i], SATURATE_LEFT_SHIFT(pIn[i], shl, DFRACT_BITS)), shl >= 0 */
+  void (*addSaturateShl)(FIXP_DBL* pOut, const FIXP_DBL* pIn, UINT length, INT shl);
+  /** Sine windowing of the STFT analysis, fftSize / 2 window coefficients in sinetab. */
+  void (*stftSineWindowing)(const FIXP_DBL* audioInputTime, FIXP_DBL* audioInputTimePrev,
+                            FIXP_DBL* audioOutputFreq, UINT fftSize, const FIXP_WTP* sinetab);
+  /** Windowed overlap-add of the STFT synthesis, fftSize / 2 window coefficients in sinetab. */
+  void (*stftOverlapAdd)(const FIXP_DBL* audioInputTime, FIXP_DBL* audioInputTimePrev,
+                         FIXP_DBL* audioOutputTime, UINT fftSize, const FIXP_WTP* sinetab);
+  /** Weighted accumulation of a spectrum of interleaved complex bins in bands, band b spans the
+      bins [bandEnd[b - 1], bandEnd[b]) with bandEnd[-1] = 0 and at least one bin. Per value
+      t = fMult(coeff[b], pIn[k] << hdr[b]) and pOut[k] = fAddSaturate(pOut[k], t >> hdr[b]), per
+      bin energy[b] += (fPow2Div2(t.re) + fPow2Div2(t.im)) >> shr[b]. With energy NULL only
+      pOut is accumulated, without the headroom shifts, and hdr and shr may be NULL. */
+  void (*stftDmxBands)(FIXP_DBL* pOut, const FIXP_DBL* pIn, FIXP_DBL* energy, const UINT* bandEnd,
+                       const FIXP_DBL* coeff, const INT* hdr, const INT* shr, UINT numBands);
+  /** Equalizer gains of the STFT active downmix, eq[b] * 2^eqExp[b] is the square root of
+      targetEne[b] * 2^-targetHdr[b] / (realizedEne[b] * 2^-realizedHdr[b]) limited to -10 ... 8 dB,
+      times 2^eqExpOffset. eq[b] is normalized, energies of 0 count as 1. */
+  void (*stftDmxEq)(FIXP_DBL* eq, SCHAR* eqExp, const FIXP_DBL* targetEne,
+                    const FIXP_DBL* realizedEne, const SCHAR* targetHdr,
+                    const SCHAR* realizedHdr, INT eqExpOffset, UINT numBands);
+  /** In place radix-2 FFT of 2^ldn interleaved complex values, see dit_fft(). */
+  void (*ditFft)(FIXP_DBL* x, const INT ldn, const FIXP_STP* trigdata, const INT trigDataSize);
+  /** In place pre twiddling of the DCT-IV of length L before its FFT, see dct_IV(). */
+  void (*dctIVPreTwiddle)(FIXP_DBL* pDat, INT L, const FIXP_WTP* twiddle);
+  /** In place post twiddling of the DCT-IV of length L after its FFT, see dct_IV(). */
+  void (*dctIVPostTwiddle)(FIXP_DBL* pDat, INT L, const FIXP_STP* sin_twiddle, INT sin_step);
+} FDK_DSP_FUNCS;
+
+/** The process wide kernel table. */
+extern FDK_DSP_FUNCS FDK_dspFuncs;
+
+/**
+ * \brief Select the fastest kernels supported by the CPU.
+ *
+ * Only the first call detects the CPU features and updates FDK_dspFuncs; it is safe to be called
+ * from concurrent threads. Must be called before instances that use FDK_dspFuncs are running.
+ */
+void FDK_dspInit(void);
+
+#endif /* FDK_DSP_H */
@@ -0,0 +1,167 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************* Library for basic calculation routines ********************
+
+   Author(s):
+
+   Description: multi-bit lookup table Huffman decoder
+
+*******************************************************************************/
+
+#ifndef FDK_HUFFMAN_H
+#define FDK_HUFFMAN_H
+
+#include "FDK_bitstream.h"
+#include "FDK_bitreader.h"
+
+/*
+ * A Huffman code is decoded with a primary table indexed by the next primaryBits bits of the
+ * stream. Codes that are longer than primaryBits continue in secondary tables, which are stored
+ * behind the primary table in the same array. Each USHORT entry is one of:
+ *
+ *   leaf:  (symbol << 5) | length         code ends in this table after length bits (1..31)
+ *   link:  0x8000 | (offset << 4) | bits  code continues at lut[offset] indexed by the next bits
+ *   0:     no code starts with these bits
+ *
+ * Tables are built from the codeword and length lists of a codebook, q.v. FDK_HUFF_LEAF() and
+ * FDK_HUFF_LINK(). A table holds at most 2048 entries and symbols up to 1023.
+ */
+#define FDK_HUFF_LEAF(symbol, length) ((USHORT)(((symbol) << 5) | (length)))
+#define FDK_HUFF_LINK(offset, bits) ((USHORT)(0x8000 | ((offset) << 4) | (bits)))
+
+typedef struct {
+  const USHORT* lut; /*!< Primary table of 1 << primaryBits entries and the secondary tables. */
+  UCHAR primaryBits; /*!< Number of bits indexing the primary table. */
+} FDK_HUFF_LUT;
+
+/**
+ * \brief Decode one Huffman codeword from a FDK_BITREADER.
+ *
+ * \param hBr   HANDLE_FDK_BITREADER handle
+ * \param hLut  Lookup table of the codebook.
+ * \return the decoded symbol, or -1 if no codeword matches. Then only the bits of the tables
+ *         before the mismatching one are consumed.
+ */
+FDK_INLINE INT FDKhuffDecode(HANDLE_FDK_BITREADER hBr, const FDK_HUFF_LUT* hLut) {
+  UINT bits = hLut->primaryBits;
+  UINT entry = hLut->lut[FDKbrPeekBits(hBr, bits)];
+
+  while (entry & 0x8000) {
+    FDKbrSkipBits(hBr, bits);
+    bits = entry & 0xF;
+    entry = hLut->lut[((entry >> 4) & 0x7FF) + FDKbrPeekBits(hBr, bits)];
+  }
+  FDKbrSkipBits(hBr, entry & 0x1F);
+
+  return (entry & 0x1F) ? (INT)(entry >> 5) : -1;
+}
+
+/**
+ * \brief Decode one Huffman codeword from a FDK_BITSTREAM. The bits read beyond the codeword are
+ *        returned to the cache if possible, so that no cache sync is needed.
+ *
+ * \param hBitStream  HANDLE_FDK_BITSTREAM handle
+ * \param hLut        Lookup table of the codebook.
+ * \return the decoded symbol, or -1 if no codeword matches, q.v. FDKhuffDecode().
+ */
+FDK_INLINE INT FDKhuffDecodeBs(HANDLE_FDK_BITSTREAM hBitStream, const FDK_HUFF_LUT* hLut) {
+  UINT bits = hLut->primaryBits;
+  UINT entry = hLut->lut[FDKreadBits(hBitStream, bits)];
+  UINT unused;
+
+  while (entry & 0x8000) {
+    bits = entry & 0xF;
+    entry = hLut->lut[((entry >> 4) & 0x7FF) + FDKreadBits(hBitStream, bits)];
+  }
+
+  unused = bits - (entry & 0x1F);
+  if (hBitStream->BitsInCache + unused <= CACHE_BITS) {
+    FDKpushBackCache(hBitStream, unused);
+  } else {
+    FDKpushBack(hBitStream, unused);
+  }
+
+  return (entry & 0x1F) ? (INT)(entry >> 5) : -1;
+}
+
+#endif /* FDK_HUFFMAN_H */
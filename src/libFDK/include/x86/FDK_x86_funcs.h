@@ -0,0 +1,176 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************* Library for basic calculation routines ********************
+
+   Author(s):
+
+   Description: Helper routines for x86 SSE4.1/AVX2 intrinsics. All helpers
+                are bit-exact with the generic fixed point operations.
+
+*******************************************************************************/
+
+#if !defined(FDK_X86_FUNCS_H)
+#define FDK_X86_FUNCS_H
+
+#include "FDK_archdef.h"
+
+#if defined(__x86__) && (defined(__GNUC__) || defined(_MSC_VER))
+#include <immintrin.h>
+
+/* The SIMD kernels are selected at run-time, so they are compiled for their instruction set
+   independent of the compiler settings of the translation unit. */
+#define FDK_X86_SIMD
+
+#if defined(__GNUC__)
+#define FDK_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+#define FDK_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define FDK_TARGET_SSE4_1
+#define FDK_TARGET_AVX2
+#endif
+
+/* 4x fixmuldiv2_DD(a, b): upper 32 bits of the 64 bit product */
+static FDK_FORCEINLINE FDK_TARGET_SSE4_1 __m128i FDK_mm_fMultDiv2_DD(__m128i a, __m128i b) {
+  __m128i even = _mm_mul_epi32(a, b);
+  __m128i odd = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xCC);
+}
+
+/* 4x fixmul_DD(a, b) */
+static FDK_FORCEINLINE FDK_TARGET_SSE4_1 __m128i FDK_mm_fMult_DD(__m128i a, __m128i b) {
+  return _mm_slli_epi32(FDK_mm_fMultDiv2_DD(a, b), 1);
+}
+
+/* 4x fAddSaturate(a, b) */
+static FDK_FORCEINLINE FDK_TARGET_SSE4_1 __m128i FDK_mm_fAddSaturate_DD(__m128i a, __m128i b) {
+  __m128i sum = _mm_add_epi32(a, b);
+  __m128i ovf = _mm_and_si128(_mm_xor_si128(a, sum), _mm_xor_si128(b, sum));
+  __m128i sat = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(MAXVAL_DBL));
+  return _mm_castps_si128(
+      _mm_blendv_ps(_mm_castsi128_ps(sum), _mm_castsi128_ps(sat), _mm_castsi128_ps(ovf)));
+}
+
+/* 4x SATURATE_LEFT_SHIFT(x, scale, DFRACT_BITS), scale in range 0 ... 31 */
+static FDK_FORCEINLINE FDK_TARGET_SSE4_1 __m128i FDK_mm_shlSaturate_DD(__m128i x, INT scale) {
+  __m128i hi = _mm_set1_epi32((LONG)MAXVAL_DBL >> scale);
+  __m128i lo = _mm_set1_epi32(~((LONG)MAXVAL_DBL >> scale));
+  __m128i res = _mm_sll_epi32(x, _mm_cvtsi32_si128(scale));
+  res = _mm_blendv_epi8(res, _mm_set1_epi32(MAXVAL_DBL), _mm_cmpgt_epi32(x, hi));
+  res = _mm_blendv_epi8(res, _mm_set1_epi32(MINVAL_DBL), _mm_cmpgt_epi32(lo, x));
+  return res;
+}
+
+/* 8x fixmuldiv2_DD(a, b): upper 32 bits of the 64 bit product */
+static FDK_FORCEINLINE FDK_TARGET_AVX2 __m256i FDK_mm256_fMultDiv2_DD(__m256i a, __m256i b) {
+  __m256i even = _mm256_mul_epi32(a, b);
+  __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+  return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+/* 8x fixmul_DD(a, b) */
+static FDK_FORCEINLINE FDK_TARGET_AVX2 __m256i FDK_mm256_fMult_DD(__m256i a, __m256i b) {
+  return _mm256_slli_epi32(FDK_mm256_fMultDiv2_DD(a, b), 1);
+}
+
+/* 8x fAddSaturate(a, b) */
+static FDK_FORCEINLINE FDK_TARGET_AVX2 __m256i FDK_mm256_fAddSaturate_DD(__m256i a, __m256i b) {
+  __m256i sum = _mm256_add_epi32(a, b);
+  __m256i ovf = _mm256_and_si256(_mm256_xor_si256(a, sum), _mm256_xor_si256(b, sum));
+  __m256i sat = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(MAXVAL_DBL));
+  return _mm256_castps_si256(_mm256_blendv_ps(
+      _mm256_castsi256_ps(sum), _mm256_castsi256_ps(sat), _mm256_castsi256_ps(ovf)));
+}
+
+/* 8x SATURATE_LEFT_SHIFT(x, scale, DFRACT_BITS), scale in range 0 ... 31 */
+static FDK_FORCEINLINE FDK_TARGET_AVX2 __m256i FDK_mm256_shlSaturate_DD(__m256i x, INT scale) {
+  __m256i hi = _mm256_set1_epi32((LONG)MAXVAL_DBL >> scale);
+  __m256i lo = _mm256_set1_epi32(~((LONG)MAXVAL_DBL >> scale));
+  __m256i res = _mm256_sll_epi32(x, _mm_cvtsi32_si128(scale));
+  res = _mm256_blendv_epi8(res, _mm256_set1_epi32(MAXVAL_DBL), _mm256_cmpgt_epi32(x, hi));
+  res = _mm256_blendv_epi8(res, _mm256_set1_epi32(MINVAL_DBL), _mm256_cmpgt_epi32(lo, x));
+  return res;
+}
+
+#endif /* defined(__x86__) && (defined(__GNUC__) || defined(_MSC_VER)) */
+
+#endif /* !defined(FDK_X86_FUNCS_H) */
@@ -118,6 +118,8 @@ amm-info@iis.fraunhofer.de
  ***********************************************************************************/
 #include <string.h>
 
+#include <mutex>
+
 #include "common_fix.h"
 
 /* locals includes */
@@ -1393,6 +1395,127 @@ CICP2GEOMETRY_ERROR cicp2geometry_get_cicpIndex_from_geometry(
   return CICP2GEOMETRY_UNSUPPORTED_CHANNEL_COUNT;
 }
 
+/**********************************************************************/ /**
+ Layouts registered by cicp2geometry_register_custom_layout(). Entries are
+ only appended, the custom layout index is CICP2GEOMETRY_CICP_CUSTOM_FIRST
+ plus the entry index.
+ **************************************************************************/
+
+typedef struct {
+  int numTotalChannels;
+  CICP2GEOMETRY_CHANNEL_GEOMETRY AzElLfe[CICP2GEOMETRY_MAX_LOUDSPEAKERS];
+} CICP2GEOMETRY_CUSTOM_LAYOUT;
+
+static std::mutex customLayoutLock;
+static CICP2GEOMETRY_CUSTOM_LAYOUT customLayouts[CICP2GEOMETRY_MAX_CUSTOM_LAYOUTS];
+static int numCustomLayouts = 0;
+
+static int getCustomLayout(int cicpIndex, CICP2GEOMETRY_CHANNEL_GEOMETRY* AzElLfe,
+                           int* numChannels, int* numLFEs) {
+  std::lock_guard<std::mutex> lock(customLayoutLock);
+  const int i = cicpIndex - CICP2GEOMETRY_CICP_CUSTOM_FIRST;
+  int tmpLfe = 0;
+
+  if ((i < 0) || (i >= numCustomLayouts)) {
+    return 1;
+  }
+
+  for (int ii = 0; ii < customLayouts[i].numTotalChannels; ii++) {
+    if (AzElLfe != NULL) {
+      AzElLfe[ii] = customLayouts[i].AzElLfe[ii];
+    }
+    if (customLayouts[i].AzElLfe[ii].LFE) {
+      tmpLfe++;
+    }
+  }
+  *numChannels = customLayouts[i].numTotalChannels - tmpLfe;
+  *numLFEs = tmpLfe;
+
+  return 0;
+}
+
+CICP2GEOMETRY_ERROR cicp2geometry_register_custom_layout(
+    const CICP2GEOMETRY_CHANNEL_GEOMETRY* AzElLfe, int numTotalChannels, int* cicpIndex) {
+  CICP2GEOMETRY_CHANNEL_GEOMETRY tmpAzElLfe[CICP2GEOMETRY_MAX_LOUDSPEAKERS];
+  const int numTableEntries = (int)(sizeof(CICP2GEOMETRY_CICP_LOUDSPEAKER_TABLE) /
+                                    sizeof(CICP2GEOMETRY_CICP_LOUDSPEAKER_TABLE[0]));
+  int numLFEs = 0;
+
+  if ((AzElLfe == NULL) || (cicpIndex == NULL)) {
+    return CICP2GEOMETRY_BAD_POINTER;
+  }
+  *cicpIndex = CICP2GEOMETRY_CICP_INVALID;
+
+  if ((numTotalChannels <= 0) || (numTotalChannels > CICP2GEOMETRY_MAX_LOUDSPEAKERS)) {
+    return CICP2GEOMETRY_UNSUPPORTED_CHANNEL_COUNT;
+  }
+
+  mpegh_FDKmemclear(tmpAzElLfe, sizeof(tmpAzElLfe));
+  for (int ch = 0; ch < numTotalChannels; ch++) {
+    if ((AzElLfe[ch].Az < -180) || (AzElLfe[ch].Az > 180)) {
+      return CICP2GEOMETRY_INVALID_AZIMITH;
+    }
+    if ((AzElLfe[ch].El < -90) || (AzElLfe[ch].El > 90)) {
+      return CICP2GEOMETRY_INVALID_ELEVATION;
+    }
+    if ((AzElLfe[ch].LFE != 0) && (AzElLfe[ch].LFE != 1)) {
+      return CICP2GEOMETRY_INVALID_LFE_FLAG;
+    }
+
+    tmpAzElLfe[ch].cicpLoudspeakerIndex = -1;
+    tmpAzElLfe[ch].Az = AzElLfe[ch].Az;
+    tmpAzElLfe[ch].El = AzElLfe[ch].El;
+    tmpAzElLfe[ch].LFE = AzElLfe[ch].LFE;
+    tmpAzElLfe[ch].loudspeakerType = CICP2GEOMETRY_LOUDSPEAKER_UNKNOWN;
+    numLFEs += AzElLfe[ch].LFE;
+
+    /* label the loudspeaker with its CICP loudspeaker index, if it has a CICP position */
+    for (int t = 0; t < numTableEntries; t++) {
+      if ((CICP2GEOMETRY_CICP_LOUDSPEAKER_TABLE[t].loudspeakerType ==
+           CICP2GEOMETRY_LOUDSPEAKER_KNOWN) &&
+          (matchLoudspeakers(CICP2GEOMETRY_CICP_LOUDSPEAKER_TABLE[t], tmpAzElLfe[ch]) == 0)) {
+        tmpAzElLfe[ch] = CICP2GEOMETRY_CICP_LOUDSPEAKER_TABLE[t];
+        break;
+      }
+    }
+  }
+
+  /* a CICP layout keeps its CICP index */
+  if (cicp2geometry_get_cicpIndex_from_geometry(tmpAzElLfe, numTotalChannels - numLFEs, numLFEs,
+                                                cicpIndex) == CICP2GEOMETRY_OK) {
+    return CICP2GEOMETRY_OK;
+  }
+
+  std::lock_guard<std::mutex> lock(customLayoutLock);
+
+  for (int i = 0; i < numCustomLayouts; i++) {
+    if ((customLayouts[i].numTotalChannels == numTotalChannels) &&
+        (matchLoudspeakerSetups(tmpAzElLfe, customLayouts[i].AzElLfe, numTotalChannels,
+                                numTotalChannels, 0, 0, numTotalChannels) == 0)) {
+      *cicpIndex = CICP2GEOMETRY_CICP_CUSTOM_FIRST + i;
+      return CICP2GEOMETRY_OK;
+    }
+  }
+
+  if (numCustomLayouts >= CICP2GEOMETRY_MAX_CUSTOM_LAYOUTS) {
+    return CICP2GEOMETRY_ALLOC_ERROR;
+  }
+
+  customLayouts[numCustomLayouts].numTotalChannels = numTotalChannels;
+  mpegh_FDKmemcpy(customLayouts[numCustomLayouts].AzElLfe, tmpAzElLfe, sizeof(tmpAzElLfe));
+  *cicpIndex = CICP2GEOMETRY_CICP_CUSTOM_FIRST + numCustomLayouts;
+  numCustomLayouts++;
+
+  return CICP2GEOMETRY_OK;
+}
+
+int cicp2geometry_is_custom_layout(int cicpIndex) {
+  std::lock_guard<std::mutex> lock(customLayoutLock);
+
+  return (cicpIndex >= CICP2GEOMETRY_CICP_CUSTOM_FIRST) &&
+         (cicpIndex < CICP2GEOMETRY_CICP_CUSTOM_FIRST + numCustomLayouts);
+}
+
 /**********************************************************************/ /**
 
  **************************************************************************/
@@ -1400,6 +1523,16 @@ CICP2GEOMETRY_ERROR cicp2geometry_get_cicpIndex_from_geometry(
 CICP2GEOMETRY_ERROR cicp2geometry_get_geometry_from_cicp(
     int cicpIndex, CICP2GEOMETRY_CHANNEL_GEOMETRY AzElLfe[CICP2GEOMETRY_MAX_LOUDSPEAKERS],
     int* numChannels, int* numLFEs) {
+  if (cicpIndex >= CICP2GEOMETRY_CICP_CUSTOM_FIRST) {
+    if (getCustomLayout(cicpIndex, AzElLfe, numChannels, numLFEs) == 0) {
+      return CICP2GEOMETRY_OK;
+    }
+    *numChannels = -1;
+    *numLFEs = -1;
+
+    return CICP2GEOMETRY_INVALID_CICP_INDEX;
+  }
+
   for (int i = 0; i < (int)(sizeof(CICP_speakerLayouts) / sizeof(CICP_speakerLayouts[0])); i++) {
     if (CICP_speakerLayouts[i].index == cicpIndex) {
       int tmpLfe = 0;
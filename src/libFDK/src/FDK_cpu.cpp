@@ -0,0 +1,171 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************* Library for basic calculation routines ********************
+
+   Author(s):
+
+   Description: Run-time detection of CPU features
+
+*******************************************************************************/
+
+#include "FDK_cpu.h"
+#include "FDK_archdef.h"
+
+#if defined(__x86__)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <cpuid.h>
+#endif
+#endif
+
+#if defined(__x86__) && (defined(_MSC_VER) || defined(__GNUC__))
+static void cpuid(UINT leaf, UINT subleaf, UINT regs[4]) {
+#if defined(_MSC_VER)
+  int r[4];
+  __cpuidex(r, (int)leaf, (int)subleaf);
+  regs[0] = (UINT)r[0];
+  regs[1] = (UINT)r[1];
+  regs[2] = (UINT)r[2];
+  regs[3] = (UINT)r[3];
+#else
+  unsigned int a, b, c, d;
+  __cpuid_count(leaf, subleaf, a, b, c, d);
+  regs[0] = a;
+  regs[1] = b;
+  regs[2] = c;
+  regs[3] = d;
+#endif
+}
+
+/* XCR0 register, tells which register states the OS saves on context switches */
+static UINT xgetbv0(void) {
+#if defined(_MSC_VER)
+  return (UINT)_xgetbv(0);
+#else
+  unsigned int a, d;
+  __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(a), "=d"(d) : "c"(0));
+  return a;
+#endif
+}
+
+static UINT detectCpuFeatures(void) {
+  UINT features = 0;
+  UINT regs[4];
+
+  cpuid(0, 0, regs);
+  UINT maxLeaf = regs[0];
+  if (maxLeaf < 1) return features;
+
+  cpuid(1, 0, regs);
+  if (regs[2] & (1 << 19)) features |= FDK_CPU_X86_SSE4_1;
+
+  /* AVX2 additionally requires the OS to preserve the ymm registers (OSXSAVE, XCR0 bits 1,2) */
+  if ((maxLeaf >= 7) && (regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) &&
+      ((xgetbv0() & 0x6) == 0x6)) {
+    cpuid(7, 0, regs);
+    if (regs[1] & (1 << 5)) features |= FDK_CPU_X86_AVX2;
+  }
+
+  return features;
+}
+#else
+static UINT detectCpuFeatures(void) {
+  return 0;
+}
+#endif
+
+UINT FDK_getCpuFeatures(void) {
+  /* thread-safe one-time initialization */
+  static const UINT cpuFeatures = detectCpuFeatures();
+  UINT features = cpuFeatures;
+
+#if defined(__X86_SSE4_1__)
+  features |= FDK_CPU_X86_SSE4_1;
+#endif
+#if defined(__X86_AVX2__)
+  features |= FDK_CPU_X86_AVX2;
+#endif
+
+  return features;
+}
@@ -0,0 +1,424 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************* Library for basic calculation routines ********************
+
+   Author(s):
+
+   Description: Run-time dispatch table for vector DSP primitives
+
+*******************************************************************************/
+
+#include "FDK_dsp.h"
+#include "FDK_cpu.h"
+#include "fixpoint_math.h"
+#include "scale.h"
+#include "cplx_mul.h"
+#include "fft_rad2.h"
+#include "scramble.h"
+
+/* Generic C kernels, used on CPUs without a specialized kernel and for the remainders of the
+   vectorized loops. */
+
+static void scaleValues_generic(FIXP_DBL* dst, const FIXP_DBL* src, INT len, INT scalefactor) {
+  INT i;
+
+  if (scalefactor == 0) {
+    if (dst != src) mpegh_FDKmemmove(dst, src, len * sizeof(FIXP_DBL));
+  } else if (scalefactor > 0) {
+    scalefactor = fixmin_I(scalefactor, (INT)DFRACT_BITS - 1);
+    for (i = 0; i < len; i++) {
+      dst[i] = src[i] << scalefactor;
+    }
+  } else {
+    INT negScalefactor = fixmin_I(-scalefactor, (INT)DFRACT_BITS - 1);
+    for (i = 0; i < len; i++) {
+      dst[i] = src[i] >> negScalefactor;
+    }
+  }
+}
+
+static void scaleValuesSaturate_generic(FIXP_DBL* dst, const FIXP_DBL* src, INT len,
+                                        INT scalefactor) {
+  INT i;
+
+  if (scalefactor == 0) {
+    if (dst != src) mpegh_FDKmemmove(dst, src, len * sizeof(FIXP_DBL));
+    return;
+  }
+
+  scalefactor = fixmax_I(fixmin_I(scalefactor, (INT)DFRACT_BITS - 1), (INT) - (DFRACT_BITS - 1));
+
+  for (i = 0; i < len; i++) {
+    dst[i] = scaleValueSaturate(src[i], scalefactor);
+  }
+}
+
+static INT getScalefactor_generic(const FIXP_DBL* vector, INT len) {
+  INT i;
+  LONG maxVal = 0;
+
+  for (i = 0; i < len; i++) {
+    LONG temp = (LONG)vector[i];
+    maxVal |= temp ^ (temp >> (DFRACT_BITS - 1));
+  }
+
+  return fixmax_I((INT)0, (INT)(fixnormz_D(maxVal) - 1));
+}
+
+static FIXP_DBL maxValue_generic(const FIXP_DBL* vector, UINT len) {
+  FIXP_DBL max = vector[0];
+
+  for (UINT i = 1; i < len; i++) {
+    max = fMax(max, vector[i]);
+  }
+
+  return max;
+}
+
+static void interleave_generic(const FIXP_DBL* RESTRICT pIn, LONG* RESTRICT pOut, UINT channels,
+                               UINT frameSize, UINT length) {
+  for (UINT ch = 0; ch < channels; ch++) {
+    const FIXP_DBL* In = &pIn[ch * frameSize];
+    LONG* Out = &pOut[ch];
+    for (UINT sample = 0; sample < length; sample++) {
+      *Out = (LONG)(*In++);
+      Out += channels;
+    }
+  }
+}
+
+static void addGainRamp_generic(FIXP_DBL* RESTRICT pOut, const FIXP_DBL* RESTRICT pIn,
+                                UINT length, FIXP_DBL scale, FIXP_DBL step, INT shl, INT shr) {
+  for (UINT i = 0; i < length; i++) {
+    scale = scale + step;
+    pOut[i] += (fMult(pIn[i], scale) << shl) >> shr;
+  }
+}
+
+static void addGainRampMulti_generic(FIXP_DBL* RESTRICT pOut, const FIXP_DBL* RESTRICT pIn,
+                                     UINT length, FDK_GAIN_RAMP* RESTRICT ramps, UINT numRamps) {
+  for (UINT n = 0; n < numRamps; n++) {
+    FIXP_DBL* RESTRICT out = &pOut[ramps[n].offset];
+    const FIXP_DBL gain = ramps[n].gain;
+    const FIXP_DBL step = ramps[n].step;
+    const INT shl = ramps[n].shl;
+    const INT shr = ramps[n].shr;
+
+    if (step == (FIXP_DBL)0) {
+      for (UINT i = 0; i < length; i++) {
+        out[i] += (fMult(pIn[i], gain) << shl) >> shr;
+      }
+    } else {
+      addGainRamp_generic(out, pIn, length, gain, step, shl, shr);
+      ramps[n].gain = (FIXP_DBL)((ULONG)gain + (ULONG)step * length);
+    }
+  }
+}
+
+static void addSaturateShl_generic(FIXP_DBL* RESTRICT pOut, const FIXP_DBL* RESTRICT pIn,
+                                   UINT length, INT shl) {
+  for (UINT i = 0; i < length; i++) {
+    pOut[i] = fAddSaturate(pOut[i], SATURATE_LEFT_SHIFT(pIn[i], shl, DFRACT_BITS));
+  }
+}
+
+/* The table contains the range im=]0-45], re=]90-45] degrees of the sine window in range
+   ]0-180[ degrees. */
+static void stftSineWindowing_generic(const FIXP_DBL* RESTRICT audioInputTime,
+                                      FIXP_DBL* RESTRICT audioInputTimePrev,
+                                      FIXP_DBL* RESTRICT audioOutputFreq, UINT fftSize,
+                                      const FIXP_WTP* RESTRICT sinetab) {
+  for (UINT j = 0; j < fftSize / 4; j++) {
+    FIXP_DBL time0, time1;
+    FIXP_WTP w = sinetab[j];
+    audioOutputFreq[j] = fMult(audioInputTimePrev[j], w.v.im);
+    audioOutputFreq[fftSize / 2 - 1 - j] = fMult(audioInputTimePrev[fftSize / 2 - 1 - j], w.v.re);
+    time0 = audioInputTime[j];
+    time1 = audioInputTime[fftSize / 2 - 1 - j];
+    audioOutputFreq[fftSize / 2 + j] = fMult(time0, w.v.re);
+    audioOutputFreq[fftSize - 1 - j] = fMult(time1, w.v.im);
+    audioInputTimePrev[j] = time0;
+    audioInputTimePrev[fftSize / 2 - 1 - j] = time1;
+  }
+}
+
+static void stftOverlapAdd_generic(const FIXP_DBL* RESTRICT audioInputTime,
+                                   FIXP_DBL* RESTRICT audioInputTimePrev,
+                                   FIXP_DBL* RESTRICT audioOutputTime, UINT fftSize,
+                                   const FIXP_WTP* RESTRICT sinetab) {
+  for (UINT j = 0; j < fftSize / 4; j++) {
+    FIXP_WTP w = sinetab[j];
+    audioOutputTime[j] +=
+        fAddSaturate(fMult(audioInputTime[j] << 8, w.v.im), audioInputTimePrev[j]);
+    audioInputTimePrev[j] = fMult(audioInputTime[fftSize / 2 + j] << 8, w.v.re);
+
+    audioOutputTime[fftSize / 2 - 1 - j] +=
+        fAddSaturate(fMult(audioInputTime[fftSize / 2 - 1 - j] << 8, w.v.re),
+                     audioInputTimePrev[fftSize / 2 - 1 - j]);
+    audioInputTimePrev[fftSize / 2 - 1 - j] = fMult(audioInputTime[fftSize - 1 - j] << 8, w.v.im);
+  }
+}
+
+static void stftDmxBands_generic(FIXP_DBL* RESTRICT pOut, const FIXP_DBL* RESTRICT pIn,
+                                 FIXP_DBL* RESTRICT energy, const UINT* RESTRICT bandEnd,
+                                 const FIXP_DBL* RESTRICT coeff, const INT* RESTRICT hdr,
+                                 const INT* RESTRICT shr, UINT numBands) {
+  UINT k = 0;
+
+  if (energy == NULL) {
+    for (UINT b = 0; b < numBands; b++) {
+      for (; k < bandEnd[b]; k++) {
+        pOut[2 * k + 0] = fAddSaturate(pOut[2 * k + 0], fMult(coeff[b], pIn[2 * k + 0]));
+        pOut[2 * k + 1] = fAddSaturate(pOut[2 * k + 1], fMult(coeff[b], pIn[2 * k + 1]));
+      }
+    }
+    return;
+  }
+
+  for (UINT b = 0; b < numBands; b++) {
+    FIXP_DBL ene = energy[b];
+
+    for (; k < bandEnd[b]; k++) {
+      FIXP_DBL tmpRe = fMult(coeff[b], pIn[2 * k + 0] << hdr[b]);
+      FIXP_DBL tmpIm = fMult(coeff[b], pIn[2 * k + 1] << hdr[b]);
+      pOut[2 * k + 0] = fAddSaturate(pOut[2 * k + 0], tmpRe >> hdr[b]);
+      pOut[2 * k + 1] = fAddSaturate(pOut[2 * k + 1], tmpIm >> hdr[b]);
+      ene += (fPow2Div2(tmpRe) + fPow2Div2(tmpIm)) >> shr[b];
+    }
+    energy[b] = ene;
+  }
+}
+
+/* EQ gain of one band, the computation of computeEQAndClip() of the STFT active downmix */
+static FIXP_DBL stftDmxEqBand(FIXP_DBL targetEne, FIXP_DBL realizedEne, INT diffExp,
+                              INT eqExpOffset, INT* eqExp) {
+  const FIXP_DBL eqLimitMax = FL2FXCONST_DBL(2.511886432f / 4.0f); /* +8 dB with exp = 2 */
+  const FIXP_DBL eqLimitMin = FL2FXCONST_DBL(0.316227766f / 4.0f); /* -10 dB with exp = 2 */
+  FIXP_DBL num = fMax(targetEne, (FIXP_DBL)1);
+  FIXP_DBL den = fMax(realizedEne, (FIXP_DBL)1);
+  INT normNum = CntLeadingZeros(num) - 1;
+  INT normDen = CntLeadingZeros(den) - 1;
+  INT expSqrt, exp, scale;
+  FIXP_DBL eq;
+
+  eq = schur_div((num << normNum) >> 1, den << normDen, FRACT_BITS);
+  exp = normDen - normNum + 1 + diffExp;
+
+  /* make the exponent even */
+  eq >>= exp & 1;
+  exp += exp & 1;
+
+  eq = fMult(eq, invSqrtNorm2(eq, &expSqrt));
+  exp = expSqrt + (exp / 2);
+
+  eq = scaleValueSaturate(eq, exp - 2);
+  eq = fMax(fMin(eq, eqLimitMax), eqLimitMin);
+  scale = CountLeadingBits(eq);
+
+  *eqExp = 2 - scale + eqExpOffset;
+  return eq << scale;
+}
+
+static void stftDmxEq_generic(FIXP_DBL* RESTRICT eq, SCHAR* RESTRICT eqExp,
+                              const FIXP_DBL* RESTRICT targetEne,
+                              const FIXP_DBL* RESTRICT realizedEne,
+                              const SCHAR* RESTRICT targetHdr, const SCHAR* RESTRICT realizedHdr,
+                              INT eqExpOffset, UINT numBands) {
+  for (UINT b = 0; b < numBands; b++) {
+    INT exp;
+    eq[b] = stftDmxEqBand(targetEne[b], realizedEne[b], realizedHdr[b] - targetHdr[b],
+                          eqExpOffset, &exp);
+    eqExp[b] = (SCHAR)exp;
+  }
+}
+
+/* The twiddle loops of dct_IV() */
+static void dctIVPreTwiddle_generic(FIXP_DBL* pDat, INT L, const FIXP_WTP* twiddle) {
+  const INT M = L >> 1;
+  FIXP_DBL* pDat_0 = &pDat[0];
+  FIXP_DBL* pDat_1 = &pDat[L - 2];
+  INT i;
+
+  for (i = 0; i < M - 1; i += 2, pDat_0 += 2, pDat_1 -= 2) {
+    FIXP_DBL accu1, accu2, accu3, accu4;
+
+    accu1 = pDat_1[1];
+    accu2 = pDat_0[0];
+    accu3 = pDat_0[1];
+    accu4 = pDat_1[0];
+
+    cplxMultDiv2(&accu1, &accu2, accu1, accu2, twiddle[i]);
+    cplxMultDiv2(&accu3, &accu4, accu4, accu3, twiddle[i + 1]);
+
+    pDat_0[0] = accu2 >> 1;
+    pDat_0[1] = accu1 >> 1;
+    pDat_1[0] = accu4 >> 1;
+    pDat_1[1] = -(accu3 >> 1);
+  }
+  if (M & 1) {
+    FIXP_DBL accu1, accu2;
+
+    accu1 = pDat_1[1];
+    accu2 = pDat_0[0];
+
+    cplxMultDiv2(&accu1, &accu2, accu1, accu2, twiddle[i]);
+
+    pDat_0[0] = accu2 >> 1;
+    pDat_0[1] = accu1 >> 1;
+  }
+}
+
+static void dctIVPostTwiddle_generic(FIXP_DBL* pDat, INT L, const FIXP_STP* sin_twiddle,
+                                     INT sin_step) {
+  const INT M = L >> 1;
+  FIXP_DBL* pDat_0 = &pDat[0];
+  FIXP_DBL* pDat_1 = &pDat[L - 2];
+  FIXP_DBL accu1, accu2, accu3, accu4;
+  INT idx, i;
+
+  /* Sin and Cos values are 0.0f and 1.0f */
+  accu1 = pDat_1[0];
+  accu2 = pDat_1[1];
+
+  pDat_1[1] = -pDat_0[1];
+
+  for (idx = sin_step, i = 1; i < (M + 1) >> 1; i++, idx += sin_step) {
+    FIXP_STP twd = sin_twiddle[idx];
+    cplxMult(&accu3, &accu4, accu1, accu2, twd);
+    pDat_0[1] = accu3;
+    pDat_1[0] = accu4;
+
+    pDat_0 += 2;
+    pDat_1 -= 2;
+
+    cplxMult(&accu3, &accu4, pDat_0[1], pDat_0[0], twd);
+
+    accu1 = pDat_1[0];
+    accu2 = pDat_1[1];
+
+    pDat_1[1] = -accu3;
+    pDat_0[0] = accu4;
+  }
+
+  if ((M & 1) == 0) {
+    /* Last Sin and Cos value pair are the same */
+    accu1 = fMult(accu1, WTC(0x5a82799a));
+    accu2 = fMult(accu2, WTC(0x5a82799a));
+
+    pDat_1[0] = accu1 + accu2;
+    pDat_0[1] = accu1 - accu2;
+  }
+}
+
+/* The architecture specific kernels use the generic kernels for their remainders, so they are
+   included after them. */
+#if defined(__x86__)
+#include "x86/FDK_dsp_x86.cpp"
+#endif
+
+FDK_DSP_FUNCS FDK_dspFuncs = {scaleValues_generic,         scaleValuesSaturate_generic,
+                              getScalefactor_generic,      maxValue_generic,
+                              interleave_generic,          addGainRamp_generic,
+                              addGainRampMulti_generic,    addSaturateShl_generic,
+                              stftSineWindowing_generic,   stftOverlapAdd_generic,
+                              stftDmxBands_generic,        stftDmxEq_generic,
+                              dit_fft,                     dctIVPreTwiddle_generic,
+                              dctIVPostTwiddle_generic};
+
+static INT dspSelectKernels(void) {
+  UINT cpuFeatures = FDK_getCpuFeatures();
+
+#if defined(FUNCTION_FDK_dspInitArch)
+  FDK_dspInitArch(&FDK_dspFuncs, cpuFeatures);
+#else
+  (void)cpuFeatures;
+#endif
+
+  return 1;
+}
+
+void FDK_dspInit(void) {
+  /* thread-safe one-time initialization */
+  static const INT initialized = dspSelectKernels();
+  (void)initialized;
+}
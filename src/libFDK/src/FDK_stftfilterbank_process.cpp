@@ -95,6 +95,8 @@ amm-info@iis.fraunhofer.de
 
 #if defined(__arm__)
 #include "arm/FDK_stftfilterbank_process_arm.cpp"
+#elif defined(__x86__)
+#include "x86/FDK_stftfilterbank_process_x86.cpp"
 #endif
 
 /**********************************************************************************************************************************/
@@ -108,6 +108,10 @@ amm-info@iis.fraunhofer.de
 
 #if defined(__arm__)
 #include "arm/dct_arm.cpp"
+
+#elif defined(__x86__)
+#include "x86/dct_x86.cpp"
+
 #endif
 
 void dct_getTables(const FIXP_WTP** ptwiddle, const FIXP_STP** sin_twiddle, int* sin_step,
@@ -90,6 +90,7 @@ amm-info@iis.fraunhofer.de
 
 #include "fft_rad2.h"
 #include "FDK_tools_rom.h"
+#include "FDK_dsp.h"
 
 #define W_PiFOURTH STC(0x5a82799a)
 //#define W_PiFOURTH ((FIXP_DBL)(0x5a82799a))
@@ -189,19 +190,19 @@ void fft(int length, FIXP_DBL* pInput, INT* pScalefactor) {
   {
     switch (length) {
       case 64:
-        dit_fft(pInput, 6, mpegh_SineTable512, 512);
+        FDK_dspFuncs.ditFft(pInput, 6, mpegh_SineTable512, 512);
         *pScalefactor += SCALEFACTOR64;
         break;
       case 128:
-        dit_fft(pInput, 7, mpegh_SineTable512, 512);
+        FDK_dspFuncs.ditFft(pInput, 7, mpegh_SineTable512, 512);
         *pScalefactor += SCALEFACTOR128;
         break;
       case 256:
-        dit_fft(pInput, 8, mpegh_SineTable512, 512);
+        FDK_dspFuncs.ditFft(pInput, 8, mpegh_SineTable512, 512);
         *pScalefactor += SCALEFACTOR256;
         break;
       case 512:
-        dit_fft(pInput, 9, mpegh_SineTable512, 512);
+        FDK_dspFuncs.ditFft(pInput, 9, mpegh_SineTable512, 512);
         *pScalefactor += SCALEFACTOR512;
         break;
       default:
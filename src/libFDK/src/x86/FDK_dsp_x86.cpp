@@ -0,0 +1,1270 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************* Library for basic calculation routines ********************
+
+   Author(s):
+
+   Description: x86 SSE4.1/AVX2 kernels of the vector DSP primitives
+
+*******************************************************************************/
+
+#include "x86/FDK_x86_funcs.h"
+
+#if defined(FDK_X86_SIMD)
+#define FUNCTION_FDK_dspInitArch
+
+/* Each SSE4.1 kernel hands its remainder to the generic kernel, each AVX2 kernel hands its
+   remainder to the SSE4.1 kernel. */
+
+static FDK_TARGET_SSE4_1 void scaleValues_sse41(FIXP_DBL* dst, const FIXP_DBL* src, INT len,
+                                                INT scalefactor) {
+  INT i = 0;
+
+  if (scalefactor > 0) {
+    __m128i shift = _mm_cvtsi32_si128(fixmin_I(scalefactor, (INT)DFRACT_BITS - 1));
+    for (; i <= len - 4; i += 4) {
+      __m128i x = _mm_loadu_si128((const __m128i*)&src[i]);
+      _mm_storeu_si128((__m128i*)&dst[i], _mm_sll_epi32(x, shift));
+    }
+  } else if (scalefactor < 0) {
+    __m128i shift = _mm_cvtsi32_si128(fixmin_I(-scalefactor, (INT)DFRACT_BITS - 1));
+    for (; i <= len - 4; i += 4) {
+      __m128i x = _mm_loadu_si128((const __m128i*)&src[i]);
+      _mm_storeu_si128((__m128i*)&dst[i], _mm_sra_epi32(x, shift));
+    }
+  }
+
+  scaleValues_generic(&dst[i], &src[i], len - i, scalefactor);
+}
+
+static FDK_TARGET_AVX2 void scaleValues_avx2(FIXP_DBL* dst, const FIXP_DBL* src, INT len,
+                                             INT scalefactor) {
+  INT i = 0;
+
+  if (scalefactor > 0) {
+    __m128i shift = _mm_cvtsi32_si128(fixmin_I(scalefactor, (INT)DFRACT_BITS - 1));
+    for (; i <= len - 8; i += 8) {
+      __m256i x = _mm256_loadu_si256((const __m256i*)&src[i]);
+      _mm256_storeu_si256((__m256i*)&dst[i], _mm256_sll_epi32(x, shift));
+    }
+  } else if (scalefactor < 0) {
+    __m128i shift = _mm_cvtsi32_si128(fixmin_I(-scalefactor, (INT)DFRACT_BITS - 1));
+    for (; i <= len - 8; i += 8) {
+      __m256i x = _mm256_loadu_si256((const __m256i*)&src[i]);
+      _mm256_storeu_si256((__m256i*)&dst[i], _mm256_sra_epi32(x, shift));
+    }
+  }
+
+  scaleValues_sse41(&dst[i], &src[i], len - i, scalefactor);
+}
+
+/* Identical to scaleValueSaturate(): left shifts saturate to 0x7FFF.FFFF resp. 0x8000.0001,
+   right shifts clear negative values which would become -1 otherwise. */
+static FDK_TARGET_SSE4_1 void scaleValuesSaturate_sse41(FIXP_DBL* dst, const FIXP_DBL* src,
+                                                        INT len, INT scalefactor) {
+  INT i = 0;
+  INT sf = fixmax_I(fixmin_I(scalefactor, (INT)DFRACT_BITS - 1), (INT) - (DFRACT_BITS - 1));
+
+  if (sf > 0) {
+    __m128i shift = _mm_cvtsi32_si128(sf);
+    __m128i hi = _mm_set1_epi32((LONG)MAXVAL_DBL >> sf);
+    __m128i lo = _mm_set1_epi32((LONG)MINVAL_DBL >> sf);
+    __m128i max = _mm_set1_epi32(MAXVAL_DBL);
+    __m128i min = _mm_set1_epi32(MINVAL_DBL + 1);
+    for (; i <= len - 4; i += 4) {
+      __m128i x = _mm_loadu_si128((const __m128i*)&src[i]);
+      __m128i y = _mm_sll_epi32(x, shift);
+      y = _mm_blendv_epi8(y, max, _mm_cmpgt_epi32(x, hi));
+      y = _mm_max_epi32(_mm_blendv_epi8(y, min, _mm_cmpgt_epi32(lo, x)), min);
+      _mm_storeu_si128((__m128i*)&dst[i], y);
+    }
+  } else if (sf < 0) {
+    __m128i shift = _mm_cvtsi32_si128(-sf);
+    __m128i thr = _mm_set1_epi32(-(1 << (-sf - 1)) - 1);
+    __m128i zero = _mm_setzero_si128();
+    for (; i <= len - 4; i += 4) {
+      __m128i x = _mm_loadu_si128((const __m128i*)&src[i]);
+      __m128i y = _mm_sra_epi32(x, shift);
+      __m128i clear = _mm_and_si128(_mm_cmpgt_epi32(x, thr), _mm_cmpgt_epi32(zero, x));
+      _mm_storeu_si128((__m128i*)&dst[i], _mm_andnot_si128(clear, y));
+    }
+  }
+
+  scaleValuesSaturate_generic(&dst[i], &src[i], len - i, scalefactor);
+}
+
+static FDK_TARGET_AVX2 void scaleValuesSaturate_avx2(FIXP_DBL* dst, const FIXP_DBL* src, INT len,
+                                                     INT scalefactor) {
+  INT i = 0;
+  INT sf = fixmax_I(fixmin_I(scalefactor, (INT)DFRACT_BITS - 1), (INT) - (DFRACT_BITS - 1));
+
+  if (sf > 0) {
+    __m128i shift = _mm_cvtsi32_si128(sf);
+    __m256i hi = _mm256_set1_epi32((LONG)MAXVAL_DBL >> sf);
+    __m256i lo = _mm256_set1_epi32((LONG)MINVAL_DBL >> sf);
+    __m256i max = _mm256_set1_epi32(MAXVAL_DBL);
+    __m256i min = _mm256_set1_epi32(MINVAL_DBL + 1);
+    for (; i <= len - 8; i += 8) {
+      __m256i x = _mm256_loadu_si256((const __m256i*)&src[i]);
+      __m256i y = _mm256_sll_epi32(x, shift);
+      y = _mm256_blendv_epi8(y, max, _mm256_cmpgt_epi32(x, hi));
+      y = _mm256_max_epi32(_mm256_blendv_epi8(y, min, _mm256_cmpgt_epi32(lo, x)), min);
+      _mm256_storeu_si256((__m256i*)&dst[i], y);
+    }
+  } else if (sf < 0) {
+    __m128i shift = _mm_cvtsi32_si128(-sf);
+    __m256i thr = _mm256_set1_epi32(-(1 << (-sf - 1)) - 1);
+    __m256i zero = _mm256_setzero_si256();
+    for (; i <= len - 8; i += 8) {
+      __m256i x = _mm256_loadu_si256((const __m256i*)&src[i]);
+      __m256i y = _mm256_sra_epi32(x, shift);
+      __m256i clear = _mm256_and_si256(_mm256_cmpgt_epi32(x, thr), _mm256_cmpgt_epi32(zero, x));
+      _mm256_storeu_si256((__m256i*)&dst[i], _mm256_andnot_si256(clear, y));
+    }
+  }
+
+  scaleValuesSaturate_sse41(&dst[i], &src[i], len - i, scalefactor);
+}
+
+/* The headroom of a concatenation of vectors is the minimum of their headrooms. */
+static FDK_TARGET_SSE4_1 INT getScalefactor_sse41(const FIXP_DBL* vector, INT len) {
+  INT i = 0;
+  __m128i acc = _mm_setzero_si128();
+
+  for (; i <= len - 4; i += 4) {
+    __m128i x = _mm_loadu_si128((const __m128i*)&vector[i]);
+    acc = _mm_or_si128(acc, _mm_xor_si128(x, _mm_srai_epi32(x, 31)));
+  }
+  acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0x4E));
+  acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0xB1));
+
+  INT sf = fixmax_I((INT)0, (INT)(fixnormz_D((LONG)_mm_cvtsi128_si32(acc)) - 1));
+
+  return fixmin_I(sf, getScalefactor_generic(&vector[i], len - i));
+}
+
+static FDK_TARGET_AVX2 INT getScalefactor_avx2(const FIXP_DBL* vector, INT len) {
+  INT i = 0;
+  __m256i acc8 = _mm256_setzero_si256();
+
+  for (; i <= len - 8; i += 8) {
+    __m256i x = _mm256_loadu_si256((const __m256i*)&vector[i]);
+    acc8 = _mm256_or_si256(acc8, _mm256_xor_si256(x, _mm256_srai_epi32(x, 31)));
+  }
+  __m128i acc = _mm_or_si128(_mm256_castsi256_si128(acc8), _mm256_extracti128_si256(acc8, 1));
+  acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0x4E));
+  acc = _mm_or_si128(acc, _mm_shuffle_epi32(acc, 0xB1));
+
+  INT sf = fixmax_I((INT)0, (INT)(fixnormz_D((LONG)_mm_cvtsi128_si32(acc)) - 1));
+
+  return fixmin_I(sf, getScalefactor_sse41(&vector[i], len - i));
+}
+
+static FDK_TARGET_SSE4_1 FIXP_DBL maxValue_sse41(const FIXP_DBL* vector, UINT len) {
+  UINT i = 0;
+  __m128i max = _mm_set1_epi32(vector[0]);
+
+  for (; i + 4 <= len; i += 4) {
+    max = _mm_max_epi32(max, _mm_loadu_si128((const __m128i*)&vector[i]));
+  }
+  max = _mm_max_epi32(max, _mm_shuffle_epi32(max, 0x4E));
+  max = _mm_max_epi32(max, _mm_shuffle_epi32(max, 0xB1));
+
+  FIXP_DBL result = (FIXP_DBL)_mm_cvtsi128_si32(max);
+  for (; i < len; i++) {
+    result = fMax(result, vector[i]);
+  }
+
+  return result;
+}
+
+static FDK_TARGET_AVX2 FIXP_DBL maxValue_avx2(const FIXP_DBL* vector, UINT len) {
+  UINT i = 0;
+  __m256i max8 = _mm256_set1_epi32(vector[0]);
+
+  for (; i + 8 <= len; i += 8) {
+    max8 = _mm256_max_epi32(max8, _mm256_loadu_si256((const __m256i*)&vector[i]));
+  }
+  __m128i max = _mm_max_epi32(_mm256_castsi256_si128(max8), _mm256_extracti128_si256(max8, 1));
+  max = _mm_max_epi32(max, _mm_shuffle_epi32(max, 0x4E));
+  max = _mm_max_epi32(max, _mm_shuffle_epi32(max, 0xB1));
+
+  FIXP_DBL result = (FIXP_DBL)_mm_cvtsi128_si32(max);
+  if (i < len) {
+    result = fMax(result, maxValue_sse41(&vector[i], len - i));
+  }
+
+  return result;
+}
+
+static FDK_TARGET_SSE4_1 void interleave_sse41(const FIXP_DBL* RESTRICT pIn, LONG* RESTRICT pOut,
+                                               UINT channels, UINT frameSize, UINT length) {
+  UINT sample = 0;
+
+  if (channels == 2) {
+    const FIXP_DBL* In0 = &pIn[0];
+    const FIXP_DBL* In1 = &pIn[frameSize];
+    for (; sample + 4 <= length; sample += 4) {
+      __m128i l = _mm_loadu_si128((const __m128i*)&In0[sample]);
+      __m128i r = _mm_loadu_si128((const __m128i*)&In1[sample]);
+      _mm_storeu_si128((__m128i*)&pOut[2 * sample], _mm_unpacklo_epi32(l, r));
+      _mm_storeu_si128((__m128i*)&pOut[2 * sample + 4], _mm_unpackhi_epi32(l, r));
+    }
+  } else if ((channels & 3) == 0) {
+    /* transpose blocks of 4 channels x 4 samples, each row is contiguous in the output */
+    for (; sample + 4 <= length; sample += 4) {
+      for (UINT ch = 0; ch < channels; ch += 4) {
+        const FIXP_DBL* In = &pIn[ch * frameSize + sample];
+        __m128i c0 = _mm_loadu_si128((const __m128i*)&In[0 * frameSize]);
+        __m128i c1 = _mm_loadu_si128((const __m128i*)&In[1 * frameSize]);
+        __m128i c2 = _mm_loadu_si128((const __m128i*)&In[2 * frameSize]);
+        __m128i c3 = _mm_loadu_si128((const __m128i*)&In[3 * frameSize]);
+        __m128i t0 = _mm_unpacklo_epi32(c0, c1); /* c0[0] c1[0] c0[1] c1[1] */
+        __m128i t1 = _mm_unpacklo_epi32(c2, c3); /* c2[0] c3[0] c2[1] c3[1] */
+        __m128i t2 = _mm_unpackhi_epi32(c0, c1); /* c0[2] c1[2] c0[3] c1[3] */
+        __m128i t3 = _mm_unpackhi_epi32(c2, c3); /* c2[2] c3[2] c2[3] c3[3] */
+        LONG* Out = &pOut[sample * channels + ch];
+        _mm_storeu_si128((__m128i*)&Out[0 * channels], _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)&Out[1 * channels], _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)&Out[2 * channels], _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128((__m128i*)&Out[3 * channels], _mm_unpackhi_epi64(t2, t3));
+      }
+    }
+  }
+
+  /* remaining samples and channel configurations not covered above */
+  interleave_generic(&pIn[sample], &pOut[sample * channels], channels, frameSize, length - sample);
+}
+
+static FDK_TARGET_AVX2 void interleave_avx2(const FIXP_DBL* RESTRICT pIn, LONG* RESTRICT pOut,
+                                            UINT channels, UINT frameSize, UINT length) {
+  UINT sample = 0;
+
+  if (channels == 2) {
+    const FIXP_DBL* In0 = &pIn[0];
+    const FIXP_DBL* In1 = &pIn[frameSize];
+    for (; sample + 8 <= length; sample += 8) {
+      __m256i l = _mm256_loadu_si256((const __m256i*)&In0[sample]);
+      __m256i r = _mm256_loadu_si256((const __m256i*)&In1[sample]);
+      __m256i lo = _mm256_unpacklo_epi32(l, r); /* L0 R0 L1 R1 | L4 R4 L5 R5 */
+      __m256i hi = _mm256_unpackhi_epi32(l, r); /* L2 R2 L3 R3 | L6 R6 L7 R7 */
+      _mm256_storeu_si256((__m256i*)&pOut[2 * sample], _mm256_permute2x128_si256(lo, hi, 0x20));
+      _mm256_storeu_si256((__m256i*)&pOut[2 * sample + 8],
+                          _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+  }
+
+  interleave_sse41(&pIn[sample], &pOut[sample * channels], channels, frameSize, length - sample);
+}
+
+static FDK_TARGET_SSE4_1 void addGainRamp_sse41(FIXP_DBL* RESTRICT pOut,
+                                                const FIXP_DBL* RESTRICT pIn, UINT length,
+                                                FIXP_DBL scale, FIXP_DBL step, INT shl, INT shr) {
+  UINT i = 0;
+  __m128i cntShl = _mm_cvtsi32_si128(shl);
+  __m128i cntShr = _mm_cvtsi32_si128(shr);
+  __m128i scale4 = _mm_add_epi32(_mm_set1_epi32(scale),
+                                 _mm_mullo_epi32(_mm_set1_epi32(step), _mm_setr_epi32(1, 2, 3, 4)));
+  __m128i step4 = _mm_slli_epi32(_mm_set1_epi32(step), 2);
+
+  for (; i + 4 <= length; i += 4) {
+    __m128i x = FDK_mm_fMult_DD(_mm_loadu_si128((const __m128i*)&pIn[i]), scale4);
+    x = _mm_sra_epi32(_mm_sll_epi32(x, cntShl), cntShr);
+    _mm_storeu_si128((__m128i*)&pOut[i], _mm_add_epi32(_mm_loadu_si128((const __m128i*)&pOut[i]), x));
+    scale4 = _mm_add_epi32(scale4, step4);
+  }
+
+  scale = (FIXP_DBL)((ULONG)scale + (ULONG)step * i);
+  addGainRamp_generic(&pOut[i], &pIn[i], length - i, scale, step, shl, shr);
+}
+
+static FDK_TARGET_AVX2 void addGainRamp_avx2(FIXP_DBL* RESTRICT pOut, const FIXP_DBL* RESTRICT pIn,
+                                             UINT length, FIXP_DBL scale, FIXP_DBL step, INT shl,
+                                             INT shr) {
+  UINT i = 0;
+  __m128i cntShl = _mm_cvtsi32_si128(shl);
+  __m128i cntShr = _mm_cvtsi32_si128(shr);
+  __m256i scale8 = _mm256_add_epi32(
+      _mm256_set1_epi32(scale),
+      _mm256_mullo_epi32(_mm256_set1_epi32(step), _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8)));
+  __m256i step8 = _mm256_slli_epi32(_mm256_set1_epi32(step), 3);
+
+  for (; i + 8 <= length; i += 8) {
+    __m256i x = FDK_mm256_fMult_DD(_mm256_loadu_si256((const __m256i*)&pIn[i]), scale8);
+    x = _mm256_sra_epi32(_mm256_sll_epi32(x, cntShl), cntShr);
+    _mm256_storeu_si256((__m256i*)&pOut[i],
+                        _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)&pOut[i]), x));
+    scale8 = _mm256_add_epi32(scale8, step8);
+  }
+
+  scale = (FIXP_DBL)((ULONG)scale + (ULONG)step * i);
+  addGainRamp_sse41(&pOut[i], &pIn[i], length - i, scale, step, shl, shr);
+}
+
+static FDK_TARGET_SSE4_1 void addGainRampMulti_sse41(FIXP_DBL* RESTRICT pOut,
+                                                     const FIXP_DBL* RESTRICT pIn, UINT length,
+                                                     FDK_GAIN_RAMP* RESTRICT ramps,
+                                                     UINT numRamps) {
+  for (UINT n = 0; n < numRamps; n++) {
+    FIXP_DBL* RESTRICT out = &pOut[ramps[n].offset];
+    const FIXP_DBL gain = ramps[n].gain;
+    const FIXP_DBL step = ramps[n].step;
+
+    if (step == (FIXP_DBL)0) {
+      UINT i = 0;
+      __m128i cntShl = _mm_cvtsi32_si128(ramps[n].shl);
+      __m128i cntShr = _mm_cvtsi32_si128(ramps[n].shr);
+      __m128i gain4 = _mm_set1_epi32(gain);
+
+      for (; i + 4 <= length; i += 4) {
+        __m128i x = FDK_mm_fMult_DD(_mm_loadu_si128((const __m128i*)&pIn[i]), gain4);
+        x = _mm_sra_epi32(_mm_sll_epi32(x, cntShl), cntShr);
+        _mm_storeu_si128((__m128i*)&out[i],
+                         _mm_add_epi32(_mm_loadu_si128((const __m128i*)&out[i]), x));
+      }
+      addGainRamp_generic(&out[i], &pIn[i], length - i, gain, step, ramps[n].shl, ramps[n].shr);
+    } else {
+      addGainRamp_sse41(out, pIn, length, gain, step, ramps[n].shl, ramps[n].shr);
+      ramps[n].gain = (FIXP_DBL)((ULONG)gain + (ULONG)step * length);
+    }
+  }
+}
+
+static FDK_TARGET_AVX2 void addGainRampMulti_avx2(FIXP_DBL* RESTRICT pOut,
+                                                  const FIXP_DBL* RESTRICT pIn, UINT length,
+                                                  FDK_GAIN_RAMP* RESTRICT ramps, UINT numRamps) {
+  for (UINT n = 0; n < numRamps; n++) {
+    FIXP_DBL* RESTRICT out = &pOut[ramps[n].offset];
+    const FIXP_DBL gain = ramps[n].gain;
+    const FIXP_DBL step = ramps[n].step;
+
+    if (step == (FIXP_DBL)0) {
+      UINT i = 0;
+      __m128i cntShl = _mm_cvtsi32_si128(ramps[n].shl);
+      __m128i cntShr = _mm_cvtsi32_si128(ramps[n].shr);
+      __m256i gain8 = _mm256_set1_epi32(gain);
+
+      for (; i + 8 <= length; i += 8) {
+        __m256i x = FDK_mm256_fMult_DD(_mm256_loadu_si256((const __m256i*)&pIn[i]), gain8);
+        x = _mm256_sra_epi32(_mm256_sll_epi32(x, cntShl), cntShr);
+        _mm256_storeu_si256((__m256i*)&out[i],
+                            _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)&out[i]), x));
+      }
+      addGainRamp_sse41(&out[i], &pIn[i], length - i, gain, step, ramps[n].shl, ramps[n].shr);
+    } else {
+      addGainRamp_avx2(out, pIn, length, gain, step, ramps[n].shl, ramps[n].shr);
+      ramps[n].gain = (FIXP_DBL)((ULONG)gain + (ULONG)step * length);
+    }
+  }
+}
+
+static FDK_TARGET_SSE4_1 void addSaturateShl_sse41(FIXP_DBL* RESTRICT pOut,
+                                                   const FIXP_DBL* RESTRICT pIn, UINT length,
+                                                   INT shl) {
+  UINT i = 0;
+
+  for (; i + 4 <= length; i += 4) {
+    __m128i x = FDK_mm_shlSaturate_DD(_mm_loadu_si128((const __m128i*)&pIn[i]), shl);
+    _mm_storeu_si128((__m128i*)&pOut[i],
+                     FDK_mm_fAddSaturate_DD(_mm_loadu_si128((const __m128i*)&pOut[i]), x));
+  }
+
+  addSaturateShl_generic(&pOut[i], &pIn[i], length - i, shl);
+}
+
+static FDK_TARGET_AVX2 void addSaturateShl_avx2(FIXP_DBL* RESTRICT pOut,
+                                                const FIXP_DBL* RESTRICT pIn, UINT length,
+                                                INT shl) {
+  UINT i = 0;
+
+  for (; i + 8 <= length; i += 8) {
+    __m256i x = FDK_mm256_shlSaturate_DD(_mm256_loadu_si256((const __m256i*)&pIn[i]), shl);
+    _mm256_storeu_si256(
+        (__m256i*)&pOut[i],
+        FDK_mm256_fAddSaturate_DD(_mm256_loadu_si256((const __m256i*)&pOut[i]), x));
+  }
+
+  addSaturateShl_sse41(&pOut[i], &pIn[i], length - i, shl);
+}
+
+#if defined(WINDOWTABLE_16BIT)
+/* Each 4 packed window coefficients yield the fMult() factors im (upper half) and re (lower half
+   shifted up); the mirrored part of the window uses them in reversed order. */
+static FDK_TARGET_SSE4_1 void stftSineWindowing_sse41(const FIXP_DBL* RESTRICT audioInputTime,
+                                                      FIXP_DBL* RESTRICT audioInputTimePrev,
+                                                      FIXP_DBL* RESTRICT audioOutputFreq,
+                                                      UINT fftSize,
+                                                      const FIXP_WTP* RESTRICT sinetab) {
+  const UINT N2 = fftSize / 2;
+  const __m128i maskIm = _mm_set1_epi32((LONG)0xFFFF0000);
+
+  if ((fftSize & 15) != 0) {
+    stftSineWindowing_generic(audioInputTime, audioInputTimePrev, audioOutputFreq, fftSize,
+                              sinetab);
+    return;
+  }
+
+  for (UINT j = 0; j < fftSize / 4; j += 4) {
+    __m128i w = _mm_loadu_si128((const __m128i*)&sinetab[j]);
+    __m128i wIm = _mm_and_si128(w, maskIm);
+    __m128i wRe = _mm_slli_epi32(w, 16);
+    __m128i wImRev = _mm_shuffle_epi32(wIm, 0x1B);
+    __m128i wReRev = _mm_shuffle_epi32(wRe, 0x1B);
+
+    __m128i prev0 = _mm_loadu_si128((const __m128i*)&audioInputTimePrev[j]);
+    __m128i prev1 = _mm_loadu_si128((const __m128i*)&audioInputTimePrev[N2 - 4 - j]);
+    __m128i time0 = _mm_loadu_si128((const __m128i*)&audioInputTime[j]);
+    __m128i time1 = _mm_loadu_si128((const __m128i*)&audioInputTime[N2 - 4 - j]);
+
+    _mm_storeu_si128((__m128i*)&audioOutputFreq[j], FDK_mm_fMult_DD(prev0, wIm));
+    _mm_storeu_si128((__m128i*)&audioOutputFreq[N2 - 4 - j], FDK_mm_fMult_DD(prev1, wReRev));
+    _mm_storeu_si128((__m128i*)&audioOutputFreq[N2 + j], FDK_mm_fMult_DD(time0, wRe));
+    _mm_storeu_si128((__m128i*)&audioOutputFreq[fftSize - 4 - j], FDK_mm_fMult_DD(time1, wImRev));
+    _mm_storeu_si128((__m128i*)&audioInputTimePrev[j], time0);
+    _mm_storeu_si128((__m128i*)&audioInputTimePrev[N2 - 4 - j], time1);
+  }
+}
+
+static FDK_TARGET_SSE4_1 void stftOverlapAdd_sse41(const FIXP_DBL* RESTRICT audioInputTime,
+                                                   FIXP_DBL* RESTRICT audioInputTimePrev,
+                                                   FIXP_DBL* RESTRICT audioOutputTime,
+                                                   UINT fftSize,
+                                                   const FIXP_WTP* RESTRICT sinetab) {
+  const UINT N2 = fftSize / 2;
+  const __m128i maskIm = _mm_set1_epi32((LONG)0xFFFF0000);
+
+  if ((fftSize & 15) != 0) {
+    stftOverlapAdd_generic(audioInputTime, audioInputTimePrev, audioOutputTime, fftSize, sinetab);
+    return;
+  }
+
+  for (UINT j = 0; j < fftSize / 4; j += 4) {
+    __m128i w = _mm_loadu_si128((const __m128i*)&sinetab[j]);
+    __m128i wIm = _mm_and_si128(w, maskIm);
+    __m128i wRe = _mm_slli_epi32(w, 16);
+    __m128i wImRev = _mm_shuffle_epi32(wIm, 0x1B);
+    __m128i wReRev = _mm_shuffle_epi32(wRe, 0x1B);
+    __m128i x;
+
+    x = _mm_slli_epi32(_mm_loadu_si128((const __m128i*)&audioInputTime[j]), 8);
+    x = FDK_mm_fAddSaturate_DD(FDK_mm_fMult_DD(x, wIm),
+                               _mm_loadu_si128((const __m128i*)&audioInputTimePrev[j]));
+    _mm_storeu_si128((__m128i*)&audioOutputTime[j],
+                     _mm_add_epi32(_mm_loadu_si128((const __m128i*)&audioOutputTime[j]), x));
+
+    x = _mm_slli_epi32(_mm_loadu_si128((const __m128i*)&audioInputTime[N2 - 4 - j]), 8);
+    x = FDK_mm_fAddSaturate_DD(FDK_mm_fMult_DD(x, wReRev),
+                               _mm_loadu_si128((const __m128i*)&audioInputTimePrev[N2 - 4 - j]));
+    _mm_storeu_si128(
+        (__m128i*)&audioOutputTime[N2 - 4 - j],
+        _mm_add_epi32(_mm_loadu_si128((const __m128i*)&audioOutputTime[N2 - 4 - j]), x));
+
+    x = _mm_slli_epi32(_mm_loadu_si128((const __m128i*)&audioInputTime[N2 + j]), 8);
+    _mm_storeu_si128((__m128i*)&audioInputTimePrev[j], FDK_mm_fMult_DD(x, wRe));
+
+    x = _mm_slli_epi32(_mm_loadu_si128((const __m128i*)&audioInputTime[fftSize - 4 - j]), 8);
+    _mm_storeu_si128((__m128i*)&audioInputTimePrev[N2 - 4 - j], FDK_mm_fMult_DD(x, wImRev));
+  }
+}
+#endif /* defined(WINDOWTABLE_16BIT) */
+
+/* Energy of the bins of 8 weighted values: the sum of each value pair (re, im), valid in the even
+   lanes. */
+static FDK_FORCEINLINE FDK_TARGET_AVX2 __m256i stftDmxBinEnergy_avx2(__m256i t) {
+  __m256i pow2 = FDK_mm256_fMultDiv2_DD(t, t);
+  return _mm256_add_epi32(pow2, _mm256_shuffle_epi32(pow2, 0xB1));
+}
+
+/* Weighted accumulation without energy */
+static FDK_TARGET_AVX2 void stftDmxBandsNoEnergy_avx2(FIXP_DBL* RESTRICT pOut,
+                                                      const FIXP_DBL* RESTRICT pIn,
+                                                      const UINT* RESTRICT bandEnd,
+                                                      const FIXP_DBL* RESTRICT coeff,
+                                                      UINT numBands) {
+  const __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i pairIndex = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+  UINT b = 0, k = 0;
+
+  /* Bands of a single bin, 4 at once with the coefficient of each band in a lane pair */
+  for (; (b + 4 <= numBands) && (bandEnd[b + 3] == k + 4); b += 4, k += 4) {
+    __m256i c = _mm256_permutevar8x32_epi32(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)&coeff[b])), pairIndex);
+    __m256i t = FDK_mm256_fMult_DD(c, _mm256_loadu_si256((const __m256i*)&pIn[2 * k]));
+    _mm256_storeu_si256(
+        (__m256i*)&pOut[2 * k],
+        FDK_mm256_fAddSaturate_DD(_mm256_loadu_si256((const __m256i*)&pOut[2 * k]), t));
+  }
+
+  /* Bands of several bins, the last vector of a band is masked */
+  for (; b < numBands; b++) {
+    const UINT length = 2 * (bandEnd[b] - k);
+    const __m256i c = _mm256_set1_epi32(coeff[b]);
+    FIXP_DBL* RESTRICT out = &pOut[2 * k];
+    const FIXP_DBL* RESTRICT in = &pIn[2 * k];
+    UINT i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+      __m256i t = FDK_mm256_fMult_DD(c, _mm256_loadu_si256((const __m256i*)&in[i]));
+      _mm256_storeu_si256(
+          (__m256i*)&out[i],
+          FDK_mm256_fAddSaturate_DD(_mm256_loadu_si256((const __m256i*)&out[i]), t));
+    }
+    if (i < length) {
+      __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(length - i), laneIndex);
+      __m256i t = FDK_mm256_fMult_DD(c, _mm256_maskload_epi32(&in[i], mask));
+      _mm256_maskstore_epi32(
+          &out[i], mask, FDK_mm256_fAddSaturate_DD(_mm256_maskload_epi32(&out[i], mask), t));
+    }
+    k = bandEnd[b];
+  }
+}
+
+static FDK_TARGET_AVX2 void stftDmxBands_avx2(FIXP_DBL* RESTRICT pOut, const FIXP_DBL* RESTRICT pIn,
+                                              FIXP_DBL* RESTRICT energy,
+                                              const UINT* RESTRICT bandEnd,
+                                              const FIXP_DBL* RESTRICT coeff,
+                                              const INT* RESTRICT hdr, const INT* RESTRICT shr,
+                                              UINT numBands) {
+  const __m256i evenLanes = _mm256_setr_epi32(-1, 0, -1, 0, -1, 0, -1, 0);
+  const __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i pairIndex = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+  const __m256i evenIndex = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  UINT b = 0, k = 0;
+
+  if (energy == NULL) {
+    stftDmxBandsNoEnergy_avx2(pOut, pIn, bandEnd, coeff, numBands);
+    return;
+  }
+
+  /* Bands of a single bin, 4 at once with the parameters of each band in a lane pair */
+  for (; (b + 4 <= numBands) && (bandEnd[b + 3] == k + 4); b += 4, k += 4) {
+    __m256i c = _mm256_permutevar8x32_epi32(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)&coeff[b])), pairIndex);
+    __m256i h = _mm256_permutevar8x32_epi32(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)&hdr[b])), pairIndex);
+    __m256i e = _mm256_permutevar8x32_epi32(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)&shr[b])), pairIndex);
+    __m256i t = FDK_mm256_fMult_DD(
+        c, _mm256_sllv_epi32(_mm256_loadu_si256((const __m256i*)&pIn[2 * k]), h));
+
+    _mm256_storeu_si256(
+        (__m256i*)&pOut[2 * k],
+        FDK_mm256_fAddSaturate_DD(_mm256_loadu_si256((const __m256i*)&pOut[2 * k]),
+                                  _mm256_srav_epi32(t, h)));
+    e = _mm256_permutevar8x32_epi32(_mm256_srav_epi32(stftDmxBinEnergy_avx2(t), e), evenIndex);
+    _mm_storeu_si128((__m128i*)&energy[b],
+                     _mm_add_epi32(_mm_loadu_si128((const __m128i*)&energy[b]),
+                                   _mm256_castsi256_si128(e)));
+  }
+
+  /* Bands of several bins, the last vector of a band is masked */
+  for (; b < numBands; b++) {
+    const UINT length = 2 * (bandEnd[b] - k);
+    const __m256i c = _mm256_set1_epi32(coeff[b]);
+    const __m128i h = _mm_cvtsi32_si128(hdr[b]);
+    const __m128i e = _mm_cvtsi32_si128(shr[b]);
+    FIXP_DBL* RESTRICT out = &pOut[2 * k];
+    const FIXP_DBL* RESTRICT in = &pIn[2 * k];
+    __m256i ene = _mm256_setzero_si256();
+    __m128i ene4;
+    UINT i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+      __m256i t =
+          FDK_mm256_fMult_DD(c, _mm256_sll_epi32(_mm256_loadu_si256((const __m256i*)&in[i]), h));
+      _mm256_storeu_si256(
+          (__m256i*)&out[i],
+          FDK_mm256_fAddSaturate_DD(_mm256_loadu_si256((const __m256i*)&out[i]),
+                                    _mm256_sra_epi32(t, h)));
+      ene = _mm256_add_epi32(
+          ene, _mm256_and_si256(_mm256_sra_epi32(stftDmxBinEnergy_avx2(t), e), evenLanes));
+    }
+    if (i < length) {
+      __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(length - i), laneIndex);
+      __m256i t =
+          FDK_mm256_fMult_DD(c, _mm256_sll_epi32(_mm256_maskload_epi32(&in[i], mask), h));
+      _mm256_maskstore_epi32(&out[i], mask,
+                             FDK_mm256_fAddSaturate_DD(_mm256_maskload_epi32(&out[i], mask),
+                                                       _mm256_sra_epi32(t, h)));
+      ene = _mm256_add_epi32(ene, _mm256_and_si256(_mm256_sra_epi32(stftDmxBinEnergy_avx2(t), e),
+                                                   _mm256_and_si256(mask, evenLanes)));
+    }
+
+    ene4 = _mm_add_epi32(_mm256_castsi256_si128(ene), _mm256_extracti128_si256(ene, 1));
+    ene4 = _mm_add_epi32(ene4, _mm_shuffle_epi32(ene4, 0x4E));
+    ene4 = _mm_add_epi32(ene4, _mm_shuffle_epi32(ene4, 0xB1));
+    energy[b] = (FIXP_DBL)((ULONG)energy[b] + (ULONG)_mm_cvtsi128_si32(ene4));
+    k = bandEnd[b];
+  }
+}
+
+#if defined(FUNCTION_invSqrtNorm2)
+/* 8x CntLeadingZeros() of positive values. The float conversion of x & ~(x >> 1) cannot round up
+   to the next power of two, so its exponent is the position of the leading one. */
+static FDK_FORCEINLINE FDK_TARGET_AVX2 __m256i stftDmxClz_avx2(__m256i x) {
+  __m256 f = _mm256_cvtepi32_ps(_mm256_andnot_si256(_mm256_srli_epi32(x, 1), x));
+  return _mm256_sub_epi32(_mm256_set1_epi32(127 + 31), _mm256_srli_epi32(_mm256_castps_si256(f), 23));
+}
+
+/* 4x the truncated quotient (num * 2^31) / den in double precision, exact or 1 too large */
+static FDK_FORCEINLINE FDK_TARGET_AVX2 __m128i stftDmxDiv_avx2(__m128i num, __m128i den) {
+  __m256d q = _mm256_div_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(num), _mm256_set1_pd(2147483648.0)),
+                            _mm256_cvtepi32_pd(den));
+  return _mm256_cvttpd_epi32(q);
+}
+
+/* 8x invSqrtNorm2() of positive values, the same float and double operations as the x86 version.
+   frexpf() is taken from the bits of the float result. */
+static FDK_FORCEINLINE FDK_TARGET_AVX2 __m256i stftDmxInvSqrt_avx2(__m256i x, __m256i* shift) {
+  const __m256d one = _mm256_set1_pd(1.0);
+  __m256 half = _mm256_mul_ps(_mm256_cvtepi32_ps(x), _mm256_set1_ps(0.5f));
+  __m128 lo = _mm256_cvtpd_ps(
+      _mm256_div_pd(one, _mm256_sqrt_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(half)))));
+  __m128 hi = _mm256_cvtpd_ps(
+      _mm256_div_pd(one, _mm256_sqrt_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(half, 1)))));
+  __m256i r = _mm256_castps_si256(_mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1));
+
+  /* mantissa in [0.5, 1) scaled by 2^31, exponent plus 15 */
+  *shift = _mm256_sub_epi32(_mm256_srli_epi32(r, 23), _mm256_set1_epi32(126 - 15));
+  return _mm256_slli_epi32(_mm256_or_si256(_mm256_and_si256(r, _mm256_set1_epi32(0x007FFFFF)),
+                                           _mm256_set1_epi32(0x00800000)),
+                           7);
+}
+
+static FDK_TARGET_AVX2 void stftDmxEq_avx2(FIXP_DBL* RESTRICT eq, SCHAR* RESTRICT eqExp,
+                                           const FIXP_DBL* RESTRICT targetEne,
+                                           const FIXP_DBL* RESTRICT realizedEne,
+                                           const SCHAR* RESTRICT targetHdr,
+                                           const SCHAR* RESTRICT realizedHdr, INT eqExpOffset,
+                                           UINT numBands) {
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i eqLimitMax = _mm256_set1_epi32(FL2FXCONST_DBL(2.511886432f / 4.0f));
+  const __m256i eqLimitMin = _mm256_set1_epi32(FL2FXCONST_DBL(0.316227766f / 4.0f));
+  UINT b = 0;
+
+  for (; b + 8 <= numBands; b += 8) {
+    __m256i num = _mm256_max_epi32(_mm256_loadu_si256((const __m256i*)&targetEne[b]), one);
+    __m256i den = _mm256_max_epi32(_mm256_loadu_si256((const __m256i*)&realizedEne[b]), one);
+    __m256i normNum = _mm256_sub_epi32(stftDmxClz_avx2(num), one);
+    __m256i normDen = _mm256_sub_epi32(stftDmxClz_avx2(den), one);
+    __m256i exp =
+        _mm256_sub_epi32(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)&realizedHdr[b])),
+                         _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)&targetHdr[b])));
+    __m256i expSqrt, odd, eqVal, shl, shr, up;
+
+    exp = _mm256_add_epi32(exp, _mm256_add_epi32(_mm256_sub_epi32(normDen, normNum), one));
+
+    /* schur_div() of the x86 version, (num << 31) / den of the normalized energies (num < den).
+       The double quotient is at most 1 too large, which leaves a negative remainder. */
+    num = _mm256_srai_epi32(_mm256_sllv_epi32(num, normNum), 1);
+    den = _mm256_sllv_epi32(den, normDen);
+    eqVal = _mm256_set_m128i(stftDmxDiv_avx2(_mm256_extracti128_si256(num, 1),
+                                             _mm256_extracti128_si256(den, 1)),
+                             stftDmxDiv_avx2(_mm256_castsi256_si128(num),
+                                             _mm256_castsi256_si128(den)));
+    eqVal = _mm256_add_epi32(
+        eqVal, _mm256_srai_epi32(_mm256_sub_epi32(_mm256_slli_epi32(num, 31),
+                                                  _mm256_mullo_epi32(eqVal, den)),
+                                 31));
+
+    /* make the exponent even */
+    odd = _mm256_and_si256(exp, one);
+    eqVal = _mm256_srav_epi32(eqVal, odd);
+    exp = _mm256_add_epi32(exp, odd);
+
+    eqVal = FDK_mm256_fMult_DD(eqVal, stftDmxInvSqrt_avx2(eqVal, &expSqrt));
+    exp = _mm256_add_epi32(expSqrt, _mm256_srai_epi32(exp, 1));
+
+    /* scaleValueSaturate() by exp - 2 of a positive value, saturated if bits are shifted out */
+    exp = _mm256_sub_epi32(exp, _mm256_set1_epi32(2));
+    shl = _mm256_max_epi32(exp, zero);
+    shr = _mm256_max_epi32(_mm256_sub_epi32(zero, exp), zero);
+    up = _mm256_sllv_epi32(eqVal, shl);
+    up = _mm256_blendv_epi8(
+        up, _mm256_set1_epi32(MAXVAL_DBL),
+        _mm256_xor_si256(_mm256_cmpeq_epi32(_mm256_srav_epi32(up, shl), eqVal),
+                         _mm256_set1_epi32(-1)));
+    eqVal = _mm256_srav_epi32(up, shr);
+
+    eqVal = _mm256_max_epi32(_mm256_min_epi32(eqVal, eqLimitMax), eqLimitMin);
+    shl = _mm256_sub_epi32(stftDmxClz_avx2(eqVal), one);
+    _mm256_storeu_si256((__m256i*)&eq[b], _mm256_sllv_epi32(eqVal, shl));
+
+    exp = _mm256_sub_epi32(_mm256_set1_epi32(2 + eqExpOffset), shl);
+    __m128i exp16 = _mm_packs_epi32(_mm256_castsi256_si128(exp), _mm256_extracti128_si256(exp, 1));
+    _mm_storel_epi64((__m128i*)&eqExp[b], _mm_packs_epi16(exp16, exp16));
+  }
+
+  stftDmxEq_generic(&eq[b], &eqExp[b], &targetEne[b], &realizedEne[b], &targetHdr[b],
+                    &realizedHdr[b], eqExpOffset, numBands - b);
+}
+#endif /* defined(FUNCTION_invSqrtNorm2) */
+
+#if defined(SINETABLE_16BIT)
+/* The butterflies of a stage m are split in the same four groups as in the generic dit_fft(): the
+   bins k and k + mh / 2 of each group r use the same twiddle factor, the bins above mh / 4 use the
+   swapped factor of bin mh / 2 - k. The rotation of the second half (-j) is applied to the result
+   of the twiddle multiplication, so all bins are multiplied with the same product pattern. Integer
+   additions are exact, so the kernels are bit-exact with the generic code as long as every product
+   is the same. */
+
+/* Maximum ldn supported by the twiddle buffer of a stage */
+#define DIT_FFT_X86_MAX_LDN (10)
+
+/* Twiddle factors of the bins 0 ... mh / 2 - 1 of a stage, each replicated for re and im. Bin 0 is
+   a plain shift and gets no factor. */
+static void ditFftStageTwiddles(FIXP_DBL* RESTRICT wc, FIXP_DBL* RESTRICT ws, INT mh,
+                                const FIXP_STP* trigdata, INT trigstep) {
+  const FIXP_DBL w45 = FX_SGL2FX_DBL(STC(0x5a82799a));
+  INT j;
+
+  wc[0] = wc[1] = ws[0] = ws[1] = (FIXP_DBL)0;
+
+  for (j = 1; j < mh / 4; j++) {
+    FIXP_STP cs = trigdata[j * trigstep];
+    INT k = mh / 2 - j;
+
+    wc[2 * j] = wc[2 * j + 1] = FX_SGL2FX_DBL(cs.v.re);
+    ws[2 * j] = ws[2 * j + 1] = FX_SGL2FX_DBL(cs.v.im);
+    wc[2 * k] = wc[2 * k + 1] = FX_SGL2FX_DBL(cs.v.im);
+    ws[2 * k] = ws[2 * k + 1] = FX_SGL2FX_DBL(cs.v.re);
+  }
+
+  j = mh / 4;
+  wc[2 * j] = wc[2 * j + 1] = w45;
+  ws[2 * j] = ws[2 * j + 1] = w45;
+}
+
+/* Stage 1 + 2 (radix 4) of 2 * 4 complex values */
+static FDK_TARGET_SSE4_1 void ditFftRadix4_sse41(FIXP_DBL* x, INT n) {
+  for (INT i = 0; i < n * 2; i += 8) {
+    __m128i ab = _mm_loadu_si128((const __m128i*)&x[i + 0]);
+    __m128i cd = _mm_loadu_si128((const __m128i*)&x[i + 4]);
+
+    /* (a00, a20, a00, a20) and (a10, a30, a10, a30) */
+    __m128i s0 = _mm_srai_epi32(_mm_add_epi32(ab, _mm_shuffle_epi32(ab, 0x4E)), 1);
+    __m128i s1 = _mm_srai_epi32(_mm_add_epi32(cd, _mm_shuffle_epi32(cd, 0x4E)), 1);
+    /* A' and C' */
+    __m128i ac = _mm_unpacklo_epi64(_mm_add_epi32(s0, s1), _mm_sub_epi32(s0, s1));
+
+    /* (a00 - Re B, a20 - Im B) and (a10 - Re D, a30 - Im D) in the upper lanes */
+    __m128i d0 = _mm_sub_epi32(s0, ab);
+    __m128i d1 = _mm_shuffle_epi32(_mm_sub_epi32(s1, cd), 0xB1);
+    __m128i p = _mm_add_epi32(d0, d1);
+    __m128i q = _mm_sub_epi32(d0, d1);
+
+    /* B' = (p.re, q.im), D' = (q.re, p.im) */
+    _mm_storeu_si128((__m128i*)&x[i + 0], _mm_blend_epi16(ac, _mm_blend_epi16(p, q, 0xC0), 0xF0));
+    _mm_storeu_si128((__m128i*)&x[i + 4], _mm_blend_epi16(_mm_shuffle_epi32(ac, 0xEE),
+                                                          _mm_blend_epi16(q, p, 0xC0), 0xF0));
+  }
+}
+
+/* 2x twiddle product of a bin of the first half: (fMultDiv2(re, c) + fMultDiv2(im, s),
+   fMultDiv2(im, c) - fMultDiv2(re, s)) */
+static FDK_FORCEINLINE FDK_TARGET_SSE4_1 __m128i ditFftTwiddle_sse41(__m128i x, __m128i c,
+                                                                   __m128i s) {
+  __m128i p = FDK_mm_fMultDiv2_DD(x, c);
+  __m128i q = FDK_mm_fMultDiv2_DD(_mm_shuffle_epi32(x, 0xB1), s);
+  return _mm_blend_epi16(_mm_add_epi32(p, q), _mm_sub_epi32(p, q), 0xCC);
+}
+
+static FDK_TARGET_SSE4_1 void ditFftStage_sse41(FIXP_DBL* x, INT n, INT mh,
+                                                const FIXP_DBL* wc, const FIXP_DBL* ws) {
+  for (INT r = 0; r < n; r += 2 * mh) {
+    FIXP_DBL* x1 = &x[2 * r];
+    FIXP_DBL* x2 = &x[2 * (r + mh)];
+
+    for (INT k = 0; k < mh / 2; k += 2) {
+      __m128i c = _mm_loadu_si128((const __m128i*)&wc[2 * k]);
+      __m128i s = _mm_loadu_si128((const __m128i*)&ws[2 * k]);
+      __m128i u, v, a, b;
+
+      /* bins k */
+      a = _mm_loadu_si128((const __m128i*)&x1[2 * k]);
+      b = _mm_loadu_si128((const __m128i*)&x2[2 * k]);
+      v = ditFftTwiddle_sse41(b, c, s);
+      if (k == 0) v = _mm_blend_epi16(v, _mm_srai_epi32(b, 1), 0x0F);
+      u = _mm_srai_epi32(a, 1);
+      _mm_storeu_si128((__m128i*)&x1[2 * k], _mm_add_epi32(u, v));
+      _mm_storeu_si128((__m128i*)&x2[2 * k], _mm_sub_epi32(u, v));
+
+      /* bins k + mh / 2, rotated by -j */
+      a = _mm_loadu_si128((const __m128i*)&x1[2 * k + mh]);
+      b = _mm_loadu_si128((const __m128i*)&x2[2 * k + mh]);
+      v = ditFftTwiddle_sse41(b, c, s);
+      if (k == 0) v = _mm_blend_epi16(v, _mm_srai_epi32(b, 1), 0x0F);
+      u = _mm_srai_epi32(a, 1);
+      v = _mm_shuffle_epi32(v, 0xB1);
+      a = _mm_add_epi32(u, v);
+      b = _mm_sub_epi32(u, v);
+      _mm_storeu_si128((__m128i*)&x1[2 * k + mh], _mm_blend_epi16(a, b, 0xCC));
+      _mm_storeu_si128((__m128i*)&x2[2 * k + mh], _mm_blend_epi16(b, a, 0xCC));
+    }
+  }
+}
+
+static FDK_TARGET_SSE4_1 void ditFft_sse41(FIXP_DBL* x, const INT ldn, const FIXP_STP* trigdata,
+                                           const INT trigDataSize) {
+  const INT n = 1 << ldn;
+  FIXP_DBL wc[1 << (DIT_FFT_X86_MAX_LDN - 1)];
+  FIXP_DBL ws[1 << (DIT_FFT_X86_MAX_LDN - 1)];
+
+  if (ldn > DIT_FFT_X86_MAX_LDN) {
+    dit_fft(x, ldn, trigdata, trigDataSize);
+    return;
+  }
+
+  C_ALLOC_ALIGNED_CHECK(x);
+
+  scramble(x, n);
+  ditFftRadix4_sse41(x, n);
+
+  for (INT ldm = 3; ldm <= ldn; ++ldm) {
+    INT mh = 1 << (ldm - 1);
+    INT trigstep = ((trigDataSize << 2) >> ldm);
+
+    FDK_ASSERT(trigstep > 0);
+
+    ditFftStageTwiddles(wc, ws, mh, trigdata, trigstep);
+    ditFftStage_sse41(x, n, mh, wc, ws);
+  }
+}
+
+/* 4x twiddle product of a bin of the first half, see ditFftTwiddle_sse41() */
+static FDK_FORCEINLINE FDK_TARGET_AVX2 __m256i ditFftTwiddle_avx2(__m256i x, __m256i c,
+                                                                __m256i s) {
+  __m256i p = FDK_mm256_fMultDiv2_DD(x, c);
+  __m256i q = FDK_mm256_fMultDiv2_DD(_mm256_shuffle_epi32(x, 0xB1), s);
+  return _mm256_blend_epi32(_mm256_add_epi32(p, q), _mm256_sub_epi32(p, q), 0xAA);
+}
+
+/* Stage with mh >= 8 */
+static FDK_TARGET_AVX2 void ditFftStage_avx2(FIXP_DBL* x, INT n, INT mh, const FIXP_DBL* wc,
+                                             const FIXP_DBL* ws) {
+  for (INT r = 0; r < n; r += 2 * mh) {
+    FIXP_DBL* x1 = &x[2 * r];
+    FIXP_DBL* x2 = &x[2 * (r + mh)];
+
+    for (INT k = 0; k < mh / 2; k += 4) {
+      __m256i c = _mm256_loadu_si256((const __m256i*)&wc[2 * k]);
+      __m256i s = _mm256_loadu_si256((const __m256i*)&ws[2 * k]);
+      __m256i u, v, a, b;
+
+      /* bins k */
+      a = _mm256_loadu_si256((const __m256i*)&x1[2 * k]);
+      b = _mm256_loadu_si256((const __m256i*)&x2[2 * k]);
+      v = ditFftTwiddle_avx2(b, c, s);
+      if (k == 0) v = _mm256_blend_epi32(v, _mm256_srai_epi32(b, 1), 0x03);
+      u = _mm256_srai_epi32(a, 1);
+      _mm256_storeu_si256((__m256i*)&x1[2 * k], _mm256_add_epi32(u, v));
+      _mm256_storeu_si256((__m256i*)&x2[2 * k], _mm256_sub_epi32(u, v));
+
+      /* bins k + mh / 2, rotated by -j */
+      a = _mm256_loadu_si256((const __m256i*)&x1[2 * k + mh]);
+      b = _mm256_loadu_si256((const __m256i*)&x2[2 * k + mh]);
+      v = ditFftTwiddle_avx2(b, c, s);
+      if (k == 0) v = _mm256_blend_epi32(v, _mm256_srai_epi32(b, 1), 0x03);
+      u = _mm256_srai_epi32(a, 1);
+      v = _mm256_shuffle_epi32(v, 0xB1);
+      a = _mm256_add_epi32(u, v);
+      b = _mm256_sub_epi32(u, v);
+      _mm256_storeu_si256((__m256i*)&x1[2 * k + mh], _mm256_blend_epi32(a, b, 0xAA));
+      _mm256_storeu_si256((__m256i*)&x2[2 * k + mh], _mm256_blend_epi32(b, a, 0xAA));
+    }
+  }
+}
+
+static FDK_TARGET_AVX2 void ditFft_avx2(FIXP_DBL* x, const INT ldn, const FIXP_STP* trigdata,
+                                        const INT trigDataSize) {
+  const INT n = 1 << ldn;
+  FIXP_DBL wc[1 << (DIT_FFT_X86_MAX_LDN - 1)];
+  FIXP_DBL ws[1 << (DIT_FFT_X86_MAX_LDN - 1)];
+
+  if (ldn > DIT_FFT_X86_MAX_LDN) {
+    dit_fft(x, ldn, trigdata, trigDataSize);
+    return;
+  }
+
+  C_ALLOC_ALIGNED_CHECK(x);
+
+  scramble(x, n);
+  ditFftRadix4_sse41(x, n);
+
+  for (INT ldm = 3; ldm <= ldn; ++ldm) {
+    INT mh = 1 << (ldm - 1);
+    INT trigstep = ((trigDataSize << 2) >> ldm);
+
+    FDK_ASSERT(trigstep > 0);
+
+    ditFftStageTwiddles(wc, ws, mh, trigdata, trigstep);
+    if (mh >= 8) {
+      ditFftStage_avx2(x, n, mh, wc, ws);
+    } else {
+      ditFftStage_sse41(x, n, mh, wc, ws);
+    }
+  }
+}
+#endif /* defined(SINETABLE_16BIT) */
+
+#if defined(SINETABLE_16BIT) && defined(WINDOWTABLE_16BIT)
+/* The DCT-IV kernels compute the products of the generic twiddle loops lane by lane with the same
+   operands, so they are bit-exact with them. */
+
+/* Pre twiddling of the iterations i and i + 2, i.e. pDat[i ... i + 3] and pDat[L - 4 - i ... L - 1 -
+   i]. Each iteration multiplies (pDat[L - 1 - i], pDat[i]) by twiddle[i] and
+   (pDat[L - 2 - i], pDat[i + 1]) by twiddle[i + 1]. */
+static FDK_FORCEINLINE FDK_TARGET_SSE4_1 void dctIVPreTwiddleBlock_sse41(FIXP_DBL* pDat, INT L,
+                                                                       const FIXP_WTP* twiddle,
+                                                                       INT i) {
+  __m128i f = _mm_loadu_si128((const __m128i*)&pDat[i]);
+  __m128i b = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&pDat[L - 4 - i]), 0x4E);
+  __m128i w = _mm_loadu_si128((const __m128i*)&twiddle[i]);
+  __m128i c = _mm_slli_epi32(w, 16);
+  __m128i s = _mm_and_si128(w, _mm_set1_epi32((LONG)0xFFFF0000));
+  __m128i y, p, q, r0, r1;
+
+  /* (accu2, accu1) by twiddle[i] */
+  y = _mm_blend_epi16(f, b, 0xCC);
+  p = FDK_mm_fMultDiv2_DD(y, _mm_shuffle_epi32(c, 0xA0));
+  q = FDK_mm_fMultDiv2_DD(_mm_shuffle_epi32(y, 0xB1), _mm_shuffle_epi32(s, 0xA0));
+  r0 = _mm_blend_epi16(_mm_add_epi32(p, q), _mm_sub_epi32(p, q), 0xCC);
+
+  /* (accu4, accu3) by twiddle[i + 1] */
+  y = _mm_blend_epi16(b, f, 0xCC);
+  p = FDK_mm_fMultDiv2_DD(y, _mm_shuffle_epi32(c, 0xF5));
+  q = FDK_mm_fMultDiv2_DD(_mm_shuffle_epi32(y, 0xB1), _mm_shuffle_epi32(s, 0xF5));
+  r1 = _mm_blend_epi16(_mm_sub_epi32(p, q), _mm_add_epi32(p, q), 0xCC);
+  r1 = _mm_shuffle_epi32(_mm_srai_epi32(r1, 1), 0x1B);
+
+  _mm_storeu_si128((__m128i*)&pDat[i], _mm_srai_epi32(r0, 1));
+  _mm_storeu_si128((__m128i*)&pDat[L - 4 - i],
+                   _mm_blend_epi16(r1, _mm_sub_epi32(_mm_setzero_si128(), r1), 0xCC));
+}
+
+static FDK_TARGET_SSE4_1 void dctIVPreTwiddle_sse41(FIXP_DBL* pDat, INT L,
+                                                    const FIXP_WTP* twiddle) {
+  if ((L & 7) != 0) {
+    dctIVPreTwiddle_generic(pDat, L, twiddle);
+    return;
+  }
+
+  for (INT i = 0; i < (L >> 1); i += 4) {
+    dctIVPreTwiddleBlock_sse41(pDat, L, twiddle, i);
+  }
+}
+
+/* Post twiddling of the iterations i and i + 1 of the generic loop. back holds the unmodified
+   values pDat[L - 2 - 2 * i ... L + 1 - 2 * i], the values of the next two iterations are
+   returned. */
+static FDK_FORCEINLINE FDK_TARGET_SSE4_1 __m128i dctIVPostTwiddleBlock_sse41(
+    FIXP_DBL* pDat, INT L, const FIXP_STP* sin_twiddle, INT sin_step, INT i, __m128i back) {
+  __m128i f = _mm_loadu_si128((const __m128i*)&pDat[2 * i]);
+  __m128i b = _mm_shuffle_epi32(back, 0x4E);
+  __m128i w = _mm_set_epi32(sin_twiddle[(i + 1) * sin_step].w, sin_twiddle[(i + 1) * sin_step].w,
+                            sin_twiddle[i * sin_step].w, sin_twiddle[i * sin_step].w);
+  __m128i c = _mm_slli_epi32(w, 16);
+  __m128i s = _mm_and_si128(w, _mm_set1_epi32((LONG)0xFFFF0000));
+  __m128i p, q, ra, rb;
+
+  back = _mm_loadu_si128((const __m128i*)&pDat[L - 6 - 2 * i]);
+
+  /* (accu3, accu4) of (accu1, accu2) */
+  p = FDK_mm_fMult_DD(b, c);
+  q = FDK_mm_fMult_DD(_mm_shuffle_epi32(b, 0xB1), s);
+  ra = _mm_blend_epi16(_mm_sub_epi32(p, q), _mm_add_epi32(p, q), 0xCC);
+
+  /* (accu4, accu3) of (pDat_0[1], pDat_0[0]) */
+  p = FDK_mm_fMult_DD(f, c);
+  q = FDK_mm_fMult_DD(_mm_shuffle_epi32(f, 0xB1), s);
+  rb = _mm_blend_epi16(_mm_add_epi32(p, q), _mm_sub_epi32(p, q), 0xCC);
+
+  _mm_storeu_si128((__m128i*)&pDat[2 * i - 1],
+                   _mm_blend_epi16(ra, _mm_shuffle_epi32(rb, 0xA0), 0xCC));
+  rb = _mm_sub_epi32(_mm_setzero_si128(), _mm_shuffle_epi32(rb, 0xF5));
+  _mm_storeu_si128((__m128i*)&pDat[L - 3 - 2 * i],
+                   _mm_shuffle_epi32(_mm_blend_epi16(rb, ra, 0xCC), 0x4E));
+
+  return back;
+}
+
+/* Remaining iterations from i of the generic loop, accu1 and accu2 are the unmodified values
+   pDat[L - 2 * i] and pDat[L + 1 - 2 * i]. */
+static void dctIVPostTwiddleTail(FIXP_DBL* pDat, INT L, const FIXP_STP* sin_twiddle,
+                                 INT sin_step, INT i, FIXP_DBL accu1, FIXP_DBL accu2) {
+  const INT M = L >> 1;
+  FIXP_DBL* pDat_0 = &pDat[2 * (i - 1)];
+  FIXP_DBL* pDat_1 = &pDat[L - 2 * i];
+  FIXP_DBL accu3, accu4;
+
+  for (INT idx = i * sin_step; i < (M + 1) >> 1; i++, idx += sin_step) {
+    FIXP_STP twd = sin_twiddle[idx];
+    cplxMult(&accu3, &accu4, accu1, accu2, twd);
+    pDat_0[1] = accu3;
+    pDat_1[0] = accu4;
+
+    pDat_0 += 2;
+    pDat_1 -= 2;
+
+    cplxMult(&accu3, &accu4, pDat_0[1], pDat_0[0], twd);
+
+    accu1 = pDat_1[0];
+    accu2 = pDat_1[1];
+
+    pDat_1[1] = -accu3;
+    pDat_0[0] = accu4;
+  }
+
+  if ((M & 1) == 0) {
+    /* Last Sin and Cos value pair are the same */
+    accu1 = fMult(accu1, WTC(0x5a82799a));
+    accu2 = fMult(accu2, WTC(0x5a82799a));
+
+    pDat_1[0] = accu1 + accu2;
+    pDat_0[1] = accu1 - accu2;
+  }
+}
+
+static FDK_TARGET_SSE4_1 void dctIVPostTwiddle_sse41(FIXP_DBL* pDat, INT L,
+                                                     const FIXP_STP* sin_twiddle, INT sin_step) {
+  const INT M = L >> 1;
+  __m128i back = _mm_loadu_si128((const __m128i*)&pDat[L - 4]);
+  INT i;
+  if ((L & 7) != 0) {
+    dctIVPostTwiddle_generic(pDat, L, sin_twiddle, sin_step);
+    return;
+  }
+
+
+  pDat[L - 1] = -pDat[1];
+
+  for (i = 1; i + 1 < (M + 1) >> 1; i += 2) {
+    back = dctIVPostTwiddleBlock_sse41(pDat, L, sin_twiddle, sin_step, i, back);
+  }
+
+  dctIVPostTwiddleTail(pDat, L, sin_twiddle, sin_step, i, _mm_extract_epi32(back, 2),
+                       _mm_extract_epi32(back, 3));
+}
+
+static FDK_TARGET_AVX2 void dctIVPreTwiddle_avx2(FIXP_DBL* pDat, INT L, const FIXP_WTP* twiddle) {
+  const INT M = L >> 1;
+  const __m256i maskIm = _mm256_set1_epi32((LONG)0xFFFF0000);
+  INT i;
+  if ((L & 7) != 0) {
+    dctIVPreTwiddle_generic(pDat, L, twiddle);
+    return;
+  }
+
+
+  for (i = 0; i + 8 <= M; i += 8) {
+    __m256i f = _mm256_loadu_si256((const __m256i*)&pDat[i]);
+    __m256i b = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i*)&pDat[L - 8 - i]),
+                                         0x1B);
+    __m256i w = _mm256_loadu_si256((const __m256i*)&twiddle[i]);
+    __m256i c = _mm256_slli_epi32(w, 16);
+    __m256i s = _mm256_and_si256(w, maskIm);
+    __m256i y, p, q, r0, r1;
+
+    y = _mm256_blend_epi32(f, b, 0xAA);
+    p = FDK_mm256_fMultDiv2_DD(y, _mm256_shuffle_epi32(c, 0xA0));
+    q = FDK_mm256_fMultDiv2_DD(_mm256_shuffle_epi32(y, 0xB1), _mm256_shuffle_epi32(s, 0xA0));
+    r0 = _mm256_blend_epi32(_mm256_add_epi32(p, q), _mm256_sub_epi32(p, q), 0xAA);
+
+    y = _mm256_blend_epi32(b, f, 0xAA);
+    p = FDK_mm256_fMultDiv2_DD(y, _mm256_shuffle_epi32(c, 0xF5));
+    q = FDK_mm256_fMultDiv2_DD(_mm256_shuffle_epi32(y, 0xB1), _mm256_shuffle_epi32(s, 0xF5));
+    r1 = _mm256_blend_epi32(_mm256_sub_epi32(p, q), _mm256_add_epi32(p, q), 0xAA);
+    r1 = _mm256_shuffle_epi32(_mm256_srai_epi32(r1, 1), 0xB1);
+    r1 = _mm256_blend_epi32(r1, _mm256_sub_epi32(_mm256_setzero_si256(), r1), 0xAA);
+
+    _mm256_storeu_si256((__m256i*)&pDat[i], _mm256_srai_epi32(r0, 1));
+    _mm256_storeu_si256((__m256i*)&pDat[L - 8 - i], _mm256_permute4x64_epi64(r1, 0x1B));
+  }
+
+  if (i < M) {
+    dctIVPreTwiddleBlock_sse41(pDat, L, twiddle, i);
+  }
+}
+
+static FDK_TARGET_AVX2 void dctIVPostTwiddle_avx2(FIXP_DBL* pDat, INT L,
+                                                  const FIXP_STP* sin_twiddle, INT sin_step) {
+  const INT M = L >> 1;
+  __m256i back = _mm256_loadu_si256((const __m256i*)&pDat[L - 8]);
+  __m128i back4;
+  INT i;
+  if ((L & 7) != 0) {
+    dctIVPostTwiddle_generic(pDat, L, sin_twiddle, sin_step);
+    return;
+  }
+
+
+  pDat[L - 1] = -pDat[1];
+
+  /* iterations i ... i + 3, back holds the unmodified values pDat[L - 6 - 2 * i ...
+     L + 1 - 2 * i] */
+  for (i = 1; i + 3 < (M + 1) >> 1; i += 4) {
+    __m256i f = _mm256_loadu_si256((const __m256i*)&pDat[2 * i]);
+    __m256i b = _mm256_permute4x64_epi64(back, 0x1B);
+    __m256i w = _mm256_set_epi32(
+        sin_twiddle[(i + 3) * sin_step].w, sin_twiddle[(i + 3) * sin_step].w,
+        sin_twiddle[(i + 2) * sin_step].w, sin_twiddle[(i + 2) * sin_step].w,
+        sin_twiddle[(i + 1) * sin_step].w, sin_twiddle[(i + 1) * sin_step].w,
+        sin_twiddle[i * sin_step].w, sin_twiddle[i * sin_step].w);
+    __m256i c = _mm256_slli_epi32(w, 16);
+    __m256i s = _mm256_and_si256(w, _mm256_set1_epi32((LONG)0xFFFF0000));
+    __m256i p, q, ra, rb;
+
+    back = _mm256_loadu_si256((const __m256i*)&pDat[L - 14 - 2 * i]);
+
+    p = FDK_mm256_fMult_DD(b, c);
+    q = FDK_mm256_fMult_DD(_mm256_shuffle_epi32(b, 0xB1), s);
+    ra = _mm256_blend_epi32(_mm256_sub_epi32(p, q), _mm256_add_epi32(p, q), 0xAA);
+
+    p = FDK_mm256_fMult_DD(f, c);
+    q = FDK_mm256_fMult_DD(_mm256_shuffle_epi32(f, 0xB1), s);
+    rb = _mm256_blend_epi32(_mm256_add_epi32(p, q), _mm256_sub_epi32(p, q), 0xAA);
+
+    _mm256_storeu_si256((__m256i*)&pDat[2 * i - 1],
+                        _mm256_blend_epi32(ra, _mm256_shuffle_epi32(rb, 0xA0), 0xAA));
+    rb = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_shuffle_epi32(rb, 0xF5));
+    _mm256_storeu_si256((__m256i*)&pDat[L - 7 - 2 * i],
+                        _mm256_permute4x64_epi64(_mm256_blend_epi32(rb, ra, 0xAA), 0x1B));
+  }
+
+  back4 = _mm256_extracti128_si256(back, 1);
+  for (; i + 1 < (M + 1) >> 1; i += 2) {
+    back4 = dctIVPostTwiddleBlock_sse41(pDat, L, sin_twiddle, sin_step, i, back4);
+  }
+
+  dctIVPostTwiddleTail(pDat, L, sin_twiddle, sin_step, i, _mm_extract_epi32(back4, 2),
+                       _mm_extract_epi32(back4, 3));
+}
+#endif /* defined(SINETABLE_16BIT) && defined(WINDOWTABLE_16BIT) */
+
+static void FDK_dspInitArch(FDK_DSP_FUNCS* funcs, UINT cpuFeatures) {
+  if (cpuFeatures & FDK_CPU_X86_SSE4_1) {
+    funcs->scaleValues = scaleValues_sse41;
+    funcs->scaleValuesSaturate = scaleValuesSaturate_sse41;
+    funcs->getScalefactor = getScalefactor_sse41;
+    funcs->maxValue = maxValue_sse41;
+    funcs->interleave = interleave_sse41;
+    funcs->addGainRamp = addGainRamp_sse41;
+    funcs->addGainRampMulti = addGainRampMulti_sse41;
+    funcs->addSaturateShl = addSaturateShl_sse41;
+#if defined(WINDOWTABLE_16BIT)
+    funcs->stftSineWindowing = stftSineWindowing_sse41;
+    funcs->stftOverlapAdd = stftOverlapAdd_sse41;
+#endif
+#if defined(SINETABLE_16BIT)
+    funcs->ditFft = ditFft_sse41;
+#endif
+#if defined(SINETABLE_16BIT) && defined(WINDOWTABLE_16BIT)
+    funcs->dctIVPreTwiddle = dctIVPreTwiddle_sse41;
+    funcs->dctIVPostTwiddle = dctIVPostTwiddle_sse41;
+#endif
+  }
+  if ((cpuFeatures & FDK_CPU_X86_AVX2) && (cpuFeatures & FDK_CPU_X86_SSE4_1)) {
+    funcs->scaleValues = scaleValues_avx2;
+    funcs->scaleValuesSaturate = scaleValuesSaturate_avx2;
+    funcs->getScalefactor = getScalefactor_avx2;
+    funcs->maxValue = maxValue_avx2;
+    funcs->interleave = interleave_avx2;
+    funcs->addGainRamp = addGainRamp_avx2;
+    funcs->addGainRampMulti = addGainRampMulti_avx2;
+    funcs->addSaturateShl = addSaturateShl_avx2;
+    funcs->stftDmxBands = stftDmxBands_avx2;
+#if defined(FUNCTION_invSqrtNorm2)
+    funcs->stftDmxEq = stftDmxEq_avx2;
+#endif
+#if defined(SINETABLE_16BIT)
+    funcs->ditFft = ditFft_avx2;
+#endif
+#if defined(SINETABLE_16BIT) && defined(WINDOWTABLE_16BIT)
+    funcs->dctIVPreTwiddle = dctIVPreTwiddle_avx2;
+    funcs->dctIVPostTwiddle = dctIVPostTwiddle_avx2;
+#endif
+  }
+}
+
+#endif /* defined(FDK_X86_SIMD) */
@@ -0,0 +1,208 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************* Library for basic calculation routines ********************
+
+   Author(s):
+
+   Description: Scaling operations for x86, dispatched to the SSE4.1/AVX2
+                kernels of FDK_dspFuncs
+
+*******************************************************************************/
+
+/* prevent multiple inclusion with re-definitions */
+#ifndef __INCLUDE_SCALE_X86__
+#define __INCLUDE_SCALE_X86__
+
+#include "x86/FDK_x86_funcs.h"
+
+#if defined(FDK_X86_SIMD)
+#include "FDK_dsp.h"
+
+#define FUNCTION_scaleValues_DBL
+#define FUNCTION_scaleValues_DBLDBL
+#define FUNCTION_scaleValuesSaturate_DBL
+#define FUNCTION_scaleValuesSaturate_DBL_DBL
+#define FUNCTION_getScalefactor_DBL
+
+#ifdef FUNCTION_scaleValues_DBLDBL
+/*!
+ *
+ *  \brief  Multiply input vector src by \f$ 2^{scalefactor} \f$
+ *          and place result into dst, dst may be equal to src
+ *  \param dst detination buffer
+ *  \param src source buffer
+ *  \param len length of vector
+ *  \param scalefactor amount of left shifts to be applied
+ *  \return void
+ *
+ */
+SCALE_INLINE
+void mpegh_scaleValues(FIXP_DBL* dst,       /*!< dst Vector */
+                       const FIXP_DBL* src, /*!< src Vector */
+                       INT len,             /*!< Length */
+                       INT scalefactor      /*!< Scalefactor */
+) {
+  FDK_dspFuncs.scaleValues(dst, src, len, scalefactor);
+}
+#endif /* FUNCTION_scaleValues_DBLDBL */
+
+#ifdef FUNCTION_scaleValues_DBL
+/*!
+ *
+ *  \brief  Multiply input vector by \f$ 2^{scalefactor} \f$
+ *  \return void
+ *
+ */
+SCALE_INLINE
+void mpegh_scaleValues(FIXP_DBL* vector, /*!< Vector */
+                       INT len,          /*!< Length */
+                       INT scalefactor   /*!< Scalefactor */
+) {
+  if (scalefactor == 0) return;
+
+  FDK_dspFuncs.scaleValues(vector, vector, len, scalefactor);
+}
+#endif /* FUNCTION_scaleValues_DBL */
+
+#ifdef FUNCTION_scaleValuesSaturate_DBL_DBL
+/*!
+ *
+ *  \brief  Multiply input vector by \f$ 2^{scalefactor} \f$ with saturation, identical to
+ *          scaleValueSaturate() applied to each element
+ *  \param dst         destination buffer, may be equal to src
+ *  \param src         source buffer
+ *  \param len         length of vector
+ *  \param scalefactor amount of shifts to be applied
+ *  \return void
+ *
+ */
+SCALE_INLINE
+void mpegh_scaleValuesSaturate(FIXP_DBL* dst,       /*!< Output */
+                               const FIXP_DBL* src, /*!< Input   */
+                               INT len,             /*!< Length */
+                               INT scalefactor      /*!< Scalefactor */
+) {
+  FDK_dspFuncs.scaleValuesSaturate(dst, src, len, scalefactor);
+}
+#endif /* FUNCTION_scaleValuesSaturate_DBL_DBL */
+
+#ifdef FUNCTION_scaleValuesSaturate_DBL
+/*!
+ *
+ *  \brief  Multiply input vector by \f$ 2^{scalefactor} \f$ with saturation
+ *  \param vector      source/destination buffer
+ *  \param len         length of vector
+ *  \param scalefactor amount of shifts to be applied
+ *  \return void
+ *
+ */
+SCALE_INLINE
+void mpegh_scaleValuesSaturate(FIXP_DBL* vector, /*!< Vector */
+                               INT len,          /*!< Length */
+                               INT scalefactor   /*!< Scalefactor */
+) {
+  if (scalefactor == 0) return;
+
+  FDK_dspFuncs.scaleValuesSaturate(vector, vector, len, scalefactor);
+}
+#endif /* FUNCTION_scaleValuesSaturate_DBL */
+
+#ifdef FUNCTION_getScalefactor_DBL
+/*!
+ *
+ *  \brief Calculate max possible scale factor for input vector
+ *
+ *  \return Maximum scale factor
+ *
+ */
+SCALE_INLINE
+INT mpegh_getScalefactor(const FIXP_DBL* vector, /*!< Pointer to input vector */
+                         INT len)                /*!< Length of input vector */
+{
+  return FDK_dspFuncs.getScalefactor(vector, len);
+}
+#endif /* FUNCTION_getScalefactor_DBL */
+
+#endif /* defined(FDK_X86_SIMD) */
+
+#endif /* __INCLUDE_SCALE_X86__ */
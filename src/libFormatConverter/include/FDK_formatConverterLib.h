@@ -110,6 +110,15 @@ typedef enum {
   IIS_FORMATCONVERTER_MODE_CUSTOM_FREQ_DOMAIN_STFT = 6
 } IIS_FORMATCONVERTER_MODE;
 
+/** Quality/complexity tier of the STFT active downmix. The tiers above full quality share the EQ
+    of neighboring ERB bands and update it only every few STFT frames, in between the downmix is
+    applied with the held EQ without computing the signal energies. */
+typedef enum {
+  IIS_FORMATCONVERTER_DMX_TIER_FULL = 0,   /**< EQ of each of the 58 ERB bands, every frame */
+  IIS_FORMATCONVERTER_DMX_TIER_MEDIUM = 1, /**< EQ shared by 2 ERB bands, every 2nd frame */
+  IIS_FORMATCONVERTER_DMX_TIER_LOW = 2     /**< EQ shared by 4 ERB bands, every 4th frame */
+} IIS_FORMATCONVERTER_DMX_TIER;
+
 typedef struct {
   UINT numLocalSpeaker;
   INT pas;
@@ -158,6 +167,14 @@ int IIS_FormatConverter_Config_SetImmersiveDownmixFlag(IIS_FORMATCONVERTER_HANDL
 int IIS_FormatConverter_Config_SetRendering3DTypeFlag(IIS_FORMATCONVERTER_HANDLE self,
                                                       UINT rendering3DtypeFlag);
 
+/** Select the quality/complexity tier of the STFT active downmix. May be called before or after
+    IIS_FormatConverter_Open(), a change takes effect with the next STFT frame.
+
+    \return returns 0 for no error, -1 for an invalid tier.
+*/
+int IIS_FormatConverter_SetDmxTier(IIS_FORMATCONVERTER_HANDLE self,
+                                   IIS_FORMATCONVERTER_DMX_TIER tier);
+
 int IIS_FormatConverter_GetDelay(IIS_FORMATCONVERTER_HANDLE self, UINT* delay);
 /**  Call this open after all _Config_ methods have been called. The FormatConverter will then
    initialize itself acording to those settings.
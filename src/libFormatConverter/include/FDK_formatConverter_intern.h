@@ -288,6 +288,13 @@ typedef enum {
   FDK_FORMAT_CONVERTER_OUTPUT_FORMAT_GENERIC
 } FDK_FORMAT_CONVERTER_OUTPUT_FORMAT;
 
+/** Nonzero entry of the sorted downmix matrix, used by the passive time domain downmix. */
+typedef struct {
+  UCHAR inCh;
+  UCHAR outCh;
+  FIXP_DMX_H coef;
+} FC_DMX_COEF;
+
 typedef struct T_FORMAT_CONVERTER_PARAMS {
   /** Sampling rate. */
   INT samplingRate;
@@ -311,6 +318,9 @@ typedef struct T_FORMAT_CONVERTER_PARAMS {
   /** dmx matrix */
   FIXP_DMX_H** dmxMtx;
   FIXP_DMX_H* dmxMtx_sorted;
+  /** nonzero entries of dmxMtx_sorted in [in][out] order */
+  FC_DMX_COEF* dmxCoefList;
+  UINT dmxCoefCount;
   /* equalizer index vector [in][out]*/
   INT** eqIndexVec;
   INT* eqIndexVec_sorted;
@@ -380,6 +390,7 @@ typedef struct {
 
   UINT immersiveDownmixFlag;
   UINT rendering3DTypeFlag;
+  IIS_FORMATCONVERTER_DMX_TIER dmxTier;
 
   /* Candidates */
   IIS_FORMATCONVERTER_MODE mode;
@@ -0,0 +1,191 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************** MPEG-H 3DA channel rendering library *********************
+
+   Author(s):
+
+   Description: Process-wide cache of computed downmix plans
+
+*******************************************************************************/
+
+#ifndef FDK_FORMATCONVERTER_PLAN_H
+#define FDK_FORMATCONVERTER_PLAN_H
+
+#include "FDK_formatConverter.h"
+#include "common_fix.h"
+
+/** Number of downmix plans kept in the process-wide cache. */
+#define FDK_FORMAT_CONVERTER_PLAN_CACHE_SIZE (4)
+
+/** Everything a downmix plan is computed from. */
+typedef struct {
+  IIS_FORMATCONVERTER_MODE mode;
+  FDK_FORMAT_CONVERTER_INPUT_FORMAT fcInputFormat;
+  FDK_FORMAT_CONVERTER_OUTPUT_FORMAT fcOutputFormat;
+  UINT samplingRate;
+  UINT frameSize;
+  INT aes;
+  UINT pas;
+  UINT immersiveDownmixFlag;
+  UINT numTotalInputChannels;
+  UINT numOutputChannels;
+  CICP2GEOMETRY_CHANNEL_GEOMETRY inputChannelGeo[FDK_FORMAT_CONVERTER_MAX_INPUT_CHANNELS];
+  CICP2GEOMETRY_CHANNEL_GEOMETRY outChannelGeo[FDK_FORMAT_CONVERTER_MAX_OUTPUT_CHANNELS];
+} FC_DMX_PLAN_KEY;
+
+/** Result of IIS_FormatConverter_Open() for one FC_DMX_PLAN_KEY: the downmix matrices, the EQ
+ * parameters and the setup the STFT downmix depends on. */
+typedef struct {
+  FC_DMX_PLAN_KEY key;
+
+  IIS_FORMATCONVERTER_MODE mode;
+  FDK_FORMAT_CONVERTER_INPUT_FORMAT fcInputFormat;
+  FDK_FORMAT_CONVERTER_OUTPUT_FORMAT fcOutputFormat;
+  INT cicpLayoutIndex;
+  UINT outChannelVbapFlag;
+  UINT inChannelVbapFlag;
+
+  AFC_FORMAT_CONVERTER_CHANNEL_ID format_in_listOfChannels[FDK_FORMAT_CONVERTER_MAX_INPUT_CHANNELS];
+  int format_in_listOfChannels_nchan;
+  AFC_FORMAT_CONVERTER_CHANNEL_ID
+  format_out_listOfChannels[FDK_FORMAT_CONVERTER_MAX_OUTPUT_CHANNELS];
+  int format_out_listOfChannels_nchan;
+
+  FIXP_DBL GVH[13][6];
+  INT GVH_e[13][6];
+  FIXP_DBL GVL[13][6];
+  INT GVL_e[13][6];
+  UINT is4GVH_StftErb[58];
+  INT topIn[13];
+  UINT midOut[6];
+  UINT erb_is4GVH_L;
+  UINT erb_is4GVH_H;
+
+  FDK_converter_formatid_t formatConverterInputFormat_internal;
+  FDK_converter_formatid_t formatConverterOutputFormat_internal;
+  INT genericIOFmt;
+  INT dmxMtxIsSet;
+
+  FIXP_DMX_H dmxMtx[NCHANIN_MAX][NCHANOUT_MAX];
+  FIXP_DMX_H dmxMtxL[NCHANIN_MAX][NCHANOUT_MAX];
+  FIXP_DMX_H dmxMtx2[NCHANIN_MAX][NCHANOUT_MAX];
+  INT eqIndexVec[NCHANIN_MAX][NCHANOUT_MAX];
+  INT eqIndexVec2[NCHANIN_MAX][NCHANOUT_MAX];
+  converter_pr_t params_internal;
+} FC_DMX_PLAN;
+
+/** Fill the cache key from the configuration of a Format Converter that is about to be opened.
+    \param key Key to fill.
+    \param fcInt A handle to the internal Format Converter state struct.
+    \param pas Phase align strength. */
+void formatConverterGetPlanKey(FC_DMX_PLAN_KEY* key, IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt,
+                               const UINT pas);
+
+/** Copy a cached downmix plan.
+    \param key Configuration to look up.
+    \param plan Receives a copy of the plan.
+    \return Returns 0 if a plan was found, otherwise 1. */
+INT formatConverterLoadPlan(const FC_DMX_PLAN_KEY* key, FC_DMX_PLAN* plan);
+
+/** Store the downmix plan of a successfully opened Format Converter, replacing the least recently
+    used one if the cache is full.
+    \param key Configuration the Format Converter was opened with.
+    \param fcInt A handle to the internal Format Converter state struct. */
+void formatConverterStorePlan(const FC_DMX_PLAN_KEY* key,
+                              IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt);
+
+/** Restore the setup of a plan that decides how the Format Converter is allocated. To be called
+    before formatConverterOpen().
+    \param fcInt A handle to the internal Format Converter state struct.
+    \param plan Plan to restore. */
+void formatConverterApplyPlanSetup(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt,
+                                   const FC_DMX_PLAN* plan);
+
+/** Restore the downmix matrices and EQ parameters of a plan. To be called after
+    setFormatConverterParams().
+    \param fcInt A handle to the internal Format Converter state struct.
+    \param plan Plan to restore. */
+void formatConverterApplyPlanParams(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt,
+                                    const FC_DMX_PLAN* plan);
+
+#endif
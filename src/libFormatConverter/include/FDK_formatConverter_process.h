@@ -132,6 +132,8 @@ void formatConverterProcess_passive_timeDomain_frameLength(
     const DMXH_PCM* RESTRICT pIn, DMXH_PCM* RESTRICT pOut,
     IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt, const int inputBufferChannelOffset);
 
+void formatConverterSetDmxCoefList(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt);
+
 /**********************************************************************************************************************************/
 void formatConverter_process_STFT(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt);
 /**********************************************************************************************************************************/
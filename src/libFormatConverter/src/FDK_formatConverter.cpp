@@ -505,6 +505,7 @@ INT formatConverterAddDmxMtx(FIXP_DMX_H** dmxMtx, IIS_FORMATCONVERTER_INTERNAL_H
       fcInt->fcParams->dmxMtx_sorted[j++] = (fcInt->fcParams->dmxMtx[column][row]);
     }
   }
+  formatConverterSetDmxCoefList(fcInt);
 
   return 0;
 }
@@ -522,6 +523,7 @@ INT formatConverterSetDmxMtx(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt) {
       fcInt->fcParams->dmxMtx_sorted[j++] = (fcInt->fcParams->dmxMtx[column][row]);
     }
   }
+  formatConverterSetDmxCoefList(fcInt);
 
   /* DMX matrix is valid now */
   fcInt->fcParams->dmxMtxIsSet = 1;
@@ -649,6 +651,7 @@ INT setCustomDownmixParameters(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt, INT ad
                                INT phaseAlignStrength) {
   if (fcInt->mode == IIS_FORMATCONVERTER_MODE_CUSTOM_FREQ_DOMAIN_STFT) {
     activeDmxSetAES(adaptiveEQStrength, fcInt->fcState->handleActiveDmxStft);
+    activeDmxSetTier((UINT)fcInt->dmxTier, fcInt->fcState->handleActiveDmxStft);
   }
   return 0;
 }
@@ -93,8 +93,10 @@ amm-info@iis.fraunhofer.de
 #include "FDK_formatConverter_constants.h"
 #include "FDK_formatConverter_constants_stft.h"
 #include "FDK_formatConverter_api.h"
+#include "FDK_formatConverter_data.h"
 #include "FDK_formatConverter_init.h"
 #include "FDK_formatConverter_intern.h"
+#include "FDK_formatConverter_plan.h"
 #include "FDK_formatConverter_process.h"
 #include "FDK_stftfilterbank_api.h"
 
@@ -116,6 +118,8 @@ static INT _applyLfeRuleSet(CICP2GEOMETRY_CHANNEL_GEOMETRY* inputChannelGeo, UIN
 
 static INT _initSTFT(IIS_FORMATCONVERTER_INTERNAL* _p);
 
+static INT _openFromPlan(IIS_FORMATCONVERTER_HANDLE self, const FC_DMX_PLAN* plan);
+
 /**********************************************/
 /*                                            */
 /*           Initialization  Methods          */
@@ -193,6 +197,7 @@ INT IIS_FormatConverter_Create(IIS_FORMATCONVERTER_HANDLE* self, IIS_FORMATCONVE
   }
 
   _p->immersiveDownmixFlag = 0;
+  _p->dmxTier = IIS_FORMATCONVERTER_DMX_TIER_FULL;
 
   _p->cicpLayoutIndex = -1;
   _p->amountOfAddedDmxMatricesAndEqualizers = 0;
@@ -280,6 +285,22 @@ int IIS_FormatConverter_Config_SetRendering3DTypeFlag(IIS_FORMATCONVERTER_HANDLE
   return 0;
 }
 
+int IIS_FormatConverter_SetDmxTier(IIS_FORMATCONVERTER_HANDLE self,
+                                   IIS_FORMATCONVERTER_DMX_TIER tier) {
+  IIS_FORMATCONVERTER_INTERNAL* _p = (IIS_FORMATCONVERTER_INTERNAL*)self->member;
+  if ((UINT)tier > (UINT)IIS_FORMATCONVERTER_DMX_TIER_LOW) return -1;
+  if (_p == NULL) return -1;
+
+  _p->dmxTier = tier;
+
+  /* Apply to an opened active downmix, otherwise it is applied on open */
+  if ((_p->fcState != NULL) && (_p->fcState->handleActiveDmxStft != NULL)) {
+    activeDmxSetTier((UINT)tier, _p->fcState->handleActiveDmxStft);
+  }
+
+  return 0;
+}
+
 int IIS_FormatConverter_GetDelay(IIS_FORMATCONVERTER_HANDLE self, UINT* delay) {
   IIS_FORMATCONVERTER_INTERNAL* _p = (IIS_FORMATCONVERTER_INTERNAL*)self->member;
   /* stftFrameSize equals the delay caused by the FormatConverter.
@@ -309,6 +330,8 @@ int IIS_FormatConverter_Open(IIS_FORMATCONVERTER_HANDLE self, INT* p_buffer, UIN
   INT unknownOutCh_vec[FDK_FORMAT_CONVERTER_MAX_OUTPUT_CHANNELS];
   INT unknownInCh_vec[FDK_FORMAT_CONVERTER_MAX_INPUT_CHANNELS];
 
+  FC_DMX_PLAN_KEY planKey;
+
   _p = (IIS_FORMATCONVERTER_INTERNAL*)self->member;
   FDK_ASSERT(_p != NULL);
 
@@ -341,6 +364,15 @@ int IIS_FormatConverter_Open(IIS_FORMATCONVERTER_HANDLE self, INT* p_buffer, UIN
     goto FC_OPEN_CLEANUP_AND_RETURN;
   }
 
+  /* Reuse the downmix plan of an earlier Format Converter with the same configuration. The plan is
+   * copied to the work buffer, which is not needed for computing the plan anymore. */
+  formatConverterGetPlanKey(&planKey, _p, self->pas);
+  if ((buf_size >= sizeof(FC_DMX_PLAN)) &&
+      (formatConverterLoadPlan(&planKey, (FC_DMX_PLAN*)p_buffer) == 0)) {
+    err = _openFromPlan(self, (FC_DMX_PLAN*)p_buffer);
+    goto FC_OPEN_CLEANUP_AND_RETURN;
+  }
+
   cicp2geometry_get_number_of_lfes(_p->outChannelGeo, self->numLocalSpeaker, &numLfes);
 
   /* Error can be ignored, because _p->cicpLayoutIndex is only required to detect target layout 5
@@ -461,6 +493,8 @@ int IIS_FormatConverter_Open(IIS_FORMATCONVERTER_HANDLE self, INT* p_buffer, UIN
     }
   }
 
+  formatConverterStorePlan(&planKey, _p);
+
 FC_OPEN_CLEANUP_AND_RETURN:
 
   if (err == 0) {
@@ -922,6 +956,46 @@ bail:
   return err;
 }
 
+/* Open the Format Converter with a cached downmix plan instead of running the rule based matrix
+ * generation, the VBAP fallbacks and the EQ design of IIS_FormatConverter_Open() again. */
+static INT _openFromPlan(IIS_FORMATCONVERTER_HANDLE self, const FC_DMX_PLAN* plan) {
+  IIS_FORMATCONVERTER_INTERNAL* _p = (IIS_FORMATCONVERTER_INTERNAL*)self->member;
+  INT err;
+
+  formatConverterApplyPlanSetup(_p, plan);
+
+  err = formatConverterOpen(_p->mode, _p);
+  if (err != 0) {
+    return err;
+  }
+
+  if (_p->mode == IIS_FORMATCONVERTER_MODE_ACTIVE_FREQ_DOMAIN_STFT ||
+      _p->mode == IIS_FORMATCONVERTER_MODE_CUSTOM_FREQ_DOMAIN_STFT) {
+    err = _initSTFT(_p);
+    if (err) {
+      return err;
+    }
+  }
+
+  if (setFormatConverterParams(_p->fcCenterFrequencies, _p) != 0) {
+    return 1;
+  }
+  formatConverterApplyPlanParams(_p, plan);
+
+  if (setFormatConverterState(_p) != 0) {
+    return -1;
+  }
+
+  setCustomDownmixParameters(_p, self->aes, self->pas);
+
+  /* Generic/Immersive control code */
+  formatConverterDmxMatrixControl(_p);
+  /* Exponent calculation */
+  formatConverterDmxMatrixExponent(_p);
+
+  return 0;
+}
+
 INT FormatConverterFrame(IIS_FORMATCONVERTER_HANDLE FormatConverter, HANDLE_FDK_BITSTREAM hBitStr) {
   UINT rendering3DType = (UINT)FDKreadBit(hBitStr);
 
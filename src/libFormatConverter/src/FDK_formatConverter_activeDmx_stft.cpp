@@ -118,6 +118,7 @@ amm-info@iis.fraunhofer.de
  ***********************************************************************************/
 
 #include "FDK_formatConverter_activeDmx_stft.h"
+#include "FDK_dsp.h"
 
 INT activeDmxStftInit(void** handle, UINT numInChans, UINT numOutChans, FIXP_DBL** inputBufferStft,
                       FIXP_DBL** prevInputBufferStft, FIXP_DBL** outputBufferStft, INT aes) {
@@ -140,6 +141,8 @@ INT activeDmxStftInit(void** handle, UINT numInChans, UINT numOutChans, FIXP_DBL
   h->inputBufferStft = inputBufferStft;
   h->prevInputBufferStft = prevInputBufferStft;
   h->outputBufferStft = outputBufferStft;
+  h->eqGain = NULL;
+  h->eqGainExp = NULL;
 
   for (erb = 0; erb < STFT_ERB_BANDS; erb++) {
     h->inBufStftHeadroomPrev[erb] = 31;   /* start value */
@@ -172,7 +175,15 @@ INT activeDmxStftInit(void** handle, UINT numInChans, UINT numOutChans, FIXP_DBL
     status = -1;
   }
 
+  h->eqGain = (FIXP_DBL*)mpegh_FDKaalloc(numOutChans * STFT_ERB_BANDS * sizeof(FIXP_DBL),
+                                         ALIGNMENT_DEFAULT);
+  h->eqGainExp = (SCHAR*)mpegh_FDKcalloc(numOutChans * STFT_ERB_BANDS, sizeof(SCHAR));
+  if ((h->eqGain == NULL) || (h->eqGainExp == NULL)) {
+    status = -1;
+  }
+
   activeDmxSetAES(aes, h); /* 7 active downmix, 0 passive downmix */
+  activeDmxSetTier(IIS_FORMATCONVERTER_DMX_TIER_FULL, h);
 
   return status;
 }
@@ -207,6 +218,10 @@ void activeDmxClose_STFT(void* handle) {
     if (h->targetEnePrevExp) {
       mpegh_FDKafree(h->targetEnePrevExp);
     }
+    if (h->eqGain) {
+      mpegh_FDKafree(h->eqGain);
+    }
+    mpegh_FDKfree(h->eqGainExp);
 
     mpegh_FDKafree(h);
   }
@@ -285,8 +300,116 @@ FDK_INLINE FIXP_DBL computeEQAndClip(FIXP_DBL targetEne, FIXP_DBL realizedEne, I
   return EQ_val;
 }
 
+/* Downmix coefficients of one input to one output channel per erb, the product of the equalizer
+   and the downmix matrix coefficient (dmxMatrixH_FDK from erb_is4GVH_L to erb_is4GVH_H), and the
+   exponents of the target energy. Returns the number of processed erb. */
+static UINT activeDmxGetErbCoeffs(FIXP_DBL* RESTRICT dmxCoeff, INT* RESTRICT targetExp,
+                                  const FIXP_DBL* eq_ptr, const FIXP_DMX_H dmxMatrixL_FDK,
+                                  const FIXP_DMX_H dmxMatrixH_FDK, const UINT erb_is4GVH_L,
+                                  const UINT erb_is4GVH_H, const INT chOut_exp,
+                                  const INT dmx_iterations) {
+  FIXP_DMX_H dmx_coeff_mtx = dmxMatrixL_FDK;
+  UINT max_erb = erb_is4GVH_L;
+  UINT erb = 0;
+
+  for (INT it = 0; it < dmx_iterations; it++) {
+    for (; erb < max_erb; erb++) {
+      dmxCoeff[erb] = fMult(dmx_coeff_mtx, eq_ptr[erb]);
+      targetExp[erb] = erb_freq_idx_256_58_exp[erb] + chOut_exp;
+    }
+    if (it == 0) {
+      max_erb = erb_is4GVH_H;
+      dmx_coeff_mtx = dmxMatrixH_FDK;
+    } else if (it == 1) {
+      max_erb = 58;
+      dmx_coeff_mtx = dmxMatrixL_FDK;
+    }
+  }
+
+  return erb;
+}
+
+/* Downmix of one input to one output channel without target energy, used in the STFT frames in
+   which the EQ values are held. The headroom of the input only matters for the energies. */
+static void activeDmxDownmix_STFT(FIXP_DBL* RESTRICT inputBuffer, FIXP_DBL* RESTRICT realizedSig,
+                                  const FIXP_DBL* eq_ptr, const FIXP_DMX_H dmxMatrixL_FDK,
+                                  const FIXP_DMX_H dmxMatrixH_FDK, const UINT erb_is4GVH_L,
+                                  const UINT erb_is4GVH_H, const INT dmx_iterations) {
+  RAM_ALIGN FIXP_DBL dmxCoeff[STFT_ERB_BANDS];
+  RAM_ALIGN INT targetExp[STFT_ERB_BANDS];
+  UINT numErb = activeDmxGetErbCoeffs(dmxCoeff, targetExp, eq_ptr, dmxMatrixL_FDK, dmxMatrixH_FDK,
+                                      erb_is4GVH_L, erb_is4GVH_H, 0, dmx_iterations);
+
+  /* The Nyquist value in the imaginary part of the DC bin counts to the last processed erb */
+  FIXP_DBL savIm0 = inputBuffer[1];
+  inputBuffer[1] = FIXP_DBL(0);
+  FDK_dspFuncs.stftDmxBands(realizedSig, inputBuffer, NULL, erb_freq_idx_256_58, dmxCoeff, NULL,
+                            NULL, numErb);
+  inputBuffer[1] = savIm0;
+  realizedSig[1] = fAddSaturate(realizedSig[1], fMult(dmxCoeff[numErb - 1], savIm0));
+}
+
+/* EQ values of one output channel for the tiers above full quality, shared by groups of
+   2^erbPerEqLd erb. The energies of a group are added at the largest exponent of its erb. */
+static void activeDmxComputeSharedEQ(activeDownmixer* h, UINT chOut, INT eq_e) {
+  const FIXP_DBL* targetEne = h->targetEnePrev[chOut];
+  const FIXP_DBL* realizedEne = h->realizedEnePrev[chOut];
+  FIXP_DBL* eqGain = &h->eqGain[chOut * STFT_ERB_BANDS];
+  SCHAR* eqGainExp = &h->eqGainExp[chOut * STFT_ERB_BANDS];
+  const INT guardBits = (INT)h->erbPerEqLd;
+
+  for (INT erbStart = 0; erbStart < STFT_ERB_BANDS; erbStart += (1 << guardBits)) {
+    INT erbStop = fMin(erbStart + (1 << guardBits), STFT_ERB_BANDS);
+    INT targetExp = -2 * DFRACT_BITS, realizedExp = -2 * DFRACT_BITS;
+    FIXP_DBL targetSum = (FIXP_DBL)0, realizedSum = (FIXP_DBL)0;
+    INT erb, EQ_exp;
+    FIXP_DBL EQ;
+
+    for (erb = erbStart; erb < erbStop; erb++) {
+      targetExp = fMax(targetExp, erb_freq_idx_256_58_exp[erb] - h->inBufStftHeadroomPrev[erb]);
+      realizedExp =
+          fMax(realizedExp, erb_freq_idx_256_58_exp[erb] - h->realizedSigHeadroomPrev[erb]);
+    }
+    for (erb = erbStart; erb < erbStop; erb++) {
+      targetSum += targetEne[erb] >>
+                   fMin(DFRACT_BITS - 1, targetExp + guardBits - erb_freq_idx_256_58_exp[erb] +
+                                             h->inBufStftHeadroomPrev[erb]);
+      realizedSum += realizedEne[erb] >>
+                     fMin(DFRACT_BITS - 1, realizedExp + guardBits - erb_freq_idx_256_58_exp[erb] +
+                                               h->realizedSigHeadroomPrev[erb]);
+    }
+
+    EQ = computeEQAndClip(targetSum, realizedSum, targetExp - realizedExp, eq_e, &EQ_exp);
+    for (erb = erbStart; erb < erbStop; erb++) {
+      eqGain[erb] = EQ;
+      eqGainExp[erb] = (SCHAR)EQ_exp;
+    }
+  }
+}
+
+/* Apply the EQ values of each erb to the realized signal of one output channel */
+static void activeDmxApplyEQ(FIXP_DBL* RESTRICT realizedSig, const FIXP_DBL* RESTRICT eqGain,
+                             const SCHAR* RESTRICT eqGainExp) {
+  UINT erb, fftBand = 1;
+
+  realizedSig[0] = fMult(eqGain[0], realizedSig[0]) << eqGainExp[0];
+  for (erb = 1; erb < STFT_ERB_BANDS; erb++) {
+    for (; fftBand < erb_freq_idx_256_58[erb]; fftBand++) {
+      realizedSig[fftBand * 2 + 0] = fMult(eqGain[erb], realizedSig[fftBand * 2 + 0])
+                                     << eqGainExp[erb];
+      realizedSig[fftBand * 2 + 1] = fMult(eqGain[erb], realizedSig[fftBand * 2 + 1])
+                                     << eqGainExp[erb];
+    }
+  }
+  /* Nyquist frequency counts to the last erb */
+  realizedSig[1] = fMult(eqGain[STFT_ERB_BANDS - 1], realizedSig[1])
+                   << eqGainExp[STFT_ERB_BANDS - 1];
+}
+
 #if defined(__arm__)
 #include "arm/FDK_formatConverter_activeDmx_stft_arm.cpp"
+#elif defined(__x86__)
+#include "x86/FDK_formatConverter_activeDmx_stft_x86.cpp"
 #endif
 
 FDK_INLINE INT get1xScalefactor(FIXP_DBL* buf) {
@@ -317,7 +440,7 @@ void activeDmxProcess_STFT(void* handle) {
 
   UINT i, chIn, numInChans, chOut, numOutChans, erb;
   FIXP_DBL** realizedSig = h->outputBufferStft;
-  const FIXP_DBL Alpha = ALPHA_AEQ;
+  const FIXP_DBL Alpha = h->eqAlpha;
   const FIXP_DBL One_subAlpha = FIXP_DBL(MAXVAL_DBL) - Alpha;
 
   INT erb_start_ix, erb_stop_ix;
@@ -370,6 +493,11 @@ void activeDmxProcess_STFT(void* handle) {
   INT *chOut_exp = _p->fcParams->chOut_exp, *chOut_count = _p->fcParams->chOut_count;
   INT dmx_iterations = _p->fcParams->dmx_iterations;
 
+  /* The tiers above full quality compute the energies and EQ values only every eqInterval frames
+   * and apply the held EQ values in between */
+  const INT updateEq = (h->eqFrameCount == 0);
+  h->eqFrameCount = (h->eqFrameCount + 1 < h->eqInterval) ? h->eqFrameCount + 1 : 0;
+
   /* Equalizers init */
   if (_p->amountOfAddedDmxMatricesAndEqualizers) {
     eq_e = EQ_BITSTREAM_H_EXP;
@@ -405,26 +533,9 @@ void activeDmxProcess_STFT(void* handle) {
     inBufStftHeadroom[erb] = 32;
   }
 
-  for (chIn = 0; chIn < numInChans; chIn++) {
-    FIXP_DBL* inBuf = h->inputBufferStft[chIn];
-    inBufStftHeadroom[0] = fMin(inBufStftHeadroom[0], get1xScalefactor(&inBuf[0]));
-    inBufStftHeadroom[STFT_ERB_BANDS - 1] =
-        fMin(inBufStftHeadroom[STFT_ERB_BANDS - 1], get1xScalefactor(&inBuf[1]));
-    for (erb = 1; erb < 33; erb++) { /* These erb use only 1 complex frequency band */
-      inBufStftHeadroom[erb] = fMin(inBufStftHeadroom[erb], get2xScalefactor(&inBuf[2 * erb]));
-    }
-    erb_start_ix = erb;
-    for (; erb < STFT_ERB_BANDS; erb++) { /* These erb use 3..19 frequency bands */
-      erb_stop_ix = erb_freq_idx_256_58[erb];
-      inBufStftHeadroom[erb] =
-          fMin(inBufStftHeadroom[erb],
-               mpegh_getScalefactor(&inBuf[2 * erb_start_ix], 2 * (erb_stop_ix - erb_start_ix)));
-      erb_start_ix = erb_stop_ix; /* for next loop iteration */
-    }
-  }
-  if (Mode3Drendering) {
-    for (chIn = TFC; chIn <= TFRA; chIn++) {
-      FIXP_DBL* inBuf = h->prevInputBufferStft[chIn];
+  if (updateEq) {
+    for (chIn = 0; chIn < numInChans; chIn++) {
+      FIXP_DBL* inBuf = h->inputBufferStft[chIn];
       inBufStftHeadroom[0] = fMin(inBufStftHeadroom[0], get1xScalefactor(&inBuf[0]));
       inBufStftHeadroom[STFT_ERB_BANDS - 1] =
           fMin(inBufStftHeadroom[STFT_ERB_BANDS - 1], get1xScalefactor(&inBuf[1]));
@@ -440,6 +551,25 @@ void activeDmxProcess_STFT(void* handle) {
         erb_start_ix = erb_stop_ix; /* for next loop iteration */
       }
     }
+    if (Mode3Drendering) {
+      for (chIn = TFC; chIn <= TFRA; chIn++) {
+        FIXP_DBL* inBuf = h->prevInputBufferStft[chIn];
+        inBufStftHeadroom[0] = fMin(inBufStftHeadroom[0], get1xScalefactor(&inBuf[0]));
+        inBufStftHeadroom[STFT_ERB_BANDS - 1] =
+            fMin(inBufStftHeadroom[STFT_ERB_BANDS - 1], get1xScalefactor(&inBuf[1]));
+        for (erb = 1; erb < 33; erb++) { /* These erb use only 1 complex frequency band */
+          inBufStftHeadroom[erb] = fMin(inBufStftHeadroom[erb], get2xScalefactor(&inBuf[2 * erb]));
+        }
+        erb_start_ix = erb;
+        for (; erb < STFT_ERB_BANDS; erb++) { /* These erb use 3..19 frequency bands */
+          erb_stop_ix = erb_freq_idx_256_58[erb];
+          inBufStftHeadroom[erb] = fMin(
+              inBufStftHeadroom[erb],
+              mpegh_getScalefactor(&inBuf[2 * erb_start_ix], 2 * (erb_stop_ix - erb_start_ix)));
+          erb_start_ix = erb_stop_ix; /* for next loop iteration */
+        }
+      }
+    }
   }
 
   /*********************************************/
@@ -485,6 +615,12 @@ void activeDmxProcess_STFT(void* handle) {
           inputBuffer = h->inputBufferStft[chIn]; /* undelayed input signal */
         }
 
+        if (!updateEq) {
+          activeDmxDownmix_STFT(inputBuffer, realizedSig[chOut], eq_ptr, dmxMatrixL_FDK[chOut],
+                                dmxMatrixH_FDK[chOut], erb_is4GVH_L, erb_is4GVH_H, dmx_iterations);
+          continue;
+        }
+
 #ifdef FUNCTION_activeDmxProcess_STFT_func1
         activeDmxProcess_STFT_func1(
             inputBuffer, realizedSig[chOut], &targetEneArr[STFT_ERB_BANDS * chOut],
@@ -565,6 +701,44 @@ void activeDmxProcess_STFT(void* handle) {
     eqIndex_FDK += numOutChans;
   } /* for(chIn = 0; chIn < numInChans; chIn++) */
 
+  /*********************************************/
+  /*            Update delay buffer            */
+  /*********************************************/
+  if (immersiveMode) {
+    for (chIn = 0; chIn < h->numInChans; chIn++) {
+      if (chIn == (UINT)_p->topIn[TFL])
+        mpegh_FDKmemcpy(h->prevInputBufferStft[TFL], h->inputBufferStft[chIn],
+                  STFT_LENGTH * sizeof(FIXP_DBL));
+      if (chIn == (UINT)_p->topIn[TFC])
+        mpegh_FDKmemcpy(h->prevInputBufferStft[TFC], h->inputBufferStft[chIn],
+                  STFT_LENGTH * sizeof(FIXP_DBL));
+      if (chIn == (UINT)_p->topIn[TFR])
+        mpegh_FDKmemcpy(h->prevInputBufferStft[TFR], h->inputBufferStft[chIn],
+                  STFT_LENGTH * sizeof(FIXP_DBL));
+      if (chIn == (UINT)_p->topIn[TFLA])
+        mpegh_FDKmemcpy(h->prevInputBufferStft[TFLA], h->inputBufferStft[chIn],
+                  STFT_LENGTH * sizeof(FIXP_DBL));
+      if (chIn == (UINT)_p->topIn[TFRA])
+        mpegh_FDKmemcpy(h->prevInputBufferStft[TFRA], h->inputBufferStft[chIn],
+                  STFT_LENGTH * sizeof(FIXP_DBL));
+    }
+  }
+
+  if (!updateEq) {
+    /* Apply the held EQ values */
+    for (chOut = 0; chOut < numOutChans; chOut++) {
+      if (chOut_count[chOut] != 0) {
+        if (h->fixpAES == (FIXP_DBL)0) {
+          mpegh_scaleValues(realizedSig[chOut], 2 * erb_freq_idx_256_58[STFT_ERB_BANDS - 1], eq_e);
+        } else {
+          activeDmxApplyEQ(realizedSig[chOut], &h->eqGain[chOut * STFT_ERB_BANDS],
+                           &h->eqGainExp[chOut * STFT_ERB_BANDS]);
+        }
+      }
+    }
+    return;
+  }
+
   /* headroom of realized signal */
   /* initialize headroom values with maximum  */
   for (erb = 0; erb < STFT_ERB_BANDS; erb++) {
@@ -601,29 +775,6 @@ void activeDmxProcess_STFT(void* handle) {
     exp_diff_realized[erb] = fMax(fMin(exp_diff_realized[erb], 31), -31);
   }
 
-  /*********************************************/
-  /*            Update delay buffer            */
-  /*********************************************/
-  if (immersiveMode) {
-    for (chIn = 0; chIn < h->numInChans; chIn++) {
-      if (chIn == (UINT)_p->topIn[TFL])
-        mpegh_FDKmemcpy(h->prevInputBufferStft[TFL], h->inputBufferStft[chIn],
-                  STFT_LENGTH * sizeof(FIXP_DBL));
-      if (chIn == (UINT)_p->topIn[TFC])
-        mpegh_FDKmemcpy(h->prevInputBufferStft[TFC], h->inputBufferStft[chIn],
-                  STFT_LENGTH * sizeof(FIXP_DBL));
-      if (chIn == (UINT)_p->topIn[TFR])
-        mpegh_FDKmemcpy(h->prevInputBufferStft[TFR], h->inputBufferStft[chIn],
-                  STFT_LENGTH * sizeof(FIXP_DBL));
-      if (chIn == (UINT)_p->topIn[TFLA])
-        mpegh_FDKmemcpy(h->prevInputBufferStft[TFLA], h->inputBufferStft[chIn],
-                  STFT_LENGTH * sizeof(FIXP_DBL));
-      if (chIn == (UINT)_p->topIn[TFRA])
-        mpegh_FDKmemcpy(h->prevInputBufferStft[TFRA], h->inputBufferStft[chIn],
-                  STFT_LENGTH * sizeof(FIXP_DBL));
-    }
-  }
-
   FIXP_DBL* realizedEnergy =
       (FIXP_DBL*)(&minHeadroomTargetEne[0]); /* Only possible, if both are of type INT[] */
 
@@ -770,6 +921,15 @@ void activeDmxProcess_STFT(void* handle) {
         mpegh_scaleValues(realizedSig[chOut], 2 * erb_freq_idx_256_58[STFT_ERB_BANDS - 1], eq_e);
       }
     }
+  } else if (h->dmxTier != IIS_FORMATCONVERTER_DMX_TIER_FULL) {
+    for (chOut = 0; chOut < numOutChans; chOut++) {
+      if (chOut_count[chOut] != 0) {
+        /* Compute the shared EQ values, held until the next update */
+        activeDmxComputeSharedEQ(h, chOut, eq_e);
+        activeDmxApplyEQ(realizedSig[chOut], &h->eqGain[chOut * STFT_ERB_BANDS],
+                         &h->eqGainExp[chOut * STFT_ERB_BANDS]);
+      }
+    }
   } else
     for (chOut = 0; chOut < numOutChans; chOut++) {
       if (chOut_count[chOut] != 0) {
@@ -832,3 +992,17 @@ void activeDmxSetAES(INT AES, void* handle) {
                1; /* fixpAES = AES/7.0f   change format from INT to Q2.29 */
 }
 /*****************************************************************************************************************/
+void activeDmxSetTier(UINT tier, void* handle) {
+  /* The energies are smoothed once per EQ update, with 1 - (1 - ALPHA_AEQ)^eqInterval */
+  static const UCHAR erbPerEqLd[] = {0, 1, 2};
+  static const UCHAR eqInterval[] = {1, 2, 4};
+  static const FIXP_DBL eqAlpha[] = {ALPHA_AEQ, FL2FXCONST_DBL(0.0851f), FL2FXCONST_DBL(0.1630f)};
+  activeDownmixer* h = (activeDownmixer*)handle;
+  FDK_ASSERT(tier <= IIS_FORMATCONVERTER_DMX_TIER_LOW);
+  h->dmxTier = tier;
+  h->erbPerEqLd = erbPerEqLd[tier];
+  h->eqInterval = eqInterval[tier];
+  h->eqAlpha = eqAlpha[tier];
+  h->eqFrameCount = 0; /* update the EQ values in the next frame */
+}
+/*****************************************************************************************************************/
@@ -142,6 +142,15 @@ typedef struct {
   INT* targetEnePrevExp;
   SCHAR inBufStftHeadroomPrev[STFT_ERB_BANDS];
   SCHAR realizedSigHeadroomPrev[STFT_ERB_BANDS];
+
+  /* Quality/complexity tier, see IIS_FORMATCONVERTER_DMX_TIER */
+  UINT dmxTier;
+  UINT erbPerEqLd;   /* ld of the number of erb sharing one EQ value */
+  UINT eqInterval;   /* number of STFT frames the EQ values are held */
+  FIXP_DBL eqAlpha;  /* energy smoothing factor per EQ update */
+  UINT eqFrameCount; /* STFT frames since the last EQ update */
+  FIXP_DBL* eqGain;  /* EQ values held between updates [numOutChans][STFT_ERB_BANDS] */
+  SCHAR* eqGainExp;  /* exponents of eqGain */
 } activeDownmixer;
 
 void activeDmxProcess_STFT(void* handle);
@@ -150,6 +159,7 @@ INT activeDmxStftInit(void** handle, UINT numInChans, UINT numOutChans, FIXP_DBL
                       FIXP_DBL** prevInputBufferStft, FIXP_DBL** outputBufferStft, INT aes);
 
 void activeDmxSetAES(INT AES, void* handle);
+void activeDmxSetTier(UINT tier, void* handle);
 void activeDmxClose_STFT(void* handle);
 
 #endif /*FDK_FORMATCONVERTER_ACTIVEDMX_STFT_H*/
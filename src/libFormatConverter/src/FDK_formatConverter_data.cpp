@@ -120,6 +120,7 @@ amm-info@iis.fraunhofer.de
 #include "FDK_formatConverter_data.h"
 
 #include "FDK_formatConverter_init.h"
+#include "FDK_formatConverter_process.h"
 #include "FDK_formatConverter_activeDmx_stft.h"
 
 /**********************************************************************************************************************************/
@@ -184,6 +185,12 @@ int allocateFormatConverterParams(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt) {
   if (fcInt->fcParams->dmxMtx_sorted == NULL) {
     status = -1;
   }
+  fcInt->fcParams->dmxCoefList =
+      (FC_DMX_COEF*)mpegh_FDKcalloc(fcInt->numTotalInputChannels * fcInt->numOutputChannels,
+                                    sizeof *fcInt->fcParams->dmxCoefList);
+  if (fcInt->fcParams->dmxCoefList == NULL) {
+    status = -1;
+  }
 
   /* dmx mtx L */
   fcInt->fcParams->dmxMtxL =
@@ -323,6 +330,9 @@ void freeFormatConverterParams(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt) {
 
   mpegh_FDKfree(fcInt->fcParams->dmxMtx_sorted);
   fcInt->fcParams->dmxMtx_sorted = NULL;
+  mpegh_FDKfree(fcInt->fcParams->dmxCoefList);
+  fcInt->fcParams->dmxCoefList = NULL;
+  fcInt->fcParams->dmxCoefCount = 0;
 
   /* dmx mtx L */
 
@@ -570,6 +580,7 @@ int formatConverterInit_internal(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt, INT*
       j++;
     }
   }
+  formatConverterSetDmxCoefList(fcInt);
 
   return 0;
 }
@@ -0,0 +1,278 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************** MPEG-H 3DA channel rendering library *********************
+
+   Author(s):
+
+   Description: Process-wide cache of computed downmix plans
+
+*******************************************************************************/
+
+#include <mutex>
+
+#include "FDK_formatConverter_plan.h"
+
+#include "FDK_formatConverter_process.h"
+
+/* The cache is shared by all Format Converter instances of the process. It lives in static
+ * storage, so that no instance allocator ever owns memory another instance releases. */
+static std::mutex fcPlanCacheLock;
+static FC_DMX_PLAN fcPlanCache[FDK_FORMAT_CONVERTER_PLAN_CACHE_SIZE];
+static UINT fcPlanCacheLastUse[FDK_FORMAT_CONVERTER_PLAN_CACHE_SIZE]; /* 0: slot empty */
+static UINT fcPlanCacheClock;
+
+/**********************************************************************************************************************************/
+
+void formatConverterGetPlanKey(FC_DMX_PLAN_KEY* key, IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt,
+                               const UINT pas) {
+  /* Clear unused geometry entries so that keys can be compared as a whole. */
+  mpegh_FDKmemclear(key, sizeof(*key));
+
+  key->mode = fcInt->mode;
+  key->fcInputFormat = fcInt->fcInputFormat;
+  key->fcOutputFormat = fcInt->fcOutputFormat;
+  key->samplingRate = fcInt->samplingRate;
+  key->frameSize = fcInt->frameSize;
+  key->aes = fcInt->aes;
+  key->pas = pas;
+  key->immersiveDownmixFlag = fcInt->immersiveDownmixFlag;
+  key->numTotalInputChannels = fcInt->numTotalInputChannels;
+  key->numOutputChannels = fcInt->numOutputChannels;
+  mpegh_FDKmemcpy(key->inputChannelGeo, fcInt->inputChannelGeo,
+                  fcInt->numTotalInputChannels * sizeof(key->inputChannelGeo[0]));
+  mpegh_FDKmemcpy(key->outChannelGeo, fcInt->outChannelGeo,
+                  fcInt->numOutputChannels * sizeof(key->outChannelGeo[0]));
+}
+
+/**********************************************************************************************************************************/
+
+INT formatConverterLoadPlan(const FC_DMX_PLAN_KEY* key, FC_DMX_PLAN* plan) {
+  std::lock_guard<std::mutex> lock(fcPlanCacheLock);
+
+  for (INT i = 0; i < FDK_FORMAT_CONVERTER_PLAN_CACHE_SIZE; i++) {
+    if ((fcPlanCacheLastUse[i] != 0) &&
+        (mpegh_FDKmemcmp(&fcPlanCache[i].key, key, sizeof(*key)) == 0)) {
+      fcPlanCacheLastUse[i] = ++fcPlanCacheClock;
+      mpegh_FDKmemcpy(plan, &fcPlanCache[i], sizeof(*plan));
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+/**********************************************************************************************************************************/
+
+void formatConverterStorePlan(const FC_DMX_PLAN_KEY* key,
+                              IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt) {
+  HANDLE_FORMAT_CONVERTER_PARAMS params = fcInt->fcParams;
+  FC_DMX_PLAN* plan;
+  INT slot = 0;
+  UINT in, out;
+
+  std::lock_guard<std::mutex> lock(fcPlanCacheLock);
+
+  /* Replace the same configuration if another instance stored it meanwhile, otherwise an empty or
+   * the least recently used slot. */
+  for (INT i = 0; i < FDK_FORMAT_CONVERTER_PLAN_CACHE_SIZE; i++) {
+    if ((fcPlanCacheLastUse[i] != 0) &&
+        (mpegh_FDKmemcmp(&fcPlanCache[i].key, key, sizeof(*key)) == 0)) {
+      slot = i;
+      break;
+    }
+    if (fcPlanCacheLastUse[i] < fcPlanCacheLastUse[slot]) {
+      slot = i;
+    }
+  }
+  plan = &fcPlanCache[slot];
+  fcPlanCacheLastUse[slot] = ++fcPlanCacheClock;
+
+  mpegh_FDKmemcpy(&plan->key, key, sizeof(*key));
+
+  plan->mode = fcInt->mode;
+  plan->fcInputFormat = fcInt->fcInputFormat;
+  plan->fcOutputFormat = fcInt->fcOutputFormat;
+  plan->cicpLayoutIndex = fcInt->cicpLayoutIndex;
+  plan->outChannelVbapFlag = fcInt->outChannelVbapFlag;
+  plan->inChannelVbapFlag = fcInt->inChannelVbapFlag;
+
+  mpegh_FDKmemcpy(plan->format_in_listOfChannels, fcInt->format_in_listOfChannels,
+                  sizeof(plan->format_in_listOfChannels));
+  plan->format_in_listOfChannels_nchan = fcInt->format_in_listOfChannels_nchan;
+  mpegh_FDKmemcpy(plan->format_out_listOfChannels, fcInt->format_out_listOfChannels,
+                  sizeof(plan->format_out_listOfChannels));
+  plan->format_out_listOfChannels_nchan = fcInt->format_out_listOfChannels_nchan;
+
+  mpegh_FDKmemcpy(plan->GVH, fcInt->GVH, sizeof(plan->GVH));
+  mpegh_FDKmemcpy(plan->GVH_e, fcInt->GVH_e, sizeof(plan->GVH_e));
+  mpegh_FDKmemcpy(plan->GVL, fcInt->GVL, sizeof(plan->GVL));
+  mpegh_FDKmemcpy(plan->GVL_e, fcInt->GVL_e, sizeof(plan->GVL_e));
+  mpegh_FDKmemcpy(plan->is4GVH_StftErb, fcInt->is4GVH_StftErb, sizeof(plan->is4GVH_StftErb));
+  mpegh_FDKmemcpy(plan->topIn, fcInt->topIn, sizeof(plan->topIn));
+  mpegh_FDKmemcpy(plan->midOut, fcInt->midOut, sizeof(plan->midOut));
+  plan->erb_is4GVH_L = fcInt->erb_is4GVH_L;
+  plan->erb_is4GVH_H = fcInt->erb_is4GVH_H;
+
+  plan->formatConverterInputFormat_internal = params->formatConverterInputFormat_internal;
+  plan->formatConverterOutputFormat_internal = params->formatConverterOutputFormat_internal;
+  plan->genericIOFmt = params->genericIOFmt;
+  plan->dmxMtxIsSet = params->dmxMtxIsSet;
+
+  for (in = 0; in < fcInt->numTotalInputChannels; in++) {
+    for (out = 0; out < fcInt->numOutputChannels; out++) {
+      plan->dmxMtx[in][out] = params->dmxMtx[in][out];
+      plan->dmxMtxL[in][out] = params->dmxMtxL[in][out];
+      plan->dmxMtx2[in][out] = params->dmxMtx2[in][out];
+      plan->eqIndexVec[in][out] = params->eqIndexVec[in][out];
+      plan->eqIndexVec2[in][out] = params->eqIndexVec2[in][out];
+    }
+  }
+  mpegh_FDKmemcpy(&plan->params_internal, params->formatConverterParams_internal,
+                  sizeof(plan->params_internal));
+}
+
+/**********************************************************************************************************************************/
+
+void formatConverterApplyPlanSetup(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt,
+                                   const FC_DMX_PLAN* plan) {
+  fcInt->mode = plan->mode;
+  fcInt->fcInputFormat = plan->fcInputFormat;
+  fcInt->fcOutputFormat = plan->fcOutputFormat;
+  fcInt->cicpLayoutIndex = plan->cicpLayoutIndex;
+  fcInt->outChannelVbapFlag = plan->outChannelVbapFlag;
+  fcInt->inChannelVbapFlag = plan->inChannelVbapFlag;
+
+  mpegh_FDKmemcpy(fcInt->format_in_listOfChannels, plan->format_in_listOfChannels,
+                  sizeof(fcInt->format_in_listOfChannels));
+  fcInt->format_in_listOfChannels_nchan = plan->format_in_listOfChannels_nchan;
+  mpegh_FDKmemcpy(fcInt->format_out_listOfChannels, plan->format_out_listOfChannels,
+                  sizeof(fcInt->format_out_listOfChannels));
+  fcInt->format_out_listOfChannels_nchan = plan->format_out_listOfChannels_nchan;
+
+  mpegh_FDKmemcpy(fcInt->GVH, plan->GVH, sizeof(fcInt->GVH));
+  mpegh_FDKmemcpy(fcInt->GVH_e, plan->GVH_e, sizeof(fcInt->GVH_e));
+  mpegh_FDKmemcpy(fcInt->GVL, plan->GVL, sizeof(fcInt->GVL));
+  mpegh_FDKmemcpy(fcInt->GVL_e, plan->GVL_e, sizeof(fcInt->GVL_e));
+  mpegh_FDKmemcpy(fcInt->is4GVH_StftErb, plan->is4GVH_StftErb, sizeof(fcInt->is4GVH_StftErb));
+  mpegh_FDKmemcpy(fcInt->topIn, plan->topIn, sizeof(fcInt->topIn));
+  mpegh_FDKmemcpy(fcInt->midOut, plan->midOut, sizeof(fcInt->midOut));
+  fcInt->erb_is4GVH_L = plan->erb_is4GVH_L;
+  fcInt->erb_is4GVH_H = plan->erb_is4GVH_H;
+}
+
+/**********************************************************************************************************************************/
+
+void formatConverterApplyPlanParams(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt,
+                                    const FC_DMX_PLAN* plan) {
+  HANDLE_FORMAT_CONVERTER_PARAMS params = fcInt->fcParams;
+  UINT in, out, j;
+
+  params->formatConverterInputFormat_internal = plan->formatConverterInputFormat_internal;
+  params->formatConverterOutputFormat_internal = plan->formatConverterOutputFormat_internal;
+  params->genericIOFmt = plan->genericIOFmt;
+  params->dmxMtxIsSet = plan->dmxMtxIsSet;
+
+  /* The sorted matrices are always the resorted [in][out] matrices at the end of
+   * IIS_FormatConverter_Open(). The immersive ones are all zero if they are not used. */
+  j = 0;
+  for (in = 0; in < fcInt->numTotalInputChannels; in++) {
+    for (out = 0; out < fcInt->numOutputChannels; out++) {
+      params->dmxMtx[in][out] = plan->dmxMtx[in][out];
+      params->dmxMtxL[in][out] = plan->dmxMtxL[in][out];
+      params->dmxMtx2[in][out] = plan->dmxMtx2[in][out];
+      params->eqIndexVec[in][out] = plan->eqIndexVec[in][out];
+      params->eqIndexVec2[in][out] = plan->eqIndexVec2[in][out];
+
+      params->dmxMtx_sorted[j] = plan->dmxMtx[in][out];
+      params->dmxMtxL_sorted[j] = plan->dmxMtxL[in][out];
+      params->dmxMtx2_sorted[j] = plan->dmxMtx2[in][out];
+      params->eqIndexVec_sorted[j] = plan->eqIndexVec[in][out];
+      params->eqIndexVec2_sorted[j] = plan->eqIndexVec2[in][out];
+      j++;
+    }
+  }
+  formatConverterSetDmxCoefList(fcInt);
+
+  mpegh_FDKmemcpy(params->formatConverterParams_internal, &plan->params_internal,
+                  sizeof(plan->params_internal));
+}
@@ -123,6 +123,43 @@ amm-info@iis.fraunhofer.de
 
 /**********************************************************************************************************************************/
 
+/* Number of samples processed per tile of the passive downmix. The input and output slices of one
+ * tile (28 + 24 channels x 64 samples x 32 bit) stay resident in the L1 data cache. */
+#define FC_PASSIVE_DMX_BLOCK_SIZE (64)
+
+/*!
+ *
+ * \brief Collect the nonzero coefficients of dmxMtx_sorted for the passive downmix.
+ *
+ * Must be called whenever dmxMtx_sorted changes. The list keeps the [in][out] order of the sorted
+ * matrix, so every output sample accumulates its inputs in the same order as before.
+ *
+ * \param fcInt                 [i] FormatConverter Handler
+ *
+ */
+void formatConverterSetDmxCoefList(IIS_FORMATCONVERTER_INTERNAL_HANDLE fcInt) {
+  const FIXP_DMX_H* dmx_mtx = fcInt->fcParams->dmxMtx_sorted;
+  FC_DMX_COEF* coefList = fcInt->fcParams->dmxCoefList;
+  UINT count = 0;
+
+  if ((dmx_mtx == NULL) || (coefList == NULL)) {
+    return;
+  }
+
+  for (UINT inCh = 0; inCh < fcInt->numTotalInputChannels; inCh += 1) {
+    for (UINT outCh = 0; outCh < fcInt->numOutputChannels; outCh += 1) {
+      FIXP_DMX_H dmx_coef = *dmx_mtx++;
+      if (dmx_coef != (FIXP_DMX_H)0) {
+        coefList[count].inCh = (UCHAR)inCh;
+        coefList[count].outCh = (UCHAR)outCh;
+        coefList[count].coef = dmx_coef;
+        count++;
+      }
+    }
+  }
+  fcInt->fcParams->dmxCoefCount = count;
+}
+
 /*!
  *
  * \brief .
@@ -147,27 +184,29 @@ void formatConverterProcess_passive_timeDomain_frameLength(
   Accumulation output buffer:
     - Blockwise:
         Blockwise accumulated frames with samples from 0 to frameSize-1 in pOut
+
+  The frame is processed in tiles of FC_PASSIVE_DMX_BLOCK_SIZE samples. Each tile applies all
+  nonzero downmix coefficients before moving on, so input and output slices are read and written
+  while they are still cached instead of once per coefficient and frame.
   */
 
-  UINT numOutChannels = fcInt->numOutputChannels;
-  UINT numInChannels = fcInt->numTotalInputChannels;
   UINT frameLength = fcInt->frameSize;
-  FIXP_DMX_H* dmx_mtx = fcInt->fcParams->dmxMtx_sorted;
+  const FC_DMX_COEF* coefList = fcInt->fcParams->dmxCoefList;
+  const UINT coefCount = fcInt->fcParams->dmxCoefCount;
 
-  DMXH_PCM* start_pOut = pOut;
-  for (UINT inCh = 0; inCh < numInChannels; inCh += 1) {
-    /* Reset output buffer pointer */
-    pOut = start_pOut;
-    for (UINT outCh = 0; outCh < numOutChannels; outCh += 1) {
-      FIXP_DMX_H dmx_coef = *dmx_mtx++;
-      if (dmx_coef != (FIXP_DMX_H)0) {
-        for (UINT sample = 0; sample < frameLength; sample++) {
-          pOut[sample] += (DMXH_PCM)FX_DBL2FX_DMXH(fMult((DMXH_PCMF)pIn[sample], dmx_coef));
-        }
+  for (UINT offset = 0; offset < frameLength; offset += FC_PASSIVE_DMX_BLOCK_SIZE) {
+    const UINT blockLength = fMin((UINT)FC_PASSIVE_DMX_BLOCK_SIZE, frameLength - offset);
+
+    for (UINT i = 0; i < coefCount; i++) {
+      const DMXH_PCM* RESTRICT pInBlock =
+          &pIn[coefList[i].inCh * inputBufferChannelOffset + offset];
+      DMXH_PCM* RESTRICT pOutBlock = &pOut[coefList[i].outCh * frameLength + offset];
+      FIXP_DMX_H dmx_coef = coefList[i].coef;
+
+      for (UINT sample = 0; sample < blockLength; sample++) {
+        pOutBlock[sample] += (DMXH_PCM)FX_DBL2FX_DMXH(fMult((DMXH_PCMF)pInBlock[sample], dmx_coef));
       }
-      pOut += frameLength;
     }
-    pIn += inputBufferChannelOffset;
   }
 }
 
@@ -0,0 +1,143 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************** MPEG-H 3DA channel rendering library *********************
+
+   Author(s):
+
+   Description: x86 version of the target energy and realized signal
+                computation and of the EQ computation of activeDmxProcess_STFT(),
+                dispatched to the AVX2 kernels of FDK_dspFuncs
+
+*******************************************************************************/
+
+#include "x86/FDK_x86_funcs.h"
+
+#if defined(FDK_X86_SIMD)
+#define FUNCTION_activeDmxProcess_STFT_func1
+#define FUNCTION_activeDmxProcess_STFT_func3
+#endif
+
+#ifdef FUNCTION_activeDmxProcess_STFT_func1
+static void activeDmxProcess_STFT_func1(FIXP_DBL* RESTRICT inputBuffer,
+                                        FIXP_DBL* RESTRICT realizedSig,
+                                        FIXP_DBL* RESTRICT targetEnergy, const UINT* erbFreqIdx,
+                                        const FIXP_DBL* eq_ptr, const FIXP_DMX_H dmxMatrixL_FDK,
+                                        const FIXP_DMX_H dmxMatrixH_FDK, const UINT erb_is4GVH_L,
+                                        const UINT erb_is4GVH_H, const INT chOut_exp,
+                                        const INT dmx_iterations, const INT* inBufStftHeadroom) {
+  RAM_ALIGN FIXP_DBL dmxCoeff[STFT_ERB_BANDS];
+  RAM_ALIGN INT targetExp[STFT_ERB_BANDS];
+  UINT erb = activeDmxGetErbCoeffs(dmxCoeff, targetExp, eq_ptr, dmxMatrixL_FDK, dmxMatrixH_FDK,
+                                   erb_is4GVH_L, erb_is4GVH_H, chOut_exp, dmx_iterations);
+
+  /* The Nyquist value in the imaginary part of the DC bin counts to the last processed erb */
+  FIXP_DBL savIm0 = inputBuffer[1];
+  inputBuffer[1] = FIXP_DBL(0);
+  FDK_dspFuncs.stftDmxBands(realizedSig, inputBuffer, targetEnergy, erbFreqIdx, dmxCoeff,
+                            inBufStftHeadroom, targetExp, erb);
+  inputBuffer[1] = savIm0;
+
+  erb--; /* switch back to last erb */
+  FIXP_DBL tmpIm = fMult(dmxCoeff[erb], savIm0 << inBufStftHeadroom[erb]);
+  realizedSig[1] = fAddSaturate(realizedSig[1], (tmpIm >> inBufStftHeadroom[erb]));
+  targetEnergy[erb] += (fPow2Div2(tmpIm) >> targetExp[erb]);
+}
+#endif /* FUNCTION_activeDmxProcess_STFT_func1 */
+
+#ifdef FUNCTION_activeDmxProcess_STFT_func3
+static void activeDmxProcess_STFT_func3(FIXP_DBL* RESTRICT targetEne,
+                                        FIXP_DBL* RESTRICT realizedSig,
+                                        FIXP_DBL* RESTRICT realizedEne, FIXP_DBL* RESTRICT eqGain,
+                                        const UINT* erbFreqIdx, const INT numErbBands,
+                                        const SCHAR* inBufStftHeadroomPrev,
+                                        const SCHAR* realizedSigHeadroomPrev, const INT eq_e) {
+  SCHAR eqGainExp[STFT_ERB_BANDS];
+
+  FDK_ASSERT((erbFreqIdx == erb_freq_idx_256_58) && (numErbBands == STFT_ERB_BANDS));
+
+  /* The EQ values of all erb at once, the same as computeEQAndClip() per erb */
+  FDK_dspFuncs.stftDmxEq(eqGain, eqGainExp, targetEne, realizedEne, inBufStftHeadroomPrev,
+                         realizedSigHeadroomPrev, eq_e, STFT_ERB_BANDS);
+  activeDmxApplyEQ(realizedSig, eqGain, eqGainExp);
+}
+#endif /* FUNCTION_activeDmxProcess_STFT_func3 */
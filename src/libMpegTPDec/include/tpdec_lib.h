@@ -474,6 +474,77 @@ int transportDec_SetAsiParsing(HANDLE_TRANSPORTDEC hTpDec, AUDIO_SCENE_INFO* pAS
 TRANSPORTDEC_ERROR transportDec_FillData(const HANDLE_TRANSPORTDEC hTp, const UCHAR* pBuffer,
                                          const UINT bufferSize, UINT* pBytesValid, const INT layer);
 
+/**
+ * \brief Fill the internal input buffer of a packet based transport format with one transport
+ *  frame split across several external buffers, e.g. network buffers, in one pass.
+ *
+ * \param hTp         Handle of transportDec.
+ * \param pBuffer     Pointers to the external input buffers, in bitstream order.
+ * \param bufferSize  Sizes in bytes of the external input buffers.
+ * \param numBuffers  Number of external input buffers.
+ * \param layer       The layer the bitstream belongs to.
+ * \return            Error code. TRANSPORTDEC_TOO_MANY_BITS if the data does not fit the internal
+ *                    input buffer or the previous transport frame is not consumed yet.
+ */
+TRANSPORTDEC_ERROR transportDec_FillDataGather(const HANDLE_TRANSPORTDEC hTp,
+                                               const UCHAR* const pBuffer[],
+                                               const UINT bufferSize[], const UINT numBuffers,
+                                               const INT layer);
+
+/**
+ * \brief Let the transport decoder of a packet based transport format parse one transport frame
+ *  directly from an external buffer instead of copying it into the internal input buffer. The
+ *  bitstream reader wraps around at bufferCapacity bytes and may read ahead up to that size.
+ *  The external buffer has to stay valid and unchanged until it is released by calling this
+ *  function with pBuffer set to NULL, which also happens implicitly with the next
+ *  transportDec_FillData() call or a reset.
+ *
+ * \param hTp             Handle of transportDec.
+ * \param pBuffer         Pointer to the external input buffer, NULL to release it and drop all
+ *                        data not consumed yet.
+ * \param bufferSize      Number of valid bytes in the external input buffer.
+ * \param bufferCapacity  Readable size in bytes of the external input buffer, a power of two not
+ *                        smaller than bufferSize.
+ * \param layer           The layer the bitstream belongs to.
+ * \return                Error code.
+ */
+TRANSPORTDEC_ERROR transportDec_FillDataInPlace(const HANDLE_TRANSPORTDEC hTp,
+                                                const UCHAR* pBuffer, const UINT bufferSize,
+                                                const UINT bufferCapacity, const INT layer);
+
+/**
+ * \brief Entry of the MHAS packet index built by transportDec_ScanMhas().
+ */
+typedef struct {
+  UINT offset;        /*!< Byte offset of the packet in the scanned buffer. */
+  UINT size;          /*!< Size of the packet in bytes including its header. */
+  UINT payloadLength; /*!< MHASPacketLength, the size of the packet payload in bytes. */
+  UINT label;         /*!< MHASPacketLabel. */
+  USHORT type;        /*!< MHASPacketType, see ::mha_pactyp_t. */
+  UCHAR isRap;        /*!< 1 for a random access point: configuration, audio scene info and sync
+                           packets, and frame packets with the usacIndependencyFlag set. */
+} TPDEC_MHAS_PACKET;
+
+/**
+ * \brief Index the MHAS packets of a byte buffer starting at a packet boundary without decoding
+ *  them. Only the packet headers are read, so the scan needs neither a transport decoder instance
+ *  nor any memory besides the index.
+ *
+ * \param pBuffer        Pointer to the MHAS stream data.
+ * \param bufferSize     Size of the MHAS stream data in bytes.
+ * \param pPackets       Index entries written for the complete packets found.
+ * \param maxPackets     Number of entries of pPackets.
+ * \param pNumPackets    Returns the number of packets indexed.
+ * \param pBytesScanned  Returns the number of bytes of the indexed packets, i.e. the offset to
+ *                       resume scanning at.
+ * \return               TRANSPORTDEC_OK if the scan stopped at the end of the buffer or after
+ *                       maxPackets packets, TRANSPORTDEC_NOT_ENOUGH_BITS if the buffer ends within
+ *                       a packet and TRANSPORTDEC_SYNC_ERROR at an invalid packet.
+ */
+TRANSPORTDEC_ERROR transportDec_ScanMhas(const UCHAR* pBuffer, const UINT bufferSize,
+                                         TPDEC_MHAS_PACKET* pPackets, const UINT maxPackets,
+                                         UINT* pNumPackets, UINT* pBytesScanned);
+
 /**
  * \brief      Get transportDec bitstream handle.
  * \param hTp  Pointer to a transport decoder handle.
@@ -594,6 +594,18 @@ int transportDec_SetAsiParsing(HANDLE_TRANSPORTDEC hTpDec, AUDIO_SCENE_INFO* pAS
   return 0;
 }
 
+/* Let the bitstream reader of a layer read from the internal buffer again after
+ * transportDec_FillDataInPlace(), dropping all data not consumed yet. */
+static void transportDec_UseInternalBuffer(HANDLE_TRANSPORTDEC hTp, const INT layer) {
+  HANDLE_FDK_BITSTREAM hBs = &hTp->bitStream[layer];
+
+  if (hBs->hBitBuf.Buffer != hTp->bsBuffer) {
+    FDKinitBitStream(hBs, hTp->bsBuffer, (65536 * 1), 0, BS_READER);
+  } else {
+    FDKresetBitbuffer(hBs);
+  }
+}
+
 TRANSPORTDEC_ERROR transportDec_FillData(const HANDLE_TRANSPORTDEC hTp, const UCHAR* pBuffer,
                                          const UINT bufferSize, UINT* pBytesValid,
                                          const INT layer) {
@@ -608,7 +620,7 @@ TRANSPORTDEC_ERROR transportDec_FillData(const HANDLE_TRANSPORTDEC hTp, const UC
 
   if (TT_IS_PACKET(hTp->transportFmt)) {
     if (hTp->numberOfRawDataBlocks == 0) {
-      FDKresetBitbuffer(hBs);
+      transportDec_UseInternalBuffer(hTp, layer);
       FDKfeedBuffer(hBs, pBuffer, bufferSize, pBytesValid);
       if (*pBytesValid != 0) {
         return TRANSPORTDEC_TOO_MANY_BITS;
@@ -637,6 +649,68 @@ TRANSPORTDEC_ERROR transportDec_FillData(const HANDLE_TRANSPORTDEC hTp, const UC
   return TRANSPORTDEC_OK;
 }
 
+TRANSPORTDEC_ERROR transportDec_FillDataGather(const HANDLE_TRANSPORTDEC hTp,
+                                               const UCHAR* const pBuffer[],
+                                               const UINT bufferSize[], const UINT numBuffers,
+                                               const INT layer) {
+  HANDLE_FDK_BITSTREAM hBs;
+
+  if ((hTp == NULL) || (layer >= TPDEC_MAX_LAYERS) || !TT_IS_PACKET(hTp->transportFmt)) {
+    return TRANSPORTDEC_INVALID_PARAMETER;
+  }
+  if (hTp->numberOfRawDataBlocks != 0) {
+    /* The previous access unit is not consumed yet */
+    return TRANSPORTDEC_TOO_MANY_BITS;
+  }
+
+  hBs = &hTp->bitStream[layer];
+  transportDec_UseInternalBuffer(hTp, layer);
+  for (UINT i = 0; i < numBuffers; i++) {
+    UINT bytesValid = bufferSize[i];
+
+    FDKfeedBuffer(hBs, pBuffer[i], bufferSize[i], &bytesValid);
+    if (bytesValid != 0) {
+      FDKresetBitbuffer(hBs);
+      return TRANSPORTDEC_TOO_MANY_BITS;
+    }
+  }
+
+  return TRANSPORTDEC_OK;
+}
+
+TRANSPORTDEC_ERROR transportDec_FillDataInPlace(const HANDLE_TRANSPORTDEC hTp,
+                                                const UCHAR* pBuffer, const UINT bufferSize,
+                                                const UINT bufferCapacity, const INT layer) {
+  if ((hTp == NULL) || (layer >= TPDEC_MAX_LAYERS) || !TT_IS_PACKET(hTp->transportFmt)) {
+    return TRANSPORTDEC_INVALID_PARAMETER;
+  }
+
+  if (pBuffer == NULL) {
+    /* Release the caller's buffer, data not consumed yet is dropped */
+    if (hTp->bitStream[layer].hBitBuf.Buffer != hTp->bsBuffer) {
+      hTp->numberOfRawDataBlocks = 0;
+    }
+    transportDec_UseInternalBuffer(hTp, layer);
+    return TRANSPORTDEC_OK;
+  }
+
+  /* The bit buffer wraps around at its size, which therefore has to be a power of two */
+  if ((bufferSize > bufferCapacity) || (bufferCapacity > MAX_BUFSIZE_BYTES) ||
+      (bufferCapacity & (bufferCapacity - 1)) || (bufferCapacity < 8)) {
+    return TRANSPORTDEC_INVALID_PARAMETER;
+  }
+  if (hTp->numberOfRawDataBlocks != 0) {
+    /* The previous access unit is not consumed yet */
+    return TRANSPORTDEC_TOO_MANY_BITS;
+  }
+
+  /* The bitstream reader never writes to its buffer */
+  FDKinitBitStream(&hTp->bitStream[layer], (UCHAR*)pBuffer, bufferCapacity, bufferSize << 3,
+                   BS_READER);
+
+  return TRANSPORTDEC_OK;
+}
+
 HANDLE_FDK_BITSTREAM transportDec_GetBitstream(const HANDLE_TRANSPORTDEC hTp, const UINT layer) {
   return &hTp->bitStream[layer];
 }
@@ -1849,7 +1923,7 @@ TRANSPORTDEC_ERROR transportDec_SetParam(const HANDLE_TRANSPORTDEC hTp, const TP
       int i;
 
       for (i = 0; i < TPDEC_MAX_TRACKS; i++) {
-        FDKresetBitbuffer(&hTp->bitStream[i]);
+        transportDec_UseInternalBuffer(hTp, i);
         hTp->auLength[i] = 0;
         hTp->accessUnitAnchor[i] = 0;
         hTp->ctrlCFGChange[i].Mpegh3daConfigLen = 0;
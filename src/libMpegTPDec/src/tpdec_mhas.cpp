@@ -0,0 +1,208 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************* MPEG transport format decoder library *********************
+
+   Author(s):
+
+   Description: MHAS packet index
+
+*******************************************************************************/
+
+#include "tpdec_lib.h"
+
+/* The transport decoder does not take larger MHAS packets either */
+#define MHAS_MAX_PACKET_LENGTH (65536 * 1)
+
+/* Read nBits <= 32 bits at *pBitPos of a byte buffer, the caller checks the buffer size. */
+static UINT mhasReadBits(const UCHAR* pBuffer, UINT* pBitPos, UINT nBits) {
+  UINT bitPos = *pBitPos;
+  UINT value = 0;
+
+  *pBitPos += nBits;
+  while (nBits > 0) {
+    const UINT bitsInByte = 8 - (bitPos & 7);
+    const UINT n = (nBits < bitsInByte) ? nBits : bitsInByte;
+
+    value = (value << n) | ((pBuffer[bitPos >> 3] >> (bitsInByte - n)) & ((1u << n) - 1));
+    bitPos += n;
+    nBits -= n;
+  }
+
+  return value;
+}
+
+/* Read an escapedValue() of an MHAS packet header, returns 0 if the buffer ends before it. */
+static int mhasEscapedValue(const UCHAR* pBuffer, const UINT bufferBits, UINT* pBitPos,
+                            UINT* pValue, const UINT nBits1, const UINT nBits2,
+                            const UINT nBits3) {
+  UINT value, escape;
+
+  if (*pBitPos + nBits1 > bufferBits) return 0;
+  value = mhasReadBits(pBuffer, pBitPos, nBits1);
+  if (value == (1u << nBits1) - 1) {
+    if (*pBitPos + nBits2 > bufferBits) return 0;
+    escape = mhasReadBits(pBuffer, pBitPos, nBits2);
+    value += escape;
+    if (escape == (1u << nBits2) - 1) {
+      if (*pBitPos + nBits3 > bufferBits) return 0;
+      value += mhasReadBits(pBuffer, pBitPos, nBits3);
+    }
+  }
+  *pValue = value;
+
+  return 1;
+}
+
+TRANSPORTDEC_ERROR transportDec_ScanMhas(const UCHAR* pBuffer, const UINT bufferSize,
+                                         TPDEC_MHAS_PACKET* pPackets, const UINT maxPackets,
+                                         UINT* pNumPackets, UINT* pBytesScanned) {
+  TRANSPORTDEC_ERROR err = TRANSPORTDEC_OK;
+  UINT offset = 0, numPackets = 0;
+
+  if ((pBuffer == NULL) || (pPackets == NULL) || (pNumPackets == NULL) ||
+      (pBytesScanned == NULL) || (bufferSize > (MAX_BUFSIZE_BYTES))) {
+    return TRANSPORTDEC_INVALID_PARAMETER;
+  }
+
+  /* Only the packet headers are read, the payloads are skipped */
+  while ((offset < bufferSize) && (numPackets < maxPackets)) {
+    const UCHAR* pPacket = pBuffer + offset;
+    /* A header has at most 120 bits */
+    const UINT headerBits = ((bufferSize - offset) < 16 ? (bufferSize - offset) : 16) << 3;
+    UINT bitPos = 0, type, label, length, headerLength;
+
+    if (!mhasEscapedValue(pPacket, headerBits, &bitPos, &type, 3, 8, 8) ||
+        !mhasEscapedValue(pPacket, headerBits, &bitPos, &label, 2, 8, 32) ||
+        !mhasEscapedValue(pPacket, headerBits, &bitPos, &length, 11, 24, 24)) {
+      err = TRANSPORTDEC_NOT_ENOUGH_BITS;
+      break;
+    }
+    if (length > MHAS_MAX_PACKET_LENGTH) {
+      err = TRANSPORTDEC_SYNC_ERROR;
+      break;
+    }
+    /* The escape codes add whole bytes to the 16 bits of the shortest header */
+    headerLength = bitPos >> 3;
+    if (length > bufferSize - offset - headerLength) {
+      err = TRANSPORTDEC_NOT_ENOUGH_BITS;
+      break;
+    }
+
+    TPDEC_MHAS_PACKET* pIndex = &pPackets[numPackets];
+    pIndex->offset = offset;
+    pIndex->size = headerLength + length;
+    pIndex->payloadLength = length;
+    pIndex->label = label;
+    pIndex->type = (USHORT)type;
+    switch (type) {
+      case MHA_PACTYP_SYNC:
+        if ((length != 1) || (label != 0) || (pPacket[headerLength] != 0xA5)) {
+          err = TRANSPORTDEC_SYNC_ERROR;
+        }
+        pIndex->isRap = 1;
+        break;
+      case MHA_PACTYP_MPEGH3DACFG:
+      case MHA_PACTYP_AUDIOSCENEINFO:
+        pIndex->isRap = 1;
+        break;
+      case MHA_PACTYP_MPEGH3DAFRAME:
+        /* usacIndependencyFlag */
+        pIndex->isRap = (length > 0) ? (pPacket[headerLength] >> 7) : 0;
+        break;
+      default:
+        pIndex->isRap = 0;
+        break;
+    }
+    if (err != TRANSPORTDEC_OK) {
+      break;
+    }
+
+    numPackets++;
+    offset += pIndex->size;
+  }
+
+  *pNumPackets = numPackets;
+  *pBytesScanned = offset;
+
+  return err;
+}
@@ -987,12 +987,37 @@ typedef enum {
   AAC_ADDITIONAL_STEREO_DMX =
       0x0908, /*!<  Additional stereo downmix. 0: Disabled (default), 1: Enabled */
   AAC_MPEGH_GOA_ENABLE = 0x0909, /*!<  Export object meta data for 3D post processing */
+  AAC_ACTIVE_DMX_TIER =
+      0x090A, /*!< Quality/complexity tier of the active downmix of channel content to the target
+                 layout.\n 0: Full quality (default). The EQ of each of the 58 ERB bands is updated
+                 every STFT frame.\n 1: Medium. The EQ is shared by 2 ERB bands and updated every
+                 2nd STFT frame.\n 2: Low. The EQ is shared by 4 ERB bands and updated every 4th
+                 STFT frame.\n The phase aligned downmix itself is computed every frame in all
+                 tiers. Can be changed at any time, it takes effect with the next frame. */
 
   AAC_EQ_FILTER_ATTENUATION_VECTOR =
-      0x0A00 /*!< One-dimensional vector of the length 32 where every 32bit value is in Q31 format.
-                Each value represents an attenuation factor which will be applied to the according
-                subband in frequency domain. Note that the whole frequency range (f_s/2) is divided
-                in 32 equidistant subbands. */
+      0x0A00, /*!< One-dimensional vector of the length 32 where every 32bit value is in Q31 format.
+                 Each value represents an attenuation factor which will be applied to the according
+                 subband in frequency domain. Note that the whole frequency range (f_s/2) is divided
+                 in 32 equidistant subbands. */
+
+  AAC_PIPELINED_DECODE =
+      0x0B00, /*!< Pipelined decoding. 0: Disabled (default), 1: Enabled.\n Each
+                 aacDecoder_DecodeFrame() call renders the frame decoded by the previous call while
+                 the next access unit is core decoded, in parallel tasks if a task executor is set
+                 with aacDecoder_SetTaskExecutor(). This adds one frame of latency: the first call
+                 returns ::AAC_DEC_INTERMEDIATE_OK without output and CStreamInfo::numPendingFrames
+                 tells whether a frame is held back. Call aacDecoder_DecodeFrame() with
+                 ::AACDEC_FLUSH to output it at the end of the stream. Parameter changes apply to
+                 the held back frame as well. */
+
+  AAC_SIGNAL_EXPORT =
+      0x0B01 /*!< Signal export of MPEG-H streams. 0: Disabled (default), 1: Enabled.\n Format
+                conversion, object rendering and everything after it are skipped. The decoded
+                channel and object signals, after user interactivity and DRC 1, and the object
+                metadata are returned by aacDecoder_GetSignals() instead, pTimeData of
+                aacDecoder_DecodeFrame() is not written and render targets get no output. Cannot
+                be combined with ::AAC_PIPELINED_DECODE. Takes effect with the next frame. */
 
 } AACDEC_PARAM;
 
@@ -1100,10 +1125,116 @@ typedef struct {
   /* Others */
   UCHAR fBsRestartOk; /*!< Flag indicating decoder context was synchronized. Set at error free
                          independent frames. */
+  UCHAR numPendingFrames; /*!< Number of decoded frames held back for output by the next call, see
+                             ::AAC_PIPELINED_DECODE. */
 } CStreamInfo;
 
 typedef struct AAC_DECODER_INSTANCE* HANDLE_AACDECODER; /*!< Pointer to a AAC decoder instance. */
 
+/**
+ * \brief Caller-supplied executor for independent tasks of one decoder call, see
+ * aacDecoder_SetTaskExecutor().
+ */
+typedef struct {
+  void (*execute)(void* context, void (*task)(void* taskData, INT taskIndex), void* taskData,
+                  INT numTasks); /*!< Run task(taskData, i) for every i in [0, numTasks), possibly
+                                    concurrently, and return when all of them have finished. A
+                                    task may wait for another task that is already running. */
+  void* context;                 /*!< Opaque pointer handed to execute(). */
+  INT maxWorkers; /*!< Maximum number of tasks per execute() call, 1 disables parallel decoding. */
+} AACDEC_TASK_EXECUTOR;
+
+/**
+ * \brief Loudspeaker of a custom target layout, see aacDecoder_RegisterTargetLayout().
+ */
+typedef struct {
+  INT azimuth;   /*!< Azimuth angle in degrees from -180 to 180, positive values to the left. */
+  INT elevation; /*!< Elevation angle in degrees from -90 to 90. */
+  INT isLfe;     /*!< 1 for an LFE loudspeaker, 0 otherwise. */
+} AACDEC_SPEAKER;
+
+/**
+ * \brief Setup cost of the object renderer for a target layout, see
+ * aacDecoder_RegisterTargetLayout().
+ */
+typedef struct {
+  UINT numTriangles;     /*!< Number of loudspeaker triangles used for panning. */
+  UINT numGhostSpeakers; /*!< Number of ghost speakers added to close gaps of the layout. */
+  UINT meshShared; /*!< 1 if the triangles were already built for an earlier registration or
+                        decoder instance with the same layout. */
+} AACDEC_LAYOUT_SETUP_INFO;
+
+/**
+ * \brief Decoded signal before rendering, see aacDecoder_GetSignals().
+ */
+typedef struct {
+  const INT_PCM* pSamples; /*!< CStreamInfo::frameSize samples with AACDEC_SIGNALS::headroom bits
+                                of headroom. Valid until the next aacDecoder_DecodeFrame() call of
+                                this decoder or of one sharing its work buffers. */
+  SHORT group;     /*!< Index of the signal group in AACDEC_SIGNALS::pGroups. */
+  SHORT azimuth;   /*!< Azimuth of the loudspeaker of a channel signal in degrees, positive values
+                        to the left. 0 for other signals. */
+  SHORT elevation; /*!< Elevation of the loudspeaker of a channel signal in degrees. */
+  SHORT isLfe;     /*!< 1 for an LFE channel signal, 0 otherwise. */
+} AACDEC_SIGNAL;
+
+/**
+ * \brief Signal group of the decoded audio scene, see aacDecoder_GetSignals().
+ */
+typedef struct {
+  UCHAR type;        /*!< 0: Channels, 1: Objects, 2: SAOC, 3: HOA. */
+  UCHAR layout;      /*!< CICP speaker layout index of a channel signal group, 0 if its
+                          loudspeakers are listed individually. 0 for other groups. */
+  UCHAR firstSignal; /*!< Index of the first signal of the group in AACDEC_SIGNALS::pSignals. */
+  UCHAR numSignals;  /*!< Number of signals of the group. */
+} AACDEC_SIGNAL_GROUP;
+
+/**
+ * \brief Object metadata of one object signal at one point in time, see aacDecoder_GetSignals().
+ * The object reaches these values at sampleOffset, they are interpolated linearly from its
+ * previous entry.
+ */
+typedef struct {
+  INT sampleOffset;    /*!< Sample position counted from the first sample of AACDEC_SIGNAL::pSamples
+                            of this frame. Positions beyond CStreamInfo::frameSize are reached in
+                            the next frame. */
+  USHORT signal;       /*!< Index of the object signal in AACDEC_SIGNALS::pSignals. */
+  SHORT azimuth;       /*!< Azimuth in 1/100 degrees from -18000 to 18000, positive values to the
+                            left. */
+  SHORT elevation;     /*!< Elevation in 1/100 degrees from -9000 to 9000. */
+  USHORT radius;       /*!< Distance in 1/256 meters. */
+  USHORT gain;         /*!< Linear gain, 4096 is 0 dB. */
+  USHORT spreadWidth;  /*!< Spread width in 1/100 degrees, the spread in all dimensions for objects
+                            with uniform spread. */
+  USHORT spreadHeight; /*!< Spread height in 1/100 degrees, 0 for uniform spread. */
+  USHORT spreadDepth;  /*!< Spread depth in 1/256 meters, 0 for uniform spread. */
+} AACDEC_OBJECT_METADATA;
+
+/**
+ * \brief Decoded signals and object metadata of a frame, see aacDecoder_GetSignals(). The arrays
+ * are owned by the decoder and valid until the next aacDecoder_DecodeFrame() call.
+ */
+typedef struct {
+  const AACDEC_SIGNAL* pSignals; /*!< Active signals, in signal group order. */
+  INT numSignals;                /*!< Number of entries of pSignals, 0 if the last
+                                      aacDecoder_DecodeFrame() call did not output a frame. */
+  const AACDEC_SIGNAL_GROUP* pGroups; /*!< Active signal groups. */
+  INT numGroups;                      /*!< Number of entries of pGroups. */
+  const AACDEC_OBJECT_METADATA* pObjectMetadata; /*!< Object metadata of all object signals, in
+                                                      ascending sampleOffset per object. */
+  INT numObjectMetadata;                         /*!< Number of entries of pObjectMetadata. */
+  INT headroom; /*!< Bits of headroom of the samples. Shifting them left by headroom with
+                     saturation gives full scale output samples. */
+  INT delay;    /*!< Delay of the signals in samples, which the rendered output compensates at
+                     the start of the stream. */
+} AACDEC_SIGNALS;
+
+#define AACDEC_MAX_RENDER_TARGETS \
+  3 /*!< Maximum number of target layouts added with aacDecoder_AddRenderTarget(). */
+
+typedef struct AACDEC_SCRATCH* HANDLE_AACDEC_SCRATCH; /*!< Pointer to a set of work buffers which can
+                                                          be shared by decoder instances. */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -1210,6 +1341,40 @@ LINKSPEC_H AAC_DECODER_ERROR aacDecoder_ConfigRaw(HANDLE_AACDECODER self, UCHAR*
 LINKSPEC_H AAC_DECODER_ERROR aacDecoder_Fill(HANDLE_AACDECODER self, const UCHAR* const pBuffer[],
                                              const UINT bufferSize[], UINT* bytesValid);
 
+#define AACDEC_MAX_SPANS 16 /*!< Maximum number of spans passed to aacDecoder_FillSpans(). */
+
+/**
+ * \brief Span of caller-owned bitstream data, see aacDecoder_FillSpans().
+ */
+typedef struct {
+  const UCHAR* pData; /*!< Pointer to the bitstream data. */
+  UINT size;          /*!< Number of valid bytes at pData. */
+  UINT capacity;      /*!< Number of readable bytes at pData, not smaller than size. 0 is the
+                           same as size. */
+} AACDEC_SPAN;
+
+/**
+ * \brief Hand one complete transport frame of a packet based transport format
+ * (::TT_MHAS_PACKETIZED, ::TT_MHA_RAW), split across one or more caller-owned spans, to the
+ * decoder.
+ *
+ * A single span whose capacity is a power of two is parsed in place without copying it. The
+ * decoder may read ahead up to capacity bytes, and the span has to stay valid and unchanged until
+ * it is released by calling this function with numSpans set to 0. The next aacDecoder_Fill() or
+ * aacDecoder_FillSpans() call releases it as well. Releasing drops all data not decoded yet.
+ * Otherwise the spans are gathered into the decoder-internal input buffer in one pass, which
+ * saves concatenating them beforehand.
+ *
+ * \param self      AAC decoder handle.
+ * \param pSpans    Spans holding the transport frame in bitstream order.
+ * \param numSpans  Number of spans, 0 to release a span parsed in place.
+ * \return          Error code. ::AAC_DEC_INVALID_PARAM if the transport format is not packet
+ *                  based, ::AAC_DEC_UNKNOWN if the data does not fit the internal input buffer or
+ *                  the previous transport frame is not decoded yet.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_FillSpans(HANDLE_AACDECODER self,
+                                                  const AACDEC_SPAN* pSpans, UINT numSpans);
+
 #define AACDEC_CONCEAL                                                                    \
   1 /*!< Flag for aacDecoder_DecodeFrame(): Trigger the built-in error concealment module \
            to generate a substitute signal for one lost frame. New input data will not be \
@@ -1258,6 +1423,175 @@ LINKSPEC_H void aacDecoder_Close(HANDLE_AACDECODER self);
  */
 LINKSPEC_H CStreamInfo* aacDecoder_GetStreamInfo(HANDLE_AACDECODER self);
 
+/**
+ * \brief   Allocate a set of work buffers, that can be shared by several decoder instances. The
+ *          buffers only hold data during a call of aacDecoder_ConfigRaw(), aacDecoder_Fill() or
+ *          aacDecoder_DecodeFrame(). Instances sharing them must therefore never be called
+ *          concurrently, e.g. by driving all of them from the same thread.
+ * \return  Handle of the work buffers, NULL on failure.
+ */
+LINKSPEC_H HANDLE_AACDEC_SCRATCH aacDecoder_OpenScratch(void);
+
+/**
+ * \brief           Free a set of work buffers. No decoder instance may be using them anymore.
+ * \param hScratch  Handle of the work buffers.
+ * \return          void.
+ */
+LINKSPEC_H void aacDecoder_CloseScratch(HANDLE_AACDEC_SCRATCH hScratch);
+
+/**
+ * \brief           Let a decoder instance use a shared set of work buffers instead of its own
+ *                  ones. The own work buffers are freed while a shared set is in use.
+ * \param self      AAC decoder handle.
+ * \param hScratch  Handle of the work buffers, see aacDecoder_OpenScratch(). NULL switches back to
+ *                  work buffers owned by the instance.
+ * \return          Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_SetScratch(HANDLE_AACDECODER self,
+                                                   HANDLE_AACDEC_SCRATCH hScratch);
+
+/**
+ * \brief            Decode the channels of a frame in parallel tasks. The per-element spectral
+ *                   processing and the per-channel inverse transform, LTP postfilter and
+ *                   concealment are split into at most maxWorkers tasks. The output does not depend
+ *                   on the number of tasks.
+ * \param self       AAC decoder handle.
+ * \param pExecutor  Task executor, the structure is copied. NULL or maxWorkers < 2 selects serial
+ *                   decoding.
+ * \return           Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_SetTaskExecutor(HANDLE_AACDECODER self,
+                                                        const AACDEC_TASK_EXECUTOR* pExecutor);
+
+/**
+ * \brief                   Get the heap memory of an MPEG-H decoder instance without keeping one.
+ *                          A temporary instance and renderers for the worst case configuration are
+ *                          opened and closed, their requests are forwarded to the allocator of the
+ *                          calling thread. The call therefore allocates about as much memory as it
+ *                          reports, and returns ::AAC_DEC_OUT_OF_MEMORY if it is not available.
+ *
+ * \param targetLayout      CICP index of the target layout.
+ * \param maxInputChannels  Maximum number of channel based signals.
+ * \param maxObjects        Maximum number of object signals.
+ * \param pPersistentMem    Pointer to variable receiving the bytes of state memory.
+ * \param pScratchMem       Pointer to variable receiving the bytes of work buffers which do not
+ *                          carry data from one frame to the next.
+ * \return                  Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_GetRequiredMemory(const INT targetLayout,
+                                                          const INT maxInputChannels,
+                                                          const INT maxObjects,
+                                                          UINT* pPersistentMem, UINT* pScratchMem);
+
+/**
+ * \brief                 Make an arbitrary loudspeaker layout available as target layout. The
+ *                        object renderer setup of the layout is built once and shared by all
+ *                        decoder instances of the process. Layouts matching a CICP layout get
+ *                        the CICP index.
+ *
+ * \param pSpeakers       Array of numSpeakers loudspeakers.
+ * \param numSpeakers     Number of loudspeakers including LFEs, at most 24.
+ * \param pTargetLayout   Pointer to variable receiving the index to be set with
+ *                        ::AAC_TARGET_LAYOUT_CICP.
+ * \param pInfo           Pointer to variable receiving the setup cost of the object renderer.
+ * \return                Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_RegisterTargetLayout(const AACDEC_SPEAKER* pSpeakers,
+                                                             const INT numSpeakers,
+                                                             INT* pTargetLayout,
+                                                             AACDEC_LAYOUT_SETUP_INFO* pInfo);
+
+/**
+ * \brief                 Copy the object renderer setup (speaker triangles, inverse matrices and
+ *                        ghost speaker downmix) of a target layout in binary form, building it
+ *                        first if no decoder instance of the process did. The data is valid for
+ *                        builds of the same version and byte order.
+ *
+ * \param targetLayout    CICP index or index of aacDecoder_RegisterTargetLayout().
+ * \param pData           Output buffer, NULL to query the size only.
+ * \param pSize           Pointer to the size of pData, receives the number of bytes of the mesh.
+ * \return                Error code, ::AAC_DEC_INVALID_PARAM if pData is too small.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_ExportSpeakerMesh(const INT targetLayout, void* pData,
+                                                          UINT* pSize);
+
+/**
+ * \brief                 Add an object renderer setup of aacDecoder_ExportSpeakerMesh() to the
+ *                        process, so that decoder instances for its target layout skip the
+ *                        triangulation.
+ *
+ * \param pData           Data returned by aacDecoder_ExportSpeakerMesh().
+ * \param size            Number of bytes of pData.
+ * \return                Error code, ::AAC_DEC_INVALID_PARAM if pData is no mesh of this build.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_ImportSpeakerMesh(const void* pData, const UINT size);
+
+/**
+ * \brief                 Render an additional target layout from the same core decoding. The
+ *                        channel and object signals are format converted and rendered once per
+ *                        target layout, then limited into the buffer set with
+ *                        aacDecoder_SetRenderTargetBuffer() by every aacDecoder_DecodeFrame() call
+ *                        that outputs a frame to pTimeData. Must be called before the decoder is
+ *                        configured.
+ *
+ *                        DRC and loudness normalization are selected for and shared with the
+ *                        layout set with ::AAC_TARGET_LAYOUT_CICP. A downmix matrix transmitted in
+ *                        the stream applies to that layout only, render targets use the generated
+ *                        format conversion. The limiter attack and release times and the
+ *                        ::AAC_ACTIVE_DMX_TIER apply to all layouts.
+ *
+ * \param self            AAC decoder handle.
+ * \param targetLayout    CICP index of the target layout, or an index of
+ *                        aacDecoder_RegisterTargetLayout().
+ * \param pIndex          Pointer to variable receiving the index of the render target, counting
+ *                        from 0 up to ::AACDEC_MAX_RENDER_TARGETS - 1.
+ * \return                Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_AddRenderTarget(HANDLE_AACDECODER self,
+                                                        const INT targetLayout, INT* pIndex);
+
+/**
+ * \brief                 Set the output buffer of a render target. The buffer is kept for the
+ *                        following aacDecoder_DecodeFrame() calls.
+ *
+ * \param self            AAC decoder handle.
+ * \param index           Index of the render target.
+ * \param pTimeData       Interleaved output buffer, or NULL if the render target is not output.
+ * \param timeDataSize    Size of the output buffer in samples.
+ * \return                Error code.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_SetRenderTargetBuffer(HANDLE_AACDECODER self,
+                                                              const INT index,
+                                                              INT_PCM* pTimeData,
+                                                              const INT timeDataSize);
+
+/**
+ * \brief                 Get the stream info of a render target. It equals the one of
+ *                        aacDecoder_GetStreamInfo() except for the description of the output
+ *                        signal, and is valid until the next call. A frameSize of 0 means that
+ *                        the last aacDecoder_DecodeFrame() call did not output to the render
+ *                        target.
+ *
+ * \param self            AAC decoder handle.
+ * \param index           Index of the render target.
+ * \return                Pointer to the stream info, NULL for an invalid index.
+ */
+LINKSPEC_H CStreamInfo* aacDecoder_GetRenderTargetInfo(HANDLE_AACDECODER self, const INT index);
+
+/**
+ * \brief                 Get the decoded signals and object metadata of the frame output by the
+ *                        last aacDecoder_DecodeFrame() call with ::AAC_SIGNAL_EXPORT enabled. The
+ *                        samples are not copied, they point into the work buffers of the decoder.
+ *                        CStreamInfo::frameSize and CStreamInfo::sampleRate describe the signals,
+ *                        the core sample rate is not converted.
+ *
+ * \param self            AAC decoder handle.
+ * \param pSignals        Pointer to a structure receiving the signals.
+ * \return                Error code, ::AAC_DEC_INVALID_PARAM if signal export is disabled.
+ */
+LINKSPEC_H AAC_DECODER_ERROR aacDecoder_GetSignals(HANDLE_AACDECODER self,
+                                                   AACDEC_SIGNALS* pSignals);
+
 #ifdef __cplusplus
 }
 #endif
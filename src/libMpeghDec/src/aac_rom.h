@@ -93,6 +93,7 @@ amm-info@iis.fraunhofer.de
 
 #include "common_fix.h"
 #include "FDK_audio.h"
+#include "FDK_huffman.h"
 
 #define PCM_AAC LONG
 #define PCM_DEC FIXP_DBL
@@ -126,16 +127,7 @@ typedef struct {
 extern const SFB_INFO sfbOffsetTables[5][16];
 
 /* Huffman tables */
-enum { HuffmanBits = 2, HuffmanEntries = (1 << HuffmanBits) };
-
-typedef struct {
-  const USHORT (*CodeBook)[HuffmanEntries];
-  UCHAR Dimension;
-  UCHAR numBits;
-  UCHAR Offset;
-} CodeBookDescription;
-
-extern const CodeBookDescription AACcodeBookDescriptionSCL;
+extern const FDK_HUFF_LUT AAChuffLutSCL;
 
 extern const UCHAR tns_max_bands_tbl[13][2];
 
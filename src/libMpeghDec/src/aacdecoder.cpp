@@ -140,6 +140,7 @@ amm-info@iis.fraunhofer.de
 #include "FDK_audio.h"
 
 #include "gVBAPRenderer.h"
+#include "gVBAPRenderer_mesh.h"
 #include "FDK_cicp2geometry.h"
 
 #include "ac_arith_coder.h"
@@ -202,6 +203,30 @@ static int CAacDecoder_GetELChannels(MP4_ELEMENT_ID type) {
   return el_channels;
 }
 
+/*!
+  \brief Get the size of the channel arena
+
+  All config dependent channel and element structures are carved out of one arena. Its size
+  depends on the amount of active channels, channel elements and CPEs of the configuration.
+
+  \return  arena size in bytes
+*/
+static UINT CAacDecoder_GetChannelArenaSize(const int numChannels, const int numElements,
+                                            const int numCpe) {
+  UINT size = numChannels * (ARENA_ALGN_SIZE(sizeof(CAacDecoderChannelInfo)) +
+                         ARENA_ALGN_SIZE(sizeof(CAacDecoderDynamicData)) +
+                         ARENA_ALGN_SIZE(sizeof(CAacDecoderStaticChannelInfo)) +
+                         ARENA_ALGN_SIZE(1024 * sizeof(FIXP_CNCL)) +
+                         ARENA_ALGN_SIZE(OverlapBufferSize * sizeof(FIXP_DBL)));
+  size += numElements * (ARENA_ALGN_SIZE(sizeof(CAacDecoderCommonStaticData)) +
+                         ARENA_ALGN_SIZE(sizeof(CAacDecoderCommonData)));
+  size += numCpe * (ARENA_ALGN_SIZE(sizeof(CJointStereoData)) +
+                    ARENA_ALGN_SIZE(sizeof(CpePersistentData)) +
+                    ARENA_ALGN_SIZE(sizeof(CCplxPredictionData)));
+
+  return size;
+}
+
 /*!
   \brief Reset ancillary data struct. Call before parsing a new frame.
 
@@ -347,6 +372,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_PreRollExtensionPayloadParse(HANDLE_A
   if (preRollPossible == 0) {
     /* Sanity check: if flushing is switched on, preRollPossible must be 1 */
     if (self->flushStatus != AACDEC_FLUSH_OFF) {
+      aacDecoder_SyncPipeline(self);
       /* Mismatch of current payload and flushing status */
       self->flushStatus = AACDEC_FLUSH_OFF;
       ErrorStatus = AAC_DEC_PARSE_ERROR;
@@ -354,6 +380,9 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_PreRollExtensionPayloadParse(HANDLE_A
     goto bail;
   }
 
+  /* The preroll access units replace the state a pending frame is rendered with. */
+  aacDecoder_SyncPipeline(self);
+
   if (self->flags[0] & AC_MPEGH3DA) {
     if (configLength > 0) {
       /* DASH IPF ATSC Config Change: Read new config and compare with current config. Apply
@@ -523,16 +552,15 @@ CAacDecoder_Open(TRANSPORT_TYPE bsFormat) /*!< bitstream format (adif,adts,loas,
   CConcealment_InitCommonData(&self->concealCommonData);
   self->concealMethodUser = ConcealMethodNone; /* undefined -> auto mode */
 
-  self->workBufferCore2 = GetWorkBufferCore2();
-  if (self->workBufferCore2 == NULL) goto bail;
-
   /* When MPEG-H is active use dedicated memory for core decoding */
-  self->pTimeData2 = GetWorkBufferCore5();
   self->timeData2Size = GetRequiredMemWorkBufferCore5();
-  if (self->pTimeData2 == NULL) {
+  if (CAacDecoder_SetScratch(self, NULL) != AAC_DEC_OK) {
     goto bail;
   }
 
+  /* Decode serially until a task executor is set. */
+  self->taskExecutor.maxWorkers = 1;
+
   return self;
 
 bail:
@@ -755,6 +783,8 @@ static AAC_DECODER_ERROR CAacDecoder_InitRenderer(HANDLE_AACDECODER self, const
         pas = pUsc->phaseAlignStrength;
       }
 
+      IIS_FormatConverter_SetDmxTier(self->pFormatConverter[streamIndex], self->activeDmxTier);
+
       /* Set immersive flag */
       if (pUsc->immersiveDownmixFlag != 0) {
         IIS_FormatConverter_Config_SetImmersiveDownmixFlag((self->pFormatConverter[streamIndex]),
@@ -831,13 +861,16 @@ static AAC_DECODER_ERROR CAacDecoder_InitRenderer(HANDLE_AACDECODER self, const
         goto bail;
       }
 
-      /* Applying the decoded downmix matrix and EQs for each signal group */
-      error = applyDownmixMatrixPerSignalGroup(
-          (IIS_FORMATCONVERTER_INTERNAL_HANDLE)(self->pFormatConverter[streamIndex])->member, self,
-          self->pUsacConfig[streamIndex], p_buffer);
-      if (error) {
-        err = AAC_DEC_OUT_OF_MEMORY;
-        goto bail;
+      /* Applying the decoded downmix matrix and EQs for each signal group. They were selected for
+       * the primary target layout, render targets use the generated ones. */
+      if (!self->renderTargetSwapped) {
+        error = applyDownmixMatrixPerSignalGroup(
+            (IIS_FORMATCONVERTER_INTERNAL_HANDLE)(self->pFormatConverter[streamIndex])->member,
+            self, self->pUsacConfig[streamIndex], p_buffer);
+        if (error) {
+          err = AAC_DEC_OUT_OF_MEMORY;
+          goto bail;
+        }
       }
     }
 
@@ -1009,79 +1042,25 @@ static void CAacDecoder_DeInit(HANDLE_AACDECODER self, const int subStreamIndex)
   }
 
   for (ch = aacChannelOffset; ch < aacChannelOffset + aacChannels; ch++) {
-    if (self->pAacDecoderChannelInfo[ch] != NULL) {
-      if (self->pAacDecoderChannelInfo[ch]->pDynData != NULL) {
-        mpegh_FDKfree(self->pAacDecoderChannelInfo[ch]->pDynData);
-      }
-      if (self->pAacDecoderChannelInfo[ch]->pComStaticData != NULL) {
-        if (self->pAacDecoderChannelInfo[ch]->pComStaticData->pWorkBufferCore1 != NULL) {
-          if (ch == aacChannelOffset) {
-            FreeWorkBufferCore1(
-                &self->pAacDecoderChannelInfo[ch]->pComStaticData->pWorkBufferCore1);
-          }
-        }
-        if (self->pAacDecoderChannelInfo[ch]->pComStaticData->cplxPredictionData != NULL) {
-          FreeCplxPredictionData(
-              &self->pAacDecoderChannelInfo[ch]->pComStaticData->cplxPredictionData);
-        }
-        /* Avoid double free of linked pComStaticData in case of CPE by settings pointer to NULL. */
-        if (ch < (28) - 1) {
-          if ((self->pAacDecoderChannelInfo[ch + 1] != NULL) &&
-              (self->pAacDecoderChannelInfo[ch + 1]->pComStaticData ==
-               self->pAacDecoderChannelInfo[ch]->pComStaticData)) {
-            self->pAacDecoderChannelInfo[ch + 1]->pComStaticData = NULL;
-          }
-        }
-        mpegh_FDKfree(self->pAacDecoderChannelInfo[ch]->pComStaticData);
-        self->pAacDecoderChannelInfo[ch]->pComStaticData = NULL;
-      }
-      if (self->pAacDecoderChannelInfo[ch]->pComData != NULL) {
-        if (self->pAacDecoderChannelInfo[ch]->pComData->pJointStereoData != NULL) {
-          mpegh_FDKfree(self->pAacDecoderChannelInfo[ch]->pComData->pJointStereoData);
-        }
-        /* Avoid double free of linked pComData in case of CPE by settings pointer to NULL. */
-        if (ch < (28) - 1) {
-          if ((self->pAacDecoderChannelInfo[ch + 1] != NULL) &&
-              (self->pAacDecoderChannelInfo[ch + 1]->pComData ==
-               self->pAacDecoderChannelInfo[ch]->pComData)) {
-            self->pAacDecoderChannelInfo[ch + 1]->pComData = NULL;
-          }
-        }
-        if (ch == aacChannelOffset) {
-          FreeWorkBufferCore6((FIXP_DBL**)&self->pAacDecoderChannelInfo[ch]->pComData);
-        } else {
-          mpegh_FDKafree(self->pAacDecoderChannelInfo[ch]->pComData);
-        }
-        self->pAacDecoderChannelInfo[ch]->pComData = NULL;
-      }
-    }
     if (self->pAacDecoderStaticChannelInfo[ch] != NULL) {
-      if (self->pAacDecoderStaticChannelInfo[ch]->concealmentInfo.spectralCoefficient != NULL) {
-        FreeConcealmentSpecBuffer(
-            &self->pAacDecoderStaticChannelInfo[ch]->concealmentInfo.spectralCoefficient);
-      }
-      if (self->pAacDecoderStaticChannelInfo[ch]->pOverlapBuffer != NULL) {
-        FreeOverlapBuffer(&self->pAacDecoderStaticChannelInfo[ch]->pOverlapBuffer);
-      }
       if (self->pAacDecoderStaticChannelInfo[ch]->hArCo != NULL) {
         CArco_Destroy(self->pAacDecoderStaticChannelInfo[ch]->hArCo);
       }
-      FreeAacDecoderStaticChannelInfo(&self->pAacDecoderStaticChannelInfo[ch]);
-    }
-    if (self->pAacDecoderChannelInfo[ch] != NULL) {
-      FreeAacDecoderChannelInfo(&self->pAacDecoderChannelInfo[ch]);
     }
+    /* The channel structures are part of the channel arena released below. */
+    self->pAacDecoderStaticChannelInfo[ch] = NULL;
+    self->pAacDecoderChannelInfo[ch] = NULL;
   }
 
   {
     int el;
     for (el = elementOffset; el < elementOffset + numElements; el++) {
-      if (self->cpeStaticData[el] != NULL) {
-        FreeCpePersistentData(&self->cpeStaticData[el]);
-      }
+      self->cpeStaticData[el] = NULL;
     }
   }
 
+  mpegh_FDKarenaDestroy(&self->channelArena);
+
   if (self->flags[subStreamIndex] & AC_MPEGH3DA) {
     for (int grp = 0; grp < TP_MPEGH_MAX_SIGNAL_GROUPS; grp++) {
       if (self->pMCTdec[grp]) {
@@ -1102,6 +1081,11 @@ static void CAacDecoder_DeInit(HANDLE_AACDECODER self, const int subStreamIndex)
 
   if (self->flags[subStreamIndex] & AC_MPEGH3DA) {
     CAacDecoder_DeInitRenderer(self, subStreamIndex);
+    for (int i = 0; i < self->numRenderTargets; i++) {
+      CAacDecoder_SwapRenderTarget(self, self->pRenderTarget[i]);
+      CAacDecoder_DeInitRenderer(self, subStreamIndex);
+      CAacDecoder_SwapRenderTarget(self, self->pRenderTarget[i]);
+    }
   }
 
   self->aacChannels = 0;
@@ -1186,17 +1170,402 @@ LINKSPEC_CPP void CAacDecoder_Close(HANDLE_AACDECODER self) {
     CAacDecoder_DeInit(self, i);
   }
 
-  /* Free WorkBufferCore2 */
-  if (self->workBufferCore2 != NULL) {
-    FreeWorkBufferCore2(&self->workBufferCore2);
-  }
-  if (self->pTimeData2 != NULL) {
-    FreeWorkBufferCore5(&self->pTimeData2);
+  for (int i = 0; i < self->numRenderTargets; i++) {
+    AACDEC_RENDER_TARGET* pTarget = self->pRenderTarget[i];
+    if (pTarget->hLimiter != NULL) {
+      pcmLimiter_Destroy(pTarget->hLimiter);
+    }
+    if (pTarget->pTimeData2 != NULL) {
+      mpegh_FDKafree(pTarget->pTimeData2);
+    }
+    mpegh_FDKfree(pTarget);
+    self->pRenderTarget[i] = NULL;
   }
+  self->numRenderTargets = 0;
+
+  /* Free WorkBufferCore1, WorkBufferCore2 and WorkBufferCore5 */
+  self->workBufferCore2 = NULL;
+  self->pTimeData2 = NULL;
+  self->pWorkBufferCore1 = NULL;
+  self->hScratch = NULL;
+  CAacDecoder_DestroyScratch(&self->ownScratch);
+  CAacDecoder_SetTaskExecutor(self, NULL);
 
   FreeAacDecoder(&self);
 }
 
+LINKSPEC_CPP INT CAacDecoder_CreateScratch(HANDLE_AACDEC_SCRATCH hScratch) {
+  /* WorkBufferCore1, WorkBufferCore2 and WorkBufferCore5 share one contiguous block. */
+  if (mpegh_FDKarenaCreate(&hScratch->arena, CAacDecoder_GetRequiredScratchMem()) != 0) {
+    return -1;
+  }
+  hScratch->workBufferCore2 = (FIXP_DBL*)mpegh_FDKarenaAlloc(
+      &hScratch->arena, ((24) * (1024 * 3)) * sizeof(FIXP_DBL));
+  hScratch->pTimeData2 =
+      (PCM_DEC*)mpegh_FDKarenaAlloc(&hScratch->arena, GetRequiredMemWorkBufferCore5());
+  hScratch->pWorkBufferCore1 =
+      (CWorkBufferCore1*)mpegh_FDKarenaAlloc(&hScratch->arena, sizeof(CWorkBufferCore1));
+  FDK_ASSERT(hScratch->pWorkBufferCore1 != NULL);
+
+  return 0;
+}
+
+LINKSPEC_CPP void CAacDecoder_DestroyScratch(HANDLE_AACDEC_SCRATCH hScratch) {
+  hScratch->workBufferCore2 = NULL;
+  hScratch->pTimeData2 = NULL;
+  hScratch->pWorkBufferCore1 = NULL;
+  mpegh_FDKarenaDestroy(&hScratch->arena);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_SetScratch(HANDLE_AACDECODER self,
+                                                      HANDLE_AACDEC_SCRATCH hScratch) {
+  if (hScratch == NULL) {
+    /* Switch back to own work buffers, they were released while shared ones were in use. */
+    if (self->ownScratch.arena.pBase == NULL) {
+      if (CAacDecoder_CreateScratch(&self->ownScratch) != 0) {
+        return AAC_DEC_OUT_OF_MEMORY;
+      }
+    }
+    hScratch = &self->ownScratch;
+  } else if (hScratch != &self->ownScratch) {
+    CAacDecoder_DestroyScratch(&self->ownScratch);
+  }
+
+  self->hScratch = hScratch;
+  self->workBufferCore2 = hScratch->workBufferCore2;
+  self->pTimeData2 = hScratch->pTimeData2;
+  self->pWorkBufferCore1 = hScratch->pWorkBufferCore1;
+
+  /* All channels of the current configuration share WorkBufferCore1. The spectral coefficients
+   * and the IGF and stereo prediction scratch of an already configured stream point into the work
+   * buffers as well, see CAacDecoder_Init(). */
+  for (int ch = 0; ch < (28); ch++) {
+    if (self->pAacDecoderChannelInfo[ch] != NULL) {
+      self->pAacDecoderChannelInfo[ch]->pComStaticData->pWorkBufferCore1 = self->pWorkBufferCore1;
+      self->pAacDecoderChannelInfo[ch]->pSpectralCoefficient =
+          (SPECTRAL_PTR)&self->workBufferCore2[ch * 1024];
+    }
+  }
+  for (int ch2 = 0; ch2 < 2; ch2++) {
+    self->igf_private_data_common[ch2].virtualSpec = &self->pTimeData2[1024 * ch2];
+  }
+  for (int el = 0; el < (3 * ((28) * 2) + (((28) * 2)) / 2 + 4 * (1) + 1); el++) {
+    if (self->cpeStaticData[el] != NULL) {
+      self->cpeStaticData[el]->jointStereoPersistentData.scratchBuffer =
+          self->pWorkBufferCore1->workBuffer;
+      self->cpeStaticData[el]->jointStereoPersistentData.scratchBuffer2 =
+          &self->pTimeData2[2 * 1024];
+    }
+  }
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_SetTaskExecutor(HANDLE_AACDECODER self,
+                                                           const AACDEC_TASK_EXECUTOR* pExecutor) {
+  if (self->pTaskScratch != NULL) {
+    mpegh_FDKafree(self->pTaskScratch);
+    self->pTaskScratch = NULL;
+  }
+  mpegh_FDKmemclear(&self->taskExecutor, sizeof(AACDEC_TASK_EXECUTOR));
+  self->taskExecutor.maxWorkers = 1;
+
+  if ((pExecutor == NULL) || (pExecutor->execute == NULL) || (pExecutor->maxWorkers < 2)) {
+    return AAC_DEC_OK;
+  }
+
+  /* Jobs are channel elements, more tasks than channels are never used. */
+  const INT maxWorkers = fMin(pExecutor->maxWorkers, (INT)(28));
+
+  /* Every task but the first one needs its own work buffers. */
+  self->pTaskScratch = (AACDEC_TASK_SCRATCH*)mpegh_FDKaalloc(
+      (maxWorkers - 1) * sizeof(AACDEC_TASK_SCRATCH), ALIGNMENT_DEFAULT);
+  if (self->pTaskScratch == NULL) {
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+  for (int i = 0; i < maxWorkers - 1; i++) {
+    for (int ch2 = 0; ch2 < 2; ch2++) {
+      self->pTaskScratch[i].igfCommon[ch2].virtualSpec =
+          &self->pTaskScratch[i].igfVirtualSpec[1024 * ch2];
+    }
+  }
+
+  self->taskExecutor = *pExecutor;
+  self->taskExecutor.maxWorkers = maxWorkers;
+
+  return AAC_DEC_OK;
+}
+
+/* Upper bound of the channel dependent memory taken by CAacDecoder_Init() */
+LINKSPEC_CPP UINT CAacDecoder_GetRequiredChannelMem(const INT numChannels) {
+  UINT size;
+
+  /* Every channel may be an element of its own or part of a channel pair. */
+  size = CAacDecoder_GetChannelArenaSize(numChannels, numChannels, numChannels / 2);
+  size += numChannels * ALGN_SIZE_EXTRES(sizeof(CArcoData));
+  size += ALGN_SIZE_EXTRES(sizeof(CMct)) + ALGN_SIZE_EXTRES(sizeof(CMctWork));
+
+  return size;
+}
+
+/* Size of the work buffers whose content does not survive a frame */
+LINKSPEC_CPP UINT CAacDecoder_GetRequiredScratchMem(void) {
+  return ARENA_ALGN_SIZE(((24) * (1024 * 3)) * sizeof(FIXP_DBL)) +
+         ARENA_ALGN_SIZE(GetRequiredMemWorkBufferCore5()) +
+         ARENA_ALGN_SIZE(sizeof(CWorkBufferCore1));
+}
+
+/* Open and close the renderers of a worst case configuration, so that their heap requests pass
+ * the allocator that is current for the calling thread. */
+LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_ProbeRendererMem(HANDLE_AACDECODER self,
+                                                            const INT targetLayout,
+                                                            const INT numInputChannels,
+                                                            const INT numObjects) {
+  AAC_DECODER_ERROR err = AAC_DEC_OK;
+  IIS_FORMATCONVERTER_HANDLE hFormatConverter = NULL;
+  HANDLE_GVBAPRENDERER hgVBAPRenderer = NULL;
+  FDK_SignalDelay renderedDelay;
+  CICP2GEOMETRY_CHANNEL_GEOMETRY outGeo[32];
+  CICP2GEOMETRY_CHANNEL_GEOMETRY inGeo[32];
+  INT numOutChannels, numOutLfe, numRefChannels, numRefLfe;
+  INT numIn = fMin(numInputChannels, (INT)FDK_FORMAT_CONVERTER_MAX_INPUT_CHANNELS);
+
+  if (self == NULL) return AAC_DEC_INVALID_HANDLE;
+
+  mpegh_FDKmemclear(outGeo, sizeof(outGeo));
+  mpegh_FDKmemclear(inGeo, sizeof(inGeo));
+  mpegh_FDKmemclear(&renderedDelay, sizeof(renderedDelay));
+
+  if (cicp2geometry_get_geometry_from_cicp(targetLayout, outGeo, &numOutChannels, &numOutLfe) !=
+      CICP2GEOMETRY_OK) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+
+  if (numIn > 0) {
+    /* The channels of the largest reference layout, extended by unknown loudspeaker positions. */
+    cicp2geometry_get_geometry_from_cicp(13, inGeo, &numRefChannels, &numRefLfe);
+    for (int i = numRefChannels + numRefLfe; i < numIn; i++) {
+      inGeo[i].cicpLoudspeakerIndex = -1;
+      inGeo[i].Az = -165 + 30 * (i - (numRefChannels + numRefLfe));
+      inGeo[i].El = 15;
+      inGeo[i].screenRelative = -1;
+      inGeo[i].loudspeakerType = CICP2GEOMETRY_LOUDSPEAKER_UNKNOWN;
+    }
+
+    if (IIS_FormatConverter_Create(&hFormatConverter,
+                                   IIS_FORMATCONVERTER_MODE_CUSTOM_FREQ_DOMAIN_STFT, outGeo,
+                                   numOutChannels + numOutLfe, 48000, 1024) != 0) {
+      err = AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+      goto bail;
+    }
+    hFormatConverter->numSignalsTotal = numIn;
+    if (IIS_FormatConverter_Config_AddInputSetup(hFormatConverter, inGeo, numIn, 0, 0) != 0) {
+      err = AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+      goto bail;
+    }
+    /* Active downmix needs more memory than passive downmix. */
+    IIS_FormatConverter_Config_SetAES(hFormatConverter, 7);
+    IIS_FormatConverter_Config_SetPAS(hFormatConverter, 3);
+    if (IIS_FormatConverter_Open(hFormatConverter, (INT*)self->workBufferCore2,
+                                 sizeof(INT) * (24) * (1024 * 3)) != 0) {
+      err = AAC_DEC_OUT_OF_MEMORY;
+      goto bail;
+    }
+  }
+
+  if (FDK_Delay_Create(&renderedDelay, 3 * 256 + TD_UPSAMPLER_MAX_DELAY,
+                       numOutChannels + numOutLfe) != 0) {
+    err = AAC_DEC_OUT_OF_MEMORY;
+    goto bail;
+  }
+
+  if (numObjects > 0) {
+    if (gVBAPRenderer_Open(&hgVBAPRenderer, numObjects, 1024, 1024, outGeo,
+                           numOutChannels + numOutLfe, targetLayout, 0, GVBAP_ENHANCED) != 0) {
+      err = AAC_DEC_OUT_OF_MEMORY;
+      goto bail;
+    }
+  }
+
+bail:
+  if (hgVBAPRenderer != NULL) {
+    gVBAPRenderer_Close(hgVBAPRenderer);
+  }
+  FDK_Delay_Destroy(&renderedDelay);
+  if (hFormatConverter != NULL) {
+    IIS_FormatConverter_Close(&hFormatConverter);
+  }
+
+  return err;
+}
+
+/* Open and close an object renderer for the target layout. Its speaker mesh stays in the mesh
+ * cache of the object renderer, so that renderers opened for a stream reuse it. */
+LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_PrepareTargetLayout(const INT targetLayout,
+                                                               AACDEC_LAYOUT_SETUP_INFO* pInfo) {
+  HANDLE_GVBAPRENDERER hgVBAPRenderer = NULL;
+  CICP2GEOMETRY_CHANNEL_GEOMETRY outGeo[32];
+  INT numOutChannels, numOutLfe;
+
+  mpegh_FDKmemclear(outGeo, sizeof(outGeo));
+
+  if (cicp2geometry_get_geometry_from_cicp(targetLayout, outGeo, &numOutChannels, &numOutLfe) !=
+      CICP2GEOMETRY_OK) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+  if (numOutChannels + numOutLfe > (24)) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+
+  if (gVBAPRenderer_Open(&hgVBAPRenderer, 1, 1024, 1024, outGeo, numOutChannels + numOutLfe,
+                         targetLayout, 0, GVBAP_ENHANCED) != 0) {
+    if (hgVBAPRenderer != NULL) {
+      gVBAPRenderer_Close(hgVBAPRenderer);
+    }
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+  gVBAPRenderer_GetSetupInfo(hgVBAPRenderer, &pInfo->numTriangles, &pInfo->numGhostSpeakers,
+                             &pInfo->meshShared);
+  gVBAPRenderer_Close(hgVBAPRenderer);
+
+  return AAC_DEC_OK;
+}
+
+/* Copy the binary form of the object renderer mesh of a target layout. A mesh that is not cached
+ * is built first the same way as by CAacDecoder_PrepareTargetLayout(). */
+LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_ExportTargetLayoutMesh(const INT targetLayout,
+                                                                  void* pData, UINT* pSize) {
+  AACDEC_LAYOUT_SETUP_INFO setupInfo;
+  CICP2GEOMETRY_CHANNEL_GEOMETRY outGeo[32];
+  VBAP_MESH_KEY key;
+  INT numOutChannels, numOutLfe;
+  UINT size;
+
+  if (pData == NULL) {
+    *pSize = sizeof(VBAP_MESH);
+    return AAC_DEC_OK;
+  }
+  if (*pSize < sizeof(VBAP_MESH)) {
+    *pSize = sizeof(VBAP_MESH);
+    return AAC_DEC_INVALID_PARAM;
+  }
+
+  mpegh_FDKmemclear(outGeo, sizeof(outGeo));
+
+  if (cicp2geometry_get_geometry_from_cicp(targetLayout, outGeo, &numOutChannels, &numOutLfe) !=
+      CICP2GEOMETRY_OK) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+  if (numOutChannels + numOutLfe > (24)) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+
+  gVBAPRenderer_GetMeshKey(&key, outGeo, numOutChannels + numOutLfe, targetLayout,
+                           GVBAP_ENHANCED);
+  size = gVBAPRenderer_ExportMesh(&key, pData, *pSize);
+  if (size == 0) {
+    AAC_DECODER_ERROR err = CAacDecoder_PrepareTargetLayout(targetLayout, &setupInfo);
+    if (err != AAC_DEC_OK) {
+      return err;
+    }
+    size = gVBAPRenderer_ExportMesh(&key, pData, *pSize);
+  }
+  /* Layouts exceeding the fixed size of a mesh are never cached. */
+  if (size == 0) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+  *pSize = size;
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_ImportTargetLayoutMesh(const void* pData,
+                                                                  const UINT size) {
+  if (gVBAPRenderer_ImportMesh(pData, size) != 0) {
+    return AAC_DEC_INVALID_PARAM;
+  }
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_AddRenderTarget(HANDLE_AACDECODER self,
+                                                           const INT targetLayout, INT* pIndex) {
+  AACDEC_RENDER_TARGET* pTarget;
+  INT numChannels = 0;
+
+  if (self->numRenderTargets >= AACDEC_MAX_RENDER_TARGETS) {
+    return AAC_DEC_SET_PARAM_FAIL;
+  }
+  if ((targetLayout <= 0) || cicp2geometry_get_numChannels_from_cicp(targetLayout, &numChannels) ||
+      (numChannels <= 0) || (numChannels > (24))) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+
+  pTarget = (AACDEC_RENDER_TARGET*)mpegh_FDKcalloc(1, sizeof(AACDEC_RENDER_TARGET));
+  if (pTarget == NULL) {
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+  pTarget->pTimeData2 =
+      (PCM_DEC*)mpegh_FDKaalloc(GetRequiredMemWorkBufferCore5(), ALIGNMENT_DEFAULT);
+  pTarget->hLimiter = pcmLimiter_Create(TDL_MPEGH3DA_DEFAULT_ATTACK, TDL_RELEASE_DEFAULT_MS,
+                                        TDL_MPEGH3DA_DEFAULT_THRESHOLD, (24), 48000);
+  if ((pTarget->pTimeData2 == NULL) || (pTarget->hLimiter == NULL)) {
+    if (pTarget->hLimiter != NULL) {
+      pcmLimiter_Destroy(pTarget->hLimiter);
+    }
+    if (pTarget->pTimeData2 != NULL) {
+      mpegh_FDKafree(pTarget->pTimeData2);
+    }
+    mpegh_FDKfree(pTarget);
+    return AAC_DEC_OUT_OF_MEMORY;
+  }
+  pTarget->targetLayout = targetLayout;
+  pTarget->targetLayout_config = targetLayout;
+  pTarget->truncateFrameSize = -1;
+  for (int q = 0; q < 128 * (24); q++) {
+    pTarget->crossfadeMem[q] = (PCM_DEC)0;
+  }
+
+  *pIndex = self->numRenderTargets;
+  self->pRenderTarget[self->numRenderTargets++] = pTarget;
+
+  return AAC_DEC_OK;
+}
+
+/* Exchange the contents of two memory areas of the given size in bytes. */
+static void swapMem(void* pA, void* pB, INT size) {
+  UCHAR tmp[256];
+  UCHAR* a = (UCHAR*)pA;
+  UCHAR* b = (UCHAR*)pB;
+
+  while (size > 0) {
+    INT n = fMin(size, (INT)sizeof(tmp));
+    mpegh_FDKmemcpy(tmp, a, n);
+    mpegh_FDKmemcpy(a, b, n);
+    mpegh_FDKmemcpy(b, tmp, n);
+    a += n;
+    b += n;
+    size -= n;
+  }
+}
+
+LINKSPEC_CPP void CAacDecoder_SwapRenderTarget(HANDLE_AACDECODER self,
+                                               AACDEC_RENDER_TARGET* pTarget) {
+  swapMem(&self->targetLayout, &pTarget->targetLayout, sizeof(self->targetLayout));
+  swapMem(&self->targetLayout_config, &pTarget->targetLayout_config,
+          sizeof(self->targetLayout_config));
+  swapMem(self->pFormatConverter, pTarget->pFormatConverter, sizeof(self->pFormatConverter));
+  swapMem(self->hgVBAPRenderer, pTarget->hgVBAPRenderer, sizeof(self->hgVBAPRenderer));
+  swapMem(&self->hLimiter, &pTarget->hLimiter, sizeof(self->hLimiter));
+  swapMem(&self->mpegH_rendered_delay, &pTarget->mpegH_rendered_delay,
+          sizeof(self->mpegH_rendered_delay));
+  swapMem(self->mpegH_sampleRateConverter_filterStates,
+          pTarget->mpegH_sampleRateConverter_filterStates,
+          sizeof(self->mpegH_sampleRateConverter_filterStates));
+  swapMem(self->crossfadeMem, pTarget->crossfadeMem, sizeof(self->crossfadeMem));
+  self->renderTargetSwapped = !self->renderTargetSwapped;
+}
+
 /*!
   \brief Initialization of decoder instance
 
@@ -1576,6 +1945,49 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self,
   if (*configChanged) {
     /* Allocate all memory structures for each channel */
     {
+      CWorkBufferCore1* pWorkBufferCore1;
+      int numChannels = 0, numChElements = 0, numCpe = 0;
+
+      /* Count active channels, channel elements and CPEs to size the channel arena. */
+      for (int _ch = 0; _ch < ascChannels; _ch++) {
+        if ((asc->m_aot != AOT_MPEGH3DA) || getOnOffFlag(self, aacChannelsOffsetIdx + _ch)) {
+          numChannels++;
+        }
+      }
+      {
+        int chIdx = aacChannelsOffsetIdx;
+        int _numElements = (((28)) + ((28)));
+        if (flags & (AC_MPEGH3DA | AC_USAC)) {
+          _numElements = (int)asc->m_sc.m_usacConfig.m_usacNumElements;
+        }
+        for (int _el = 0; _el < _numElements; _el++) {
+          int el = elementOffset + _el;
+
+          if (IS_CHANNEL_ELEMENT(self->elements[el])) {
+            int el_channels = CAacDecoder_GetELChannels(self->elements[el]);
+
+            if (getOnOffFlag(self, chIdx)) {
+              numChElements++;
+              if (el_channels == 2) {
+                numCpe++;
+              }
+            }
+            chIdx += el_channels;
+          }
+          if (self->elements[el] == ID_END) {
+            break;
+          }
+        }
+      }
+
+      if (mpegh_FDKarenaCreate(&self->channelArena,
+                               CAacDecoder_GetChannelArenaSize(numChannels, numChElements,
+                                                               numCpe)) != 0) {
+        goto bail;
+      }
+      /* WorkBufferCore1 is part of the (possibly shared) scratch, see CAacDecoder_SetScratch(). */
+      pWorkBufferCore1 = self->pWorkBufferCore1;
+
       int ch = aacChannelsOffset;
       for (int _ch = 0; _ch < ascChannels; _ch++) {
         if (asc->m_aot == AOT_MPEGH3DA) {
@@ -1588,14 +2000,16 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self,
         if (ch >= (28)) {
           goto bail;
         }
-        self->pAacDecoderChannelInfo[ch] = GetAacDecoderChannelInfo(ch);
+        self->pAacDecoderChannelInfo[ch] = (CAacDecoderChannelInfo*)mpegh_FDKarenaAlloc(
+            &self->channelArena, sizeof(CAacDecoderChannelInfo));
         /* This is temporary until the DynamicData is split into two or more regions!
            The memory could be reused after completed core decoding. */
         if (self->pAacDecoderChannelInfo[ch] == NULL) {
           goto bail;
         }
         self->pAacDecoderChannelInfo[ch]->pDynData =
-            (CAacDecoderDynamicData*)mpegh_FDKmalloc(sizeof(CAacDecoderDynamicData));
+            (CAacDecoderDynamicData*)mpegh_FDKarenaAlloc(&self->channelArena,
+                                                         sizeof(CAacDecoderDynamicData));
         if (self->pAacDecoderChannelInfo[ch]->pDynData == NULL) {
           goto bail;
         }
@@ -1639,29 +2053,24 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self,
                 goto bail;
               }
               self->pAacDecoderChannelInfo[ch]->pComStaticData =
-                  (CAacDecoderCommonStaticData*)mpegh_FDKcalloc(1, sizeof(CAacDecoderCommonStaticData));
+                  (CAacDecoderCommonStaticData*)mpegh_FDKarenaAlloc(
+                      &self->channelArena, sizeof(CAacDecoderCommonStaticData));
               if (self->pAacDecoderChannelInfo[ch]->pComStaticData == NULL) {
                 goto bail;
               }
-              if (ch == aacChannelsOffset) {
-                self->pAacDecoderChannelInfo[ch]->pComData =
-                    (CAacDecoderCommonData*)GetWorkBufferCore6();
-                self->pAacDecoderChannelInfo[ch]->pComStaticData->pWorkBufferCore1 =
-                    GetWorkBufferCore1();
-              } else {
-                self->pAacDecoderChannelInfo[ch]->pComData = (CAacDecoderCommonData*)mpegh_FDKaalloc(
-                    sizeof(CAacDecoderCommonData), ALIGNMENT_DEFAULT);
-                self->pAacDecoderChannelInfo[ch]->pComStaticData->pWorkBufferCore1 =
-                    self->pAacDecoderChannelInfo[aacChannelsOffset]
-                        ->pComStaticData->pWorkBufferCore1;
-              }
+              self->pAacDecoderChannelInfo[ch]->pComData =
+                  (CAacDecoderCommonData*)mpegh_FDKarenaAlloc(&self->channelArena,
+                                                              sizeof(CAacDecoderCommonData));
+              self->pAacDecoderChannelInfo[ch]->pComStaticData->pWorkBufferCore1 =
+                  pWorkBufferCore1;
               if ((self->pAacDecoderChannelInfo[ch]->pComData == NULL) ||
                   (self->pAacDecoderChannelInfo[ch]->pComStaticData->pWorkBufferCore1 == NULL)) {
                 goto bail;
               }
               if (el_channels == 2) {
                 self->pAacDecoderChannelInfo[ch]->pComData->pJointStereoData =
-                    (CJointStereoData*)mpegh_FDKmalloc(sizeof(CJointStereoData));
+                    (CJointStereoData*)mpegh_FDKarenaAlloc(&self->channelArena,
+                                                           sizeof(CJointStereoData));
                 if (self->pAacDecoderChannelInfo[ch]->pComData->pJointStereoData == NULL) {
                   goto bail;
                 }
@@ -1735,17 +2144,20 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self,
       for (int _ch = 0; _ch < ascChannels; _ch++) {
         /* Allocate persistent channel memory */
         if (getOnOffFlag(self, chIdx)) {
-          self->pAacDecoderStaticChannelInfo[ch] = GetAacDecoderStaticChannelInfo(ch);
+          self->pAacDecoderStaticChannelInfo[ch] =
+              (CAacDecoderStaticChannelInfo*)mpegh_FDKarenaAlloc(
+                  &self->channelArena, sizeof(CAacDecoderStaticChannelInfo));
           if (self->pAacDecoderStaticChannelInfo[ch] == NULL) {
             goto bail;
           }
           self->pAacDecoderStaticChannelInfo[ch]->concealmentInfo.spectralCoefficient =
-              GetConcealmentSpecBuffer(ch);
+              (FIXP_CNCL*)mpegh_FDKarenaAlloc(&self->channelArena, 1024 * sizeof(FIXP_CNCL));
           if (self->pAacDecoderStaticChannelInfo[ch]->concealmentInfo.spectralCoefficient == NULL) {
             goto bail;
           }
-          self->pAacDecoderStaticChannelInfo[ch]->pOverlapBuffer =
-              GetOverlapBuffer(ch); /* This area size depends on the AOT */
+          self->pAacDecoderStaticChannelInfo[ch]->pOverlapBuffer = (FIXP_DBL*)mpegh_FDKarenaAlloc(
+              &self->channelArena,
+              OverlapBufferSize * sizeof(FIXP_DBL)); /* This area size depends on the AOT */
           if (self->pAacDecoderStaticChannelInfo[ch]->pOverlapBuffer == NULL) {
             goto bail;
           }
@@ -1783,7 +2195,8 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self,
           if (elFlags[el2] & AC_EL_USAC_CP_POSSIBLE) {
             complexStereoPredPossible = 1;
             if (self->cpeStaticData[el2] == NULL) {
-              self->cpeStaticData[el2] = GetCpePersistentData();
+              self->cpeStaticData[el2] = (CpePersistentData*)mpegh_FDKarenaAlloc(
+                  &self->channelArena, sizeof(CpePersistentData));
               if (self->cpeStaticData[el2] == NULL) {
                 goto bail;
               }
@@ -1841,7 +2254,8 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self,
             /* needed once for all channels */
             if (self->pAacDecoderChannelInfo[ch - 1]->pComStaticData->cplxPredictionData == NULL) {
               self->pAacDecoderChannelInfo[ch - 1]->pComStaticData->cplxPredictionData =
-                  GetCplxPredictionData();
+                  (CCplxPredictionData*)mpegh_FDKarenaAlloc(&self->channelArena,
+                                                            sizeof(CCplxPredictionData));
             }
             if (self->pAacDecoderChannelInfo[ch - 1]->pComStaticData->cplxPredictionData == NULL) {
               goto bail;
@@ -1966,6 +2380,10 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self,
   if ((asc->m_aot == AOT_MPEGH3DA) || (asc->m_aot == AOT_USAC)) {
     pcmLimiter_SetAttack(self->hLimiter, TDL_MPEGH3DA_DEFAULT_ATTACK);
     pcmLimiter_SetThreshold(self->hLimiter, TDL_MPEGH3DA_DEFAULT_THRESHOLD);
+    for (int i = 0; i < self->numRenderTargets; i++) {
+      pcmLimiter_SetAttack(self->pRenderTarget[i]->hLimiter, TDL_MPEGH3DA_DEFAULT_ATTACK);
+      pcmLimiter_SetThreshold(self->pRenderTarget[i]->hLimiter, TDL_MPEGH3DA_DEFAULT_THRESHOLD);
+    }
   }
 
   if (*configChanged) {
@@ -1976,6 +2394,20 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_Init(HANDLE_AACDECODER self,
       if (err != AAC_DEC_OK) {
         goto bail;
       }
+      /* Render targets get renderers of their own for the same signals. They count the same
+       * object signal groups, unless their initialization fails. */
+      const UCHAR numObjSignalGroups = self->numObjSignalGroups[streamIndex];
+      for (int i = 0; i < self->numRenderTargets; i++) {
+        CAacDecoder_SwapRenderTarget(self, self->pRenderTarget[i]);
+        err = CAacDecoder_InitRenderer(
+            self, self->pUsacConfig[streamIndex], self->samplingRateInfo[streamIndex].samplingRate,
+            self->streamInfo.aacSamplesPerFrame, elementOffset, self->workBufferCore2);
+        CAacDecoder_SwapRenderTarget(self, self->pRenderTarget[i]);
+        self->numObjSignalGroups[streamIndex] = numObjSignalGroups;
+        if (err != AAC_DEC_OK) {
+          goto bail;
+        }
+      }
     }
   }
 
@@ -1991,6 +2423,162 @@ bail:
   return AAC_DEC_OUT_OF_MEMORY;
 }
 
+/* Channel element handled by one task. For CAacDecoder_DecodeElementsTask() first is the first
+ * channel of the element, for CAacDecoder_InverseTransformTask() it is the index of the first
+ * channel job of the element. */
+typedef struct {
+  UCHAR el;
+  UCHAR streamIndex;
+  UCHAR first;
+  UCHAR numChannels;
+} AACDEC_ELEMENT_JOB;
+
+/* Channel of an element job of CAacDecoder_InverseTransformTask() */
+typedef struct {
+  INT offset;        /* Offset of the channel in the time data buffer */
+  UCHAR c;           /* Channel index in canonical MPEG channel order */
+  UCHAR elCh;        /* Channel index within the element */
+  UCHAR frameOK;     /* self->frameOK as seen by the channel in stream order */
+  UCHAR transform;   /* 0: only update the concealment state */
+  UCHAR renderError; /* Set by the task for an unknown render mode */
+} AACDEC_CHANNEL_JOB;
+
+typedef struct {
+  HANDLE_AACDECODER self;
+  AACDEC_ELEMENT_JOB* pElementJobs;
+  AACDEC_CHANNEL_JOB* pChannelJobs;
+  INT numJobs;
+  INT numTasks;
+  UINT flags;
+  PCM_DEC* pTimeData;
+} AACDEC_TASK_DATA;
+
+static CWorkBufferCore1* CAacDecoder_GetTaskWorkBuffer(HANDLE_AACDECODER self, INT taskIndex) {
+  if (taskIndex == 0) {
+    return self->pWorkBufferCore1;
+  }
+  return &self->pTaskScratch[taskIndex - 1].workBufferCore1;
+}
+
+/* Point the scratch memory of an element, which CAacDecoder_Init() sets up to be shared by all
+ * elements, to the work buffers of the task decoding it. */
+static void CAacDecoder_BindElementScratch(HANDLE_AACDECODER self, const AACDEC_ELEMENT_JOB* pJob,
+                                           INT taskIndex) {
+  IGF_PRIVATE_DATA_COMMON* pIgfCommon = self->igf_private_data_common;
+  FIXP_DBL* pStereoPredScratch = &self->pTimeData2[2 * 1024];
+  CpePersistentData* pCpeStaticData =
+      self->pAacDecoderStaticChannelInfo[pJob->first]->pCpeStaticData;
+
+  if (taskIndex > 0) {
+    pIgfCommon = self->pTaskScratch[taskIndex - 1].igfCommon;
+    pStereoPredScratch = self->pTaskScratch[taskIndex - 1].stereoPredScratch;
+  }
+
+  for (int ch2 = 0; ch2 < pJob->numChannels; ch2++) {
+    self->pAacDecoderChannelInfo[pJob->first + ch2]->IGFdata.IGF_Common_channel_data_handle =
+        &pIgfCommon[ch2];
+  }
+  if (pCpeStaticData != NULL) {
+    pCpeStaticData->jointStereoPersistentData.scratchBuffer =
+        CAacDecoder_GetTaskWorkBuffer(self, taskIndex)->workBuffer;
+    pCpeStaticData->jointStereoPersistentData.scratchBuffer2 = pStereoPredScratch;
+  }
+}
+
+/* Run the jobs of pTaskData, distributed over at most taskExecutor.maxWorkers tasks. */
+static void CAacDecoder_RunTasks(HANDLE_AACDECODER self, void (*task)(void* taskData, INT taskIndex),
+                                 AACDEC_TASK_DATA* pTaskData) {
+  pTaskData->numTasks = fMin(self->taskExecutor.maxWorkers, pTaskData->numJobs);
+
+  if (pTaskData->numTasks > 1) {
+    self->taskExecutor.execute(self->taskExecutor.context, task, pTaskData, pTaskData->numTasks);
+  } else if (pTaskData->numJobs > 0) {
+    pTaskData->numTasks = 1;
+    task(pTaskData, 0);
+  }
+}
+
+static void CAacDecoder_DecodeElementsTask(void* taskData, INT taskIndex) {
+  AACDEC_TASK_DATA* pTaskData = (AACDEC_TASK_DATA*)taskData;
+  HANDLE_AACDECODER self = pTaskData->self;
+  CWorkBufferCore1* pWorkBufferCore1 = CAacDecoder_GetTaskWorkBuffer(self, taskIndex);
+
+  for (int j = taskIndex; j < pTaskData->numJobs; j += pTaskData->numTasks) {
+    AACDEC_ELEMENT_JOB* pJob = &pTaskData->pElementJobs[j];
+
+    CAacDecoder_BindElementScratch(self, pJob, taskIndex);
+    CChannelElement_Decode(&self->pAacDecoderChannelInfo[pJob->first],
+                           &self->pAacDecoderStaticChannelInfo[pJob->first],
+                           &self->samplingRateInfo[pJob->streamIndex],
+                           self->flags[pJob->streamIndex], self->elFlags[pJob->el],
+                           pJob->numChannels, pWorkBufferCore1);
+  }
+}
+
+/* Conceal defective spectral data and transform the channels to time domain. The channels of one
+ * element are processed in order, because a concealed channel forces concealment of the
+ * following channels of the element. */
+static void CAacDecoder_InverseTransformTask(void* taskData, INT taskIndex) {
+  AACDEC_TASK_DATA* pTaskData = (AACDEC_TASK_DATA*)taskData;
+  HANDLE_AACDECODER self = pTaskData->self;
+  const UINT flags = pTaskData->flags;
+  FIXP_DBL* mdctOutTemp = CAacDecoder_GetTaskWorkBuffer(self, taskIndex)->mdctOutTemp;
+
+  for (int j = taskIndex; j < pTaskData->numJobs; j += pTaskData->numTasks) {
+    AACDEC_ELEMENT_JOB* pElementJob = &pTaskData->pElementJobs[j];
+    const int streamIndex = pElementJob->streamIndex;
+    int frameOk_butConceal = 0; /* Force frame concealment during mute release active state. */
+
+    for (int i = 0; i < pElementJob->numChannels; i++) {
+      AACDEC_CHANNEL_JOB* pJob = &pTaskData->pChannelJobs[pElementJob->first + i];
+      CAacDecoderChannelInfo* pAacDecoderChannelInfo = self->pAacDecoderChannelInfo[pJob->c];
+      CAacDecoderStaticChannelInfo* pAacDecoderStaticChannelInfo =
+          self->pAacDecoderStaticChannelInfo[pJob->c];
+      PCM_DEC* pTimeData = pTaskData->pTimeData + pJob->offset;
+
+      if (CConcealment_Apply(&pAacDecoderStaticChannelInfo->concealmentInfo,
+                             pAacDecoderChannelInfo, pAacDecoderStaticChannelInfo,
+                             &self->samplingRateInfo[streamIndex],
+                             self->streamInfo.aacSamplesPerFrame, 0,
+                             (pJob->frameOK && !(flags & AACDEC_CONCEAL)),
+                             self->flags[streamIndex]) == -1) {
+        frameOk_butConceal = 1;
+      }
+
+      if (!pJob->transform) {
+        continue;
+      }
+      if (self->flushStatus && (self->flushCnt > 0) && !(flags & AACDEC_CONCEAL)) {
+        mpegh_FDKmemclear(pTimeData, sizeof(PCM_DEC) * self->streamInfo.aacSamplesPerFrame);
+      } else
+        switch (pAacDecoderChannelInfo->renderMode) {
+          case AACDEC_RENDER_IMDCT:
+
+            CBlock_FrequencyToTime(
+                pAacDecoderStaticChannelInfo, pAacDecoderChannelInfo, pTimeData,
+                self->streamInfo.aacSamplesPerFrame,
+                (pJob->frameOK && !(flags & AACDEC_CONCEAL) && !frameOk_butConceal), mdctOutTemp,
+                self->aacOutDataHeadroom, self->elFlags[pElementJob->el], pJob->elCh);
+            if (self->flags[streamIndex] & AC_MPEGH3DA) {
+              ltp_post(pTimeData, self->streamInfo.aacSamplesPerFrame,
+                       self->streamInfo.aacSampleRate, pAacDecoderStaticChannelInfo->ltp_param,
+                       &(pAacDecoderStaticChannelInfo->ltp_pitch_int_past),
+                       &(pAacDecoderStaticChannelInfo->ltp_pitch_fr_past),
+                       &(pAacDecoderStaticChannelInfo->ltp_gain_past),
+                       &(pAacDecoderStaticChannelInfo->ltp_gainIdx_past),
+                       pAacDecoderStaticChannelInfo->ltp_mem_in,
+                       pAacDecoderStaticChannelInfo->ltp_mem_out);
+            }
+
+            break;
+          default:
+            pJob->renderError = 1;
+            break;
+        }
+    }
+  }
+}
+
 LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, const UINT flags,
                                                        PCM_DEC* pTimeData, const INT timeDataSize,
                                                        const int timeDataChannelOffset) {
@@ -2010,6 +2598,17 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
 
   INT CConceal_TDFading_Applied[(28)] = {0}; /* Initialize status of Time Domain fading */
 
+  /* Element and channel jobs for CAacDecoder_RunTasks() */
+  AACDEC_ELEMENT_JOB elementJobs[(3 * ((28) * 2) + (((28) * 2)) / 2 + 4 * (1) + 1)];
+  AACDEC_CHANNEL_JOB channelJobs[((28) * 2)];
+  int numElementJobs = 0, numChannelJobs = 0;
+  AACDEC_TASK_DATA taskData;
+
+  taskData.self = self;
+  taskData.flags = flags;
+  taskData.pTimeData = pTimeData;
+  taskData.pChannelJobs = channelJobs;
+
   /* Init fBsRestartOk. For USAC/MPEG-H defaults to zero because AC_INDEP is required.
      For all other formats every frame is independent. */
   if (self->flags[streamIndex] & (AC_MPEGH3DA | AC_USAC)) {
@@ -2353,6 +2952,14 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
                     ->element[element_count - element_count_prev_streams]
                     .extElement.usacExtElementType;
 
+            if ((usacExtElementType == ID_EXT_ELE_OBJ_METADATA) ||
+                (usacExtElementType == ID_EXT_ELE_PROD_METADATA) ||
+                (usacExtElementType == ID_EXT_ELE_FMT_CNVRTR) ||
+                (usacExtElementType == ID_EXT_ELE_UNI_DRC)) {
+              /* The metadata of a pending frame is still needed for its rendering. */
+              aacDecoder_SyncPipeline(self);
+            }
+
             switch (usacExtElementType) {
               case ID_EXT_ELE_OBJ_METADATA:
                 if (self->targetLayout_config > -1) {
@@ -2482,6 +3089,17 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
               case ID_EXT_ELE_FMT_CNVRTR: /* FormatConverterFrame() */
                 if (self->pFormatConverter[streamIndex] != NULL) {
                   FormatConverterFrame(self->pFormatConverter[streamIndex], bs);
+                  /* The render targets convert the same channel signals. */
+                  IIS_FORMATCONVERTER_INTERNAL_HANDLE _p =
+                      (IIS_FORMATCONVERTER_INTERNAL_HANDLE)self->pFormatConverter[streamIndex]
+                          ->member;
+                  for (int i = 0; i < self->numRenderTargets; i++) {
+                    if (self->pRenderTarget[i]->pFormatConverter[streamIndex] != NULL) {
+                      IIS_FormatConverter_Config_SetRendering3DTypeFlag(
+                          self->pRenderTarget[i]->pFormatConverter[streamIndex],
+                          _p->rendering3DTypeFlag);
+                    }
+                  }
                 }
                 break;
               case ID_EXT_ELE_UNI_DRC: /* uniDrcGain() */
@@ -2695,10 +3313,11 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
             break;
           }
           {
-            CChannelElement_Decode(&self->pAacDecoderChannelInfo[aacChannels],
-                                   &self->pAacDecoderStaticChannelInfo[aacChannels],
-                                   &self->samplingRateInfo[streamIndex], self->flags[streamIndex],
-                                   self->elFlags[element_count], el_channels);
+            AACDEC_ELEMENT_JOB* pJob = &elementJobs[numElementJobs++];
+            pJob->el = (UCHAR)element_count;
+            pJob->streamIndex = (UCHAR)streamIndex;
+            pJob->first = (UCHAR)aacChannels;
+            pJob->numChannels = (UCHAR)el_channels;
           }
           aacChannels += el_channels;
           aacChannelsIdx += el_channels;
@@ -2713,6 +3332,11 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
     element_count++;
   }
 
+  /* The channel elements are independent of each other after MCT and stereo filling. */
+  taskData.pElementJobs = elementJobs;
+  taskData.numJobs = numElementJobs;
+  CAacDecoder_RunTasks(self, CAacDecoder_DecodeElementsTask, &taskData);
+
   /* More AAC channels than specified by the ASC not allowed. */
   if ((aacChannels == 0 || aacChannels > self->aacChannels) &&
       !(flags & (AACDEC_CONCEAL | AACDEC_FLUSH))) {
@@ -2801,14 +3425,14 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
 
     int el;
     int el_channels;
+    int robustnessError = 0;
     streamIndex = 0;
     c = 0;
     cIdx = 0;
     el_channels = 0;
-    for (el = 0; el < element_count; el++) {
-      int frameOk_butConceal = 0; /* Force frame concealment during mute release active state. */
-      int concealApplyReturnCode;
-
+    /* Collect the channels to be transformed. Everything depending on the order of the channels
+     * is done here or after the transform, so that the jobs are independent of each other. */
+    for (el = 0; (el < element_count) && !robustnessError; el++) {
       /* Determine current sub stream */
       if (self->flags[streamIndex] & (AC_MPEGH3DA | AC_USAC)) {
         int numElements = 0;
@@ -2843,8 +3467,13 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
         }
       }
 
-      int offset;
       int elCh = 0;
+      AACDEC_ELEMENT_JOB* pElementJob = &elementJobs[numElementJobs];
+      pElementJob->el = (UCHAR)el;
+      pElementJob->streamIndex = (UCHAR)streamIndex;
+      pElementJob->first = (UCHAR)numChannelJobs;
+      pElementJob->numChannels = 0;
+
       /* "c" iterates in canonical MPEG channel order */
       for (; cIdx < el_channels; c++, cIdx++, elCh++) {
         if (!getOnOffFlag(self, cIdx)) {
@@ -2853,7 +3482,8 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
         }
         /* Robustness check */
         if (c >= aacChannels) {
-          return AAC_DEC_UNKNOWN;
+          robustnessError = 1;
+          break;
         }
 
         CAacDecoderChannelInfo* pAacDecoderChannelInfo = self->pAacDecoderChannelInfo[c];
@@ -2861,7 +3491,7 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
             self->pAacDecoderStaticChannelInfo[c];
 
         /* Setup offset for time buffer traversal. */
-        offset = Reverse_chMapping[c] * timeDataChannelOffset;
+        int offset = Reverse_chMapping[c] * timeDataChannelOffset;
 
         if (self->flags[streamIndex] & AC_MPEGH3DA) {
           /* Clear audio data for sub streams which are currently not available. */
@@ -2897,70 +3527,56 @@ LINKSPEC_CPP AAC_DECODER_ERROR CAacDecoder_DecodeFrame(HANDLE_AACDECODER self, c
           }
         }
 
-        /*
-          Conceal defective spectral data
-        */
-        {
-          CAacDecoderChannelInfo** ppAacDecoderChannelInfo = &pAacDecoderChannelInfo;
-          CAacDecoderStaticChannelInfo** ppAacDecoderStaticChannelInfo =
-              &pAacDecoderStaticChannelInfo;
-          {
-            concealApplyReturnCode = CConcealment_Apply(
-                &(*ppAacDecoderStaticChannelInfo)->concealmentInfo, *ppAacDecoderChannelInfo,
-                *ppAacDecoderStaticChannelInfo, &self->samplingRateInfo[streamIndex],
-                self->streamInfo.aacSamplesPerFrame, 0,
-                (self->frameOK && !(flags & AACDEC_CONCEAL)), self->flags[streamIndex]);
-          }
-        }
-        if (concealApplyReturnCode == -1) {
-          frameOk_butConceal = 1;
-        }
+        AACDEC_CHANNEL_JOB* pJob = &channelJobs[numChannelJobs++];
+        pElementJob->numChannels++;
+        pJob->offset = offset;
+        pJob->c = (UCHAR)c;
+        pJob->elCh = (UCHAR)elCh;
+        pJob->frameOK = self->frameOK;
+        pJob->transform = 1;
+        pJob->renderError = 0;
 
         if (timeDataSize < timeDataChannelOffset * self->aacChannels) {
+          /* Only update the concealment state. */
           ErrorStatus = AAC_DEC_OUTPUT_BUFFER_TOO_SMALL;
+          pJob->transform = 0;
           break;
         }
-        if (self->flushStatus && (self->flushCnt > 0) && !(flags & AACDEC_CONCEAL)) {
-          mpegh_FDKmemclear(pTimeData + offset, sizeof(PCM_DEC) * self->streamInfo.aacSamplesPerFrame);
-        } else
-          switch (pAacDecoderChannelInfo->renderMode) {
-            case AACDEC_RENDER_IMDCT:
-
-              CBlock_FrequencyToTime(
-                  pAacDecoderStaticChannelInfo, pAacDecoderChannelInfo, pTimeData + offset,
-                  self->streamInfo.aacSamplesPerFrame,
-                  (self->frameOK && !(flags & AACDEC_CONCEAL) && !frameOk_butConceal),
-                  pAacDecoderChannelInfo->pComStaticData->pWorkBufferCore1->mdctOutTemp,
-                  self->aacOutDataHeadroom, self->elFlags[el], elCh);
-              if (self->flags[streamIndex] & AC_MPEGH3DA) {
-                ltp_post(pTimeData + offset, self->streamInfo.aacSamplesPerFrame,
-                         self->streamInfo.aacSampleRate, pAacDecoderStaticChannelInfo->ltp_param,
-                         &(pAacDecoderStaticChannelInfo->ltp_pitch_int_past),
-                         &(pAacDecoderStaticChannelInfo->ltp_pitch_fr_past),
-                         &(pAacDecoderStaticChannelInfo->ltp_gain_past),
-                         &(pAacDecoderStaticChannelInfo->ltp_gainIdx_past),
-                         pAacDecoderStaticChannelInfo->ltp_mem_in,
-                         pAacDecoderStaticChannelInfo->ltp_mem_out);
-              }
+      }
+      if (pElementJob->numChannels > 0) {
+        numElementJobs++;
+      }
+    }
 
-              break;
-            default:
-              ErrorStatus = AAC_DEC_UNKNOWN;
-              break;
-          }
-        /* TimeDomainFading */
-        if (!CConceal_TDFading_Applied[c]) {
-          CConceal_TDFading_Applied[c] = CConcealment_TDFading(
-              self->streamInfo.aacSamplesPerFrame, &self->pAacDecoderStaticChannelInfo[c],
-              self->aacOutDataHeadroom, pTimeData + offset, 0);
-          if (c + 1 < (28) && c < aacChannels - 1) {
-            /* update next TDNoise Seed to avoid muting in case of Parametric Stereo */
-            self->pAacDecoderStaticChannelInfo[c + 1]->concealmentInfo.TDNoiseSeed =
-                self->pAacDecoderStaticChannelInfo[c]->concealmentInfo.TDNoiseSeed;
-          }
+    /* Conceal and transform the channels, channels of one element share one job. */
+    taskData.pElementJobs = elementJobs;
+    taskData.numJobs = numElementJobs;
+    CAacDecoder_RunTasks(self, CAacDecoder_InverseTransformTask, &taskData);
+
+    for (int j = 0; j < numChannelJobs; j++) {
+      if (channelJobs[j].renderError) {
+        ErrorStatus = AAC_DEC_UNKNOWN;
+      }
+      if (!channelJobs[j].transform) {
+        continue;
+      }
+      c = channelJobs[j].c;
+      /* TimeDomainFading */
+      if (!CConceal_TDFading_Applied[c]) {
+        CConceal_TDFading_Applied[c] = CConcealment_TDFading(
+            self->streamInfo.aacSamplesPerFrame, &self->pAacDecoderStaticChannelInfo[c],
+            self->aacOutDataHeadroom, pTimeData + channelJobs[j].offset, 0);
+        if (c + 1 < (28) && c < aacChannels - 1) {
+          /* update next TDNoise Seed to avoid muting in case of Parametric Stereo */
+          self->pAacDecoderStaticChannelInfo[c + 1]->concealmentInfo.TDNoiseSeed =
+              self->pAacDecoderStaticChannelInfo[c]->concealmentInfo.TDNoiseSeed;
         }
       }
     }
+
+    if (robustnessError) {
+      return AAC_DEC_UNKNOWN;
+    }
   }
 
   /* Add additional concealment delay */
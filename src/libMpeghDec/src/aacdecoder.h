@@ -142,6 +142,25 @@ typedef struct {
   int nrElements;
 } CAncData;
 
+/* Work buffers whose content is only valid during one decoder call. They are allocated as one
+ * block, either by each decoder instance or once for several instances, see
+ * aacDecoder_SetScratch(). */
+struct AACDEC_SCRATCH {
+  FDK_MEM_ARENA arena;
+  FIXP_DBL* workBufferCore2;
+  PCM_DEC* pTimeData2;
+  CWorkBufferCore1* pWorkBufferCore1;
+};
+
+/* Work buffers of a parallel decoding task other than the first one, which uses the ones of the
+ * instance. See CAacDecoder_SetTaskExecutor(). */
+typedef struct {
+  CWorkBufferCore1 workBufferCore1;
+  IGF_PRIVATE_DATA_COMMON igfCommon[2];
+  FIXP_DBL igfVirtualSpec[2 * 1024];
+  FIXP_DBL stereoPredScratch[1024];
+} AACDEC_TASK_SCRATCH;
+
 enum {
   AACDEC_FLUSH_OFF = 0,
   AACDEC_MPEGH_CFG_CHANGE_ATSC_FLUSH_ON = 1,
@@ -212,6 +231,31 @@ TRANSPORTDEC_ERROR PcmDataPayload(EarconDecoder* earconDecoder, FIXP_DBL* TimeDa
                                   SCHAR defaultTargetLoudness, INT targetLayout,
                                   SHORT LastFrameSamples, SHORT NewFrameSamples);
 
+/* Additional target layout rendered from the core output of the decoder instance, see
+ * aacDecoder_AddRenderTarget(). The fields up to earconDecoder mirror the layout dependent ones of
+ * AAC_DECODER_INSTANCE and are swapped with them by CAacDecoder_SwapRenderTarget(), so that the
+ * renderer code runs unchanged on either layout. */
+typedef struct {
+  INT targetLayout;        /*!< Requested target layout, always equal to targetLayout_config. */
+  INT targetLayout_config; /*!< Applied target layout. */
+  IIS_FORMATCONVERTER_HANDLE pFormatConverter[TPDEC_MAX_TRACKS]; /*!< Format converter instances. */
+  HANDLE_GVBAPRENDERER hgVBAPRenderer[TP_MPEGH_MAX_SIGNAL_GROUPS]; /*!< Object renderers. */
+  TDLimiterPtr hLimiter;                 /*!< Time domain limiter of the target layout. */
+  FDK_SignalDelay mpegH_rendered_delay;  /*!< Delay compensation of the rendering chain. */
+  FIXP_DBL mpegH_sampleRateConverter_filterStates[(24)][TD_STATES_MEM_SIZE];
+  PCM_DEC crossfadeMem[128 * (24)];      /*!< Memory for saving samples for MPEG-H crossfade */
+
+  EarconDecoder earconDecoder; /*!< Copy of the earcon state of the primary layout. */
+  PCM_DEC* pTimeData2;         /*!< Rendered signal of the current frame. */
+  INT truncateFrameSize;       /*!< Size of the truncated current frame, -1 if not truncated. */
+  AAC_DECODER_ERROR renderError; /*!< Result of rendering the current frame. */
+  CStreamInfo streamInfo;        /*!< Stream info of the frame being rendered. */
+  CStreamInfo outputInfo;        /*!< Stream info of the frame output in the current call. */
+  CStreamInfo info;              /*!< Stream info returned by aacDecoder_GetRenderTargetInfo(). */
+  INT_PCM* pTimeData;            /*!< Output buffer set by the library user, may be NULL. */
+  INT timeDataSize;              /*!< Size of the output buffer in samples. */
+} AACDEC_RENDER_TARGET;
+
 /* AAC decoder (opaque toward userland) struct declaration */
 struct AAC_DECODER_INSTANCE {
   INT aacChannels;                     /*!< Amount of AAC decoder channels allocated.        */
@@ -259,9 +303,23 @@ struct AAC_DECODER_INSTANCE {
   CAacDecoderStaticChannelInfo*
       pAacDecoderStaticChannelInfo[(28)]; /*!< Persistent channel memory */
 
+  AACDEC_SCRATCH ownScratch; /*!< Work buffers of the instance, released while a shared scratch
+                                  context is attached. */
+  HANDLE_AACDEC_SCRATCH hScratch; /*!< Work buffers in use, either ownScratch or shared ones. */
+  FDK_MEM_ARENA channelArena; /*!< Holds all config dependent channel and element structures. */
+
   FIXP_DBL* workBufferCore2;
   PCM_DEC* pTimeData2;
   INT timeData2Size;
+  CWorkBufferCore1* pWorkBufferCore1;
+
+  AACDEC_TASK_EXECUTOR taskExecutor; /*!< Runs channels in parallel if maxWorkers > 1. */
+  AACDEC_TASK_SCRATCH* pTaskScratch; /*!< Work buffers of tasks 1 to maxWorkers-1. */
+  struct AACDEC_PIPELINE* pPipeline; /*!< Frame held back by pipelined decoding, NULL if the
+                                        decoder runs serially. */
+  struct AACDEC_SIGNAL_EXPORT* pSignalExport; /*!< Signals of the last frame output without
+                                                 rendering, NULL unless ::AAC_SIGNAL_EXPORT is
+                                                 enabled. */
 
   CpePersistentData* cpeStaticData[(3 * ((28) * 2) + (((28) * 2)) / 2 + 4 * (1) +
                                     1)]; /*!< Pointer to persistent data shared by both channels of
@@ -309,6 +367,8 @@ struct AAC_DECODER_INSTANCE {
   INT targetLayout_config; /*!< Applied Target layout index which can be either equal targetLayout
                               or referenceLayout (if targetLayout is 0). */
   IIS_FORMATCONVERTER_HANDLE pFormatConverter[TPDEC_MAX_TRACKS]; /*!< Format converter instances. */
+  IIS_FORMATCONVERTER_DMX_TIER activeDmxTier; /*!< Quality/complexity tier of the active downmix of
+                                                 the format converters, see ::AAC_ACTIVE_DMX_TIER */
   INT downmixId;
 
   IGF_PRIVATE_DATA_COMMON
@@ -365,6 +425,12 @@ struct AAC_DECODER_INSTANCE {
       24)][TD_STATES_MEM_SIZE]; /*!< MPEG-H sample rate converter for upsampling to output sample
                                    rate */
   EarconDecoder earconDecoder;
+
+  AACDEC_RENDER_TARGET* pRenderTarget[AACDEC_MAX_RENDER_TARGETS]; /*!< Additional target layouts
+                                                                     rendered from the same core
+                                                                     output. */
+  UCHAR numRenderTargets;    /*!< Number of entries of pRenderTarget. */
+  UCHAR renderTargetSwapped; /*!< Set while the layout of a render target is swapped in. */
 };
 
 #define AAC_DEBUG_EXTHLP \
@@ -468,9 +534,60 @@ LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_PreRollExtensionPayloadParse(HANDLE_AAC
 /* Destroy aac decoder */
 LINKSPEC_H void CAacDecoder_Close(HANDLE_AACDECODER self);
 
+/* Upper bound of the channel dependent memory for the given number of channels */
+LINKSPEC_H UINT CAacDecoder_GetRequiredChannelMem(const INT numChannels);
+
+/* Size of the work buffers which may be shared between decoder instances */
+LINKSPEC_H UINT CAacDecoder_GetRequiredScratchMem(void);
+
+/* Allocate a set of work buffers */
+LINKSPEC_H INT CAacDecoder_CreateScratch(HANDLE_AACDEC_SCRATCH hScratch);
+
+/* Free a set of work buffers */
+LINKSPEC_H void CAacDecoder_DestroyScratch(HANDLE_AACDEC_SCRATCH hScratch);
+
+/* Make the decoder use another set of work buffers, NULL selects the own ones */
+LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_SetScratch(HANDLE_AACDECODER self,
+                                                    HANDLE_AACDEC_SCRATCH hScratch);
+
+/* Set the executor for parallel decoding of channels */
+LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_SetTaskExecutor(HANDLE_AACDECODER self,
+                                                         const AACDEC_TASK_EXECUTOR* pExecutor);
+
+/* Open and close renderer instances for a worst case configuration */
+LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_ProbeRendererMem(HANDLE_AACDECODER self,
+                                                          const INT targetLayout,
+                                                          const INT numInputChannels,
+                                                          const INT numObjects);
+
+/* Build the object renderer setup of a target layout ahead of decoder configuration */
+LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_PrepareTargetLayout(const INT targetLayout,
+                                                             AACDEC_LAYOUT_SETUP_INFO* pInfo);
+
+/* Copy the object renderer mesh of a target layout in binary form */
+LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_ExportTargetLayoutMesh(const INT targetLayout,
+                                                                void* pData, UINT* pSize);
+
+/* Add an object renderer mesh in binary form to the process-wide mesh cache */
+LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_ImportTargetLayoutMesh(const void* pData,
+                                                                const UINT size);
+
+/* Add a target layout rendered from the same core output as the primary one */
+LINKSPEC_H AAC_DECODER_ERROR CAacDecoder_AddRenderTarget(HANDLE_AACDECODER self,
+                                                         const INT targetLayout, INT* pIndex);
+
+/* Exchange the layout dependent renderer state of the instance with the one of a render target */
+LINKSPEC_H void CAacDecoder_SwapRenderTarget(HANDLE_AACDECODER self,
+                                             AACDEC_RENDER_TARGET* pTarget);
+
 /* get streaminfo handle from decoder */
 LINKSPEC_H CStreamInfo* CAacDecoder_GetStreamInfo(HANDLE_AACDECODER self);
 
+/* Render a frame held back by pipelined decoding before decoder state it depends on is changed.
+ * Outside of a aacDecoder_DecodeFrame() call the frame is dropped instead. Called during the
+ * rendering of that frame it does nothing, the changed state applies to the frame itself. */
+LINKSPEC_H void aacDecoder_SyncPipeline(HANDLE_AACDECODER self);
+
 void EarconDecoder_Init(HANDLE_EARCONDECODER pEarconDecoderH);
 
 #endif /* #ifndef AACDECODER_H */
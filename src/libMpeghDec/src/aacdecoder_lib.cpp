@@ -94,6 +94,7 @@ amm-info@iis.fraunhofer.de
 #include "aacdecoder.h"
 #include "tpdec_lib.h"
 #include "FDK_core.h" /* FDK_tools version info */
+#include "FDK_dsp.h"
 
 #include "conceal.h"
 
@@ -106,6 +107,9 @@ amm-info@iis.fraunhofer.de
 
 #include "ui.h"
 
+#include <mutex>
+#include <new>
+
 /* Decoder library info */
 #define AACDECODER_LIB_VL0 4
 #define AACDECODER_LIB_VL1 1
@@ -120,6 +124,8 @@ amm-info@iis.fraunhofer.de
 #endif
 
 static AAC_DECODER_ERROR setConcealMethod(const HANDLE_AACDECODER self, const INT method);
+static AAC_DECODER_ERROR setPipelinedDecode(const HANDLE_AACDECODER self, const INT enable);
+static AAC_DECODER_ERROR setSignalExport(const HANDLE_AACDECODER self, const INT enable);
 
 LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_GetFreeBytes(const HANDLE_AACDECODER self,
                                                        UINT* pFreeBytes) {
@@ -215,6 +221,8 @@ static INT aacDecoder_ConfigCallback(void* handle, const CSAudioSpecificConfig*
   TRANSPORTDEC_ERROR errTp;
 
   FDK_ASSERT(self != NULL);
+
+  aacDecoder_SyncPipeline(self);
   {
     { err = aacDecoder_Config(self, pAscStruct, configMode, configChanged); }
   }
@@ -258,6 +266,8 @@ static INT aacDecoder_FreeMemCallback(void* handle, const CSAudioSpecificConfig*
   TRANSPORTDEC_ERROR errTp = TRANSPORTDEC_OK;
   HANDLE_AACDECODER self = (HANDLE_AACDECODER)handle;
 
+  aacDecoder_SyncPipeline(self);
+
   int subStreamIndex = 0;
 
   if (pAscStruct->m_aot == AOT_MPEGH3DA) {
@@ -279,6 +289,7 @@ static INT aacDecoder_CtrlCFGChangeCallback(void* handle,
   HANDLE_AACDECODER self = (HANDLE_AACDECODER)handle;
 
   if (self != NULL) {
+    aacDecoder_SyncPipeline(self);
     CAacDecoder_CtrlCFGChange(self, pCtrlCFGChangeStruct->flushStatus,
                               pCtrlCFGChangeStruct->flushCnt, pCtrlCFGChangeStruct->buildUpStatus,
                               pCtrlCFGChangeStruct->buildUpCnt);
@@ -300,6 +311,8 @@ static INT aacDecoder_TruncationMsgCallback(void* handle, INT nTruncSamples, INT
 
   FDK_ASSERT(self != NULL);
 
+  aacDecoder_SyncPipeline(self);
+
   int startOffset, stopOffset;
 
   /* Determine truncation boundaries */
@@ -370,6 +383,9 @@ static INT aacDecoder_UniDrcCallback(void* handle, HANDLE_FDK_BITSTREAM hBs,
   HANDLE_AACDECODER hAacDecoder = (HANDLE_AACDECODER)handle;
   DRC_DEC_CODEC_MODE drcDecCodecMode = DRC_DEC_CODEC_MODE_UNDEFINED;
   UCHAR dummyBuffer[4] = {0, 0, 0, 0};
+
+  aacDecoder_SyncPipeline(hAacDecoder);
+
   FDK_BITSTREAM dummyBs;
   HANDLE_FDK_BITSTREAM hReadBs;
 
@@ -421,6 +437,8 @@ static INT aacDecoder_ParseDmxMatrixCallback(void* handle, HANDLE_FDK_BITSTREAM
   HANDLE_DRC_DECODER hUniDrcDecoder = NULL;
   hUniDrcDecoder = hAacDecoder->hUniDrcDecoder;
 
+  aacDecoder_SyncPipeline(hAacDecoder);
+
   const int targetLayout = usc->targetLayout;
   const int numSignalGroups = usc->bsNumSignalGroups;
   const int downmixConfigType = usc->downmixConfigType;
@@ -481,6 +499,8 @@ static INT aacDecoder_ParseDmxMatrixCallback(void* handle, HANDLE_FDK_BITSTREAM
 static INT aacDecoder_EarconSetBSCallback(void* handle, HANDLE_FDK_BITSTREAM bs) {
   HANDLE_AACDECODER hAacDecoder = (HANDLE_AACDECODER)handle;
 
+  aacDecoder_SyncPipeline(hAacDecoder);
+
   if (hAacDecoder->earconDecoder.earconConfig.EarconFlag) {
     hAacDecoder->earconDecoder.CurrentFrameHasEarcon = 1;
 
@@ -626,12 +646,16 @@ static INT aacDecoder_EarconSetBSCallback(void* handle, HANDLE_FDK_BITSTREAM bs)
 
 static INT aacDecoder_EarconSetConfigCallback(void* handle, EarconConfig* earconConfig) {
   HANDLE_AACDECODER hAacDecoder = (HANDLE_AACDECODER)handle;
+
+  aacDecoder_SyncPipeline(hAacDecoder);
   hAacDecoder->earconDecoder.earconConfig = *earconConfig;
   return 0;
 }
 
 static INT aacDecoder_EarconSetInfoCallback(void* handle, EarconInfo* earconInfo) {
   HANDLE_AACDECODER hAacDecoder = (HANDLE_AACDECODER)handle;
+
+  aacDecoder_SyncPipeline(hAacDecoder);
   hAacDecoder->earconDecoder.earconInfo = *earconInfo;
   return 0;
 }
@@ -755,6 +779,9 @@ aacDecoder_SetParam(const HANDLE_AACDECODER self, /*!< Handle of the decoder ins
         default:
           return AAC_DEC_SET_PARAM_FAIL;
       }
+      for (int i = 0; i < self->numRenderTargets; i++) {
+        pcmLimiter_SetAttack(self->pRenderTarget[i]->hLimiter, value);
+      }
       break;
 
     case AAC_PCM_LIMITER_RELEAS_TIME:
@@ -770,6 +797,9 @@ aacDecoder_SetParam(const HANDLE_AACDECODER self, /*!< Handle of the decoder ins
         default:
           return AAC_DEC_SET_PARAM_FAIL;
       }
+      for (int i = 0; i < self->numRenderTargets; i++) {
+        pcmLimiter_SetRelease(self->pRenderTarget[i]->hLimiter, value);
+      }
       break;
 
     case AAC_PCM_OUTPUT_CHANNEL_MAPPING:
@@ -817,6 +847,26 @@ aacDecoder_SetParam(const HANDLE_AACDECODER self, /*!< Handle of the decoder ins
       }
       break;
 
+    case AAC_ACTIVE_DMX_TIER:
+      if ((value < (INT)IIS_FORMATCONVERTER_DMX_TIER_FULL) ||
+          (value > (INT)IIS_FORMATCONVERTER_DMX_TIER_LOW)) {
+        return AAC_DEC_SET_PARAM_FAIL;
+      }
+      self->activeDmxTier = (IIS_FORMATCONVERTER_DMX_TIER)value;
+      /* Switch running format converters with the next frame */
+      for (int i = 0; i < TPDEC_MAX_TRACKS; i++) {
+        if (self->pFormatConverter[i] != NULL) {
+          IIS_FormatConverter_SetDmxTier(self->pFormatConverter[i], self->activeDmxTier);
+        }
+        for (int t = 0; t < self->numRenderTargets; t++) {
+          if (self->pRenderTarget[t]->pFormatConverter[i] != NULL) {
+            IIS_FormatConverter_SetDmxTier(self->pRenderTarget[t]->pFormatConverter[i],
+                                           self->activeDmxTier);
+          }
+        }
+      }
+      break;
+
     case AAC_DRC_ATTENUATION_FACTOR:
       /* DRC compression factor (where 0 is no and 127 is max compression) */
       if ((value < 0) || (value > 127)) {
@@ -873,6 +923,7 @@ aacDecoder_SetParam(const HANDLE_AACDECODER self, /*!< Handle of the decoder ins
       break;
     case AAC_TPDEC_CLEAR_BUFFER:
       errTp = transportDec_SetParam(hTpDec, TPDEC_PARAM_RESET, 1);
+      aacDecoder_SyncPipeline(self); /* drop a frame held back by pipelined decoding */
       self->streamInfo.numLostAccessUnits = 0;
       self->streamInfo.numBadBytes = 0;
       self->streamInfo.numTotalBytes = 0;
@@ -884,6 +935,12 @@ aacDecoder_SetParam(const HANDLE_AACDECODER self, /*!< Handle of the decoder ins
     case AAC_TPDEC_PARAM_SET_BURSTPERIOD:
       errTp = transportDec_SetParam(hTpDec, TPDEC_PARAM_BURST_PERIOD, (int)value);
       break;
+    case AAC_PIPELINED_DECODE:
+      errorStatus = setPipelinedDecode(self, value);
+      break;
+    case AAC_SIGNAL_EXPORT:
+      errorStatus = setSignalExport(self, value);
+      break;
     case AAC_CONCEAL_METHOD:
       /* Changing the concealment method can introduce additional bitstream delay. And
          that in turn affects sub libraries and modules which makes the whole thing quite
@@ -1008,6 +1065,9 @@ LINKSPEC_CPP HANDLE_AACDECODER aacDecoder_Open(TRANSPORT_TYPE transportFmt, UINT
 
   UINT nrOfLayers_min = fMin(nrOfLayers, (UINT)TPDEC_MAX_LAYERS);
 
+  /* Select the DSP kernels matching the CPU, done once per process. */
+  FDK_dspInit();
+
   /* Allocate transport layer struct. */
   pIn = transportDec_Open(transportFmt, 0, nrOfLayers_min);
   if (pIn == NULL) {
@@ -1026,6 +1086,7 @@ LINKSPEC_CPP HANDLE_AACDECODER aacDecoder_Open(TRANSPORT_TYPE transportFmt, UINT
   aacDec->nrOfLayers = nrOfLayers_min;
 
   aacDec->targetLayout = 6; /* default channel layout is 5.1 */
+  aacDec->activeDmxTier = IIS_FORMATCONVERTER_DMX_TIER_FULL;
   transportDec_SetParam(pIn, TPDEC_PARAM_TARGETLAYOUT, aacDec->targetLayout);
 
   /* Register Config Update callback. */
@@ -1126,6 +1187,48 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_Fill(HANDLE_AACDECODER self, const UCH
   return errorStatus;
 }
 
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_FillSpans(HANDLE_AACDECODER self,
+                                                    const AACDEC_SPAN* pSpans, UINT numSpans) {
+  const UCHAR* pBuffer[AACDEC_MAX_SPANS];
+  UINT bufferSize[AACDEC_MAX_SPANS];
+  TRANSPORTDEC_ERROR tpErr;
+
+  if (self == NULL) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  if (((pSpans == NULL) && (numSpans > 0)) || (numSpans > AACDEC_MAX_SPANS)) {
+    return AAC_DEC_INVALID_PARAM;
+  }
+
+  /* Release a span parsed in place */
+  tpErr = transportDec_FillDataInPlace(self->hInput, NULL, 0, 0, 0);
+  if ((tpErr != TRANSPORTDEC_OK) || (numSpans == 0)) {
+    return (tpErr == TRANSPORTDEC_OK) ? AAC_DEC_OK : AAC_DEC_INVALID_PARAM;
+  }
+
+  if ((numSpans == 1) && (pSpans[0].pData != NULL)) {
+    const UINT capacity = (pSpans[0].capacity > 0) ? pSpans[0].capacity : pSpans[0].size;
+
+    tpErr = transportDec_FillDataInPlace(self->hInput, pSpans[0].pData, pSpans[0].size, capacity,
+                                         0);
+    if (tpErr != TRANSPORTDEC_INVALID_PARAMETER) {
+      return (tpErr == TRANSPORTDEC_OK) ? AAC_DEC_OK : AAC_DEC_UNKNOWN;
+    }
+    /* Not a power of two, too small or too large to be parsed in place, copy it */
+  }
+
+  for (UINT i = 0; i < numSpans; i++) {
+    if ((pSpans[i].pData == NULL) && (pSpans[i].size > 0)) {
+      return AAC_DEC_INVALID_PARAM;
+    }
+    pBuffer[i] = pSpans[i].pData;
+    bufferSize[i] = pSpans[i].size;
+  }
+  tpErr = transportDec_FillDataGather(self->hInput, pBuffer, bufferSize, numSpans, 0);
+
+  return (tpErr == TRANSPORTDEC_OK) ? AAC_DEC_OK : AAC_DEC_UNKNOWN;
+}
+
 static void aacDecoder_SignalInterruption(HANDLE_AACDECODER self) {
   CAacDecoder_SignalInterruption(self);
 
@@ -1133,10 +1236,9 @@ static void aacDecoder_SignalInterruption(HANDLE_AACDECODER self) {
   self->drcStatusValid = 0;
 }
 
-static void aacDecoder_UpdateBitStreamCounters(CStreamInfo* pSi, HANDLE_FDK_BITSTREAM hBs,
-                                               INT nBits, AAC_DECODER_ERROR ErrorStatus) {
-  /* calculate bit difference (amount of bits moved forward) */
-  nBits = nBits - FDKgetValidBits(hBs);
+static void aacDecoder_UpdateBitStreamCounters(CStreamInfo* pSi, INT nBits,
+                                               AAC_DECODER_ERROR ErrorStatus) {
+  /* nBits is the bit difference (amount of bits moved forward) */
 
   /* Note: The amount of bits consumed might become negative when parsing a
      bit stream with several sub frames, and we find out at the last sub frame
@@ -1177,43 +1279,153 @@ static INT aacDecoder_EstimateNumberOfLostFrames(HANDLE_AACDECODER self) {
   return n;
 }
 
-LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(HANDLE_AACDECODER self, INT_PCM* pTimeData,
-                                                      const INT timeDataSize, const UINT flags) {
-  AAC_DECODER_ERROR ErrorStatus;
-  INT layer;
-  INT nBits;
-  INT timeData2Size;
+/* State of one decoder call, handed from reading an access unit to its output. */
+typedef struct {
+  UINT flags;                /* Flags of the decoder call. */
+  INT nBits;                 /* Valid bits of the bit buffer before reading the access unit. */
+  int fTpInterruption;       /* Transport originated interruption detection. */
+  int fTpConceal;            /* Transport originated concealment. */
+  int fEndAuNotAdjusted;     /* The end of the access unit was not adjusted */
+  int truncateFrameSize;     /* -1 if not set */
+  UINT accessUnit;           /* Current one of the preroll access units and the frame itself */
+  UINT numAccessUnits;
+  UINT numPrerollAU;
+  UINT prerollAUOffset[AACDEC_MAX_NUM_PREROLL_AU * TPDEC_MAX_LAYERS];
+  INT auStartAnchor[TPDEC_MAX_LAYERS];
   INT timeDataHeadroom;
-  HANDLE_FDK_BITSTREAM hBs;
-  int fTpInterruption = 0; /* Transport originated interruption detection. */
-  int fTpConceal = 0;      /* Transport originated concealment. */
-  int streamIndex = 0;
-  int truncateFrameSize = -1; /* not set */
-  UINT accessUnit = 0;
-  UINT numAccessUnits = 1;
-  UINT numPrerollAU = 0;
-  int fEndAuNotAdjusted = 0; /* The end of the access unit was not adjusted */
-  PCM_DEC* pTimeData2;
+  PCM_DEC* pTimeData2;       /* Core output, rendered in place */
   PCM_AAC* pTimeData3;
-  INT pcmLimiterScale = 0;
+  FIXP_DBL* pWorkBuffer;     /* Renderer output, used for interleaving as well */
+  UINT decFlags;             /* self->flags[0] after core decoding of the access unit */
+  UCHAR limiterEnable;       /* self->limiterEnableCurr after core decoding of the access unit */
+  UCHAR fUiApplied;          /* User interactivity of the access unit is applied already */
+  UCHAR fTargetsRendered;    /* The render targets hold the access unit, see pRenderTarget */
+  UCHAR fSignalsExported;    /* The access unit is exported instead of rendered */
+  AAC_DECODER_ERROR uiError; /* Result of applying the user interactivity */
+} AACDEC_FRAME_STATE;
+
+enum {
+  AACDEC_PIPELINE_EMPTY = 0, /* No frame is held back */
+  AACDEC_PIPELINE_PENDING,   /* The core decoded frame waits for rendering */
+  AACDEC_PIPELINE_RENDERING, /* The frame is being rendered */
+  AACDEC_PIPELINE_RENDERED   /* The frame is rendered into the output buffer of the current call */
+};
+
+/* Frame held back between two decoder calls by pipelined decoding, see ::AAC_PIPELINED_DECODE.
+ * Each call renders the frame held back by the previous call, while the next access unit is
+ * core decoded. */
+struct AACDEC_PIPELINE {
+  FDK_MEM_ARENA arena;
+  PCM_DEC* pTimeData2;             /* Core output of the pending frame */
+  FIXP_DBL* pWorkBuffer;           /* Work buffer of the renderer */
+  AACDEC_FRAME_STATE pending;      /* State of the pending frame */
+  CStreamInfo streamInfo;          /* Stream info after core decoding of the pending frame */
+  AAC_DECODER_ERROR decodeError;   /* Result of reading and core decoding the pending frame */
+  AAC_DECODER_ERROR renderError;   /* Result of rendering the pending frame */
+  INT nBits;                       /* Bits consumed by the pending frame */
+  UCHAR frameOK;                   /* self->frameOK after core decoding of the pending frame */
+  UCHAR fSteady;                   /* Rendered on streamInfo, may overlap with the next frame */
+  INT validBits[TPDEC_MAX_LAYERS]; /* Valid bits of the transport layers at hold time */
+  INT_PCM* pTimeData;              /* Output buffer of the current call, NULL between calls */
+  INT timeDataSize;
+  INT renderState; /* AACDEC_PIPELINE_*, changed under renderLock while a task may render */
+  std::recursive_mutex renderLock; /* Held while the pending frame is rendered or claimed */
+};
+
+static AAC_DECODER_ERROR setPipelinedDecode(const HANDLE_AACDECODER self, const INT enable) {
+  struct AACDEC_PIPELINE* pPipe = self->pPipeline;
+
+  if ((enable < 0) || (enable > 1)) {
+    return AAC_DEC_SET_PARAM_FAIL;
+  }
+  if (enable && (self->pSignalExport != NULL)) {
+    return AAC_DEC_SET_PARAM_FAIL;
+  }
 
-  if (self == NULL) {
-    return AAC_DEC_INVALID_HANDLE;
+  if (enable && (pPipe == NULL)) {
+    pPipe = (struct AACDEC_PIPELINE*)mpegh_FDKcalloc(1, sizeof(struct AACDEC_PIPELINE));
+    if (pPipe == NULL) {
+      return AAC_DEC_OUT_OF_MEMORY;
+    }
+    if (mpegh_FDKarenaCreate(&pPipe->arena,
+                             ARENA_ALGN_SIZE(GetRequiredMemWorkBufferCore5()) +
+                                 ARENA_ALGN_SIZE(((24) * (1024 * 3)) * sizeof(FIXP_DBL))) != 0) {
+      mpegh_FDKfree(pPipe);
+      return AAC_DEC_OUT_OF_MEMORY;
+    }
+    pPipe->pTimeData2 =
+        (PCM_DEC*)mpegh_FDKarenaAlloc(&pPipe->arena, GetRequiredMemWorkBufferCore5());
+    pPipe->pWorkBuffer = (FIXP_DBL*)mpegh_FDKarenaAlloc(
+        &pPipe->arena, ((24) * (1024 * 3)) * sizeof(FIXP_DBL));
+    new (&pPipe->renderLock) std::recursive_mutex;
+    pPipe->renderState = AACDEC_PIPELINE_EMPTY;
+    self->pPipeline = pPipe;
+  } else if (!enable && (pPipe != NULL)) {
+    /* A frame held back is dropped. */
+    self->pPipeline = NULL;
+    self->streamInfo.numPendingFrames = 0;
+    mpegh_FDKarenaDestroy(&pPipe->arena);
+    pPipe->renderLock.~recursive_mutex();
+    mpegh_FDKfree(pPipe);
   }
-  if (pTimeData == NULL) {
-    return AAC_DEC_INVALID_PARAM;
+
+  return AAC_DEC_OK;
+}
+
+/* Pre-rendering signals of the last frame output with ::AAC_SIGNAL_EXPORT, see
+ * aacDecoder_GetSignals(). The samples stay in the core output of the frame. */
+struct AACDEC_SIGNAL_EXPORT {
+  AACDEC_SIGNALS signals;
+  AACDEC_SIGNAL signal[(28)];
+  AACDEC_SIGNAL_GROUP group[TP_MPEGH_MAX_SIGNAL_GROUPS];
+  AACDEC_OBJECT_METADATA objectMetadata[(28) * GVBAPRENDERER_MAX_OAM_FRAMES_PER_CORE_FRAME];
+};
+
+static AAC_DECODER_ERROR setSignalExport(const HANDLE_AACDECODER self, const INT enable) {
+  struct AACDEC_SIGNAL_EXPORT* pExport = self->pSignalExport;
+
+  if ((enable < 0) || (enable > 1)) {
+    return AAC_DEC_SET_PARAM_FAIL;
+  }
+  if (enable && (self->pPipeline != NULL)) {
+    return AAC_DEC_SET_PARAM_FAIL;
   }
 
+  if (enable && (pExport == NULL)) {
+    pExport =
+        (struct AACDEC_SIGNAL_EXPORT*)mpegh_FDKcalloc(1, sizeof(struct AACDEC_SIGNAL_EXPORT));
+    if (pExport == NULL) {
+      return AAC_DEC_OUT_OF_MEMORY;
+    }
+    pExport->signals.pSignals = pExport->signal;
+    pExport->signals.pGroups = pExport->group;
+    pExport->signals.pObjectMetadata = pExport->objectMetadata;
+    self->pSignalExport = pExport;
+  } else if (!enable && (pExport != NULL)) {
+    self->pSignalExport = NULL;
+    mpegh_FDKfree(pExport);
+  }
+
+  return AAC_DEC_OK;
+}
+
+static void aacDecoder_InitFrameState(AACDEC_FRAME_STATE* st, const UINT flags) {
+  mpegh_FDKmemclear(st, sizeof(AACDEC_FRAME_STATE));
+  st->flags = flags;
+  st->truncateFrameSize = -1;
+  st->numAccessUnits = 1;
+}
+
+/* Read the next access unit from the transport layer. Returns AAC_DEC_OK if it is to be decoded. */
+static AAC_DECODER_ERROR aacDecoder_ReadAU(HANDLE_AACDECODER self, AACDEC_FRAME_STATE* st) {
+  const UINT flags = st->flags;
+  INT layer;
+
   if (flags & AACDEC_INTR) {
     self->streamInfo.numLostAccessUnits = 0;
   }
   self->streamInfo.mpeghAUSize = 0;
 
-  hBs = transportDec_GetBitstream(self->hInput, 0);
-
-  /* Get current bits position for bitrate calculation. */
-  nBits = FDKgetValidBits(hBs);
-
   if (!((flags & (AACDEC_CONCEAL | AACDEC_FLUSH)) ||
         (self->flushStatus == AACDEC_MPEGH_DASH_IPF_ATSC_FLUSH_ON) ||
         (self->flushStatus == AACDEC_USAC_DASH_IPF_FLUSH_ON) ||
@@ -1225,29 +1437,24 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(HANDLE_AACDECODER self, IN
       if (err != TRANSPORTDEC_OK) {
         switch (err) {
           case TRANSPORTDEC_NOT_ENOUGH_BITS:
-            ErrorStatus = AAC_DEC_NOT_ENOUGH_BITS;
-            goto bail;
+            return AAC_DEC_NOT_ENOUGH_BITS;
           case TRANSPORTDEC_SYNC_ERROR:
             if (TT_IS_PACKET(transportDec_GetFormat(self->hInput))) {
-              ErrorStatus = AAC_DEC_PARSE_ERROR;
-              fTpConceal = 1;
+              st->fTpConceal = 1;
             } else {
               self->streamInfo.numLostAccessUnits = aacDecoder_EstimateNumberOfLostFrames(self);
-              fTpInterruption = 1;
+              st->fTpInterruption = 1;
             }
             break;
           case TRANSPORTDEC_NEED_TO_RESTART:
-            ErrorStatus = AAC_DEC_NEED_TO_RESTART;
-            goto bail;
+            return AAC_DEC_NEED_TO_RESTART;
           case TRANSPORTDEC_CRC_ERROR:
-            fTpConceal = 1;
+            st->fTpConceal = 1;
             break;
           case TRANSPORTDEC_UNSUPPORTED_FORMAT:
-            ErrorStatus = AAC_DEC_UNSUPPORTED_FORMAT;
-            goto bail;
+            return AAC_DEC_UNSUPPORTED_FORMAT;
           default:
-            ErrorStatus = AAC_DEC_UNKNOWN;
-            goto bail;
+            return AAC_DEC_UNKNOWN;
         }
       }
     }
@@ -1262,716 +1469,937 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(HANDLE_AACDECODER self, IN
   if (self->buildUpStatus == AACDEC_MPEGH_BUILD_UP_IDLE) {
     /* return without decoding audio to allow UI persistency module to restore settings first */
     self->streamInfo.frameSize = 0;
-    ErrorStatus = AAC_DEC_INTERMEDIATE_OK;
-    goto bail;
+    return AAC_DEC_INTERMEDIATE_OK;
   }
 
-  UINT prerollAUOffset[AACDEC_MAX_NUM_PREROLL_AU * TPDEC_MAX_LAYERS];
   for (int i = 0; i < AACDEC_MAX_NUM_PREROLL_AU + 1; i++) self->prerollAULength[i] = 0;
 
-  INT auStartAnchor[TPDEC_MAX_LAYERS];
-  HANDLE_FDK_BITSTREAM hBsAu;
+  return AAC_DEC_OK;
+}
 
-  /* Process preroll frames and current frame */
-  do {
-    if (!(flags & (AACDEC_CONCEAL | AACDEC_FLUSH)) &&
-        (self->flushStatus != AACDEC_MPEGH_CFG_CHANGE_ATSC_FLUSH_ON) && (accessUnit == 0) &&
-        (self->hasAudioPreRoll || (self->buildUpStatus == AACDEC_MPEGH_BUILD_UP_IDLE_IN_BAND)) &&
-        !fTpInterruption &&
-        !fTpConceal /* Bit stream pointer needs to be at the beginning of a (valid) AU. */
-    ) {
-      ErrorStatus = CAacDecoder_PreRollExtensionPayloadParse(self, &numPrerollAU, prerollAUOffset);
+/* Prepare core decoding of st->accessUnit: parse the preroll and position the bit stream. Returns
+ * AAC_DEC_OK if core decoding is to follow. */
+static AAC_DECODER_ERROR aacDecoder_PrepareAU(HANDLE_AACDECODER self, AACDEC_FRAME_STATE* st) {
+  const UINT flags = st->flags;
+  AAC_DECODER_ERROR ErrorStatus;
+  HANDLE_FDK_BITSTREAM hBsAu;
 
-      if (ErrorStatus != AAC_DEC_OK) {
-        switch (ErrorStatus) {
-          case AAC_DEC_NOT_ENOUGH_BITS:
-            goto bail;
-          case AAC_DEC_PARSE_ERROR:
-            self->frameOK = 0;
-            break;
-          default:
-            break;
-        }
+  if (!(flags & (AACDEC_CONCEAL | AACDEC_FLUSH)) &&
+      (self->flushStatus != AACDEC_MPEGH_CFG_CHANGE_ATSC_FLUSH_ON) && (st->accessUnit == 0) &&
+      (self->hasAudioPreRoll || (self->buildUpStatus == AACDEC_MPEGH_BUILD_UP_IDLE_IN_BAND)) &&
+      !st->fTpInterruption &&
+      !st->fTpConceal /* Bit stream pointer needs to be at the beginning of a (valid) AU. */
+  ) {
+    ErrorStatus =
+        CAacDecoder_PreRollExtensionPayloadParse(self, &st->numPrerollAU, st->prerollAUOffset);
+
+    if (ErrorStatus != AAC_DEC_OK) {
+      switch (ErrorStatus) {
+        case AAC_DEC_NOT_ENOUGH_BITS:
+          return ErrorStatus;
+        case AAC_DEC_PARSE_ERROR:
+          self->frameOK = 0;
+          break;
+        default:
+          break;
       }
-
-      numAccessUnits += numPrerollAU;
     }
 
-    if (self->buildUpStatus == AACDEC_MPEGH_BUILD_UP_IDLE_IN_BAND) {
-      /* return without decoding audio to allow UI persistency module to restore settings first */
-      self->streamInfo.frameSize = 0;
-      ErrorStatus = AAC_DEC_INTERMEDIATE_OK;
-      goto bail;
-    }
+    st->numAccessUnits += st->numPrerollAU;
+  }
 
-    for (int i = TPDEC_MAX_LAYERS - 1; i >= 0; i--) {
-      hBsAu = transportDec_GetBitstream(self->hInput, i);
-      auStartAnchor[i] = (INT)FDKgetValidBits(hBsAu);
+  if (self->buildUpStatus == AACDEC_MPEGH_BUILD_UP_IDLE_IN_BAND) {
+    /* return without decoding audio to allow UI persistency module to restore settings first */
+    self->streamInfo.frameSize = 0;
+    return AAC_DEC_INTERMEDIATE_OK;
+  }
 
-      if (auStartAnchor[i] > 0 && accessUnit < numPrerollAU) {
-        FDKpushFor(hBsAu, prerollAUOffset[accessUnit + i]);
-      }
-    }
-    self->accessUnit = accessUnit;
+  for (int i = TPDEC_MAX_LAYERS - 1; i >= 0; i--) {
+    hBsAu = transportDec_GetBitstream(self->hInput, i);
+    st->auStartAnchor[i] = (INT)FDKgetValidBits(hBsAu);
 
-    /* Signal bit stream interruption to other modules if required. */
-    if (fTpInterruption || ((flags & AACDEC_INTR) && (accessUnit == 0))) {
-      aacDecoder_SignalInterruption(self);
-      if (!((flags & AACDEC_INTR) && (accessUnit == 0))) {
-        ErrorStatus = AAC_DEC_TRANSPORT_SYNC_ERROR;
-        goto bail;
-      }
+    if (st->auStartAnchor[i] > 0 && st->accessUnit < st->numPrerollAU) {
+      FDKpushFor(hBsAu, st->prerollAUOffset[st->accessUnit + i]);
     }
+  }
+  self->accessUnit = st->accessUnit;
 
-    /* Clearing core data will be done in CAacDecoder_DecodeFrame() below.
-       Tell other modules to clear states if required. */
-    if (flags & AACDEC_CLRHIST) {
+  /* Signal bit stream interruption to other modules if required. */
+  if (st->fTpInterruption || ((flags & AACDEC_INTR) && (st->accessUnit == 0))) {
+    aacDecoder_SignalInterruption(self);
+    if (!((flags & AACDEC_INTR) && (st->accessUnit == 0))) {
+      return AAC_DEC_TRANSPORT_SYNC_ERROR;
     }
+  }
 
-    /* Empty bit buffer in case of flush request. */
-    if (flags & AACDEC_FLUSH && !(flags & AACDEC_CONCEAL)) {
-      if (!self->flushStatus) {
-        transportDec_SetParam(self->hInput, TPDEC_PARAM_RESET, 1);
-        self->streamInfo.numLostAccessUnits = 0;
-        self->streamInfo.numBadBytes = 0;
-        self->streamInfo.numTotalBytes = 0;
-      }
-    }
-    /* Reset the output delay field. The modules will add their figures one after another. */
-    self->streamInfo.outputDelay = 0;
+  /* Clearing core data will be done in CAacDecoder_DecodeFrame() below.
+     Tell other modules to clear states if required. */
+  if (flags & AACDEC_CLRHIST) {
+  }
 
-    if (self->limiterEnableUser == (UCHAR)-1) {
-      /* Enable limiter for all non-lowdelay and non-HD AOT's. */
-      self->limiterEnableCurr = (self->flags[0] & (AC_LD | AC_ELD | AC_HDAAC)) ? 0 : 1;
-    } else {
-      /* Use limiter configuration as requested. */
-      self->limiterEnableCurr = self->limiterEnableUser;
+  /* Empty bit buffer in case of flush request. */
+  if (flags & AACDEC_FLUSH && !(flags & AACDEC_CONCEAL)) {
+    if (!self->flushStatus) {
+      transportDec_SetParam(self->hInput, TPDEC_PARAM_RESET, 1);
+      self->streamInfo.numLostAccessUnits = 0;
+      self->streamInfo.numBadBytes = 0;
+      self->streamInfo.numTotalBytes = 0;
     }
+  }
+  /* Reset the output delay field. The modules will add their figures one after another. */
+  self->streamInfo.outputDelay = 0;
 
-    pTimeData2 = self->pTimeData2;
-    timeData2Size = self->timeData2Size / sizeof(PCM_DEC);
-    pTimeData3 = (PCM_AAC*)self->pTimeData2;
-
-    ErrorStatus = CAacDecoder_DecodeFrame(
-        self,
-        flags | (fTpConceal ? AACDEC_CONCEAL : 0) |
-            ((self->flushStatus && !(flags & AACDEC_CONCEAL)) ? AACDEC_FLUSH : 0),
-        pTimeData2 + 256, timeData2Size - 256, self->streamInfo.aacSamplesPerFrame + 256);
-
-    timeDataHeadroom = self->aacOutDataHeadroom;
+  if (self->limiterEnableUser == (UCHAR)-1) {
+    /* Enable limiter for all non-lowdelay and non-HD AOT's. */
+    self->limiterEnableCurr = (self->flags[0] & (AC_LD | AC_ELD | AC_HDAAC)) ? 0 : 1;
+  } else {
+    /* Use limiter configuration as requested. */
+    self->limiterEnableCurr = self->limiterEnableUser;
+  }
 
-    if (!((flags & (AACDEC_CONCEAL | AACDEC_FLUSH)) || fTpConceal || self->flushStatus) &&
-        (!(IS_OUTPUT_VALID(ErrorStatus)) || !(accessUnit < numPrerollAU))) {
-      TRANSPORTDEC_ERROR tpErr;
-      tpErr = transportDec_EndAccessUnit(self->hInput);
-      if (tpErr != TRANSPORTDEC_OK) {
-        self->frameOK = 0;
-      }
-    } else { /* while preroll processing later possibly an error in the renderer part occurrs */
-      if (IS_OUTPUT_VALID(ErrorStatus)) {
-        fEndAuNotAdjusted = 1;
-      }
-    }
+  return AAC_DEC_OK;
+}
 
-    /* If the current pTimeData2 does not contain a valid signal, there nothing else we can do, so
-     * bail. */
-    if (!IS_OUTPUT_VALID(ErrorStatus)) {
-      goto bail;
-    }
+/* Core decode st->accessUnit into self->pTimeData2. */
+static AAC_DECODER_ERROR aacDecoder_DecodeAU(HANDLE_AACDECODER self, AACDEC_FRAME_STATE* st) {
+  const UINT flags = st->flags;
+  const INT timeData2Size = self->timeData2Size / sizeof(PCM_DEC);
+  AAC_DECODER_ERROR ErrorStatus;
 
-    {
-      self->streamInfo.sampleRate = self->streamInfo.aacSampleRate;
-      self->streamInfo.frameSize = self->streamInfo.aacSamplesPerFrame;
-    }
+  st->pTimeData2 = self->pTimeData2;
+  st->pTimeData3 = (PCM_AAC*)self->pTimeData2;
+  st->pWorkBuffer = self->workBufferCore2;
 
-    self->streamInfo.numChannels = self->streamInfo.aacNumChannels;
+  ErrorStatus = CAacDecoder_DecodeFrame(
+      self,
+      flags | (st->fTpConceal ? AACDEC_CONCEAL : 0) |
+          ((self->flushStatus && !(flags & AACDEC_CONCEAL)) ? AACDEC_FLUSH : 0),
+      st->pTimeData2 + 256, timeData2Size - 256, self->streamInfo.aacSamplesPerFrame + 256);
 
-    /* MPEG-H Rendering */
+  st->timeDataHeadroom = self->aacOutDataHeadroom;
 
-    if ((self->flags[0] & AC_MPEGH3DA) && (self->targetLayout_config >= 0) &&
-        (self->streamInfo.numChannels > 0)) {
-      int grp = 0;
-      /* Temporary downmix buffers */
-      PCM_DEC* pTimeData_in = pTimeData2;
+  if (!((flags & (AACDEC_CONCEAL | AACDEC_FLUSH)) || st->fTpConceal || self->flushStatus) &&
+      (!(IS_OUTPUT_VALID(ErrorStatus)) || !(st->accessUnit < st->numPrerollAU))) {
+    TRANSPORTDEC_ERROR tpErr;
+    tpErr = transportDec_EndAccessUnit(self->hInput);
+    if (tpErr != TRANSPORTDEC_OK) {
+      self->frameOK = 0;
+    }
+  } else { /* while preroll processing later possibly an error in the renderer part occurrs */
+    if (IS_OUTPUT_VALID(ErrorStatus)) {
+      st->fEndAuNotAdjusted = 1;
+    }
+  }
 
-      {
-        AAC_DECODER_ERROR ErrorUI;
-        /* apply user interactivity */
-        ErrorUI = applyUserInteractivity(self, pTimeData_in + 256);
+  st->decFlags = self->flags[0];
+  st->limiterEnable = self->limiterEnableCurr;
 
-        if (ErrorUI != AAC_DEC_OK) {
-          ErrorStatus = ErrorUI;
-          goto bail;
-        }
-      }
+  return ErrorStatus;
+}
 
-      /* Apply DRC 1 (before downmix/rendering) */
-      int drcNumChannels = 0, drcStartChannel = 0, drcTotalChannels = 0;
-      int signalsPrevStreams = 0;
-      FDK_drcDec_Preprocess(self->hUniDrcDecoder);
-
-      for (streamIndex = 0; streamIndex < TPDEC_MAX_TRACKS; streamIndex++) {
-        if (self->pUsacConfig[streamIndex] == NULL) break;
-        for (grp = 0; grp < self->pUsacConfig[streamIndex]->bsNumSignalGroups; grp++) {
-          int transportStartChannel =
-              self->pUsacConfig[streamIndex]->m_signalGroupType[grp].firstSigIdx +
-              signalsPrevStreams;
-          int transportNumChannels = self->pUsacConfig[streamIndex]->m_signalGroupType[grp].count;
-          int signalGroupType = self->pUsacConfig[streamIndex]->m_signalGroupType[grp].type;
-          int processTimeDomainDrc = !self->multibandDrcPresent;
-          int processStftDomainDrcObjectsOrHoa = 0;
-
-          /* get start channel index referenced in DRC configuration */
-          switch (signalGroupType) {
-            case 0: /* channels */
-              drcNumChannels = transportNumChannels;
-              break;
-            case 1: /* objects */
-              processStftDomainDrcObjectsOrHoa = self->multibandDrcPresent;
-              drcNumChannels = transportNumChannels;
-              break;
-            default:
-              drcNumChannels = transportNumChannels;
-              break;
-          }
+static void aacDecoder_ApplyUserInteractivity(HANDLE_AACDECODER self, AACDEC_FRAME_STATE* st,
+                                              const CStreamInfo* pSi) {
+  st->uiError = AAC_DEC_OK;
+  if ((st->decFlags & AC_MPEGH3DA) && (self->targetLayout_config >= 0) &&
+      (pSi->aacNumChannels > 0)) {
+    st->uiError = applyUserInteractivity(self, pSi->aacNumChannels, pSi->aacSamplesPerFrame,
+                                         st->pTimeData2 + 256);
+  }
+  st->fUiApplied = 1;
+}
 
-          /* substract inactive channels */
-          int transportNumChannels2 = transportNumChannels;
-          for (int sig = 0; sig < transportNumChannels; sig++) {
-            if (!getOnOffFlag(self, sig + transportStartChannel)) {
-              transportNumChannels2--;
-            }
-          }
-          transportNumChannels = transportNumChannels2;
-          int transportStartChannel2 = transportStartChannel;
-          for (int sig = 0; sig < transportStartChannel; sig++) {
-            if (!getOnOffFlag(self, sig)) {
-              transportStartChannel2--;
-            }
-          }
-          transportStartChannel = transportStartChannel2;
-          drcTotalChannels += transportNumChannels;
+/* Render the core output of st->accessUnit in st->pTimeData2 to the current target layout into
+ * pTimeData2, which may be st->pTimeData2 itself, and describe the result in pSi. */
+static AAC_DECODER_ERROR aacDecoder_RenderLayout(HANDLE_AACDECODER self, AACDEC_FRAME_STATE* st,
+                                                 CStreamInfo* pSi, PCM_DEC* pTimeData2,
+                                                 EarconDecoder* pEarconDecoder) {
+  const UINT flags = st->flags;
+  PCM_DEC* pTimeData_in = st->pTimeData2;
+  int streamIndex, grp, signalsPrevStreams;
+
+  /* Amount of rendered channels. Does not change when we export the MPEGH channels/objects/HOA,
+   * since the format converter is skipped*/
+  {
+    pSi->numChannels = cicp2geometry_get_numChannels_from_cicp(self->targetLayout_config);
+  }
 
-          if (drcTotalChannels > self->aacChannels) {
-            /* configuration mismatch between signal groups and channel elements */
-            ErrorStatus = AAC_DEC_UNKNOWN;
-            goto bail;
-          }
+  /* Clear output buffer, were each renderer will mix its output into. */
+  if ((st->decFlags & AC_MPEGH3DA) && (self->targetLayout_config > -1)) {
+    mpegh_FDKmemclear(st->pWorkBuffer, (pSi->numChannels) * (pSi->frameSize) * sizeof(FIXP_DBL));
+  }
 
-          if (processTimeDomainDrc && transportNumChannels > 0)
-            FDK_drcDec_ProcessTime(self->hUniDrcDecoder, 0, DRC_DEC_DRC1, transportStartChannel,
-                                   drcStartChannel - transportStartChannel, transportNumChannels,
-                                   pTimeData2 + 256, self->streamInfo.frameSize + 256);
-
-          if (processStftDomainDrcObjectsOrHoa && transportNumChannels > 0) {
-            C_AALLOC_SCRATCH_START(stftBuffer, FIXP_DBL, 512) /* 2*(stft frame size) */
-            for (int i = 0; i < self->numTimeSlots; i++) {
-              /* get headroom */
-              int ch;
-              int STFT_headroom = 31;
-              int STFT_headroom_prescaling = 0, STFT_headroom_prescaling_min = 0;
-              for (ch = 0; ch < transportNumChannels; ch++) {
-                STFT_headroom =
-                    fMin(STFT_headroom,
-                         mpegh_getScalefactor(&(pTimeData2[(transportStartChannel + ch) *
-                                                         (self->streamInfo.frameSize + 256) +
-                                                     i * self->stftFrameSize + 256]),
-                                        self->stftFrameSize));
-              }
-              /* Ensure PCM_OUT_HEADROOM bit headroom */
-              STFT_headroom_prescaling = fMax(STFT_headroom - PCM_OUT_HEADROOM, 0);
-              /* Don't prescale more than necessary */
-              STFT_headroom_prescaling = fMin(STFT_headroom_prescaling, PCM_OUT_HEADROOM);
-              /* Ensure at least one bit headroom for FFT */
-              if (STFT_headroom == 0) STFT_headroom_prescaling = -1;
-
-              STFT_headroom_prescaling_min =
-                  fMin((INT)self->STFT_headroom_prescaling[grp], STFT_headroom_prescaling);
-
-              /* Transform to frequency domain*/
-              for (ch = 0; ch < transportNumChannels; ch++) {
-                StftFilterbank_Process(
-                    &(pTimeData2[(transportStartChannel + ch) * (self->streamInfo.frameSize + 256) +
-                                 i * self->stftFrameSize + 256]),
-                    stftBuffer, self->stftFilterbankAnalysis[transportStartChannel + ch],
-                    STFT_headroom_prescaling_min);
-
-                /* Delay of DRC gains: Delay of STFT Analysis (256) - 128 because MPEG-D DRC
-                 * downsamples at the middle of each timeslot */
-                FDK_drcDec_ProcessFreq(
-                    self->hUniDrcDecoder, 128, DRC_DEC_DRC1, transportStartChannel + ch,
-                    drcStartChannel - transportStartChannel, 1, i, (FIXP_DBL**)&stftBuffer, NULL);
-
-                /* clear output buffer first, as StftFilterbank_Process accumulates its output
-                 * signal to the buffer */
-                mpegh_FDKmemclear(
-                    &(pTimeData2[(transportStartChannel + ch) * (self->streamInfo.frameSize + 256) +
-                                 i * self->stftFrameSize + 256]),
-                    self->stftFrameSize * sizeof(FIXP_DBL));
-                /* Transform to time domain */
-                StftFilterbank_Process(
-                    stftBuffer,
-                    &(pTimeData2[(transportStartChannel + ch) * (self->streamInfo.frameSize + 256) +
-                                 i * self->stftFrameSize + 256]),
-                    self->stftFilterbankSynthesis[transportStartChannel + ch],
-                    STFT_headroom_prescaling_min);
-              }
-              /* Keep the current signal headroom correction for use in the next frame */
-              self->STFT_headroom_prescaling[grp] = STFT_headroom_prescaling;
-            }
-            C_AALLOC_SCRATCH_END(stftBuffer, FIXP_DBL, 512)
-          }
-          drcStartChannel += drcNumChannels;
-
-          /* Compensate STFT delay in object and HOA signal path in case of time domain DRC. */
-          if (processTimeDomainDrc) {
-            for (int ch = 0; ch < transportNumChannels; ch++) {
-              mpegh_FDKmemcpy(
-                  pTimeData2 + (transportStartChannel + ch) * (self->streamInfo.frameSize + 256),
-                  self->delayBuffer[transportStartChannel + ch], sizeof(PCM_DEC) * 256);
-              mpegh_FDKmemcpy(self->delayBuffer[transportStartChannel + ch],
-                        pTimeData2 +
-                            (transportStartChannel + ch) * (self->streamInfo.frameSize + 256) +
-                            self->streamInfo.frameSize,
-                        sizeof(PCM_DEC) * 256);
-            }
-          }
+  {
+    signalsPrevStreams = 0;
+    for (streamIndex = 0; streamIndex < TPDEC_MAX_TRACKS; streamIndex++) {
+      if (self->pUsacConfig[streamIndex] == NULL) break;
+      /* Apply format converter if there is at least one channel signal group (always first). */
+      if (self->pUsacConfig[streamIndex]->m_signalGroupType[0].type == 0) {
+        int err;
+
+        err = IIS_FormatConverter_Process(
+            self->pFormatConverter[streamIndex],
+            self->multibandDrcPresent ? self->hUniDrcDecoder : NULL,
+            pTimeData_in + 256 + signalsPrevStreams * (pSi->frameSize + 256),
+            (PCM_DEC*)st->pWorkBuffer, pSi->aacSamplesPerFrame + 256);
+
+        if (err != 0) {
+          return AAC_DEC_UNKNOWN;
         }
-        signalsPrevStreams += self->ascChannels[streamIndex];
       }
-      streamIndex = 0;
 
-      /* Amount of rendered channels. Does not change when we export the MPEGH channels/objects/HOA,
-       * since the format converter is skipped*/
-      {
-        self->streamInfo.numChannels =
-            cicp2geometry_get_numChannels_from_cicp(self->targetLayout_config);
-      }
+      signalsPrevStreams += self->ascChannels[streamIndex];
+    }
+    streamIndex = 0;
+  }
 
-      /* Clear output buffer, were each renderer will mix its output into. */
-      if ((self->flags[0] & AC_MPEGH3DA) && (self->targetLayout_config > -1)) {
-        mpegh_FDKmemclear(self->workBufferCore2, (self->streamInfo.numChannels) *
-                                               (self->streamInfo.frameSize) * sizeof(FIXP_DBL));
+  int numObjGroup = 0;
+  /* DMX processing IN: pTimeData_tmp (working buffer) OUT: pTimeData_tmp2 ( working buffer for
+   * deinterleaving / ouput buffer for interleaving )*/
+  signalsPrevStreams = 0;
+  for (streamIndex = 0; streamIndex < TPDEC_MAX_TRACKS; streamIndex++) {
+    if (self->pUsacConfig[streamIndex] == NULL) break;
+    for (grp = 0; grp < self->pUsacConfig[streamIndex]->bsNumSignalGroups; grp++) {
+      int signalOffset = self->multibandDrcPresent ? 256 : 0;
+
+      if (!getOnOffFlag(self,
+                        self->pUsacConfig[streamIndex]->m_signalGroupType[grp].firstSigIdx +
+                            signalsPrevStreams)) {
+        continue;
       }
 
-      {
-        signalsPrevStreams = 0;
-        for (streamIndex = 0; streamIndex < TPDEC_MAX_TRACKS; streamIndex++) {
-          if (self->pUsacConfig[streamIndex] == NULL) break;
-          /* Apply format converter if there is at least one channel signal group (always first). */
-          if (self->pUsacConfig[streamIndex]->m_signalGroupType[0].type == 0) {
-            int err;
-
-            err = IIS_FormatConverter_Process(
-                self->pFormatConverter[streamIndex],
-                self->multibandDrcPresent ? self->hUniDrcDecoder : NULL,
-                pTimeData_in + 256 + signalsPrevStreams * (self->streamInfo.frameSize + 256),
-                (PCM_DEC*)self->workBufferCore2, self->streamInfo.aacSamplesPerFrame + 256);
-
-            if (err != 0) {
-              ErrorStatus = AAC_DEC_UNKNOWN;
-              goto bail;
-            }
-          }
-
-          signalsPrevStreams += self->ascChannels[streamIndex];
-        }
-        streamIndex = 0;
+      /* Apply object rendering on the object signal group */
+      if (self->pUsacConfig[streamIndex]->m_signalGroupType[grp].type == 1 &&
+          self->hgVBAPRenderer[numObjGroup] != NULL) {
+        gVBAPRenderer_RenderFrame_Time(self->hgVBAPRenderer[numObjGroup],
+                                       pTimeData_in + signalOffset, st->pWorkBuffer, 256,
+                                       pSi->frameSize + 256);
+        numObjGroup++;
       }
 
-      int numObjGroup = 0;
-      /* DMX processing IN: pTimeData_tmp (working buffer) OUT: pTimeData_tmp2 ( working buffer for
-       * deinterleaving / ouput buffer for interleaving )*/
-      signalsPrevStreams = 0;
-      for (streamIndex = 0; streamIndex < TPDEC_MAX_TRACKS; streamIndex++) {
-        if (self->pUsacConfig[streamIndex] == NULL) break;
-        for (grp = 0; grp < self->pUsacConfig[streamIndex]->bsNumSignalGroups; grp++) {
-          int signalOffset = self->multibandDrcPresent ? 256 : 0;
-
-          if (!getOnOffFlag(self,
-                            self->pUsacConfig[streamIndex]->m_signalGroupType[grp].firstSigIdx +
-                                signalsPrevStreams)) {
-            continue;
-          }
-
-          /* Apply object rendering on the object signal group */
-          if (self->pUsacConfig[streamIndex]->m_signalGroupType[grp].type == 1 &&
-              self->hgVBAPRenderer[numObjGroup] != NULL) {
-            gVBAPRenderer_RenderFrame_Time(self->hgVBAPRenderer[numObjGroup],
-                                           pTimeData_in + signalOffset, self->workBufferCore2, 256,
-                                           self->streamInfo.frameSize + 256);
-            numObjGroup++;
-          }
-
-          pTimeData_in += self->pUsacConfig[streamIndex]->m_signalGroupType[grp].count *
-                          (self->streamInfo.frameSize + 256);
-        }
-        signalsPrevStreams += self->ascChannels[streamIndex];
+      pTimeData_in += self->pUsacConfig[streamIndex]->m_signalGroupType[grp].count *
+                      (pSi->frameSize + 256);
+    }
+    signalsPrevStreams += self->ascChannels[streamIndex];
+  }
+  streamIndex = 0;
+
+  /* Apply DRC 2/3 (after downmix/rendering) */
+  FDK_drcDec_ProcessTime(self->hUniDrcDecoder, 256, DRC_DEC_DRC2_DRC3, 0, 0,
+                         pSi->numChannels, st->pWorkBuffer,
+                         pSi->frameSize);
+
+  INT ovSamples = 0;
+  INT splitFrameSize = 0;
+  INT newFrameSize = pSi->frameSize;
+  INT newSampleRate = pSi->sampleRate;
+  TD_FAC_UPSAMPLE sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_1_1;
+
+  switch (pSi->aacSampleRate) {
+    case 14700:
+    case 16000:
+      newFrameSize = 3 * pSi->frameSize;
+      newSampleRate = 3 * pSi->sampleRate;
+      sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_3_1;
+      splitFrameSize = (newFrameSize - self->mpegH_rendered_delay.delay) / 3;
+      ovSamples = newFrameSize - self->mpegH_rendered_delay.delay - (3 * splitFrameSize);
+      if (ovSamples) {
+        ovSamples = 3 - ovSamples;
+        splitFrameSize++;
       }
-      streamIndex = 0;
-
-      /* Apply DRC 2/3 (after downmix/rendering) */
-      FDK_drcDec_ProcessTime(self->hUniDrcDecoder, 256, DRC_DEC_DRC2_DRC3, 0, 0,
-                             self->streamInfo.numChannels, self->workBufferCore2,
-                             self->streamInfo.frameSize);
-
-      INT ovSamples = 0;
-      INT splitFrameSize = 0;
-      INT newFrameSize = self->streamInfo.frameSize;
-      INT newSampleRate = self->streamInfo.sampleRate;
-      TD_FAC_UPSAMPLE sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_1_1;
-
-      switch (self->streamInfo.aacSampleRate) {
-        case 14700:
-        case 16000:
-          newFrameSize = 3 * self->streamInfo.frameSize;
-          newSampleRate = 3 * self->streamInfo.sampleRate;
-          sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_3_1;
-          splitFrameSize = (newFrameSize - self->mpegH_rendered_delay.delay) / 3;
-          ovSamples = newFrameSize - self->mpegH_rendered_delay.delay - (3 * splitFrameSize);
-          if (ovSamples) {
-            ovSamples = 3 - ovSamples;
-            splitFrameSize++;
-          }
-          break;
-        case 22050:
-        case 24000:
-          newFrameSize = 2 * self->streamInfo.frameSize;
-          newSampleRate = 2 * self->streamInfo.sampleRate;
-          sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_2_1;
-          splitFrameSize = (newFrameSize - self->mpegH_rendered_delay.delay) >> 1;
-          ovSamples = newFrameSize - self->mpegH_rendered_delay.delay - (2 * splitFrameSize);
-          if (ovSamples) {
-            splitFrameSize++;
-          }
-          break;
-        case 29400:
-        case 32000:
-          newFrameSize = (3 * self->streamInfo.frameSize) >> 1;
-          newSampleRate = (3 * self->streamInfo.sampleRate) >> 1;
-          sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_3_2;
-          splitFrameSize = ((newFrameSize - self->mpegH_rendered_delay.delay) / 3) << 1;
-          ovSamples = newFrameSize - self->mpegH_rendered_delay.delay - splitFrameSize -
-                      (splitFrameSize >> 1);
-          if (ovSamples) {
-            ovSamples = 3 - ovSamples;
-            splitFrameSize = splitFrameSize + 2;
-          }
-          break;
-        case 44100:
-        case 48000:
-          newFrameSize = self->streamInfo.frameSize;
-          newSampleRate = self->streamInfo.sampleRate;
-          sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_1_1;
-          splitFrameSize = newFrameSize - self->mpegH_rendered_delay.delay;
-          ovSamples = 0;
-          break;
+      break;
+    case 22050:
+    case 24000:
+      newFrameSize = 2 * pSi->frameSize;
+      newSampleRate = 2 * pSi->sampleRate;
+      sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_2_1;
+      splitFrameSize = (newFrameSize - self->mpegH_rendered_delay.delay) >> 1;
+      ovSamples = newFrameSize - self->mpegH_rendered_delay.delay - (2 * splitFrameSize);
+      if (ovSamples) {
+        splitFrameSize++;
+      }
+      break;
+    case 29400:
+    case 32000:
+      newFrameSize = (3 * pSi->frameSize) >> 1;
+      newSampleRate = (3 * pSi->sampleRate) >> 1;
+      sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_3_2;
+      splitFrameSize = ((newFrameSize - self->mpegH_rendered_delay.delay) / 3) << 1;
+      ovSamples = newFrameSize - self->mpegH_rendered_delay.delay - splitFrameSize -
+                  (splitFrameSize >> 1);
+      if (ovSamples) {
+        ovSamples = 3 - ovSamples;
+        splitFrameSize = splitFrameSize + 2;
       }
+      break;
+    case 44100:
+    case 48000:
+      newFrameSize = pSi->frameSize;
+      newSampleRate = pSi->sampleRate;
+      sampleRateConverter_facUpsampling = TD_FAC_UPSAMPLE_1_1;
+      splitFrameSize = newFrameSize - self->mpegH_rendered_delay.delay;
+      ovSamples = 0;
+      break;
+  }
 
-      /* upsampling */
-      for (int ch = 0; ch < self->streamInfo.numChannels; ch++) {
-        FDK_ASSERT(ch < self->mpegH_rendered_delay.num_channels);
-        FDK_ASSERT(newFrameSize >= self->mpegH_rendered_delay.delay);
+  /* upsampling */
+  for (int ch = 0; ch < pSi->numChannels; ch++) {
+    FDK_ASSERT(ch < self->mpegH_rendered_delay.num_channels);
+    FDK_ASSERT(newFrameSize >= self->mpegH_rendered_delay.delay);
 
-        /* Copy delayed samples from delay buffer to time buffer */
-        if (self->mpegH_rendered_delay.delay) {
-          mpegh_FDKmemcpy(pTimeData2 + newFrameSize * ch,
-                    &self->mpegH_rendered_delay.delay_line[self->mpegH_rendered_delay.delay * ch],
-                    self->mpegH_rendered_delay.delay * sizeof(FIXP_DBL));
-        }
+    /* Copy delayed samples from delay buffer to time buffer */
+    if (self->mpegH_rendered_delay.delay) {
+      mpegh_FDKmemcpy(pTimeData2 + newFrameSize * ch,
+                &self->mpegH_rendered_delay.delay_line[self->mpegH_rendered_delay.delay * ch],
+                      self->mpegH_rendered_delay.delay * sizeof(FIXP_DBL));
+    }
 
-        /* Resample first part of the current time signal and store the result in the time buffer */
-        TD_upsampler(sampleRateConverter_facUpsampling,
-                     &self->workBufferCore2[self->streamInfo.frameSize * ch], splitFrameSize,
-                     &pTimeData2[newFrameSize * ch + self->mpegH_rendered_delay.delay],
-                     &self->mpegH_sampleRateConverter_filterStates[ch][0]);
+    /* Resample first part of the current time signal and store the result in the time buffer */
+    TD_upsampler(sampleRateConverter_facUpsampling,
+                 &st->pWorkBuffer[pSi->frameSize * ch], splitFrameSize,
+                 &pTimeData2[newFrameSize * ch + self->mpegH_rendered_delay.delay],
+                 &self->mpegH_sampleRateConverter_filterStates[ch][0]);
 
-        /* Copy hang over samples from the time buffer to the delay buffer */
-        if (ovSamples) {
-          mpegh_FDKmemcpy(&self->mpegH_rendered_delay.delay_line[self->mpegH_rendered_delay.delay * ch],
-                    pTimeData2 + newFrameSize * ch + newFrameSize, ovSamples * sizeof(FIXP_DBL));
-        }
+    /* Copy hang over samples from the time buffer to the delay buffer */
+    if (ovSamples) {
+      mpegh_FDKmemcpy(&self->mpegH_rendered_delay.delay_line[self->mpegH_rendered_delay.delay * ch],
+                pTimeData2 + newFrameSize * ch + newFrameSize, ovSamples * sizeof(FIXP_DBL));
+    }
 
-        /* Resample second part of the current time signal and store the result in the delay buffer
-         */
-        TD_upsampler(sampleRateConverter_facUpsampling,
-                     &self->workBufferCore2[self->streamInfo.frameSize * ch + splitFrameSize],
-                     self->streamInfo.frameSize - splitFrameSize,
-                     &self->mpegH_rendered_delay
-                          .delay_line[self->mpegH_rendered_delay.delay * ch + ovSamples],
-                     &self->mpegH_sampleRateConverter_filterStates[ch][0]);
-      }
+    /* Resample second part of the current time signal and store the result in the delay buffer
+     */
+    TD_upsampler(sampleRateConverter_facUpsampling,
+                 &st->pWorkBuffer[pSi->frameSize * ch + splitFrameSize],
+                 pSi->frameSize - splitFrameSize,
+                 &self->mpegH_rendered_delay
+                      .delay_line[self->mpegH_rendered_delay.delay * ch + ovSamples],
+                 &self->mpegH_sampleRateConverter_filterStates[ch][0]);
+  }
 
-      /* change streamInfo parameters */
-      self->streamInfo.frameSize = newFrameSize;
-      self->streamInfo.sampleRate = newSampleRate;
+  /* change streamInfo parameters */
+  pSi->frameSize = newFrameSize;
+  pSi->sampleRate = newSampleRate;
 
-      if ((self->flushStatus || flags & AACDEC_FLUSH) && !(flags & AACDEC_CONCEAL)) {
-        self->streamInfo.mpeghAUSize = 0;
-      } else if (accessUnit == numAccessUnits - 1) {
-        self->streamInfo.mpeghAUSize = self->streamInfo.frameSize - self->truncateSampleCount;
-        self->truncateSampleCount = 0;
-      }
+  if ((self->flushStatus || flags & AACDEC_FLUSH) && !(flags & AACDEC_CONCEAL)) {
+    pSi->mpeghAUSize = 0;
+  } else if (st->accessUnit == st->numAccessUnits - 1) {
+    pSi->mpeghAUSize = pSi->frameSize - self->truncateSampleCount;
+    self->truncateSampleCount = 0;
+  }
 
-      /* Truncation */
-      if (!(flags & (AACDEC_CONCEAL | AACDEC_FLUSH))) {
-        int frameSizeRemaining = self->streamInfo.frameSize;
-        int lastFrameSamples = 775, newFrameSamples = frameSizeRemaining - lastFrameSamples;
-
-        /* extend/shift truncation range for flushed and preroll frames */
-        for (int q = 0; q < TRUNC_QUEUE_SIZE; q++) {
-          if (self->flushStatus) {
-            if (self->truncateStopOffset[q] >= 775) {
-              self->truncateStopOffset[q] += self->streamInfo.frameSize;
-              /* If there is a trunc segment starting after position 0 (+ delay) it has to be
-              shifted instead of extended because it is after the inserted flush/preroll */
-              if (self->truncateStartOffset[q] > 775) {
-                self->truncateStartOffset[q] += self->streamInfo.frameSize;
-              }
-            }
+  /* Truncation */
+  if (!(flags & (AACDEC_CONCEAL | AACDEC_FLUSH))) {
+    int frameSizeRemaining = pSi->frameSize;
+    int lastFrameSamples = 775, newFrameSamples = frameSizeRemaining - lastFrameSamples;
+
+    /* extend/shift truncation range for flushed and preroll frames */
+    for (int q = 0; q < TRUNC_QUEUE_SIZE; q++) {
+      if (self->flushStatus) {
+        if (self->truncateStopOffset[q] >= 775) {
+          self->truncateStopOffset[q] += pSi->frameSize;
+          /* If there is a trunc segment starting after position 0 (+ delay) it has to be
+          shifted instead of extended because it is after the inserted flush/preroll */
+          if (self->truncateStartOffset[q] > 775) {
+            self->truncateStartOffset[q] += pSi->frameSize;
           }
-          if (accessUnit < numPrerollAU) {
-            if (self->truncateStopOffset[q] > 0) {
-              self->truncateStopOffset[q] += self->streamInfo.frameSize;
-              /* If there is a trunc segment starting after position 0 (+ delay) it has to be
-              shifted instead of extended because it is after the inserted flush/preroll */
-              if (self->truncateStartOffset[q] > 775) {
-                self->truncateStartOffset[q] += self->streamInfo.frameSize;
-              }
-            }
+        }
+      }
+      if (st->accessUnit < st->numPrerollAU) {
+        if (self->truncateStopOffset[q] > 0) {
+          self->truncateStopOffset[q] += pSi->frameSize;
+          /* If there is a trunc segment starting after position 0 (+ delay) it has to be
+          shifted instead of extended because it is after the inserted flush/preroll */
+          if (self->truncateStartOffset[q] > 775) {
+            self->truncateStartOffset[q] += pSi->frameSize;
           }
         }
+      }
+    }
 
-        /* Go through truncation queue */
-        for (int q = 0; q < TRUNC_QUEUE_SIZE; q++) {
-          int truncateFrameSizeCurrent;
-          int truncStart, truncStop, truncLength;
-
-          /* update offsets from previous iteration truncation segment */
-          self->truncateStartOffset[q] =
-              fMax(-128, self->truncateStartOffset[q] -
-                             (self->streamInfo.frameSize - frameSizeRemaining));
-          self->truncateStopOffset[q] =
-              fMax(-128,
-                   self->truncateStopOffset[q] - (self->streamInfo.frameSize - frameSizeRemaining));
-
-          /* Skip inactive truncation segments. */
-          if (q > 0 && (self->truncateStartOffset[q] < 0 && self->truncateStopOffset[q] < 0)) {
-            continue;
-          }
+    /* Go through truncation queue */
+    for (int q = 0; q < TRUNC_QUEUE_SIZE; q++) {
+      int truncateFrameSizeCurrent;
+      int truncStart, truncStop, truncLength;
 
-          /* current frame start and stop sample index of truncated part */
-          truncStart = fMax(0, fMin(frameSizeRemaining, (INT)self->truncateStartOffset[q]));
-          truncStop = fMax(0, fMin(frameSizeRemaining, (INT)self->truncateStopOffset[q]));
+      /* update offsets from previous iteration truncation segment */
+      self->truncateStartOffset[q] =
+          fMax(-128, self->truncateStartOffset[q] - (pSi->frameSize - frameSizeRemaining));
+      self->truncateStopOffset[q] =
+          fMax(-128, self->truncateStopOffset[q] - (pSi->frameSize - frameSizeRemaining));
 
-          /* length of truncated and remaining part */
-          truncLength = truncStop - truncStart;
-          truncateFrameSizeCurrent = frameSizeRemaining - truncLength;
+      /* Skip inactive truncation segments. */
+      if (q > 0 && (self->truncateStartOffset[q] < 0 && self->truncateStopOffset[q] < 0)) {
+        continue;
+      }
 
-          /* number of new frame and last frame samples for Earcon */
-          newFrameSamples -= fMax(lastFrameSamples, truncStop) - fMax(lastFrameSamples, truncStart);
-          lastFrameSamples -=
-              fMin(lastFrameSamples, truncStop) - fMin(lastFrameSamples, truncStart);
+      /* current frame start and stop sample index of truncated part */
+      truncStart = fMax(0, fMin(frameSizeRemaining, (INT)self->truncateStartOffset[q]));
+      truncStop = fMax(0, fMin(frameSizeRemaining, (INT)self->truncateStopOffset[q]));
 
-          /* save samples for crossfade */
-          if ((self->truncateStartOffset[q] + 128 > 0) &&
-              (self->truncateStartOffset[q] < frameSizeRemaining)) {
-            int ch, l;
+      /* length of truncated and remaining part */
+      truncLength = truncStop - truncStart;
+      truncateFrameSizeCurrent = frameSizeRemaining - truncLength;
 
-            l = fMin(frameSizeRemaining, (INT)self->truncateStartOffset[q] + 128) - truncStart;
+      /* number of new frame and last frame samples for Earcon */
+      newFrameSamples -= fMax(lastFrameSamples, truncStop) - fMax(lastFrameSamples, truncStart);
+      lastFrameSamples -=
+          fMin(lastFrameSamples, truncStop) - fMin(lastFrameSamples, truncStart);
 
-            for (ch = 0; ch < self->streamInfo.numChannels; ch++) {
-              mpegh_FDKmemcpy(self->crossfadeMem + 128 * ch + truncStart - self->truncateStartOffset[q],
-                        pTimeData2 + self->streamInfo.frameSize * ch + truncStart,
-                        l * sizeof(PCM_DEC));
-            }
-          }
+      /* save samples for crossfade */
+      if ((self->truncateStartOffset[q] + 128 > 0) &&
+          (self->truncateStartOffset[q] < frameSizeRemaining)) {
+        int ch, l;
 
-          /* apply crossfade */
-          if (self->applyCrossfade != AACDEC_CROSSFADE_BITMASK_OFF) {
-            if ((self->truncateStopOffset[q] + 128 > 0) &&
-                (self->truncateStopOffset[q] < frameSizeRemaining)) {
-              int i, ch;
-
-              {
-                FIXP_SGL alpha, step = FL2FXCONST_SGL(1.0 / 127);
-                int stop;
-
-                stop = fMin(frameSizeRemaining, (INT)self->truncateStopOffset[q] + 128);
-                alpha = (FIXP_SGL)((truncStop - self->truncateStopOffset[q]) * (int)step) - step;
-                for (i = truncStop; i < stop; i++) {
-                  alpha += step; /* increment alpha before the loop to avoid FIXP_SGL overflow */
-                  for (ch = 0; ch < self->streamInfo.numChannels; ch++) {
-                    PCM_DEC tmpIn, tmpOut;
-
-                    tmpIn = pTimeData2[self->streamInfo.frameSize * ch + i];
-                    tmpOut = self->crossfadeMem[128 * ch + i - self->truncateStopOffset[q]];
-                    pTimeData2[self->streamInfo.frameSize * ch + i] =
-                        fMult(alpha, tmpIn) +
-                        fMult((FIXP_SGL)(FL2FXCONST_SGL(1.0) - alpha), tmpOut);
-                  }
-                }
-              }
+        l = fMin(frameSizeRemaining, (INT)self->truncateStartOffset[q] + 128) - truncStart;
 
-              if (self->truncateStopOffset[q] + 128 <= frameSizeRemaining) {
-                self->applyCrossfade =
-                    AACDEC_CROSSFADE_BITMASK_OFF; /* disable cross-fade between frames at nect
-                                                     config change */
-              }
-            }
-          }
+        for (ch = 0; ch < pSi->numChannels; ch++) {
+          mpegh_FDKmemcpy(self->crossfadeMem + 128 * ch + truncStart - self->truncateStartOffset[q],
+                          pTimeData2 + pSi->frameSize * ch + truncStart,
+                          l * sizeof(PCM_DEC));
+        }
+      }
 
-          /* apply truncation */
-          /* This version keeps the distance (self->streamInfo.frameSize) of the channel data
-             There are 2 exclusive cases:
-             In case of truncStart !=0, we truncate all data [truncStart
-             ...self->streamInfo.frameSize-1]
-                => no copy required
-             In case of truncStop !=0, we truncate all data [0 ... truncStop-1]
-                => copy [truncStop ... self->streamInfo.frameSize-1] to [0
-             ...truncateFrameSizeCurrent-1]
-           */
-          if ((truncLength > 0) && (truncateFrameSizeCurrent > 0)) {
-            int ch;
+      /* apply crossfade */
+      if (self->applyCrossfade != AACDEC_CROSSFADE_BITMASK_OFF) {
+        if ((self->truncateStopOffset[q] + 128 > 0) &&
+            (self->truncateStopOffset[q] < frameSizeRemaining)) {
+          int i, ch;
 
-            for (ch = 0; ch < self->streamInfo.numChannels; ch++) {
-              if (truncStop < frameSizeRemaining) {
-                /* Truncate first samples [0..truncStop-1]: move remaining to start at 0 for each
-                 * channel */
-                mpegh_FDKmemmove(pTimeData2 + self->streamInfo.frameSize * ch,
-                           pTimeData2 + self->streamInfo.frameSize * ch + truncStop,
-                           truncateFrameSizeCurrent * sizeof(PCM_DEC));
+          {
+            FIXP_SGL alpha, step = FL2FXCONST_SGL(1.0 / 127);
+            int stop;
+
+            stop = fMin(frameSizeRemaining, (INT)self->truncateStopOffset[q] + 128);
+            alpha = (FIXP_SGL)((truncStop - self->truncateStopOffset[q]) * (int)step) - step;
+            for (i = truncStop; i < stop; i++) {
+              alpha += step; /* increment alpha before the loop to avoid FIXP_SGL overflow */
+              for (ch = 0; ch < pSi->numChannels; ch++) {
+                PCM_DEC tmpIn, tmpOut;
+
+                tmpIn = pTimeData2[pSi->frameSize * ch + i];
+                tmpOut = self->crossfadeMem[128 * ch + i - self->truncateStopOffset[q]];
+                pTimeData2[pSi->frameSize * ch + i] =
+                    fMult(alpha, tmpIn) +
+                    fMult((FIXP_SGL)(FL2FXCONST_SGL(1.0) - alpha), tmpOut);
               }
             }
           }
 
-          /* update offsets for next iteration preroll/flushing/decoding */
-          self->truncateStartOffset[q] =
-              fMax(-128, self->truncateStartOffset[q] - frameSizeRemaining);
-          self->truncateStopOffset[q] =
-              fMax(-128, self->truncateStopOffset[q] - frameSizeRemaining);
-
-          frameSizeRemaining -= truncLength;
-        } /* for (int q=0...) */
-
-        if (self->flags[0] & AC_MPEGH3DA) {
-          if (accessUnit == numAccessUnits - 1) {
-            PcmDataPayload(&self->earconDecoder, self->pTimeData2, self->streamInfo.frameSize,
-                           self->drcStatus.targetLoudness, self->defaultTargetLoudness,
-                           self->targetLayout, fMax(0, lastFrameSamples), fMax(0, newFrameSamples));
+          if (self->truncateStopOffset[q] + 128 <= frameSizeRemaining) {
+            self->applyCrossfade =
+                AACDEC_CROSSFADE_BITMASK_OFF; /* disable cross-fade between frames at nect
+                                                 config change */
           }
         }
+      }
 
-        truncateFrameSize = frameSizeRemaining;
-      } else {
-        /* Clear truncation queue */
-        for (int q = 0; q < TRUNC_QUEUE_SIZE; q++) {
-          self->truncateStartOffset[q] = -128;
-          self->truncateStopOffset[q] = -128;
-        }
-
-        if (self->flags[0] & AC_MPEGH3DA) {
-          if (accessUnit == numAccessUnits - 1) {
-            PcmDataPayload(&self->earconDecoder, self->pTimeData2, self->streamInfo.frameSize,
-                           self->drcStatus.targetLoudness, self->defaultTargetLoudness,
-                           self->targetLayout, 775, self->streamInfo.frameSize - 775);
+      /* apply truncation */
+      /* This version keeps the distance (pSi->frameSize) of the channel data
+         There are 2 exclusive cases:
+         In case of truncStart !=0, we truncate all data [truncStart
+         ...pSi->frameSize-1]
+            => no copy required
+         In case of truncStop !=0, we truncate all data [0 ... truncStop-1]
+            => copy [truncStop ... pSi->frameSize-1] to [0
+         ...truncateFrameSizeCurrent-1]
+       */
+      if ((truncLength > 0) && (truncateFrameSizeCurrent > 0)) {
+        int ch;
+
+        for (ch = 0; ch < pSi->numChannels; ch++) {
+          if (truncStop < frameSizeRemaining) {
+            /* Truncate first samples [0..truncStop-1]: move remaining to start at 0 for each
+             * channel */
+            mpegh_FDKmemmove(pTimeData2 + pSi->frameSize * ch,
+                             pTimeData2 + pSi->frameSize * ch + truncStop,
+                             truncateFrameSizeCurrent * sizeof(PCM_DEC));
           }
         }
       }
 
-      /* Target Layout dependency */
-      FDK_ASSERT(cicp2geometry_get_numChannels_from_cicp(self->targetLayout_config) != 0);
+      /* update offsets for next iteration preroll/flushing/decoding */
+      self->truncateStartOffset[q] =
+          fMax(-128, self->truncateStartOffset[q] - frameSizeRemaining);
+      self->truncateStopOffset[q] =
+          fMax(-128, self->truncateStopOffset[q] - frameSizeRemaining);
 
-      timeDataHeadroom = PCM_OUT_HEADROOM;
+      frameSizeRemaining -= truncLength;
+    } /* for (int q=0...) */
 
-    } else {
-      {
-        for (int ii = 0; ii < self->streamInfo.aacNumChannels; ii++) {
-          mpegh_FDKmemmove(pTimeData3 + ii * (self->streamInfo.frameSize),
-                     pTimeData2 + ii * (self->streamInfo.aacSamplesPerFrame + 256) + 256,
-                     self->streamInfo.frameSize * sizeof(PCM_AAC));
-        }
+    if (st->decFlags & AC_MPEGH3DA) {
+      if (st->accessUnit == st->numAccessUnits - 1) {
+        PcmDataPayload(pEarconDecoder, pTimeData2, pSi->frameSize,
+                       self->drcStatus.targetLoudness, self->defaultTargetLoudness,
+                       self->targetLayout, fMax(0, lastFrameSamples), fMax(0, newFrameSamples));
       }
     }
 
-    /* sbr decoder */
-
-    /* SBR decoder for Unified Stereo Config (stereoConfigIndex == 3) */
-
-    if (!((self->flags[0] & AC_MPEGH3DA) && (self->targetLayout_config >= 0) &&
-          (self->streamInfo.numChannels > 0))) {
-      if ((INT)PCM_OUT_HEADROOM != timeDataHeadroom) {
-        mpegh_scaleValues(pTimeData2, (PCM_DEC*)pTimeData3,
-                    self->streamInfo.frameSize * self->streamInfo.numChannels,
-                    -(PCM_OUT_HEADROOM - timeDataHeadroom));
-      }
+    st->truncateFrameSize = frameSizeRemaining;
+  } else {
+    /* Clear truncation queue */
+    for (int q = 0; q < TRUNC_QUEUE_SIZE; q++) {
+      self->truncateStartOffset[q] = -128;
+      self->truncateStopOffset[q] = -128;
     }
 
-    if (FDK_drcDec_GetParam(self->hUniDrcDecoder, DRC_DEC_IS_ACTIVE)) {
-      /* return output loudness information for MPEG-D DRC */
-      LONG outputLoudness = FDK_drcDec_GetParam(self->hUniDrcDecoder, DRC_DEC_OUTPUT_LOUDNESS);
-      if (outputLoudness == DRC_DEC_LOUDNESS_NOT_PRESENT) {
-        /* no valid MPEG-D DRC loudness value contained */
-        self->streamInfo.outputLoudness = -1;
-      } else {
-        if (outputLoudness > 0) {
-          /* positive output loudness values (very unusual) are limited to 0 LKFS */
-          self->streamInfo.outputLoudness = 0;
-        } else {
-          self->streamInfo.outputLoudness =
-              -(INT)outputLoudness >> 22; /* negate and scale from e = 7 to e = (31-2) */
-        }
-      }
-    } else {
-      /* return output loudness information for MPEG-4 DRC */
-      if (self->streamInfo.drcProgRefLev < 0) { /* no MPEG-4 DRC loudness metadata contained */
-        self->streamInfo.outputLoudness = -1;
-      } else {
-        if (self->defaultTargetLoudness < 0) { /* loudness normalization is off */
-          self->streamInfo.outputLoudness = self->streamInfo.drcProgRefLev;
-        } else {
-          self->streamInfo.outputLoudness = self->defaultTargetLoudness;
-        }
+    if (st->decFlags & AC_MPEGH3DA) {
+      if (st->accessUnit == st->numAccessUnits - 1) {
+        PcmDataPayload(pEarconDecoder, pTimeData2, pSi->frameSize,
+                       self->drcStatus.targetLoudness, self->defaultTargetLoudness,
+                       self->targetLayout, 775, pSi->frameSize - 775);
       }
     }
+  }
 
-    if (self->streamInfo.extAot != AOT_AAC_SLS) {
-    }
+  /* Target Layout dependency */
+  FDK_ASSERT(cicp2geometry_get_numChannels_from_cicp(self->targetLayout_config) != 0);
 
-    /* Signal interruption to take effect in next frame. */
-    if ((flags & AACDEC_FLUSH || self->flushStatus) && !(flags & AACDEC_CONCEAL)) {
-      aacDecoder_SignalInterruption(self);
-    }
+  st->timeDataHeadroom = PCM_OUT_HEADROOM;
 
-    /* Update externally visible copy of flags */
-    self->streamInfo.flags = self->flags[0];
+  return AAC_DEC_OK;
+}
 
-    if (accessUnit < numPrerollAU) {
-      for (int i = TPDEC_MAX_LAYERS - 1; i >= 0; i--) {
-        hBsAu = transportDec_GetBitstream(self->hInput, i);
-        if (auStartAnchor[i] > 0) {
-          FDKpushBack(hBsAu, auStartAnchor[i] - FDKgetValidBits(hBsAu));
+/* Describe the core output of st->accessUnit in st->pTimeData2 and the object metadata for
+ * aacDecoder_GetSignals() instead of rendering it. The signals are time aligned like the input of
+ * the object renderers, i.e. delayed by 256 samples, and the truncation queue is dropped. */
+static AAC_DECODER_ERROR aacDecoder_ExportSignals(HANDLE_AACDECODER self,
+                                                  const AACDEC_FRAME_STATE* st, CStreamInfo* pSi) {
+  AACDEC_SIGNALS* pSignals = &self->pSignalExport->signals;
+  const INT signalOffset = self->multibandDrcPresent ? 256 : 0;
+  PCM_DEC* pTimeData_in = st->pTimeData2 + signalOffset;
+  int streamIndex, grp, signalsPrevStreams = 0, numObjGroup = 0, numSignals = 0;
+
+  pSignals->numGroups = 0;
+  pSignals->numObjectMetadata = 0;
+  pSignals->headroom = st->timeDataHeadroom;
+  pSignals->delay = 3 * 256;
+
+  for (streamIndex = 0; streamIndex < TPDEC_MAX_TRACKS; streamIndex++) {
+    if (self->pUsacConfig[streamIndex] == NULL) break;
+    for (grp = 0; grp < self->pUsacConfig[streamIndex]->bsNumSignalGroups; grp++) {
+      const CSSignalGroup* pGroup = &self->pUsacConfig[streamIndex]->m_signalGroupType[grp];
+      const INT firstSignal = numSignals;
+      AACDEC_SIGNAL_GROUP* pGroupOut;
+
+      if (!getOnOffFlag(self, pGroup->firstSigIdx + signalsPrevStreams)) {
+        continue;
+      }
+      if (firstSignal + pGroup->count > (28)) {
+        return AAC_DEC_UNKNOWN;
+      }
+
+      pGroupOut = &self->pSignalExport->group[pSignals->numGroups];
+      pGroupOut->type = pGroup->type;
+      pGroupOut->layout = (pGroup->type == 0) ? pGroup->Layout : 0;
+      pGroupOut->firstSignal = (UCHAR)firstSignal;
+      pGroupOut->numSignals = pGroup->count;
+
+      for (int sig = 0; sig < pGroup->count; sig++) {
+        AACDEC_SIGNAL* pSignal = &self->pSignalExport->signal[numSignals++];
+
+        pSignal->pSamples = (const INT_PCM*)pTimeData_in;
+        pSignal->group = (SHORT)pSignals->numGroups;
+        pSignal->azimuth = 0;
+        pSignal->elevation = 0;
+        pSignal->isLfe = 0;
+        if ((pGroup->type == 0) && (pGroup->speakers != NULL)) {
+          pSignal->azimuth = pGroup->speakers[sig].Az;
+          pSignal->elevation = pGroup->speakers[sig].El;
+          pSignal->isLfe = pGroup->speakers[sig].Lfe;
         }
+        pTimeData_in += pSi->aacSamplesPerFrame + 256;
       }
-    } else {
-      if ((self->buildUpStatus == AACDEC_MPEGH_BUILD_UP_ON) ||
-          (self->buildUpStatus == AACDEC_MPEGH_BUILD_UP_ON_IN_BAND) ||
-          (self->buildUpStatus == AACDEC_USAC_BUILD_UP_ON)) {
-        self->buildUpCnt--;
+      pSignals->numGroups++;
+
+      /* Object metadata of the object signal group as seen by its renderer */
+      if ((pGroup->type == 1) && (self->hgVBAPRenderer[numObjGroup] != NULL)) {
+        HANDLE_GVBAPRENDERER hRenderer = self->hgVBAPRenderer[numObjGroup];
+        const OAM_SAMPLE* pStopSamples[GVBAPRENDERER_MAX_OAM_FRAMES_PER_CORE_FRAME];
+        INT stopSamplePositions[GVBAPRENDERER_MAX_OAM_FRAMES_PER_CORE_FRAME];
+        const int numObjects = fMin((INT)pGroup->count, hRenderer->numObjects);
+        const int numStops =
+            gVBAPRenderer_GetMetadata(hRenderer, pStopSamples, stopSamplePositions);
+
+        for (int obj = 0; obj < numObjects; obj++) {
+          for (int k = 0; k < numStops; k++) {
+            const OAM_SAMPLE* pOam = &pStopSamples[k][obj];
+            AACDEC_OBJECT_METADATA* pMd =
+                &self->pSignalExport->objectMetadata[pSignals->numObjectMetadata++];
+
+            pMd->sampleOffset = 256 + stopSamplePositions[k];
+            pMd->signal = (USHORT)(firstSignal + obj);
+            /* -180 ... 180 degrees are mapped to -1 ... 1 */
+            pMd->azimuth = (SHORT)fMultI(pOam->sph.azi, 18000);
+            pMd->elevation = (SHORT)fMultI(pOam->sph.ele, 18000);
+            pMd->spreadWidth = (USHORT)fMultI(pOam->spreadAngle, 18000);
+            pMd->spreadHeight = (USHORT)fMultI(pOam->spreadHeight, 18000);
+            /* exponent 4 and 3 */
+            pMd->radius = (USHORT)fMultI(pOam->sph.rad, 16 * 256);
+            pMd->spreadDepth = (USHORT)fMultI(pOam->spreadDepth, 16 * 256);
+            pMd->gain = (USHORT)fMultI(pOam->gain, 8 * 4096);
+          }
+        }
+        numObjGroup++;
+      }
+    }
+    signalsPrevStreams += self->ascChannels[streamIndex];
+  }
+
+  /* Published by aacDecoder_ProcessFrame() once the frame is complete */
+  pSi->numChannels = numSignals;
+  if ((self->flushStatus || st->flags & AACDEC_FLUSH) && !(st->flags & AACDEC_CONCEAL)) {
+    pSi->mpeghAUSize = 0;
+  } else if (st->accessUnit == st->numAccessUnits - 1) {
+    pSi->mpeghAUSize = pSi->frameSize - self->truncateSampleCount;
+    self->truncateSampleCount = 0;
+  }
+  for (int q = 0; q < TRUNC_QUEUE_SIZE; q++) {
+    self->truncateStartOffset[q] = -128;
+    self->truncateStopOffset[q] = -128;
+  }
+
+  return AAC_DEC_OK;
+}
+
+/* Render the core output of st->accessUnit to the additional target layouts. Each one is rendered
+ * in place from a copy of the core output, since the renderers modify their input (e.g. the STFT
+ * prescaling). The core output, the truncation, earcon and DRC gain state that the primary layout
+ * carries to the next frame is left untouched. */
+static void aacDecoder_RenderTargets(HANDLE_AACDECODER self, const AACDEC_FRAME_STATE* st,
+                                     const CStreamInfo* pSi) {
+  SHORT truncateStartOffset[TRUNC_QUEUE_SIZE], truncateStopOffset[TRUNC_QUEUE_SIZE];
+  const SHORT truncateSampleCount = self->truncateSampleCount;
+  const UCHAR applyCrossfade = self->applyCrossfade;
+
+  mpegh_FDKmemcpy(truncateStartOffset, self->truncateStartOffset, sizeof(truncateStartOffset));
+  mpegh_FDKmemcpy(truncateStopOffset, self->truncateStopOffset, sizeof(truncateStopOffset));
+  FDK_drcDec_SaveProcessState(self->hUniDrcDecoder);
+
+  for (int i = 0; i < self->numRenderTargets; i++) {
+    AACDEC_RENDER_TARGET* pTarget = self->pRenderTarget[i];
+    AACDEC_FRAME_STATE tst = *st;
+
+    /* The object metadata is parsed into and modified by the user interactivity on the renderers
+     * of the primary layout. */
+    for (int grp = 0; grp < TP_MPEGH_MAX_SIGNAL_GROUPS; grp++) {
+      if ((self->hgVBAPRenderer[grp] != NULL) && (pTarget->hgVBAPRenderer[grp] != NULL)) {
+        gVBAPRenderer_CopyMetadata(pTarget->hgVBAPRenderer[grp], self->hgVBAPRenderer[grp]);
+      }
+    }
+    pTarget->earconDecoder = self->earconDecoder;
+    pTarget->streamInfo = *pSi;
+    mpegh_FDKmemcpy(pTarget->pTimeData2, st->pTimeData2,
+                    pSi->aacNumChannels * (pSi->aacSamplesPerFrame + 256) * sizeof(PCM_DEC));
+    tst.pTimeData2 = pTarget->pTimeData2;
+
+    CAacDecoder_SwapRenderTarget(self, pTarget);
+    pTarget->renderError = aacDecoder_RenderLayout(self, &tst, &pTarget->streamInfo,
+                                                   pTarget->pTimeData2, &pTarget->earconDecoder);
+    CAacDecoder_SwapRenderTarget(self, pTarget);
+    pTarget->truncateFrameSize = tst.truncateFrameSize;
+
+    mpegh_FDKmemcpy(self->truncateStartOffset, truncateStartOffset, sizeof(truncateStartOffset));
+    mpegh_FDKmemcpy(self->truncateStopOffset, truncateStopOffset, sizeof(truncateStopOffset));
+    self->truncateSampleCount = truncateSampleCount;
+    self->applyCrossfade = applyCrossfade;
+    FDK_drcDec_RestoreProcessState(self->hUniDrcDecoder);
+  }
+}
 
-        if (self->buildUpCnt < 0) {
-          self->buildUpStatus = 0;
+/* Render the core decoded st->accessUnit in st->pTimeData2 and describe the result in pSi. */
+static AAC_DECODER_ERROR aacDecoder_RenderAU(HANDLE_AACDECODER self, AACDEC_FRAME_STATE* st,
+                                             CStreamInfo* pSi, AAC_DECODER_ERROR ErrorStatus) {
+  PCM_DEC* pTimeData2 = st->pTimeData2;
+  PCM_AAC* pTimeData3 = st->pTimeData3;
+  int streamIndex = 0;
+
+  st->fTargetsRendered = 0;
+
+  {
+    pSi->sampleRate = pSi->aacSampleRate;
+    pSi->frameSize = pSi->aacSamplesPerFrame;
+  }
+
+  pSi->numChannels = pSi->aacNumChannels;
+
+  /* MPEG-H Rendering */
+
+  if ((st->decFlags & AC_MPEGH3DA) && (self->targetLayout_config >= 0) &&
+      (pSi->numChannels > 0)) {
+    int grp = 0;
+
+    /* apply user interactivity, unless that was done before the rendering was started in a task */
+    if (!st->fUiApplied) {
+      aacDecoder_ApplyUserInteractivity(self, st, pSi);
+    }
+    st->fUiApplied = 0;
+    if (st->uiError != AAC_DEC_OK) {
+      ErrorStatus = st->uiError;
+      return ErrorStatus;
+    }
+
+    /* Apply DRC 1 (before downmix/rendering) */
+    int drcNumChannels = 0, drcStartChannel = 0, drcTotalChannels = 0;
+    int signalsPrevStreams = 0;
+    FDK_drcDec_Preprocess(self->hUniDrcDecoder);
+
+    for (streamIndex = 0; streamIndex < TPDEC_MAX_TRACKS; streamIndex++) {
+      if (self->pUsacConfig[streamIndex] == NULL) break;
+      for (grp = 0; grp < self->pUsacConfig[streamIndex]->bsNumSignalGroups; grp++) {
+        int transportStartChannel =
+            self->pUsacConfig[streamIndex]->m_signalGroupType[grp].firstSigIdx +
+            signalsPrevStreams;
+        int transportNumChannels = self->pUsacConfig[streamIndex]->m_signalGroupType[grp].count;
+        int signalGroupType = self->pUsacConfig[streamIndex]->m_signalGroupType[grp].type;
+        int processTimeDomainDrc = !self->multibandDrcPresent;
+        int processStftDomainDrcObjectsOrHoa = 0;
+
+        /* get start channel index referenced in DRC configuration */
+        switch (signalGroupType) {
+          case 0: /* channels */
+            /* Without format converter the channels take the path of the objects */
+            processStftDomainDrcObjectsOrHoa =
+                self->multibandDrcPresent && (self->pSignalExport != NULL);
+            drcNumChannels = transportNumChannels;
+            break;
+          case 1: /* objects */
+            processStftDomainDrcObjectsOrHoa = self->multibandDrcPresent;
+            drcNumChannels = transportNumChannels;
+            break;
+          default:
+            drcNumChannels = transportNumChannels;
+            break;
+        }
+
+        /* substract inactive channels */
+        int transportNumChannels2 = transportNumChannels;
+        for (int sig = 0; sig < transportNumChannels; sig++) {
+          if (!getOnOffFlag(self, sig + transportStartChannel)) {
+            transportNumChannels2--;
+          }
+        }
+        transportNumChannels = transportNumChannels2;
+        int transportStartChannel2 = transportStartChannel;
+        for (int sig = 0; sig < transportStartChannel; sig++) {
+          if (!getOnOffFlag(self, sig)) {
+            transportStartChannel2--;
+          }
+        }
+        transportStartChannel = transportStartChannel2;
+        drcTotalChannels += transportNumChannels;
+
+        if (drcTotalChannels > self->aacChannels) {
+          /* configuration mismatch between signal groups and channel elements */
+          ErrorStatus = AAC_DEC_UNKNOWN;
+          return ErrorStatus;
+        }
+
+        if (processTimeDomainDrc && transportNumChannels > 0)
+          FDK_drcDec_ProcessTime(self->hUniDrcDecoder, 0, DRC_DEC_DRC1, transportStartChannel,
+                                 drcStartChannel - transportStartChannel, transportNumChannels,
+                                 pTimeData2 + 256, pSi->frameSize + 256);
+
+        if (processStftDomainDrcObjectsOrHoa && transportNumChannels > 0) {
+          C_AALLOC_SCRATCH_START(stftBuffer, FIXP_DBL, 512) /* 2*(stft frame size) */
+          for (int i = 0; i < self->numTimeSlots; i++) {
+            /* get headroom */
+            int ch;
+            int STFT_headroom = 31;
+            int STFT_headroom_prescaling = 0, STFT_headroom_prescaling_min = 0;
+            for (ch = 0; ch < transportNumChannels; ch++) {
+              STFT_headroom =
+                  fMin(STFT_headroom,
+                       mpegh_getScalefactor(&(pTimeData2[(transportStartChannel + ch) *
+                                                       (pSi->frameSize + 256) +
+                                                   i * self->stftFrameSize + 256]),
+                                      self->stftFrameSize));
+            }
+            /* Ensure PCM_OUT_HEADROOM bit headroom */
+            STFT_headroom_prescaling = fMax(STFT_headroom - PCM_OUT_HEADROOM, 0);
+            /* Don't prescale more than necessary */
+            STFT_headroom_prescaling = fMin(STFT_headroom_prescaling, PCM_OUT_HEADROOM);
+            /* Ensure at least one bit headroom for FFT */
+            if (STFT_headroom == 0) STFT_headroom_prescaling = -1;
+
+            STFT_headroom_prescaling_min =
+                fMin((INT)self->STFT_headroom_prescaling[grp], STFT_headroom_prescaling);
+
+            /* Transform to frequency domain*/
+            for (ch = 0; ch < transportNumChannels; ch++) {
+              StftFilterbank_Process(
+                  &(pTimeData2[(transportStartChannel + ch) * (pSi->frameSize + 256) +
+                               i * self->stftFrameSize + 256]),
+                  stftBuffer, self->stftFilterbankAnalysis[transportStartChannel + ch],
+                  STFT_headroom_prescaling_min);
+
+              /* Delay of DRC gains: Delay of STFT Analysis (256) - 128 because MPEG-D DRC
+               * downsamples at the middle of each timeslot */
+              FDK_drcDec_ProcessFreq(
+                  self->hUniDrcDecoder, 128, DRC_DEC_DRC1, transportStartChannel + ch,
+                  drcStartChannel - transportStartChannel, 1, i, (FIXP_DBL**)&stftBuffer, NULL);
+
+              /* clear output buffer first, as StftFilterbank_Process accumulates its output
+               * signal to the buffer */
+              mpegh_FDKmemclear(
+                  &(pTimeData2[(transportStartChannel + ch) * (pSi->frameSize + 256) +
+                               i * self->stftFrameSize + 256]),
+                  self->stftFrameSize * sizeof(FIXP_DBL));
+              /* Transform to time domain */
+              StftFilterbank_Process(
+                  stftBuffer,
+                  &(pTimeData2[(transportStartChannel + ch) * (pSi->frameSize + 256) +
+                               i * self->stftFrameSize + 256]),
+                  self->stftFilterbankSynthesis[transportStartChannel + ch],
+                  STFT_headroom_prescaling_min);
+            }
+            /* Keep the current signal headroom correction for use in the next frame */
+            self->STFT_headroom_prescaling[grp] = STFT_headroom_prescaling;
+          }
+          C_AALLOC_SCRATCH_END(stftBuffer, FIXP_DBL, 512)
+        }
+        drcStartChannel += drcNumChannels;
+
+        /* Compensate STFT delay in object and HOA signal path in case of time domain DRC. */
+        if (processTimeDomainDrc) {
+          for (int ch = 0; ch < transportNumChannels; ch++) {
+            mpegh_FDKmemcpy(
+                pTimeData2 + (transportStartChannel + ch) * (pSi->frameSize + 256),
+                self->delayBuffer[transportStartChannel + ch], sizeof(PCM_DEC) * 256);
+            mpegh_FDKmemcpy(self->delayBuffer[transportStartChannel + ch],
+                            pTimeData2 +
+                                (transportStartChannel + ch) * (pSi->frameSize + 256) +
+                                pSi->frameSize,
+                            sizeof(PCM_DEC) * 256);
+          }
         }
       }
+      signalsPrevStreams += self->ascChannels[streamIndex];
     }
+    streamIndex = 0;
 
-    if (self->flushStatus != AACDEC_USAC_DASH_IPF_FLUSH_ON) {
-      accessUnit++;
+    if (self->pSignalExport != NULL) {
+      AAC_DECODER_ERROR exportError = aacDecoder_ExportSignals(self, st, pSi);
+      if (exportError != AAC_DEC_OK) {
+        ErrorStatus = exportError;
+        return ErrorStatus;
+      }
+      st->fSignalsExported = 1;
+    } else {
+      /* Render the additional target layouts first, the primary one is rendered in place. */
+      aacDecoder_RenderTargets(self, st, pSi);
+      st->fTargetsRendered = 1;
+
+      AAC_DECODER_ERROR renderError =
+          aacDecoder_RenderLayout(self, st, pSi, pTimeData2, &self->earconDecoder);
+      if (renderError != AAC_DEC_OK) {
+        ErrorStatus = renderError;
+        return ErrorStatus;
+      }
+    }
+
+  } else {
+    {
+      for (int ii = 0; ii < pSi->aacNumChannels; ii++) {
+        mpegh_FDKmemmove(pTimeData3 + ii * (pSi->frameSize),
+                         pTimeData2 + ii * (pSi->aacSamplesPerFrame + 256) + 256,
+                         pSi->frameSize * sizeof(PCM_AAC));
+      }
     }
-  } while ((accessUnit < numAccessUnits) ||
-           ((self->flushStatus == AACDEC_USAC_DASH_IPF_FLUSH_ON) && !(flags & AACDEC_CONCEAL)));
+  }
+
+  /* sbr decoder */
+
+  /* SBR decoder for Unified Stereo Config (stereoConfigIndex == 3) */
+
+  if (!((st->decFlags & AC_MPEGH3DA) && (self->targetLayout_config >= 0) &&
+        (pSi->numChannels > 0))) {
+    if ((INT)PCM_OUT_HEADROOM != st->timeDataHeadroom) {
+      mpegh_scaleValues(pTimeData2, (PCM_DEC*)pTimeData3,
+                        pSi->frameSize * pSi->numChannels,
+                        -(PCM_OUT_HEADROOM - st->timeDataHeadroom));
+    }
+  }
+
+  if (FDK_drcDec_GetParam(self->hUniDrcDecoder, DRC_DEC_IS_ACTIVE)) {
+    /* return output loudness information for MPEG-D DRC */
+    LONG outputLoudness = FDK_drcDec_GetParam(self->hUniDrcDecoder, DRC_DEC_OUTPUT_LOUDNESS);
+    if (outputLoudness == DRC_DEC_LOUDNESS_NOT_PRESENT) {
+      /* no valid MPEG-D DRC loudness value contained */
+      pSi->outputLoudness = -1;
+    } else {
+      if (outputLoudness > 0) {
+        /* positive output loudness values (very unusual) are limited to 0 LKFS */
+        pSi->outputLoudness = 0;
+      } else {
+        pSi->outputLoudness =
+            -(INT)outputLoudness >> 22; /* negate and scale from e = 7 to e = (31-2) */
+      }
+    }
+  } else {
+    /* return output loudness information for MPEG-4 DRC */
+    if (pSi->drcProgRefLev < 0) { /* no MPEG-4 DRC loudness metadata contained */
+      pSi->outputLoudness = -1;
+    } else {
+      if (self->defaultTargetLoudness < 0) { /* loudness normalization is off */
+        pSi->outputLoudness = pSi->drcProgRefLev;
+      } else {
+        pSi->outputLoudness = self->defaultTargetLoudness;
+      }
+    }
+  }
+
+  if (pSi->extAot != AOT_AAC_SLS) {
+  }
+
+  return ErrorStatus;
+}
 
-  if (self->streamInfo.extAot != AOT_AAC_SLS) {
+/* Rewind the bit stream after a preroll access unit and advance to the next access unit. */
+static void aacDecoder_EndAU(HANDLE_AACDECODER self, AACDEC_FRAME_STATE* st, CStreamInfo* pSi) {
+  const UINT flags = st->flags;
+  HANDLE_FDK_BITSTREAM hBsAu;
+
+  /* Signal interruption to take effect in next frame. */
+  if ((flags & AACDEC_FLUSH || self->flushStatus) && !(flags & AACDEC_CONCEAL)) {
+    aacDecoder_SignalInterruption(self);
+  }
+
+  /* Update externally visible copy of flags */
+  pSi->flags = st->decFlags;
+
+  if (st->accessUnit < st->numPrerollAU) {
+    for (int i = TPDEC_MAX_LAYERS - 1; i >= 0; i--) {
+      hBsAu = transportDec_GetBitstream(self->hInput, i);
+      if (st->auStartAnchor[i] > 0) {
+        FDKpushBack(hBsAu, st->auStartAnchor[i] - FDKgetValidBits(hBsAu));
+      }
+    }
+  } else {
+    if ((self->buildUpStatus == AACDEC_MPEGH_BUILD_UP_ON) ||
+        (self->buildUpStatus == AACDEC_MPEGH_BUILD_UP_ON_IN_BAND) ||
+        (self->buildUpStatus == AACDEC_USAC_BUILD_UP_ON)) {
+      self->buildUpCnt--;
+
+      if (self->buildUpCnt < 0) {
+        self->buildUpStatus = 0;
+      }
+    }
+  }
+
+  if (self->flushStatus != AACDEC_USAC_DASH_IPF_FLUSH_ON) {
+    st->accessUnit++;
+  }
+}
+
+/* Limit and interleave the rendered frame into pTimeData. */
+static AAC_DECODER_ERROR aacDecoder_OutputFrame(HANDLE_AACDECODER self, AACDEC_FRAME_STATE* st,
+                                                CStreamInfo* pSi, INT_PCM* pTimeData,
+                                                const INT timeDataSize,
+                                                AAC_DECODER_ERROR ErrorStatus) {
+  const UINT flags = st->flags;
+  PCM_DEC* pTimeData2 = st->pTimeData2;
+  INT pcmLimiterScale = 0;
+
+  if (pSi->extAot != AOT_AAC_SLS) {
     pcmLimiterScale += PCM_OUT_HEADROOM;
 
     if (flags & AACDEC_CLRHIST) {
@@ -1980,41 +2408,40 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(HANDLE_AACDECODER self, IN
     }
 
     /* Check whether time data buffer is large enough. */
-    if (timeDataSize < (self->streamInfo.numChannels * self->streamInfo.frameSize)) {
+    if (timeDataSize < (pSi->numChannels * pSi->frameSize)) {
       ErrorStatus = AAC_DEC_OUTPUT_BUFFER_TOO_SMALL;
-      goto bail;
+      return ErrorStatus;
     }
 
     /* use workBufferCore2 buffer for interleaving */
-    PCM_AAC* pInterleaveBuffer = (PCM_AAC*)self->workBufferCore2;
-    int blockLength = self->streamInfo.frameSize;
+    PCM_AAC* pInterleaveBuffer = (PCM_AAC*)st->pWorkBuffer;
+    int blockLength = pSi->frameSize;
 
     /* applyLimiter requests for interleaved data and doesn't support in-place processing */
     /* Interleave output buffer */
-    MPEGH_interleave(pTimeData2, pInterleaveBuffer, self->streamInfo.numChannels, blockLength,
-                   self->streamInfo.frameSize);
+    MPEGH_interleave(pTimeData2, pInterleaveBuffer, pSi->numChannels, blockLength,
+                     pSi->frameSize);
 
-    if (truncateFrameSize != -1) {
-      self->streamInfo.frameSize = truncateFrameSize;
+    if (st->truncateFrameSize != -1) {
+      pSi->frameSize = st->truncateFrameSize;
     }
 
-    if (self->limiterEnableCurr) {
+    if (st->limiterEnable) {
       /* limiter work buffer */
       PCM_AAC* tmpBuffer = (PCM_AAC*)pTimeData2; /* points to workBufferCore5 */
 
       /* Set actual signal parameters */
-      pcmLimiter_SetNChannels(self->hLimiter, self->streamInfo.numChannels);
-      if (pcmLimiter_SetSampleRate(self->hLimiter, self->streamInfo.sampleRate) != TDLIMIT_OK) {
+      pcmLimiter_SetNChannels(self->hLimiter, pSi->numChannels);
+      if (pcmLimiter_SetSampleRate(self->hLimiter, pSi->sampleRate) != TDLIMIT_OK) {
         return AAC_DEC_SET_PARAM_FAIL;
       }
 
       pcmLimiter_Apply(self->hLimiter, pInterleaveBuffer, pTimeData, tmpBuffer, NULL,
-                       pcmLimiterScale, self->streamInfo.frameSize);
+                       pcmLimiterScale, pSi->frameSize);
 
-      if (self->flags[streamIndex] & AC_MPEGH3DA) {
-        if (!(accessUnit <
-              numPrerollAU)) /* after preroll frame decoding no valid samples to discard exist */
-        {
+      if (st->decFlags & AC_MPEGH3DA) {
+        /* after preroll frame decoding no valid samples to discard exist */
+        if (!(st->accessUnit < st->numPrerollAU)) {
           /* discard samples of constant decoder delay and pcmLimiter delay at start */
           if (self->discardSamplesAtStartCnt ==
               -1) /* no left truncation has happend before thus the constant decoder delay is not
@@ -2030,43 +2457,123 @@ LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(HANDLE_AACDECODER self, IN
             }
           }
 
-          if (self->discardSamplesAtStartCnt > 0 && self->streamInfo.numChannels > 0) {
-            if (self->streamInfo.frameSize <= self->discardSamplesAtStartCnt) {
-              self->discardSamplesAtStartCnt -= self->streamInfo.frameSize;
-              self->streamInfo.frameSize = 0;
+          if (self->discardSamplesAtStartCnt > 0 && pSi->numChannels > 0) {
+            if (pSi->frameSize <= self->discardSamplesAtStartCnt) {
+              self->discardSamplesAtStartCnt -= pSi->frameSize;
+              pSi->frameSize = 0;
             } else {
               mpegh_FDKmemmove(pTimeData,
-                         &pTimeData[self->discardSamplesAtStartCnt * self->streamInfo.numChannels],
-                         (self->streamInfo.frameSize - self->discardSamplesAtStartCnt) *
-                             self->streamInfo.numChannels * sizeof(INT_PCM));
-              self->streamInfo.frameSize -= self->discardSamplesAtStartCnt;
+                               &pTimeData[self->discardSamplesAtStartCnt * pSi->numChannels],
+                               (pSi->frameSize - self->discardSamplesAtStartCnt) *
+                                   pSi->numChannels * sizeof(INT_PCM));
+              pSi->frameSize -= self->discardSamplesAtStartCnt;
               self->discardSamplesAtStartCnt = 0;
             }
           }
 
-          if (self->streamInfo.frameSize > 0)
-            self->streamInfo.outputDelay += self->discardSamplesAtStartCnt;
+          if (pSi->frameSize > 0)
+            pSi->outputDelay += self->discardSamplesAtStartCnt;
         }
       } else {
         /* Announce the additional limiter output delay */
-        self->streamInfo.outputDelay += pcmLimiter_GetDelay(self->hLimiter);
+        pSi->outputDelay += pcmLimiter_GetDelay(self->hLimiter);
       }
     } else {
       mpegh_scaleValuesSaturate(pTimeData, (PCM_DEC*)pInterleaveBuffer,
-                          self->streamInfo.frameSize * self->streamInfo.numChannels,
-                          pcmLimiterScale);
+                                pSi->frameSize * pSi->numChannels,
+                                pcmLimiterScale);
     }
-  } /* if (self->streamInfo.extAot != AOT_AAC_SLS)*/
+  } /* if (pSi->extAot != AOT_AAC_SLS)*/
 
-bail:
+  return ErrorStatus;
+}
+
+/* Limit and interleave the frame rendered to the additional target layouts into their output
+ * buffers. The delay discarded at start is counted by the primary layout. */
+static void aacDecoder_OutputTargets(HANDLE_AACDECODER self, const AACDEC_FRAME_STATE* st,
+                                     const CStreamInfo* pSi) {
+  const INT discardSamplesAtStartCnt = self->discardSamplesAtStartCnt;
+
+  for (int i = 0; i < self->numRenderTargets; i++) {
+    AACDEC_RENDER_TARGET* pTarget = self->pRenderTarget[i];
+    AACDEC_FRAME_STATE tst = *st;
+    AAC_DECODER_ERROR err;
+
+    if ((pTarget->renderError != AAC_DEC_OK) || (pTarget->pTimeData == NULL)) {
+      continue;
+    }
+    tst.pTimeData2 = pTarget->pTimeData2;
+    tst.truncateFrameSize = pTarget->truncateFrameSize;
+
+    CAacDecoder_SwapRenderTarget(self, pTarget);
+    err = aacDecoder_OutputFrame(self, &tst, &pTarget->streamInfo, pTarget->pTimeData,
+                                 pTarget->timeDataSize, AAC_DEC_OK);
+    CAacDecoder_SwapRenderTarget(self, pTarget);
+    self->discardSamplesAtStartCnt = discardSamplesAtStartCnt;
+
+    if (err == AAC_DEC_OK) {
+      pTarget->outputInfo = pTarget->streamInfo;
+      pTarget->outputInfo.outputLoudness = pSi->outputLoudness;
+    }
+  }
+}
+
+/* Decode, render and output all access units of a frame. If fDecoded is set, core decoding of the
+ * first one is done already and ErrorStatus is its result. */
+static AAC_DECODER_ERROR aacDecoder_ProcessFrame(HANDLE_AACDECODER self, AACDEC_FRAME_STATE* st,
+                                                 CStreamInfo* pSi, INT_PCM* pTimeData,
+                                                 const INT timeDataSize,
+                                                 AAC_DECODER_ERROR ErrorStatus, int fDecoded) {
+  /* Process preroll frames and current frame */
+  do {
+    if (!fDecoded) {
+      ErrorStatus = aacDecoder_PrepareAU(self, st);
+      if (ErrorStatus != AAC_DEC_OK) {
+        return ErrorStatus;
+      }
+      ErrorStatus = aacDecoder_DecodeAU(self, st);
+      /* If the current pTimeData2 does not contain a valid signal, there nothing else we can do,
+       * so bail. */
+      if (!IS_OUTPUT_VALID(ErrorStatus)) {
+        return ErrorStatus;
+      }
+    }
+    fDecoded = 0;
+
+    ErrorStatus = aacDecoder_RenderAU(self, st, pSi, ErrorStatus);
+    if (!IS_OUTPUT_VALID(ErrorStatus)) {
+      return ErrorStatus;
+    }
+
+    aacDecoder_EndAU(self, st, pSi);
+  } while ((st->accessUnit < st->numAccessUnits) ||
+           ((self->flushStatus == AACDEC_USAC_DASH_IPF_FLUSH_ON) &&
+            !(st->flags & AACDEC_CONCEAL)));
+
+  if (st->fTargetsRendered) {
+    aacDecoder_OutputTargets(self, st, pSi);
+  }
+  if (st->fSignalsExported) {
+    /* The signals stay in st->pTimeData2 for aacDecoder_GetSignals() */
+    self->pSignalExport->signals.numSignals = pSi->numChannels;
+    return ErrorStatus;
+  }
 
+  return aacDecoder_OutputFrame(self, st, pSi, pTimeData, timeDataSize, ErrorStatus);
+}
+
+/* Update the statistics and the stream info of a frame that consumed nBits. */
+static void aacDecoder_FinishFrame(HANDLE_AACDECODER self, const AACDEC_FRAME_STATE* st,
+                                   const INT nBits, const UCHAR frameOK,
+                                   AAC_DECODER_ERROR ErrorStatus) {
   /* error in renderer part occurred, ErrorStatus was set to invalid output */
-  if (fEndAuNotAdjusted && !IS_OUTPUT_VALID(ErrorStatus) && (accessUnit < numPrerollAU)) {
+  if (st->fEndAuNotAdjusted && !IS_OUTPUT_VALID(ErrorStatus) &&
+      (st->accessUnit < st->numPrerollAU)) {
     transportDec_EndAccessUnit(self->hInput);
   }
 
   /* Update Statistics */
-  aacDecoder_UpdateBitStreamCounters(&self->streamInfo, hBs, nBits, ErrorStatus);
+  aacDecoder_UpdateBitStreamCounters(&self->streamInfo, nBits, ErrorStatus);
 
   /* Ensure consistency of IS_OUTPUT_VALID() macro. */
   FDK_ASSERT((((self->streamInfo.numChannels <= 0) || (self->streamInfo.sampleRate <= 0)) &&
@@ -2078,14 +2585,345 @@ bail:
   }
 
   /*Logical AND of the independent frame flag and "frame decoded correctly" flag*/
-  self->streamInfo.fBsRestartOk &= (self->frameOK ? 1 : 0);
+  self->streamInfo.fBsRestartOk &= (frameOK ? 1 : 0);
+}
+
+/* Stream info fields that describe the output of a decoder call rather than the core state. */
+static void aacDecoder_CopyOutputInfo(CStreamInfo* pDst, const CStreamInfo* pSrc) {
+  pDst->sampleRate = pSrc->sampleRate;
+  pDst->frameSize = pSrc->frameSize;
+  pDst->mpeghAUSize = pSrc->mpeghAUSize;
+  pDst->numChannels = pSrc->numChannels;
+  pDst->bitRate = pSrc->bitRate;
+  pDst->outputDelay = pSrc->outputDelay;
+  pDst->flags = pSrc->flags;
+  pDst->outputLoudness = pSrc->outputLoudness;
+  pDst->fBsRestartOk = pSrc->fBsRestartOk;
+}
+
+/* Render the pending frame into the output buffer of the current call, unless that is done
+ * already. A task finding the frame rendered by another task blocks on renderLock until it is
+ * done.
+ * A sync from within the rendering, or from the user interactivity applied while the frame is
+ * claimed, re-enters renderLock on the same thread and finds the frame claimed. It returns without
+ * rendering on purpose: the decoder state it syncs on is changed for that very frame. */
+static void aacDecoder_RenderPending(HANDLE_AACDECODER self) {
+  struct AACDEC_PIPELINE* pPipe = self->pPipeline;
+  std::lock_guard<std::recursive_mutex> lock(pPipe->renderLock);
+
+  if (pPipe->renderState == AACDEC_PIPELINE_PENDING) {
+    pPipe->renderState = AACDEC_PIPELINE_RENDERING;
+    pPipe->renderError =
+        aacDecoder_ProcessFrame(self, &pPipe->pending, &pPipe->streamInfo, pPipe->pTimeData,
+                                pPipe->timeDataSize, pPipe->decodeError, 1);
+    pPipe->renderState = AACDEC_PIPELINE_RENDERED;
+  }
+}
+
+LINKSPEC_CPP void aacDecoder_SyncPipeline(HANDLE_AACDECODER self) {
+  struct AACDEC_PIPELINE* pPipe = self->pPipeline;
+
+  if (pPipe == NULL) {
+    return;
+  }
+  if (pPipe->pTimeData == NULL) {
+    /* Outside of a decoder call there is no output buffer, drop the frame. */
+    pPipe->renderState = AACDEC_PIPELINE_EMPTY;
+  } else {
+    aacDecoder_RenderPending(self);
+  }
+}
+
+/* Output the pending frame in the current call, after it has been rendered if it is steady. Its
+ * stream info is merged into self->streamInfo and kept in pOutputInfo as well. */
+static AAC_DECODER_ERROR aacDecoder_CompletePending(HANDLE_AACDECODER self,
+                                                    CStreamInfo* pOutputInfo) {
+  struct AACDEC_PIPELINE* pPipe = self->pPipeline;
+  const UINT outputDelay = self->streamInfo.outputDelay;
+  const INT mpeghAUSize = self->streamInfo.mpeghAUSize;
+  const UCHAR fBsRestartOk = self->streamInfo.fBsRestartOk;
+  AAC_DECODER_ERROR ErrorStatus;
+
+  if (pPipe->fSteady) {
+    if (pPipe->renderState == AACDEC_PIPELINE_PENDING) {
+      aacDecoder_RenderPending(self);
+    }
+    aacDecoder_CopyOutputInfo(&self->streamInfo, &pPipe->streamInfo);
+    ErrorStatus = pPipe->renderError;
+  } else {
+    /* Frames with preroll, concealment, flushing or errors run serially on self->streamInfo, as
+     * they would have without pipelining. */
+    pPipe->renderState = AACDEC_PIPELINE_EMPTY;
+    self->streamInfo.outputDelay = pPipe->streamInfo.outputDelay;
+    self->streamInfo.mpeghAUSize = pPipe->streamInfo.mpeghAUSize;
+    self->streamInfo.fBsRestartOk = pPipe->streamInfo.fBsRestartOk;
+    /* The access unit start of a preroll frame moves with data filled in meanwhile. */
+    for (int i = 0; i < TPDEC_MAX_LAYERS; i++) {
+      if (pPipe->pending.auStartAnchor[i] > 0) {
+        pPipe->pending.auStartAnchor[i] +=
+            (INT)FDKgetValidBits(transportDec_GetBitstream(self->hInput, i)) - pPipe->validBits[i];
+      }
+    }
+    if (IS_OUTPUT_VALID(pPipe->decodeError)) {
+      ErrorStatus =
+          aacDecoder_ProcessFrame(self, &pPipe->pending, &self->streamInfo, pPipe->pTimeData,
+                                  pPipe->timeDataSize, pPipe->decodeError, 1);
+    } else {
+      ErrorStatus = pPipe->decodeError;
+      if (ErrorStatus == AAC_DEC_INTERMEDIATE_OK) {
+        self->streamInfo.frameSize = 0;
+      }
+    }
+  }
+  pPipe->renderState = AACDEC_PIPELINE_EMPTY;
+
+  aacDecoder_FinishFrame(self, &pPipe->pending, pPipe->nBits, pPipe->frameOK, ErrorStatus);
+  aacDecoder_CopyOutputInfo(pOutputInfo, &self->streamInfo);
+
+  /* Keep the figures of an access unit core decoded meanwhile. */
+  self->streamInfo.outputDelay = outputDelay;
+  self->streamInfo.mpeghAUSize = mpeghAUSize;
+  self->streamInfo.fBsRestartOk = fBsRestartOk;
+
+  return ErrorStatus;
+}
+
+/* Hold back the access unit core decoded in st until the next decoder call. */
+static void aacDecoder_HoldFrame(HANDLE_AACDECODER self, const AACDEC_FRAME_STATE* st,
+                                 const INT nBits, AAC_DECODER_ERROR ErrorStatus) {
+  struct AACDEC_PIPELINE* pPipe = self->pPipeline;
+
+  pPipe->pending = *st;
+  pPipe->streamInfo = self->streamInfo;
+  pPipe->decodeError = ErrorStatus;
+  pPipe->renderError = ErrorStatus;
+  pPipe->nBits = nBits;
+  pPipe->frameOK = self->frameOK;
+  for (int i = 0; i < TPDEC_MAX_LAYERS; i++) {
+    pPipe->validBits[i] = (INT)FDKgetValidBits(transportDec_GetBitstream(self->hInput, i));
+  }
+  pPipe->fSteady = IS_OUTPUT_VALID(ErrorStatus) && (st->flags == 0) &&
+                   (st->numAccessUnits == 1) && !st->fTpConceal && !st->fTpInterruption &&
+                   (self->flushStatus == AACDEC_FLUSH_OFF) && (self->buildUpStatus == 0) &&
+                   (self->streamInfo.numChannels > 0);
+
+  if (IS_OUTPUT_VALID(ErrorStatus)) {
+    /* Move the core output out of the work buffers, which are reused by the next access unit. */
+    const INT stride = self->streamInfo.aacSamplesPerFrame + 256;
+    INT numChannels = self->streamInfo.aacNumChannels;
+    INT numSignals = 0;
+
+    for (int i = 0; i < TPDEC_MAX_TRACKS; i++) {
+      numSignals += self->ascChannels[i];
+    }
+    numChannels = fMin(fMax(numChannels, numSignals),
+                       (INT)(self->timeData2Size / sizeof(PCM_DEC)) / stride);
+    mpegh_FDKmemcpy(pPipe->pTimeData2, st->pTimeData2, numChannels * stride * sizeof(PCM_DEC));
+
+    pPipe->pending.pTimeData2 = pPipe->pTimeData2;
+    pPipe->pending.pTimeData3 = (PCM_AAC*)pPipe->pTimeData2;
+    pPipe->pending.pWorkBuffer = pPipe->pWorkBuffer;
+  }
+
+  pPipe->renderState = AACDEC_PIPELINE_PENDING;
+}
+
+typedef struct {
+  HANDLE_AACDECODER self;
+  AACDEC_FRAME_STATE* st;
+  AAC_DECODER_ERROR ErrorStatus;
+} AACDEC_OVERLAP_DATA;
+
+/* Task 0 renders the pending frame, task 1 core decodes the next access unit. */
+static void aacDecoder_OverlapTask(void* taskData, INT taskIndex) {
+  AACDEC_OVERLAP_DATA* pData = (AACDEC_OVERLAP_DATA*)taskData;
+
+  if (taskIndex == 0) {
+    aacDecoder_RenderPending(pData->self);
+  } else {
+    pData->ErrorStatus = aacDecoder_DecodeAU(pData->self, pData->st);
+  }
+}
+
+/* Core decode the access unit in st, overlapped with rendering of a steady pending frame. */
+static AAC_DECODER_ERROR aacDecoder_DecodeAUPipelined(HANDLE_AACDECODER self,
+                                                      AACDEC_FRAME_STATE* st) {
+  struct AACDEC_PIPELINE* pPipe = self->pPipeline;
+  AACDEC_OVERLAP_DATA data;
+
+  if (pPipe->renderState != AACDEC_PIPELINE_PENDING) {
+    return aacDecoder_DecodeAU(self, st);
+  }
+
+  /* The user interactivity may change which signals the core decodes, so it is applied first. The
+   * frame is claimed meanwhile, the syncs of the changes must not render it yet. */
+  {
+    std::lock_guard<std::recursive_mutex> lock(pPipe->renderLock);
+    pPipe->renderState = AACDEC_PIPELINE_RENDERING;
+    aacDecoder_ApplyUserInteractivity(self, &pPipe->pending, &pPipe->streamInfo);
+    pPipe->renderState = AACDEC_PIPELINE_PENDING;
+  }
+
+  data.self = self;
+  data.st = st;
+  data.ErrorStatus = AAC_DEC_OK;
+
+  if ((self->taskExecutor.execute != NULL) && (self->taskExecutor.maxWorkers > 1)) {
+    const INT maxWorkers = self->taskExecutor.maxWorkers;
+
+    /* The core decoder runs inside a task, so it must not start tasks of its own. */
+    self->taskExecutor.maxWorkers = 1;
+    self->taskExecutor.execute(self->taskExecutor.context, aacDecoder_OverlapTask, &data, 2);
+    self->taskExecutor.maxWorkers = maxWorkers;
+  } else {
+    aacDecoder_OverlapTask(&data, 0);
+    aacDecoder_OverlapTask(&data, 1);
+  }
+
+  return data.ErrorStatus;
+}
+
+static AAC_DECODER_ERROR aacDecoder_DecodeFrameSerial(HANDLE_AACDECODER self, INT_PCM* pTimeData,
+                                                      const INT timeDataSize, const UINT flags) {
+  HANDLE_FDK_BITSTREAM hBs = transportDec_GetBitstream(self->hInput, 0);
+  AACDEC_FRAME_STATE st;
+  AAC_DECODER_ERROR ErrorStatus;
+
+  aacDecoder_InitFrameState(&st, flags);
+
+  /* Get current bits position for bitrate calculation. */
+  st.nBits = FDKgetValidBits(hBs);
+
+  ErrorStatus = aacDecoder_ReadAU(self, &st);
+  if (ErrorStatus == AAC_DEC_OK) {
+    ErrorStatus = aacDecoder_ProcessFrame(self, &st, &self->streamInfo, pTimeData, timeDataSize,
+                                          ErrorStatus, 0);
+  }
+
+  aacDecoder_FinishFrame(self, &st, st.nBits - (INT)FDKgetValidBits(hBs), self->frameOK,
+                         ErrorStatus);
 
   return ErrorStatus;
 }
 
+/* Pipelined variant of aacDecoder_DecodeFrame(): output the frame held back by the previous call
+ * and hold back the access unit read now. */
+static AAC_DECODER_ERROR aacDecoder_DecodeFramePipelined(HANDLE_AACDECODER self,
+                                                         INT_PCM* pTimeData,
+                                                         const INT timeDataSize,
+                                                         const UINT flags) {
+  struct AACDEC_PIPELINE* pPipe = self->pPipeline;
+  HANDLE_FDK_BITSTREAM hBs = transportDec_GetBitstream(self->hInput, 0);
+  AACDEC_FRAME_STATE st;
+  CStreamInfo outputInfo;
+  AAC_DECODER_ERROR ErrorStatus, outputStatus = AAC_DEC_OK;
+  int fOutput = 0;
+
+  pPipe->pTimeData = pTimeData;
+  pPipe->timeDataSize = timeDataSize;
+
+  if (pPipe->renderState == AACDEC_PIPELINE_PENDING) {
+    if ((flags != 0) || !pPipe->fSteady) {
+      outputStatus = aacDecoder_CompletePending(self, &outputInfo);
+      fOutput = 1;
+    }
+  } else if (flags != 0) {
+    /* Nothing is held back, decode without delay. */
+    pPipe->pTimeData = NULL;
+    return aacDecoder_DecodeFrameSerial(self, pTimeData, timeDataSize, flags);
+  }
+
+  /* A concealed or flushed frame is only decoded after the pending frame has been output. */
+  if (!(fOutput && (flags & (AACDEC_CONCEAL | AACDEC_FLUSH)))) {
+    aacDecoder_InitFrameState(&st, flags);
+    st.nBits = FDKgetValidBits(hBs);
+
+    ErrorStatus = aacDecoder_ReadAU(self, &st);
+    if (st.fTpConceal || st.fTpInterruption) {
+      /* The interruption handling of the next access unit must not precede the pending one. */
+      aacDecoder_SyncPipeline(self);
+    }
+    if (ErrorStatus == AAC_DEC_OK) {
+      ErrorStatus = aacDecoder_PrepareAU(self, &st);
+    }
+    if (ErrorStatus == AAC_DEC_OK) {
+      ErrorStatus = aacDecoder_DecodeAUPipelined(self, &st);
+    }
+
+    if ((ErrorStatus == AAC_DEC_NOT_ENOUGH_BITS) &&
+        (pPipe->renderState == AACDEC_PIPELINE_PENDING)) {
+      /* The pending frame waits for the next access unit. */
+      aacDecoder_FinishFrame(self, &st, st.nBits - (INT)FDKgetValidBits(hBs), self->frameOK,
+                             ErrorStatus);
+      pPipe->pTimeData = NULL;
+      return ErrorStatus;
+    }
+
+    if (pPipe->renderState != AACDEC_PIPELINE_EMPTY) {
+      outputStatus = aacDecoder_CompletePending(self, &outputInfo);
+      fOutput = 1;
+    }
+
+    if (!fOutput) {
+      if (IS_OUTPUT_VALID(ErrorStatus)) {
+        /* The pipeline fills up, there is no output yet. */
+        aacDecoder_HoldFrame(self, &st, st.nBits - (INT)FDKgetValidBits(hBs), ErrorStatus);
+        self->streamInfo.frameSize = 0;
+        self->streamInfo.mpeghAUSize = 0;
+        ErrorStatus = AAC_DEC_INTERMEDIATE_OK;
+      } else {
+        aacDecoder_FinishFrame(self, &st, st.nBits - (INT)FDKgetValidBits(hBs), self->frameOK,
+                               ErrorStatus);
+      }
+      self->streamInfo.numPendingFrames =
+          (pPipe->renderState == AACDEC_PIPELINE_PENDING) ? 1 : 0;
+      pPipe->pTimeData = NULL;
+      return ErrorStatus;
+    }
+
+    if (ErrorStatus != AAC_DEC_NOT_ENOUGH_BITS) {
+      aacDecoder_HoldFrame(self, &st, st.nBits - (INT)FDKgetValidBits(hBs), ErrorStatus);
+    }
+  }
+
+  aacDecoder_CopyOutputInfo(&self->streamInfo, &outputInfo);
+  self->streamInfo.numPendingFrames =
+      (pPipe->renderState == AACDEC_PIPELINE_PENDING) ? 1 : 0;
+  pPipe->pTimeData = NULL;
+
+  return outputStatus;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_DecodeFrame(HANDLE_AACDECODER self, INT_PCM* pTimeData,
+                                                      const INT timeDataSize, const UINT flags) {
+  if (self == NULL) {
+    return AAC_DEC_INVALID_HANDLE;
+  }
+  if (pTimeData == NULL) {
+    return AAC_DEC_INVALID_PARAM;
+  }
+
+  /* Nothing is output to the render targets until a frame is output by this call. */
+  for (int i = 0; i < self->numRenderTargets; i++) {
+    self->pRenderTarget[i]->outputInfo.numChannels = 0;
+  }
+  if (self->pSignalExport != NULL) {
+    self->pSignalExport->signals.numSignals = 0;
+  }
+
+  if (self->pPipeline != NULL) {
+    return aacDecoder_DecodeFramePipelined(self, pTimeData, timeDataSize, flags);
+  }
+
+  return aacDecoder_DecodeFrameSerial(self, pTimeData, timeDataSize, flags);
+}
+
 LINKSPEC_CPP void aacDecoder_Close(HANDLE_AACDECODER self) {
   if (self == NULL) return;
 
+  setPipelinedDecode(self, 0);
+  setSignalExport(self, 0);
+
   if (self->hLimiter != NULL) {
     pcmLimiter_Destroy(self->hLimiter);
   }
@@ -2106,3 +2944,239 @@ LINKSPEC_CPP void aacDecoder_Close(HANDLE_AACDECODER self) {
 LINKSPEC_CPP CStreamInfo* aacDecoder_GetStreamInfo(HANDLE_AACDECODER self) {
   return CAacDecoder_GetStreamInfo(self);
 }
+
+LINKSPEC_CPP HANDLE_AACDEC_SCRATCH aacDecoder_OpenScratch(void) {
+  HANDLE_AACDEC_SCRATCH hScratch;
+
+  hScratch = (HANDLE_AACDEC_SCRATCH)mpegh_FDKcalloc(1, sizeof(struct AACDEC_SCRATCH));
+  if (hScratch == NULL) {
+    return NULL;
+  }
+  if (CAacDecoder_CreateScratch(hScratch) != 0) {
+    mpegh_FDKfree(hScratch);
+    return NULL;
+  }
+
+  return hScratch;
+}
+
+LINKSPEC_CPP void aacDecoder_CloseScratch(HANDLE_AACDEC_SCRATCH hScratch) {
+  if (hScratch == NULL) return;
+
+  CAacDecoder_DestroyScratch(hScratch);
+  mpegh_FDKfree(hScratch);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_SetScratch(HANDLE_AACDECODER self,
+                                                     HANDLE_AACDEC_SCRATCH hScratch) {
+  if (self == NULL) return AAC_DEC_INVALID_HANDLE;
+
+  return CAacDecoder_SetScratch(self, hScratch);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_SetTaskExecutor(HANDLE_AACDECODER self,
+                                                         const AACDEC_TASK_EXECUTOR* pExecutor) {
+  if (self == NULL) return AAC_DEC_INVALID_HANDLE;
+
+  return CAacDecoder_SetTaskExecutor(self, pExecutor);
+}
+
+/* Heap bookkeeping of aacDecoder_GetRequiredMemory(). Each block is prefixed by its size and taken
+ * from the allocator that was current before the probe started. */
+typedef struct {
+  const FDK_ALLOCATOR* pParent;
+  const FDK_ALLOCATOR* pSelf;
+  UINT live;
+  UINT peak;
+} MEM_PROBE;
+
+#define MEM_PROBE_PREFIX_SIZE (ALGN_SIZE_EXTRES(sizeof(UINT)))
+
+static void* memProbeMalloc(void* context, size_t size) {
+  MEM_PROBE* pProbe = (MEM_PROBE*)context;
+  UCHAR* ptr;
+
+  mpegh_FDKsetAllocator(pProbe->pParent);
+  ptr = (UCHAR*)mpegh_FDKmalloc((UINT)size + MEM_PROBE_PREFIX_SIZE);
+  mpegh_FDKsetAllocator(pProbe->pSelf);
+  if (ptr == NULL) return NULL;
+
+  *(UINT*)ptr = (UINT)size;
+  pProbe->live += (UINT)size;
+  pProbe->peak = fMax(pProbe->peak, pProbe->live);
+
+  return ptr + MEM_PROBE_PREFIX_SIZE;
+}
+
+static void memProbeFree(void* context, void* ptr) {
+  MEM_PROBE* pProbe = (MEM_PROBE*)context;
+  UCHAR* base = (UCHAR*)ptr - MEM_PROBE_PREFIX_SIZE;
+
+  pProbe->live -= *(UINT*)base;
+  mpegh_FDKfree(base);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_GetRequiredMemory(const INT targetLayout,
+                                                            const INT maxInputChannels,
+                                                            const INT maxObjects,
+                                                            UINT* pPersistentMem,
+                                                            UINT* pScratchMem) {
+  AAC_DECODER_ERROR err = AAC_DEC_OK;
+  HANDLE_AACDECODER hProbe;
+  MEM_PROBE probe;
+  FDK_ALLOCATOR probeAllocator = {memProbeMalloc, NULL, memProbeFree, &probe};
+  UINT openMem, rendererMem;
+
+  if ((pPersistentMem == NULL) || (pScratchMem == NULL)) return AAC_DEC_INVALID_PARAM;
+  if ((maxInputChannels < 0) || (maxObjects < 0) || (maxInputChannels + maxObjects > (28))) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+
+  probe.pSelf = &probeAllocator;
+  probe.live = 0;
+  probe.peak = 0;
+  probe.pParent = mpegh_FDKsetAllocator(&probeAllocator);
+
+  hProbe = aacDecoder_Open(TT_MHAS_PACKETIZED, 1);
+  if (hProbe == NULL) {
+    err = AAC_DEC_OUT_OF_MEMORY;
+    goto bail;
+  }
+  err = aacDecoder_SetParam(hProbe, AAC_TARGET_LAYOUT_CICP, targetLayout);
+  if (err != AAC_DEC_OK) {
+    goto bail;
+  }
+  openMem = probe.live;
+
+  /* Renderers may need temporary memory while they are set up. */
+  probe.peak = probe.live;
+  err = CAacDecoder_ProbeRendererMem(hProbe, targetLayout, maxInputChannels, maxObjects);
+  if (err != AAC_DEC_OK) {
+    goto bail;
+  }
+  rendererMem = probe.peak - openMem;
+
+  *pScratchMem = CAacDecoder_GetRequiredScratchMem();
+  *pPersistentMem = openMem + rendererMem;
+  *pPersistentMem += CAacDecoder_GetRequiredChannelMem(maxInputChannels + maxObjects);
+  *pPersistentMem -= *pScratchMem;
+
+bail:
+  aacDecoder_Close(hProbe);
+  mpegh_FDKsetAllocator(probe.pParent);
+
+  return err;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_RegisterTargetLayout(const AACDEC_SPEAKER* pSpeakers,
+                                                               const INT numSpeakers,
+                                                               INT* pTargetLayout,
+                                                               AACDEC_LAYOUT_SETUP_INFO* pInfo) {
+  CICP2GEOMETRY_CHANNEL_GEOMETRY geo[CICP2GEOMETRY_MAX_LOUDSPEAKERS];
+
+  if ((pSpeakers == NULL) || (pTargetLayout == NULL) || (pInfo == NULL)) {
+    return AAC_DEC_INVALID_PARAM;
+  }
+  if ((numSpeakers <= 0) || (numSpeakers > (24))) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+
+  mpegh_FDKmemclear(geo, sizeof(geo));
+  for (int i = 0; i < numSpeakers; i++) {
+    geo[i].Az = pSpeakers[i].azimuth;
+    geo[i].El = pSpeakers[i].elevation;
+    geo[i].LFE = pSpeakers[i].isLfe;
+  }
+  if (cicp2geometry_register_custom_layout(geo, numSpeakers, pTargetLayout) != CICP2GEOMETRY_OK) {
+    return AAC_DEC_UNSUPPORTED_CHANNELCONFIG;
+  }
+
+  return CAacDecoder_PrepareTargetLayout(*pTargetLayout, pInfo);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_ExportSpeakerMesh(const INT targetLayout, void* pData,
+                                                            UINT* pSize) {
+  if (pSize == NULL) {
+    return AAC_DEC_INVALID_PARAM;
+  }
+
+  return CAacDecoder_ExportTargetLayoutMesh(targetLayout, pData, pSize);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_ImportSpeakerMesh(const void* pData, const UINT size) {
+  if (pData == NULL) {
+    return AAC_DEC_INVALID_PARAM;
+  }
+
+  return CAacDecoder_ImportTargetLayoutMesh(pData, size);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_AddRenderTarget(HANDLE_AACDECODER self,
+                                                          const INT targetLayout, INT* pIndex) {
+  if (self == NULL) return AAC_DEC_INVALID_HANDLE;
+  if (pIndex == NULL) return AAC_DEC_INVALID_PARAM;
+
+  /* The renderers of all target layouts are set up together with the primary ones. */
+  if (self->ascChannels[0] > 0) {
+    return AAC_DEC_SET_PARAM_FAIL;
+  }
+
+  return CAacDecoder_AddRenderTarget(self, targetLayout, pIndex);
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_SetRenderTargetBuffer(HANDLE_AACDECODER self,
+                                                                const INT index,
+                                                                INT_PCM* pTimeData,
+                                                                const INT timeDataSize) {
+  if (self == NULL) return AAC_DEC_INVALID_HANDLE;
+  if ((index < 0) || (index >= self->numRenderTargets)) {
+    return AAC_DEC_INVALID_PARAM;
+  }
+
+  self->pRenderTarget[index]->pTimeData = pTimeData;
+  self->pRenderTarget[index]->timeDataSize = (pTimeData != NULL) ? timeDataSize : 0;
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP AAC_DECODER_ERROR aacDecoder_GetSignals(HANDLE_AACDECODER self,
+                                                     AACDEC_SIGNALS* pSignals) {
+  if (self == NULL) return AAC_DEC_INVALID_HANDLE;
+  if ((pSignals == NULL) || (self->pSignalExport == NULL)) {
+    return AAC_DEC_INVALID_PARAM;
+  }
+
+  *pSignals = self->pSignalExport->signals;
+
+  return AAC_DEC_OK;
+}
+
+LINKSPEC_CPP CStreamInfo* aacDecoder_GetRenderTargetInfo(HANDLE_AACDECODER self,
+                                                         const INT index) {
+  AACDEC_RENDER_TARGET* pTarget;
+  CStreamInfo* pInfo;
+
+  if ((self == NULL) || (index < 0) || (index >= self->numRenderTargets)) {
+    return NULL;
+  }
+  pTarget = self->pRenderTarget[index];
+  pInfo = &pTarget->info;
+
+  /* Everything but the output signal description is shared with the primary layout. */
+  *pInfo = self->streamInfo;
+  if (pTarget->outputInfo.numChannels > 0) {
+    pInfo->sampleRate = pTarget->outputInfo.sampleRate;
+    pInfo->frameSize = pTarget->outputInfo.frameSize;
+    pInfo->numChannels = pTarget->outputInfo.numChannels;
+    pInfo->mpeghAUSize = pTarget->outputInfo.mpeghAUSize;
+    pInfo->outputDelay = pTarget->outputInfo.outputDelay;
+    pInfo->outputLoudness = pTarget->outputInfo.outputLoudness;
+  } else {
+    /* No frame was output to the render target by the last decoder call. */
+    pInfo->frameSize = 0;
+    pInfo->mpeghAUSize = 0;
+    pInfo->numChannels = cicp2geometry_get_numChannels_from_cicp(pTarget->targetLayout);
+  }
+
+  return pInfo;
+}
@@ -96,6 +96,7 @@ amm-info@iis.fraunhofer.de
 #include "FDK_tools_rom.h"
 
 #include "ac_arith_coder.h"
+#include "FDK_huffman.h"
 
 #if defined(__arm__)
 #include "arm/block_arm.cpp"
@@ -111,12 +112,11 @@ AAC_DECODER_ERROR CBlock_ReadScaleFactorData(CAacDecoderChannelInfo* pAacDecoder
                    .GlobalGain; /* accu for scale factor delta coding */
   UCHAR* pCodeBook = pAacDecoderChannelInfo->pDynData->aCodeBook;
   SHORT* pScaleFactor = pAacDecoderChannelInfo->pDynData->aScaleFactor;
-  const CodeBookDescription* hcb = &AACcodeBookDescriptionSCL;
-
-  const USHORT(*CodeBook)[HuffmanEntries] = hcb->CodeBook;
+  FDK_BITREADER br;
 
   int ScaleFactorBandsTransmitted =
       GetScaleFactorBandsTransmitted(&pAacDecoderChannelInfo->icsInfo);
+  FDKbrAttach(&br, bs);
   for (group = 0; group < GetWindowGroups(&pAacDecoderChannelInfo->icsInfo); group++) {
     for (band = 0; band < ScaleFactorBandsTransmitted; band++) {
       switch (pCodeBook[band]) {
@@ -126,10 +126,11 @@ AAC_DECODER_ERROR CBlock_ReadScaleFactorData(CAacDecoderChannelInfo* pAacDecoder
 
         default: /* decode scale factor */
           if (!((flags & (AC_USAC | AC_RSVD50 | AC_MPEGH3DA)) && band == 0 && group == 0)) {
-            temp = CBlock_DecodeHuffmanWordCB(bs, CodeBook);
+            temp = FDKhuffDecode(&br, &AAChuffLutSCL);
             factor += temp - 60; /* MIDFAC 1.5 dB */
           }
           if (255 < factor || 0 > factor) {
+            FDKbrDetach(&br, bs);
             return AAC_DEC_PARSE_ERROR;
           }
           pScaleFactor[band] = factor - 100;
@@ -137,7 +138,7 @@ AAC_DECODER_ERROR CBlock_ReadScaleFactorData(CAacDecoderChannelInfo* pAacDecoder
 
         case INTENSITY_HCB: /* intensity steering */
         case INTENSITY_HCB2:
-          temp = CBlock_DecodeHuffmanWordCB(bs, CodeBook);
+          temp = FDKhuffDecode(&br, &AAChuffLutSCL);
           position += temp - 60;
           pScaleFactor[band] = position - 100;
           break;
@@ -146,6 +147,7 @@ AAC_DECODER_ERROR CBlock_ReadScaleFactorData(CAacDecoderChannelInfo* pAacDecoder
     pCodeBook += 16;
     pScaleFactor += 16;
   }
+  FDKbrDetach(&br, bs);
 
   return AAC_DEC_OK;
 }
@@ -1324,7 +1326,7 @@ void CBlock_FrequencyToTime(CAacDecoderStaticChannelInfo* pAacDecoderStaticChann
 
   {
     {
-      FIXP_DBL* tmp = pAacDecoderChannelInfo->pComStaticData->pWorkBufferCore1->mdctOutTemp;
+      FIXP_DBL* tmp = pWorkBuffer1;
 #if defined(FDK_ASSERT_ENABLE)
       nSamples =
 #endif
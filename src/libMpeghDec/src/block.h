@@ -250,82 +250,4 @@ FDK_INLINE void InverseQuantize(FIXP_DBL* pSignedValue, UINT lsb, int scale) {
   *pSignedValue = (signedValue < (FIXP_DBL)0) ? -value : value;
 }
 
-/*!
-  \brief Conversion of index values to quantized coefficients
-
-  The function converts the index values to quantized coefficients.
-
-  \return  dimension
-*/
-FDK_INLINE
-int CBlock_UnpackIndex(
-    int idx,                        /*!< pointer to index */
-    FIXP_DBL* RESTRICT qp,          /*!< pointer to quantized coefficients */
-    const CodeBookDescription* hcb) /*!< pointer to sideinfo of the current codebook */
-{
-  int dim = hcb->Dimension;
-  int offset = hcb->Offset;
-  int bits = hcb->numBits;
-  int mask = (1 << bits) - 1;
-  int i;
-
-  for (i = 0; i < dim; i++) {
-    qp[i] = (FIXP_DBL)((idx & mask) - offset);
-    idx >>= bits;
-  }
-
-  return dim;
-}
-
-/*!
-  \brief Read huffman codeword
-
-  The function reads the huffman codeword from the bitstream and
-  returns the index value.
-
-  \return  index value
-*/
-inline int CBlock_DecodeHuffmanWord(
-    HANDLE_FDK_BITSTREAM bs,        /*!< pointer to bitstream */
-    const CodeBookDescription* hcb) /*!< pointer to codebook description */
-{
-  UINT val;
-  UINT index = 0;
-  const USHORT(*CodeBook)[HuffmanEntries] = hcb->CodeBook;
-
-  while (1) {
-    val = CodeBook[index][FDKreadBits(bs, HuffmanBits)]; /* Expensive memory access */
-
-    if ((val & 1) == 0) {
-      index = val >> 2;
-      continue;
-    } else {
-      if (val & 2) {
-        FDKpushBackCache(bs, 1);
-      }
-
-      val >>= 2;
-      break;
-    }
-  }
-
-  return val;
-}
-FDK_FORCEINLINE
-int CBlock_DecodeHuffmanWordCB(
-    HANDLE_FDK_BITSTREAM bs,                  /*!< pointer to bitstream */
-    const USHORT (*CodeBook)[HuffmanEntries]) /*!< pointer to codebook description */
-{
-  UINT index = 0;
-  while (1) {
-    index = CodeBook[index][FDKread2Bits(bs)]; /* Expensive memory access */
-    if (index & 1) break;
-    index >>= 2;
-  }
-  if (index & 2) {
-    FDKpushBackCache(bs, 1);
-  }
-  return index >> 2;
-}
-
 #endif /* #ifndef BLOCK_H */
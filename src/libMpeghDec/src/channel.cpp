@@ -121,7 +121,8 @@ static void Clean_Complex_Prediction_coefficients(
 void CChannelElement_Decode(
     CAacDecoderChannelInfo* pAacDecoderChannelInfo[2], /*!< pointer to aac decoder channel info */
     CAacDecoderStaticChannelInfo* pAacDecoderStaticChannelInfo[2],
-    SamplingRateInfo* pSamplingRateInfo, UINT flags, UINT elFlags, int el_channels) {
+    SamplingRateInfo* pSamplingRateInfo, UINT flags, UINT elFlags, int el_channels,
+    CWorkBufferCore1* pWorkBufferCore1) {
   int ch = 0;
 
   int maxSfBandsL = 0, maxSfBandsR = 0;
@@ -199,11 +200,8 @@ void CChannelElement_Decode(
       /* Apply IGF stereo */
       if ((elFlags & AC_EL_ENHANCED_NOISE) && !(elFlags & AC_EL_IGF_AFTER_TNS) &&
           !(elFlags & AC_EL_IGF_INDEP_TILING)) {
-        UCHAR* TNF_maskL =
-            (UCHAR*)pAacDecoderChannelInfo[0]->pComStaticData->pWorkBufferCore1->mdctOutTemp + 512;
-        UCHAR* TNF_maskR =
-            (UCHAR*)pAacDecoderChannelInfo[0]->pComStaticData->pWorkBufferCore1->mdctOutTemp + 512 +
-            1024;
+        UCHAR* TNF_maskL = (UCHAR*)pWorkBufferCore1->mdctOutTemp + 512;
+        UCHAR* TNF_maskR = (UCHAR*)pWorkBufferCore1->mdctOutTemp + 512 + 1024;
         mpegh_FDKmemclear(TNF_maskL, 1024);
         mpegh_FDKmemclear(TNF_maskR, 1024);
 
@@ -304,11 +302,8 @@ void CChannelElement_Decode(
       /* Apply IGF stereo */
       if ((elFlags & AC_EL_ENHANCED_NOISE) && (elFlags & AC_EL_IGF_AFTER_TNS) &&
           !(elFlags & AC_EL_IGF_INDEP_TILING)) {
-        UCHAR* TNF_maskL =
-            (UCHAR*)pAacDecoderChannelInfo[0]->pComStaticData->pWorkBufferCore1->mdctOutTemp + 512;
-        UCHAR* TNF_maskR =
-            (UCHAR*)pAacDecoderChannelInfo[0]->pComStaticData->pWorkBufferCore1->mdctOutTemp + 512 +
-            1024;
+        UCHAR* TNF_maskL = (UCHAR*)pWorkBufferCore1->mdctOutTemp + 512;
+        UCHAR* TNF_maskR = (UCHAR*)pWorkBufferCore1->mdctOutTemp + 512 + 1024;
         mpegh_FDKmemclear(TNF_maskL, 1024);
         mpegh_FDKmemclear(TNF_maskR, 1024);
 
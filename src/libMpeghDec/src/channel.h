@@ -111,12 +111,12 @@ void CChannel_CodebookTableInit(CAacDecoderChannelInfo* pAacDecoderChannelInfo);
  * or two.
  * \param pSamplingRateInfo pointer to sample rate information structure
  * \param el_channels amount of channels of the element to be decoded.
- * \param output pointer to time domain output buffer (ACELP)
+ * \param pWorkBufferCore1 temporary memory, not shared with concurrently decoded elements.
  */
 void CChannelElement_Decode(CAacDecoderChannelInfo* pAacDecoderChannelInfo[2],
                             CAacDecoderStaticChannelInfo* pAacDecoderStaticChannelInfo[2],
                             SamplingRateInfo* pSamplingRateInfo, UINT flags, UINT elFlags,
-                            int el_channels);
+                            int el_channels, CWorkBufferCore1* pWorkBufferCore1);
 
 /**
  * \brief Read channel element of given type from bitstream.
@@ -258,6 +258,99 @@ int deque_bulk_pop_front(deque* q, unsigned int numData) {
   return 0;
 }
 
+int deque_bulk_front_view(const deque* q, unsigned int numData, void** data0,
+                          unsigned int* length0, void** data1, unsigned int* length1) {
+  if (q->size < numData) {
+    return -1;
+  }
+
+  *data0 = (unsigned char*)q->data + q->first * q->block_size;
+  if (q->first + numData > q->max) {
+    *length0 = q->max - q->first;
+    *data1 = q->data;
+    *length1 = numData - *length0;
+  } else {
+    *length0 = numData;
+    *data1 = NULL;
+    *length1 = 0;
+  }
+  return 0;
+}
+
+void* deque_back_space(const deque* q, unsigned int numData) {
+  if (q->size + numData > q->max || q->last + numData > q->max) {
+    return NULL;
+  }
+  return (unsigned char*)q->data + q->last * q->block_size;
+}
+
+int deque_bulk_push_back_in_place(deque* q, unsigned int numData) {
+  if (q->size + numData > q->max) {
+    return -1;
+  }
+
+  q->last = (q->last + numData) % q->max;
+  q->size += numData;
+  if (q->size == q->max) {
+    q->full = true;
+  }
+  return 0;
+}
+
+static void deque_copy_at(deque* q, unsigned int dstIndex, unsigned int srcIndex) {
+  mpegh_FDKmemcpy(deque_at(q, dstIndex), deque_at(q, srcIndex), q->block_size);
+}
+
+int deque_bulk_erase(deque* q, unsigned int index, unsigned int numData) {
+  if (index + numData > q->size) {
+    return -1;
+  }
+  if (numData == 0) {
+    return 0;
+  }
+
+  // close the gap by moving the data behind it
+  for (unsigned int i = index + numData; i < q->size; i++) {
+    deque_copy_at(q, i - numData, i);
+  }
+  q->last = (q->last + q->max - numData) % q->max;
+  q->size -= numData;
+  q->full = false;
+  return 0;
+}
+
+int deque_bulk_insert_zeros(deque* q, unsigned int index, unsigned int numZeros) {
+  if (index > q->size) {
+    return -1;
+  }
+  if (numZeros == 0) {
+    return 0;
+  }
+  if (deque_bulk_push_back_zeros(q, numZeros) != 0) {
+    return -1;
+  }
+
+  // open the gap by moving the data behind it
+  for (unsigned int i = q->size - numZeros; i-- > index;) {
+    deque_copy_at(q, i + numZeros, i);
+  }
+  return deque_bulk_set_zeros(q, index, numZeros);
+}
+
+int deque_bulk_set_zeros(deque* q, unsigned int index, unsigned int numZeros) {
+  if (index + numZeros > q->size) {
+    return -1;
+  }
+
+  unsigned int pos = (q->first + index) % q->max;
+  unsigned int toSet = (numZeros < q->max - pos) ? numZeros : q->max - pos;
+  mpegh_FDKmemset((unsigned char*)q->data + pos * q->block_size, 0, toSet * q->block_size);
+  if (numZeros > toSet) {
+    mpegh_FDKmemset((unsigned char*)q->data, 0, (numZeros - toSet) * q->block_size);
+  }
+  return 0;
+}
+
 bool deque_full(const deque* q) {
   return (q->full) ? true : false;
 }
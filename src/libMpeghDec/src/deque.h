@@ -125,6 +125,19 @@ int deque_bulk_pop_front_copy(deque* q, void* destination, unsigned int numData)
 
 int deque_bulk_pop_front(deque* q, unsigned int numData);
 
+int deque_bulk_front_view(const deque* q, unsigned int numData, void** data0,
+                          unsigned int* length0, void** data1, unsigned int* length1);
+
+void* deque_back_space(const deque* q, unsigned int numData);
+
+int deque_bulk_push_back_in_place(deque* q, unsigned int numData);
+
+int deque_bulk_erase(deque* q, unsigned int index, unsigned int numData);
+
+int deque_bulk_insert_zeros(deque* q, unsigned int index, unsigned int numZeros);
+
+int deque_bulk_set_zeros(deque* q, unsigned int index, unsigned int numZeros);
+
 bool deque_full(const deque* queue);
 
 bool deque_empty(const deque* queue);
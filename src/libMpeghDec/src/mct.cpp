@@ -93,73 +93,32 @@ amm-info@iis.fraunhofer.de
 #include "mct.h"
 #include "FDK_igfDec.h"
 
-#define CODE_BOOK_ALPHA_LAV 121
 #define CODE_BOOK_BETA_LAV 65
 #define DEFAULT_BETA (48) /*equals 45 degrees */
 #define DEFAULT_ALPHA (0)
 #define READ_MASK(a, b) ((a) & (UINT64)1 << (63 - (b)))
 
-/* huffman tables */
-
-static const int huff_ctabAngle[CODE_BOOK_BETA_LAV] = {
-    0x00000000, 0x0000000B, 0x00000012, 0x0000001B, 0x0000001F, 0x00000031, 0x0000003A, 0x00000043,
-    0x00000065, 0x00000073, 0x00000082, 0x0000009A, 0x000000CE, 0x000000EE, 0x00000106, 0x0000013A,
-    0x000001D9, 0x000001DE, 0x00000202, 0x00000261, 0x0000020F, 0x0000020E, 0x00000263, 0x00000266,
-    0x00000272, 0x00000271, 0x00000277, 0x00000276, 0x00000334, 0x00000325, 0x00000326, 0x00000327,
-    0x00000324, 0x00000323, 0x00000335, 0x00000322, 0x00000320, 0x00000321, 0x00000273, 0x00000270,
-    0x00000267, 0x00000260, 0x000004C4, 0x000004C5, 0x00000203, 0x000001DF, 0x000001DA, 0x000001D8,
-    0x0000019B, 0x000001DB, 0x00000132, 0x00000100, 0x000000CF, 0x000000CC, 0x0000009B, 0x00000081,
-    0x00000072, 0x0000004F, 0x00000042, 0x00000038, 0x00000030, 0x0000001E, 0x0000001A, 0x00000011,
-    0x0000000A};
-
-static const int huff_ltabAngle[CODE_BOOK_BETA_LAV] = {
-    0x00000001, 0x00000004, 0x00000005, 0x00000005, 0x00000005, 0x00000006, 0x00000006, 0x00000007,
-    0x00000007, 0x00000007, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000009, 0x00000009,
-    0x00000009, 0x00000009, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A,
-    0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A,
-    0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A, 0x0000000A,
-    0x0000000A, 0x0000000A, 0x0000000B, 0x0000000B, 0x0000000A, 0x00000009, 0x00000009, 0x00000009,
-    0x00000009, 0x00000009, 0x00000009, 0x00000009, 0x00000008, 0x00000008, 0x00000008, 0x00000008,
-    0x00000007, 0x00000007, 0x00000007, 0x00000006, 0x00000006, 0x00000005, 0x00000005, 0x00000005,
-    0x00000004};
-#define HUFF_LTABANGLE_MAX_VALUE 0xB
-
-static const int huff_ctabscf[CODE_BOOK_ALPHA_LAV] = {
-    0x0003ffe8, 0x0003ffe6, 0x0003ffe7, 0x0003ffe5, 0x0007fff5, 0x0007fff1, 0x0007ffed, 0x0007fff6,
-    0x0007ffee, 0x0007ffef, 0x0007fff0, 0x0007fffc, 0x0007fffd, 0x0007ffff, 0x0007fffe, 0x0007fff7,
-    0x0007fff8, 0x0007fffb, 0x0007fff9, 0x0003ffe4, 0x0007fffa, 0x0003ffe3, 0x0001ffef, 0x0001fff0,
-    0x0000fff5, 0x0001ffee, 0x0000fff2, 0x0000fff3, 0x0000fff4, 0x0000fff1, 0x00007ff6, 0x00007ff7,
-    0x00003ff9, 0x00003ff5, 0x00003ff7, 0x00003ff3, 0x00003ff6, 0x00003ff2, 0x00001ff7, 0x00001ff5,
-    0x00000ff9, 0x00000ff7, 0x00000ff6, 0x000007f9, 0x00000ff4, 0x000007f8, 0x000003f9, 0x000003f7,
-    0x000003f5, 0x000001f8, 0x000001f7, 0x000000fa, 0x000000f8, 0x000000f6, 0x00000079, 0x0000003a,
-    0x00000038, 0x0000001a, 0x0000000b, 0x00000004, 0x00000000, 0x0000000a, 0x0000000c, 0x0000001b,
-    0x00000039, 0x0000003b, 0x00000078, 0x0000007a, 0x000000f7, 0x000000f9, 0x000001f6, 0x000001f9,
-    0x000003f4, 0x000003f6, 0x000003f8, 0x000007f5, 0x000007f4, 0x000007f6, 0x000007f7, 0x00000ff5,
-    0x00000ff8, 0x00001ff4, 0x00001ff6, 0x00001ff8, 0x00003ff8, 0x00003ff4, 0x0000fff0, 0x00007ff4,
-    0x0000fff6, 0x00007ff5, 0x0003ffe2, 0x0007ffd9, 0x0007ffda, 0x0007ffdb, 0x0007ffdc, 0x0007ffdd,
-    0x0007ffde, 0x0007ffd8, 0x0007ffd2, 0x0007ffd3, 0x0007ffd4, 0x0007ffd5, 0x0007ffd6, 0x0007fff2,
-    0x0007ffdf, 0x0007ffe7, 0x0007ffe8, 0x0007ffe9, 0x0007ffea, 0x0007ffeb, 0x0007ffe6, 0x0007ffe0,
-    0x0007ffe1, 0x0007ffe2, 0x0007ffe3, 0x0007ffe4, 0x0007ffe5, 0x0007ffd7, 0x0007ffec, 0x0007fff4,
-    0x0007fff3};
-
-static const int huff_ltabscf[CODE_BOOK_ALPHA_LAV] = {
-    0x00000012, 0x00000012, 0x00000012, 0x00000012, 0x00000013, 0x00000013, 0x00000013, 0x00000013,
-    0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013,
-    0x00000013, 0x00000013, 0x00000013, 0x00000012, 0x00000013, 0x00000012, 0x00000011, 0x00000011,
-    0x00000010, 0x00000011, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x0000000f, 0x0000000f,
-    0x0000000e, 0x0000000e, 0x0000000e, 0x0000000e, 0x0000000e, 0x0000000e, 0x0000000d, 0x0000000d,
-    0x0000000c, 0x0000000c, 0x0000000c, 0x0000000b, 0x0000000c, 0x0000000b, 0x0000000a, 0x0000000a,
-    0x0000000a, 0x00000009, 0x00000009, 0x00000008, 0x00000008, 0x00000008, 0x00000007, 0x00000006,
-    0x00000006, 0x00000005, 0x00000004, 0x00000003, 0x00000001, 0x00000004, 0x00000004, 0x00000005,
-    0x00000006, 0x00000006, 0x00000007, 0x00000007, 0x00000008, 0x00000008, 0x00000009, 0x00000009,
-    0x0000000a, 0x0000000a, 0x0000000a, 0x0000000b, 0x0000000b, 0x0000000b, 0x0000000b, 0x0000000c,
-    0x0000000c, 0x0000000d, 0x0000000d, 0x0000000d, 0x0000000e, 0x0000000e, 0x00000010, 0x0000000f,
-    0x00000010, 0x0000000f, 0x00000012, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013,
-    0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013,
-    0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013,
-    0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x00000013,
-    0x00000013};
-#define HUFF_LTABSCF_MAX_VALUE 0x13
+/* angle Huffman codebook as lookup table with 6 bit primary table, q.v. FDK_huffman.h. The alpha
+ * codebook equals the scalefactor codebook AAChuffLutSCL. */
+
+static const USHORT huff_lutAngle[172] = {
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x8404, 0x8501, 0x07E5, 0x07E5,
+    0x0045, 0x0045, 0x8525, 0x8724, 0x0804, 0x0804, 0x0804, 0x0804, 0x0024, 0x0024, 0x0024, 0x0024,
+    0x0786, 0x00A6, 0x8824, 0x8924, 0x07C5, 0x07C5, 0x0065, 0x0065, 0x0766, 0x8A21, 0x00C6, 0x8A43,
+    0x07A5, 0x07A5, 0x0085, 0x0085, 0x0663, 0x0663, 0x0244, 0x0584, 0x06E2, 0x06E2, 0x06E2, 0x06E2,
+    0x0142, 0x0142, 0x0142, 0x0142, 0x01C3, 0x01C3, 0x02A4, 0x0284, 0x0741, 0x00E1, 0x0524, 0x0524,
+    0x0264, 0x0264, 0x0545, 0x0565, 0x02C4, 0x02C4, 0x0643, 0x0643, 0x0643, 0x0643, 0x02E4, 0x02E4,
+    0x0504, 0x0504, 0x0162, 0x0162, 0x0162, 0x0162, 0x0162, 0x0162, 0x0162, 0x0162, 0x06C2, 0x06C2,
+    0x06C2, 0x06C2, 0x06C2, 0x06C2, 0x06C2, 0x06C2, 0x04E4, 0x0324, 0x0304, 0x04C4, 0x01E3, 0x01E3,
+    0x0364, 0x0344, 0x0721, 0x0721, 0x0721, 0x0721, 0x0721, 0x0721, 0x0721, 0x0721, 0x0484, 0x04A4,
+    0x0464, 0x0424, 0x0404, 0x03A4, 0x03C4, 0x03E4, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101,
+    0x0101, 0x0101, 0x06A2, 0x06A2, 0x06A2, 0x06A2, 0x0384, 0x0444, 0x0603, 0x0603, 0x0182, 0x0182,
+    0x0182, 0x0182, 0x0682, 0x0682, 0x0682, 0x0682, 0x0701, 0x0121, 0x05E3, 0x0203, 0x05C3, 0x0623,
+    0x01A2, 0x01A2, 0x0223, 0x05A3};
+
+static const FDK_HUFF_LUT huffLutAngle = {huff_lutAngle, 6};
 
 /* quantized sin/cos tables for index */
 static const FIXP_SPK tabIndexToCosSinAlpha[CODE_BOOK_BETA_LAV] = {
@@ -311,34 +270,10 @@ static int CMct_inverseMctParseChannelPair(HANDLE_FDK_BITSTREAM hbitBuffer, UCHA
   return err;
 }
 
-static int CMct_decodeHuffman(HANDLE_FDK_BITSTREAM hbitBuffer, const int* const ctab,
-                              const int* const ltab, int maxl, int limit) {
-  int tabIdx, shift;
-
-  int bsVal = FDKreadBits(hbitBuffer, maxl);
-
-  for (tabIdx = 0; tabIdx < limit; tabIdx++) {
-    shift = maxl - ltab[tabIdx]; /* shift in [0.. maxl] */
-    if ((bsVal >> shift) == ctab[tabIdx]) {
-      /* found */
-      break;
-    }
-  }
-  if (tabIdx >= limit) {
-    /* End of angle code book reached */
-    tabIdx = -1;
-    shift = maxl;
-  }
-  FDKpushBack(hbitBuffer, shift);
-
-  return tabIdx;
-}
-
 static int Read_MultichannelCodingBox(const int MCTSignalingType, const int usacIndepFlag,
                                       HANDLE_FDK_BITSTREAM hbitBuffer, const CMctPtr self,
-                                      CMctWorkPtr work, const int i, const int* huff_ctab,
-                                      const int* huff_ltab, const int huff_ltab_max_val,
-                                      const int code_book_lav) {
+                                      CMctWorkPtr work, const int i,
+                                      const FDK_HUFF_LUT* hHuffLut) {
   int retVal = 0;
 
   /* read channel pair */
@@ -393,16 +328,14 @@ static int Read_MultichannelCodingBox(const int MCTSignalingType, const int usac
 
   if (work->bHasBandwiseCoeffs[i] == 0) {
     /* use fullband angle */
-    int val =
-        CMct_decodeHuffman(hbitBuffer, huff_ctab, huff_ltab, huff_ltab_max_val, code_book_lav);
+    int val = FDKhuffDecodeBs(hbitBuffer, hHuffLut);
     FDK_ASSERT(val >= 0 && val < 256);
     work->pairCoeffDeltaFb[i] = val;
   } else {
     /* use bandwise angles */
     for (int j = 0; j < work->numMctMaskBands[i]; j++) {
       if (READ_MASK(work->mctMask[i], j) > 0) {
-        int val =
-            CMct_decodeHuffman(hbitBuffer, huff_ctab, huff_ltab, huff_ltab_max_val, code_book_lav);
+        int val = FDKhuffDecodeBs(hbitBuffer, hHuffLut);
         FDK_ASSERT(val >= 0 && val < 256);
         work->pairCoeffDeltaSfb[i][j] = val;
       }
@@ -473,15 +406,13 @@ int CMct_inverseMctParseBS(CMctPtr self, HANDLE_FDK_BITSTREAM hbitBuffer, int us
 
     if (self->MCCSignalingType == 0) {
       retVal = Read_MultichannelCodingBox(self->MCCSignalingType, usacIndepFlag, hbitBuffer, self,
-                                          work, i, huff_ctabscf, huff_ltabscf,
-                                          HUFF_LTABSCF_MAX_VALUE, CODE_BOOK_ALPHA_LAV);
+                                          work, i, &AAChuffLutSCL);
       if (retVal) {
         return retVal;
       }
     } else if (self->MCCSignalingType == 1) {
       Read_MultichannelCodingBox(self->MCCSignalingType, usacIndepFlag, hbitBuffer, self, work, i,
-                                 huff_ctabAngle, huff_ltabAngle, HUFF_LTABANGLE_MAX_VALUE,
-                                 CODE_BOOK_BETA_LAV);
+                                 &huffLutAngle);
       if (retVal) {
         return retVal;
       }
@@ -90,10 +90,13 @@ amm-info@iis.fraunhofer.de
 
 #include <math.h>
 
+#include <chrono>
+
 #include "FDK_cicp2geometry.h"
 #include "aacdecoder_lib.h"
 #include "deque.h"
 #include "mpeghdecoder.h"
+#include "tpdec_lib.h"
 
 // The following threshold determines the maximally allowed time difference (in milliseconds) of
 // two consecutively provided MPEG-H frames. If this threshold is exceeded the decoding process
@@ -101,6 +104,8 @@ amm-info@iis.fraunhofer.de
 #define THRESHOLD 200000000  // 200 milliseconds ~ 9.375 frames of 1024 samples at 48kHz
 
 #define TIMESTAMP_ARRAY_SIZE (10)
+// An MHAS frame decodes to one frame, plus a concealed one if a sync error forces it ahead.
+#define MAX_FRAMES_PER_INPUT (2)
 #define FADE_ARRAY_SIZE (10)
 #define NUM_FADE_SAMPLES_PER_CHANNEL (128)
 
@@ -109,6 +114,10 @@ amm-info@iis.fraunhofer.de
 
 #define TOLERANCE (5)
 
+#define MAX_NUM_SIGNALS (28)
+#define MAX_NUM_SIGNAL_GROUPS (2 * MAX_NUM_SIGNALS)
+#define MAX_NUM_OBJECT_METADATA (16 * MAX_NUM_SIGNALS)
+
 #define DEFAULT_DRC_SETTING_TARGET_REFERENCE_LEVEL (96)
 #define DEFAULT_DRC_SETTING_EFFECT_TYPE (0)
 #define DEFAULT_DRC_SETTING_BOOST_FACTOR (127)
@@ -121,13 +130,33 @@ typedef struct AUInfo {
   int outputLoudness;
 } AUInfo;
 
+typedef struct PoolSlotInfo {
+  unsigned int slot;    // index into the output frame pool
+  unsigned int offset;  // samples * channel already consumed
+  unsigned int size;    // samples * channel
+} PoolSlotInfo;
+
 typedef struct OutputInfo {
   int size;  // samples * channel
   bool concealed;
   int outputLoudness;
 } OutputInfo;
 
+typedef struct SignalsInfo {
+  MPEGH_DECODER_SIGNAL signal[MAX_NUM_SIGNALS];
+  MPEGH_DECODER_SIGNAL_GROUP group[MAX_NUM_SIGNAL_GROUPS];
+  MPEGH_DECODER_OBJECT_METADATA objectMetadata[MAX_NUM_OBJECT_METADATA];
+} SignalsInfo;
+
+typedef struct MPEGH_DECODER_SCRATCH {
+  HANDLE_AACDEC_SCRATCH hCoreScratch;
+  INT_PCM* tmpSamples; /* sized for MAX_NUM_OUTPUT_CHANNELS */
+} MPEGH_DECODER_SCRATCH;
+
 typedef struct MPEGH_DECODER_CONTEXT {
+  /* Allocator of this instance, current for the calling thread during each API call. */
+  FDK_ALLOCATOR allocator;
+
   int sampleRate;
   int numberOfChannels;
   int32_t cicpIndex;
@@ -135,6 +164,27 @@ typedef struct MPEGH_DECODER_CONTEXT {
 
   HANDLE_AACDECODER mpeghdec;
   INT_PCM* tmpSamples;
+  /* Shared work buffers, NULL if the instance uses its own ones. */
+  HANDLE_MPEGH_DECODER_SCRATCH scratch;
+  /* Task executor of the core decoder, execute is NULL for serial decoding. */
+  AACDEC_TASK_EXECUTOR executor;
+  /* Pipelined decoding of the core decoder, see mpeghdecoder_setPipelinedDecoding(). */
+  int pipelinedDecoding;
+  /* A sync error forced a concealed frame that was left to the next call for lack of space. */
+  bool concealPending;
+
+  /* Additional target layouts rendered by the core decoder of this instance, see
+   * mpeghdecoder_addTargetLayout(). A target layout instance has no core decoder of its own and
+   * points to the instance driving it. */
+  HANDLE_MPEGH_DECODER_CONTEXT parent;
+  HANDLE_MPEGH_DECODER_CONTEXT targets[AACDEC_MAX_RENDER_TARGETS];
+  int numTargets;
+
+  /* Callback receiving the decoded signals instead of rendering them, see
+   * mpeghdecoder_setSignalsCallback(). */
+  MPEGH_DECODER_SIGNALS_CALLBACK signalsCallback;
+  void* signalsContext;
+  SignalsInfo* signalsInfo;
 
   uint8_t* mhaConfig;
   uint32_t mhaConfigLength;
@@ -144,16 +194,28 @@ typedef struct MPEGH_DECODER_CONTEXT {
 
   deque auInfoQueue;
 
-  deque decodedSamplesQueue;
   deque outputInfoQueue;
+  /* Ring of the output frames, followed by the decoded samples not taken over into an output
+   * frame yet. Fades and timestamp corrections are applied in place. */
   deque outputSamplesQueue;
+  unsigned int numQueuedSamples; /* decoded samples at the back of outputSamplesQueue */
+  INT_PCM* decodeBuffer;         /* buffer the current frame is decoded into */
 
   deque fadeoutIdxQueue;
   deque fadeinIdxQueue;
 
+  /* Caller-supplied output frame pool. If set, the decoder writes directly into the pool and
+   * poolUsedQueue holds the slot indices of the decoded samples instead of outputSamplesQueue. */
+  INT_PCM** outputPool;
+  unsigned int outputPoolSize;
+  unsigned int numPooledSamples;
+  deque poolFreeQueue;
+  deque poolUsedQueue;
+
   uint64_t frameNumber;
 
   unsigned int maxDecoderOutputSamples;
+  unsigned int viewedSamples; /* samples handed out by getSamplesView, not yet released */
 
   bool drcUpdate;
   /* Desired DRC values (set by user). */
@@ -171,41 +233,235 @@ typedef struct MPEGH_DECODER_CONTEXT {
   int lastDrcAlbumMode;
 } MPEGH_DECODER_CONTEXT;
 
+/* Makes an allocator the current one of the calling thread for the lifetime of the object. */
+struct AllocatorScope {
+  explicit AllocatorScope(const FDK_ALLOCATOR* pAllocator)
+      : pPrevious(mpegh_FDKsetAllocator(pAllocator)) {}
+  ~AllocatorScope() { mpegh_FDKsetAllocator(pPrevious); }
+
+  const FDK_ALLOCATOR* pPrevious;
+};
+
 /*
  * Method:    fade
  * called to fadein/fadeout a signal
  */
 static void fade(int32_t* sample, int index, int fadelen, bool fadein);
 
+/*
+ * Method:    allocQueues
+ * called to allocate all queues, returns a negative value on failure
+ */
+static int allocQueues(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
+
 /*
  * Method:    clearQueues
  * called to clear all queues
  */
 static void clearQueues(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
 
+/*
+ * Method:    resetOutput
+ * called to drop all pending samples and forget the output configuration
+ */
+static void resetOutput(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
+
+/*
+ * Method:    destroyContext
+ * called to de-allocate an instance, which can be a target layout instance
+ */
+static void destroyContext(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
+
+/*
+ * Method:    hasSamplesView
+ * called to check whether an instance or one of its target layouts has a view not yet released
+ */
+static bool hasSamplesView(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
+
 /*
  * Method:    restartDecoder
- * called to restart the decoder
+ * called to restart the decoder, fails while a view of the output is not yet released
  */
 static MPEGH_DECODER_ERROR restartDecoder(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
 
 static void updateDrcSettings(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
 
+/*
+ * Method:    getDecodeBuffer
+ * called to get the buffer the next frame is decoded into
+ */
+static INT_PCM* getDecodeBuffer(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
+
+/*
+ * Method:    pushDecodedSamples
+ * called to append a decoded frame held in the current decode buffer to the sample queue
+ */
+static void pushDecodedSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples);
+
+/*
+ * Method:    consumePooledSamples
+ * called to move samples from the output frame pool to dst, replaced by zeros if zero is set,
+ * or drop them if dst is NULL
+ */
+static void consumePooledSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples,
+                                 deque* dst, bool zero);
+
+/*
+ * Method:    consumeDecodedSamples
+ * called to take samples from the sample queue over into the output frames, replaced by zeros
+ * if zero is set
+ */
+static void consumeDecodedSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples,
+                                  bool zero);
+
+/*
+ * Method:    dropDecodedSamples
+ * called to remove samples from the sample queue
+ */
+static void dropDecodedSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples);
+
+/*
+ * Method:    addZeroSamples
+ * called to append zero samples to the output frames
+ */
+static void addZeroSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples);
+
+/*
+ * Method:    getNumOutputSamples
+ * called to get the number of samples taken over into the output frames
+ */
+static unsigned int getNumOutputSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
+
+/*
+ * Method:    getNumDecodedSamples
+ * called to get the number of samples in the sample queue
+ */
+static unsigned int getNumDecodedSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
+
+/*
+ * Method:    hasDecodeSpace
+ * called to check whether the sample queues of an instance and its target layouts can take
+ * numFrames more decoded frames
+ */
+static bool hasDecodeSpace(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numFrames);
+
+/*
+ * Method:    hasInputSpace
+ * called to check whether an instance and its target layouts can take another MHAS frame and
+ * numFrames decoded frames
+ */
+static bool hasInputSpace(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numFrames);
+
+/*
+ * Method:    pushTimestamp
+ * called to append a timestamp to the timestamp queues of an instance and its target layouts
+ */
+static void pushTimestamp(HANDLE_MPEGH_DECODER_CONTEXT hCtx, uint64_t timestamp);
+
+/*
+ * Method:    popTimestamp
+ * called to remove the newest or the oldest timestamp of an instance and its target layouts
+ */
+static void popTimestamp(HANDLE_MPEGH_DECODER_CONTEXT hCtx, bool newest);
+
+/*
+ * Method:    setTargetBuffers
+ * called to let the core decoder render the target layouts into their decode buffers
+ */
+static void setTargetBuffers(HANDLE_MPEGH_DECODER_CONTEXT hCtx);
+
+/*
+ * Method:    pushTargetSamples
+ * called to append the frame rendered to each target layout to its sample queue
+ */
+static MPEGH_DECODER_ERROR pushTargetSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                             const CStreamInfo* p_si, bool concealed);
+
+/*
+ * Method:    decodeInput
+ * called to hand an MHAS frame held in one buffer or in spans to the decoder and decode it
+ */
+static MPEGH_DECODER_ERROR decodeInput(HANDLE_MPEGH_DECODER_CONTEXT hCtx, const uint8_t* inData,
+                                       uint32_t inLength, const AACDEC_SPAN* spans,
+                                       uint32_t numSpans, uint64_t timestamp);
+
+/*
+ * Method:    outputSignals
+ * called to hand the signals of the frame decoded last to the signals callback
+ */
+static void outputSignals(HANDLE_MPEGH_DECODER_CONTEXT hCtx, uint64_t pts, bool concealed);
+
+/*
+ * Method:    prepareOutputFrame
+ * called to move the next frame into the output queue and apply fadein/fadeout in place
+ */
+static MPEGH_DECODER_ERROR prepareOutputFrame(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                              unsigned int* numOutputSamples,
+                                              MPEGH_DECODER_OUTPUT_INFO* outInfo);
+
+/*
+ * Method:    releaseOutputFrame
+ * called to remove an output frame from the output queue, optionally copying it to outData
+ */
+static void releaseOutputFrame(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numOutputSamples,
+                               int32_t* outData);
+
+/*
+ * Method:    getFdkAllocator
+ * called to convert allocator callbacks of the API, NULL selects the C library allocator
+ */
+static int getFdkAllocator(const MPEGH_DECODER_ALLOCATOR* allocator, FDK_ALLOCATOR* fdkAllocator) {
+  mpegh_FDKmemclear(fdkAllocator, sizeof(FDK_ALLOCATOR));
+  if (allocator != NULL) {
+    if ((allocator->mallocFunc == NULL) || (allocator->freeFunc == NULL)) {
+      return -1;
+    }
+    fdkAllocator->mallocFunc = allocator->mallocFunc;
+    fdkAllocator->alignedAllocFunc = allocator->alignedAllocFunc;
+    fdkAllocator->freeFunc = allocator->freeFunc;
+    fdkAllocator->context = allocator->context;
+  }
+  return 0;
+}
+
+/* CICP layouts and layouts registered with mpeghdecoder_registerSpeakerLayout() */
+static bool isSupportedTargetLayout(int32_t cicpSetup) {
+  if (cicp2geometry_is_custom_layout(cicpSetup)) {
+    return true;
+  }
+  return !((cicpSetup <= 0) || (cicpSetup == 8) || ((cicpSetup > 20) && (cicpSetup < 100)) ||
+           ((cicpSetup > 351) && (cicpSetup < 400)) || (cicpSetup > 422));
+}
+
 HANDLE_MPEGH_DECODER_CONTEXT mpeghdecoder_init(int32_t cicpSetup) {
+  return mpeghdecoder_initWithAllocator(cicpSetup, NULL);
+}
+
+HANDLE_MPEGH_DECODER_CONTEXT
+mpeghdecoder_initWithAllocator(int32_t cicpSetup, const MPEGH_DECODER_ALLOCATOR* allocator) {
   int dequeError = 0;
   AAC_DECODER_ERROR ErrorStatus;
   int numOutChannels = cicp2geometry_get_numChannels_from_cicp(cicpSetup);
+  FDK_ALLOCATOR fdkAllocator;
 
   /* Check for allowed target layouts */
-  if ((cicpSetup <= 0) || (cicpSetup == 8) || ((cicpSetup > 20) && (cicpSetup < 100)) ||
-      ((cicpSetup > 351) && (cicpSetup < 400)) || (cicpSetup > 422)) {
+  if (!isSupportedTargetLayout(cicpSetup)) {
     return NULL;
   }
 
+  if (getFdkAllocator(allocator, &fdkAllocator) != 0) {
+    return NULL;
+  }
+
+  /* The context itself is taken from the allocator, which is then kept in the context. */
+  AllocatorScope scope(&fdkAllocator);
+
   MPEGH_DECODER_CONTEXT* ctx = (MPEGH_DECODER_CONTEXT*)mpegh_FDKcalloc(1, sizeof(MPEGH_DECODER_CONTEXT));
   if (ctx == NULL) {
     goto bail;
   }
+  ctx->allocator = fdkAllocator;
+  mpegh_FDKsetAllocator(&ctx->allocator);
 
   ctx->maxDecoderOutputSamples = numOutChannels * MAX_NUM_FRAME_SAMPLES;
   ctx->tmpSamples = (INT_PCM*)mpegh_FDKcalloc(ctx->maxDecoderOutputSamples, sizeof(INT_PCM));
@@ -229,37 +485,7 @@ HANDLE_MPEGH_DECODER_CONTEXT mpeghdecoder_init(int32_t cicpSetup) {
   }
 
   // context variables initialization
-  dequeError = deque_alloc(&ctx->timestampInQueue, TIMESTAMP_ARRAY_SIZE, sizeof(uint64_t));
-  if (dequeError < 0) {
-    goto bail;
-  }
-  dequeError = deque_alloc(&ctx->timestampOutQueue, TIMESTAMP_ARRAY_SIZE, sizeof(uint64_t));
-  if (dequeError < 0) {
-    goto bail;
-  }
-  dequeError = deque_alloc(&ctx->auInfoQueue, TIMESTAMP_ARRAY_SIZE, sizeof(AUInfo));
-  if (dequeError < 0) {
-    goto bail;
-  }
-  dequeError = deque_alloc(&ctx->decodedSamplesQueue,
-                           TIMESTAMP_ARRAY_SIZE * ctx->maxDecoderOutputSamples, sizeof(INT_PCM));
-  if (dequeError < 0) {
-    goto bail;
-  }
-  dequeError = deque_alloc(&ctx->outputInfoQueue, TIMESTAMP_ARRAY_SIZE, sizeof(OutputInfo));
-  if (dequeError < 0) {
-    goto bail;
-  }
-  dequeError = deque_alloc(&ctx->outputSamplesQueue,
-                           TIMESTAMP_ARRAY_SIZE * ctx->maxDecoderOutputSamples, sizeof(INT_PCM));
-  if (dequeError < 0) {
-    goto bail;
-  }
-  dequeError = deque_alloc(&ctx->fadeoutIdxQueue, FADE_ARRAY_SIZE, sizeof(int));
-  if (dequeError < 0) {
-    goto bail;
-  }
-  dequeError = deque_alloc(&ctx->fadeinIdxQueue, FADE_ARRAY_SIZE, sizeof(int));
+  dequeError = allocQueues(ctx);
   if (dequeError < 0) {
     goto bail;
   }
@@ -270,6 +496,7 @@ HANDLE_MPEGH_DECODER_CONTEXT mpeghdecoder_init(int32_t cicpSetup) {
   ctx->zeroSignal = false;
 
   ctx->frameNumber = 0;
+  ctx->viewedSamples = 0;
 
   ctx->drcUpdate = true;
   /* Desired DRC values (set by user). Initialized to default values to be
@@ -295,14 +522,189 @@ bail:
   return NULL;
 }
 
+MPEGH_DECODER_ERROR
+mpeghdecoder_getRequiredMemory(int32_t cicpSetup, int32_t maxInputChannels, int32_t maxObjects,
+                               MPEGH_DECODER_MEMORY_INFO* info) {
+  UINT persistentMem = 0, scratchMem = 0;
+  size_t maxDecoderOutputSamples;
+  size_t wrapperMem;
+
+  if (info == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+
+  /* Check for allowed target layouts */
+  if (!isSupportedTargetLayout(cicpSetup)) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+
+  switch (aacDecoder_GetRequiredMemory(cicpSetup, maxInputChannels, maxObjects, &persistentMem,
+                                       &scratchMem)) {
+    case AAC_DEC_OK:
+      break;
+    case AAC_DEC_OUT_OF_MEMORY:
+      return MPEGH_DEC_OUT_OF_MEMORY;
+    default:
+      return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+
+  /* Context and queues allocated by mpeghdecoder_initWithAllocator(). */
+  maxDecoderOutputSamples = cicp2geometry_get_numChannels_from_cicp(cicpSetup) *
+                            MAX_NUM_FRAME_SAMPLES;
+  wrapperMem = ALGN_SIZE_EXTRES(sizeof(MPEGH_DECODER_CONTEXT));
+  wrapperMem += ALGN_SIZE_EXTRES(2 * TIMESTAMP_ARRAY_SIZE * maxDecoderOutputSamples *
+                                 sizeof(INT_PCM));
+  wrapperMem += 2 * ALGN_SIZE_EXTRES(TIMESTAMP_ARRAY_SIZE * sizeof(uint64_t));
+  wrapperMem += ALGN_SIZE_EXTRES(TIMESTAMP_ARRAY_SIZE * sizeof(AUInfo));
+  wrapperMem += ALGN_SIZE_EXTRES(TIMESTAMP_ARRAY_SIZE * sizeof(OutputInfo));
+  wrapperMem += 2 * ALGN_SIZE_EXTRES(FADE_ARRAY_SIZE * sizeof(int));
+
+  info->persistent = wrapperMem + persistentMem;
+  /* tmpSamples is scratch as well, see mpeghdecoder_setScratch(). */
+  info->scratch = scratchMem + ALGN_SIZE_EXTRES(maxDecoderOutputSamples * sizeof(INT_PCM));
+
+  return MPEGH_DEC_OK;
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_registerSpeakerLayout(const MPEGH_DECODER_SPEAKER* speakers,
+                                                       int32_t numSpeakers, int32_t* cicpSetup,
+                                                       MPEGH_DECODER_LAYOUT_INFO* info) {
+  AACDEC_SPEAKER aacSpeakers[MAX_NUM_OUTPUT_CHANNELS];
+  AACDEC_LAYOUT_SETUP_INFO setupInfo;
+  INT targetLayout;
+
+  if ((speakers == NULL) || (cicpSetup == NULL)) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if ((numSpeakers <= 0) || (numSpeakers > MAX_NUM_OUTPUT_CHANNELS)) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+
+  for (int i = 0; i < numSpeakers; i++) {
+    aacSpeakers[i].azimuth = speakers[i].azimuth;
+    aacSpeakers[i].elevation = speakers[i].elevation;
+    aacSpeakers[i].isLfe = speakers[i].isLfe ? 1 : 0;
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  if (aacDecoder_RegisterTargetLayout(aacSpeakers, numSpeakers, &targetLayout, &setupInfo) !=
+      AAC_DEC_OK) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+  std::chrono::steady_clock::duration setupTime = std::chrono::steady_clock::now() - start;
+
+  *cicpSetup = targetLayout;
+  if (info != NULL) {
+    info->numTriangles = (int32_t)setupInfo.numTriangles;
+    info->numGhostSpeakers = (int32_t)setupInfo.numGhostSpeakers;
+    info->isShared = (setupInfo.meshShared != 0);
+    info->setupTimeUs =
+        (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(setupTime).count();
+  }
+
+  return MPEGH_DEC_OK;
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_exportSpeakerMesh(int32_t cicpSetup, void* buffer,
+                                                   uint32_t* size) {
+  UINT meshSize;
+
+  if (size == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (!isSupportedTargetLayout(cicpSetup)) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+
+  meshSize = (UINT)*size;
+  switch (aacDecoder_ExportSpeakerMesh(cicpSetup, buffer, &meshSize)) {
+    case AAC_DEC_OK:
+      *size = (uint32_t)meshSize;
+      return MPEGH_DEC_OK;
+    case AAC_DEC_INVALID_PARAM:
+      *size = (uint32_t)meshSize;
+      return MPEGH_DEC_BUFFER_ERROR;
+    case AAC_DEC_OUT_OF_MEMORY:
+      return MPEGH_DEC_OUT_OF_MEMORY;
+    default:
+      return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_importSpeakerMesh(const void* buffer, uint32_t size) {
+  if (buffer == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+
+  if (aacDecoder_ImportSpeakerMesh(buffer, (UINT)size) != AAC_DEC_OK) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+
+  return MPEGH_DEC_OK;
+}
+
+HANDLE_MPEGH_DECODER_CONTEXT mpeghdecoder_addTargetLayout(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                                          int32_t cicpSetup) {
+  AAC_DECODER_ERROR ErrorStatus;
+  INT index;
+
+  if (hCtx == NULL || hCtx->parent != NULL || hCtx->numTargets >= AACDEC_MAX_RENDER_TARGETS ||
+      hCtx->signalsCallback != NULL) {
+    return NULL;
+  }
+  if (!isSupportedTargetLayout(cicpSetup)) {
+    return NULL;
+  }
+  AllocatorScope scope(&hCtx->allocator);
+
+  MPEGH_DECODER_CONTEXT* target =
+      (MPEGH_DECODER_CONTEXT*)mpegh_FDKcalloc(1, sizeof(MPEGH_DECODER_CONTEXT));
+  if (target == NULL) {
+    return NULL;
+  }
+  target->allocator = hCtx->allocator;
+  target->parent = hCtx;
+  target->cicpIndex = cicpSetup;
+  target->sampleRate = -1;
+  target->numberOfChannels = -1;
+
+  // the target layout only keeps the output queues, it is decoded by the core decoder of hCtx
+  target->maxDecoderOutputSamples =
+      cicp2geometry_get_numChannels_from_cicp(cicpSetup) * MAX_NUM_FRAME_SAMPLES;
+  target->tmpSamples = (INT_PCM*)mpegh_FDKcalloc(target->maxDecoderOutputSamples, sizeof(INT_PCM));
+  if (target->tmpSamples == NULL || allocQueues(target) < 0) {
+    destroyContext(target);
+    return NULL;
+  }
+
+  hCtx->targets[hCtx->numTargets++] = target;
+  ErrorStatus = aacDecoder_AddRenderTarget(hCtx->mpeghdec, cicpSetup, &index);
+  if (ErrorStatus == AAC_DEC_SET_PARAM_FAIL) {
+    // the core decoder is already configured, set it up again including the new target layout
+    if (restartDecoder(hCtx) == MPEGH_DEC_OK) {
+      return target;
+    }
+  } else if (ErrorStatus == AAC_DEC_OK) {
+    return target;
+  }
+
+  hCtx->targets[--hCtx->numTargets] = NULL;
+  destroyContext(target);
+  return NULL;
+}
+
 MPEGH_DECODER_ERROR mpeghdecoder_setMhaConfig(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
                                               const uint8_t* config, uint32_t configSize) {
   if (hCtx == NULL || config == NULL) {
     return MPEGH_DEC_NULLPTR_ERROR;
   }
+  if (hCtx->parent != NULL) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
   if (configSize == 0) {
     return MPEGH_DEC_UNSUPPORTED_PARAM;
   }
+  AllocatorScope scope(&hCtx->allocator);
   if (hCtx->mhaConfig != NULL) {
     mpegh_FDKfree(hCtx->mhaConfig);
     hCtx->mhaConfig = NULL;
@@ -319,20 +721,94 @@ MPEGH_DECODER_ERROR mpeghdecoder_setMhaConfig(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
   return retval;
 }
 
-void mpeghdecoder_destroy(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+MPEGH_DECODER_ERROR mpeghdecoder_setOutputFramePool(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                                   int32_t* const* frames, uint32_t numFrames,
+                                                   uint32_t frameLength) {
   if (hCtx == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (numFrames > 0 && frames == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (numFrames > 0 && frameLength < hCtx->maxDecoderOutputSamples) {
+    return MPEGH_DEC_BUFFER_ERROR;
+  }
+  // one frame can be partially taken over and one waits for the timestamp of the next MHAS
+  // frame, which may decode to two frames
+  if (numFrames > 0 && numFrames < 2 + MAX_FRAMES_PER_INPUT) {
+    return MPEGH_DEC_BUFFER_ERROR;
+  }
+  // the pool can only be exchanged while no decoded samples are pending
+  if (getNumDecodedSamples(hCtx) > 0) {
+    return MPEGH_DEC_BUFFER_ERROR;
+  }
+  for (uint32_t i = 0; i < numFrames; i++) {
+    if (frames[i] == NULL) {
+      return MPEGH_DEC_NULLPTR_ERROR;
+    }
+  }
+  AllocatorScope scope(&hCtx->allocator);
+
+  deque_free(&hCtx->poolFreeQueue);
+  deque_free(&hCtx->poolUsedQueue);
+  if (hCtx->outputPool != NULL) {
+    mpegh_FDKfree(hCtx->outputPool);
+    hCtx->outputPool = NULL;
+  }
+  hCtx->outputPoolSize = 0;
+  hCtx->numPooledSamples = 0;
+
+  if (numFrames == 0) {
+    // back to decoding into the internal sample queue
+    return MPEGH_DEC_OK;
+  }
+
+  hCtx->outputPool = (INT_PCM**)mpegh_FDKcalloc(numFrames, sizeof(INT_PCM*));
+  if (hCtx->outputPool == NULL) {
+    return MPEGH_DEC_OUT_OF_MEMORY;
+  }
+  if (deque_alloc(&hCtx->poolFreeQueue, numFrames, sizeof(unsigned int)) < 0 ||
+      deque_alloc(&hCtx->poolUsedQueue, numFrames, sizeof(PoolSlotInfo)) < 0) {
+    deque_free(&hCtx->poolFreeQueue);
+    deque_free(&hCtx->poolUsedQueue);
+    mpegh_FDKfree(hCtx->outputPool);
+    hCtx->outputPool = NULL;
+    return MPEGH_DEC_OUT_OF_MEMORY;
+  }
+  for (unsigned int slot = 0; slot < numFrames; slot++) {
+    hCtx->outputPool[slot] = (INT_PCM*)frames[slot];
+    deque_push_back(&hCtx->poolFreeQueue, &slot);
+  }
+  hCtx->outputPoolSize = numFrames;
+
+  return MPEGH_DEC_OK;
+}
+
+void mpeghdecoder_destroy(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+  // target layout instances are destroyed together with the instance driving them
+  if (hCtx == NULL || hCtx->parent != NULL) {
     return;
   }
 
+  for (int i = 0; i < hCtx->numTargets; i++) {
+    destroyContext(hCtx->targets[i]);
+    hCtx->targets[i] = NULL;
+  }
+  hCtx->numTargets = 0;
+
+  destroyContext(hCtx);
+}
+
+void destroyContext(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
   if (hCtx->mhaConfig != NULL) {
     mpegh_FDKfree(hCtx->mhaConfig);
     hCtx->mhaConfig = NULL;
   }
 
-  if (hCtx->tmpSamples != NULL) {
+  if (hCtx->tmpSamples != NULL && hCtx->scratch == NULL) {
     mpegh_FDKfree(hCtx->tmpSamples);
-    hCtx->tmpSamples = NULL;
   }
+  hCtx->tmpSamples = NULL;
 
   // destroy the MPEG-H decoder instance
   if (hCtx->mpeghdec != NULL) {
@@ -340,39 +816,346 @@ void mpeghdecoder_destroy(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
     hCtx->mpeghdec = NULL;
   }
 
-  // free memory for queues
-  deque_free(&hCtx->timestampInQueue);
-  deque_free(&hCtx->timestampOutQueue);
-  deque_free(&hCtx->auInfoQueue);
-  deque_free(&hCtx->decodedSamplesQueue);
-  deque_free(&hCtx->outputInfoQueue);
-  deque_free(&hCtx->outputSamplesQueue);
-  deque_free(&hCtx->fadeoutIdxQueue);
-  deque_free(&hCtx->fadeinIdxQueue);
+  // free memory for queues
+  deque_free(&hCtx->timestampInQueue);
+  deque_free(&hCtx->timestampOutQueue);
+  deque_free(&hCtx->auInfoQueue);
+  deque_free(&hCtx->outputInfoQueue);
+  deque_free(&hCtx->outputSamplesQueue);
+  deque_free(&hCtx->fadeoutIdxQueue);
+  deque_free(&hCtx->fadeinIdxQueue);
+
+  deque_free(&hCtx->poolFreeQueue);
+  deque_free(&hCtx->poolUsedQueue);
+  if (hCtx->outputPool != NULL) {
+    mpegh_FDKfree(hCtx->outputPool);
+    hCtx->outputPool = NULL;
+  }
+
+  if (hCtx->signalsInfo != NULL) {
+    mpegh_FDKfree(hCtx->signalsInfo);
+    hCtx->signalsInfo = NULL;
+  }
+
+  mpegh_FDKfree(hCtx);
+  hCtx = NULL;
+}
+
+HANDLE_MPEGH_DECODER_SCRATCH
+mpeghdecoder_createScratch(const MPEGH_DECODER_ALLOCATOR* allocator) {
+  FDK_ALLOCATOR fdkAllocator;
+
+  if (getFdkAllocator(allocator, &fdkAllocator) != 0) {
+    return NULL;
+  }
+  AllocatorScope scope(&fdkAllocator);
+
+  MPEGH_DECODER_SCRATCH* scratch =
+      (MPEGH_DECODER_SCRATCH*)mpegh_FDKcalloc(1, sizeof(MPEGH_DECODER_SCRATCH));
+  if (scratch == NULL) {
+    return NULL;
+  }
+  scratch->tmpSamples =
+      (INT_PCM*)mpegh_FDKcalloc(MAX_NUM_OUTPUT_CHANNELS * MAX_NUM_FRAME_SAMPLES, sizeof(INT_PCM));
+  scratch->hCoreScratch = aacDecoder_OpenScratch();
+  if (scratch->tmpSamples == NULL || scratch->hCoreScratch == NULL) {
+    mpeghdecoder_destroyScratch(scratch);
+    return NULL;
+  }
+
+  return scratch;
+}
+
+void mpeghdecoder_destroyScratch(HANDLE_MPEGH_DECODER_SCRATCH hScratch) {
+  if (hScratch == NULL) {
+    return;
+  }
+
+  aacDecoder_CloseScratch(hScratch->hCoreScratch);
+  if (hScratch->tmpSamples != NULL) {
+    mpegh_FDKfree(hScratch->tmpSamples);
+  }
+  mpegh_FDKfree(hScratch);
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_setScratch(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                            HANDLE_MPEGH_DECODER_SCRATCH hScratch) {
+  if (hCtx == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (hCtx->parent != NULL) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+  if (hScratch == hCtx->scratch) {
+    return MPEGH_DEC_OK;
+  }
+  AllocatorScope scope(&hCtx->allocator);
+
+  if (hScratch != NULL) {
+    if (aacDecoder_SetScratch(hCtx->mpeghdec, hScratch->hCoreScratch) != AAC_DEC_OK) {
+      return MPEGH_DEC_PROCESS_ERROR;
+    }
+    if (hCtx->scratch == NULL) {
+      mpegh_FDKfree(hCtx->tmpSamples);
+    }
+    hCtx->tmpSamples = hScratch->tmpSamples;
+  } else {
+    // re-allocate the work buffers which were released while sharing
+    INT_PCM* tmpSamples =
+        (INT_PCM*)mpegh_FDKcalloc(hCtx->maxDecoderOutputSamples, sizeof(INT_PCM));
+    if (tmpSamples == NULL) {
+      return MPEGH_DEC_OUT_OF_MEMORY;
+    }
+    if (aacDecoder_SetScratch(hCtx->mpeghdec, NULL) != AAC_DEC_OK) {
+      mpegh_FDKfree(tmpSamples);
+      return MPEGH_DEC_OUT_OF_MEMORY;
+    }
+    hCtx->tmpSamples = tmpSamples;
+  }
+  hCtx->scratch = hScratch;
+
+  return MPEGH_DEC_OK;
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_setTaskExecutor(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                                 const MPEGH_DECODER_TASK_EXECUTOR* executor) {
+  if (hCtx == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (hCtx->parent != NULL) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+  AllocatorScope scope(&hCtx->allocator);
+
+  AACDEC_TASK_EXECUTOR coreExecutor = {NULL, NULL, 1};
+  if (executor != NULL) {
+    // int32_t and INT are the same type, so the task signatures match
+    coreExecutor.execute = (void (*)(void*, void (*)(void*, INT), void*, INT))executor->execute;
+    coreExecutor.context = executor->context;
+    coreExecutor.maxWorkers = executor->maxWorkers;
+  }
+
+  switch (aacDecoder_SetTaskExecutor(hCtx->mpeghdec, &coreExecutor)) {
+    case AAC_DEC_OK:
+      hCtx->executor = coreExecutor;
+      return MPEGH_DEC_OK;
+    case AAC_DEC_OUT_OF_MEMORY:
+      return MPEGH_DEC_OUT_OF_MEMORY;
+    default:
+      return MPEGH_DEC_PROCESS_ERROR;
+  }
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_setPipelinedDecoding(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                                      int enable) {
+  if (hCtx == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (hCtx->parent != NULL) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+  AllocatorScope scope(&hCtx->allocator);
+
+  switch (aacDecoder_SetParam(hCtx->mpeghdec, AAC_PIPELINED_DECODE, enable ? 1 : 0)) {
+    case AAC_DEC_OK:
+      hCtx->pipelinedDecoding = enable ? 1 : 0;
+      return MPEGH_DEC_OK;
+    case AAC_DEC_OUT_OF_MEMORY:
+      return MPEGH_DEC_OUT_OF_MEMORY;
+    default:
+      return MPEGH_DEC_PROCESS_ERROR;
+  }
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_setSignalsCallback(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                                    MPEGH_DECODER_SIGNALS_CALLBACK callback,
+                                                    void* context) {
+  if (hCtx == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (hCtx->parent != NULL || hCtx->numTargets > 0) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+  if (hCtx->viewedSamples > 0) {
+    return MPEGH_DEC_BUFFER_ERROR;
+  }
+  AllocatorScope scope(&hCtx->allocator);
+
+  if (callback != NULL && hCtx->signalsInfo == NULL) {
+    hCtx->signalsInfo = (SignalsInfo*)mpegh_FDKcalloc(1, sizeof(SignalsInfo));
+    if (hCtx->signalsInfo == NULL) {
+      return MPEGH_DEC_OUT_OF_MEMORY;
+    }
+  }
+
+  switch (aacDecoder_SetParam(hCtx->mpeghdec, AAC_SIGNAL_EXPORT, callback != NULL ? 1 : 0)) {
+    case AAC_DEC_OK:
+      break;
+    case AAC_DEC_OUT_OF_MEMORY:
+      return MPEGH_DEC_OUT_OF_MEMORY;
+    default:
+      // not available together with pipelined decoding
+      return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+
+  if (callback == NULL && hCtx->signalsInfo != NULL) {
+    mpegh_FDKfree(hCtx->signalsInfo);
+    hCtx->signalsInfo = NULL;
+  }
+  // the output configuration changes between rendered samples and exported signals, the samples
+  // pending for mpeghdecoder_getSamples() are dropped
+  if ((callback != NULL) != (hCtx->signalsCallback != NULL)) {
+    resetOutput(hCtx);
+  }
+  hCtx->signalsCallback = callback;
+  hCtx->signalsContext = context;
+
+  return MPEGH_DEC_OK;
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, const uint8_t* inData,
+                                         uint32_t inLength, uint64_t timestamp) {
+  if (hCtx == NULL || inData == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (inLength == 0) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+  return decodeInput(hCtx, inData, inLength, NULL, 0, timestamp);
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_processSpans(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                              const MPEGH_DECODER_SPAN* spans, uint32_t numSpans,
+                                              uint64_t timestamp) {
+  AACDEC_SPAN coreSpans[AACDEC_MAX_SPANS];
+  uint32_t inLength = 0;
+
+  if (hCtx == NULL || spans == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (numSpans == 0 || numSpans > AACDEC_MAX_SPANS) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+  for (uint32_t i = 0; i < numSpans; i++) {
+    if (spans[i].data == NULL && spans[i].length > 0) {
+      return MPEGH_DEC_NULLPTR_ERROR;
+    }
+    if (spans[i].capacity != 0 && spans[i].capacity < spans[i].length) {
+      return MPEGH_DEC_UNSUPPORTED_PARAM;
+    }
+    coreSpans[i].pData = spans[i].data;
+    coreSpans[i].size = spans[i].length;
+    coreSpans[i].capacity = spans[i].capacity;
+    inLength += spans[i].length;
+  }
+  if (inLength == 0) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+
+  MPEGH_DECODER_ERROR retval = decodeInput(hCtx, NULL, inLength, coreSpans, numSpans, timestamp);
+
+  // the spans are only borrowed during this call, drop any data the decoder did not consume
+  if (hCtx->parent == NULL && hCtx->mpeghdec != NULL) {
+    aacDecoder_FillSpans(hCtx->mpeghdec, NULL, 0);
+  }
+  return retval;
+}
+
+MPEGH_DECODER_ERROR mpeghdecoder_scanMhas(const uint8_t* data, uint32_t length,
+                                          MPEGH_DECODER_MHAS_PACKET* packets, uint32_t maxPackets,
+                                          uint32_t* numPackets, uint32_t* bytesScanned) {
+  TPDEC_MHAS_PACKET index[64];
+  uint32_t offset = 0, count = 0;
+  TRANSPORTDEC_ERROR err = TRANSPORTDEC_OK;
+
+  if (data == NULL || packets == NULL || numPackets == NULL || bytesScanned == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+
+  // scan in chunks of index entries converted to the public layout
+  while (count < maxPackets && err == TRANSPORTDEC_OK) {
+    UINT chunkPackets = 0, chunkBytes = 0;
+    UINT maxChunkPackets = maxPackets - count;
+    if (maxChunkPackets > sizeof(index) / sizeof(index[0])) {
+      maxChunkPackets = sizeof(index) / sizeof(index[0]);
+    }
+    err = transportDec_ScanMhas(data + offset, length - offset, index, maxChunkPackets,
+                                &chunkPackets, &chunkBytes);
+    for (UINT i = 0; i < chunkPackets; i++) {
+      MPEGH_DECODER_MHAS_PACKET* packet = &packets[count + i];
+      packet->offset = offset + index[i].offset;
+      packet->size = index[i].size;
+      packet->payloadLength = index[i].payloadLength;
+      packet->label = index[i].label;
+      packet->type = index[i].type;
+      packet->isRap = index[i].isRap != 0;
+    }
+    count += chunkPackets;
+    offset += chunkBytes;
+    if (chunkPackets < maxChunkPackets) {
+      break;
+    }
+  }
+  *numPackets = count;
+  *bytesScanned = offset;
 
-  mpegh_FDKfree(hCtx);
-  hCtx = NULL;
+  switch (err) {
+    case TRANSPORTDEC_OK:
+      return MPEGH_DEC_OK;
+    case TRANSPORTDEC_NOT_ENOUGH_BITS:
+      return MPEGH_DEC_FEED_DATA;
+    case TRANSPORTDEC_INVALID_PARAMETER:
+      return MPEGH_DEC_UNSUPPORTED_PARAM;
+    default:
+      return MPEGH_DEC_PROCESS_ERROR;
+  }
 }
 
-MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, const uint8_t* inData,
-                                         uint32_t inLength, uint64_t timestamp) {
-  if (hCtx == NULL || inData == NULL) {
+MPEGH_DECODER_ERROR mpeghdecoder_processPackets(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                                const uint8_t* data,
+                                                const MPEGH_DECODER_MHAS_PACKET* packets,
+                                                uint32_t numPackets, uint64_t timestamp) {
+  MPEGH_DECODER_SPAN spans[AACDEC_MAX_SPANS];
+  uint32_t numSpans = 0;
+
+  if (hCtx == NULL || data == NULL || packets == NULL) {
     return MPEGH_DEC_NULLPTR_ERROR;
   }
-  if (inLength == 0) {
-    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  // merge adjacent packets into one span
+  for (uint32_t i = 0; i < numPackets; i++) {
+    if (numSpans > 0 &&
+        spans[numSpans - 1].data + spans[numSpans - 1].length == data + packets[i].offset) {
+      spans[numSpans - 1].length += packets[i].size;
+      continue;
+    }
+    if (numSpans == AACDEC_MAX_SPANS) {
+      return MPEGH_DEC_UNSUPPORTED_PARAM;
+    }
+    spans[numSpans].data = data + packets[i].offset;
+    spans[numSpans].length = packets[i].size;
+    spans[numSpans].capacity = 0;
+    numSpans++;
   }
-  if (deque_full(&hCtx->timestampInQueue)) {
-    return MPEGH_DEC_BUFFER_ERROR;
+  return mpeghdecoder_processSpans(hCtx, spans, numSpans, timestamp);
+}
+
+MPEGH_DECODER_ERROR decodeInput(HANDLE_MPEGH_DECODER_CONTEXT hCtx, const uint8_t* inData,
+                                uint32_t inLength, const AACDEC_SPAN* spans, uint32_t numSpans,
+                                uint64_t timestamp) {
+  if (hCtx->parent != NULL) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
   }
-  if (deque_space(&hCtx->decodedSamplesQueue) < hCtx->maxDecoderOutputSamples) {
+  // reserve space for all frames the MHAS frame can decode to, none of them may get lost
+  if (!hasInputSpace(hCtx, MAX_FRAMES_PER_INPUT)) {
     return MPEGH_DEC_BUFFER_ERROR;
   }
+  AllocatorScope scope(&hCtx->allocator);
 
   bool isDone = false;
   unsigned int validBytes = inLength;
   bool decodingSuccessful = false;
-  bool doConceal = false;
+  bool doConceal = hCtx->concealPending;
+  uint64_t signalsPts = timestamp;
 
   // update the DRC settings if necessary
   updateDrcSettings(hCtx);
@@ -381,9 +1164,11 @@ MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, cons
 
   // store the presentation timestamp associated with this MHAS frame; two
   // consecutive timestamps have to differ!
+  bool timestampPushed = false;
   if (deque_empty(&hCtx->timestampInQueue) ||
       *(uint64_t*)deque_back(&hCtx->timestampInQueue) != timestamp) {
-    deque_push_back(&hCtx->timestampInQueue, &timestamp);
+    pushTimestamp(hCtx, timestamp);
+    timestampPushed = true;
   }
 
   if (deque_size(&hCtx->timestampInQueue) > 1) {
@@ -395,6 +1180,10 @@ MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, cons
 
     if (duration > THRESHOLD) {
       MPEGH_DECODER_ERROR retval = restartDecoder(hCtx);
+      if (retval == MPEGH_DEC_BUFFER_ERROR && timestampPushed) {
+        // nothing was restarted, so the frame can be passed again once the view is released
+        popTimestamp(hCtx, true);
+      }
       if (retval != MPEGH_DEC_OK) {
         return retval;
       }
@@ -403,7 +1192,7 @@ MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, cons
       // store the presentation timestamp associated with this MHAS frame; two
       // consecutive timestamps have to differ! restartDecoder also cleared all
       // queues!
-      deque_push_back(&hCtx->timestampInQueue, &timestamp);
+      pushTimestamp(hCtx, timestamp);
     }
   }
 
@@ -411,26 +1200,38 @@ MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, cons
     bool concealed = false;
     isDone = false;
 
-    // pass the MHAS frame to the MPEG-H decoder
-    AAC_DECODER_ERROR err =
-        aacDecoder_Fill(hCtx->mpeghdec, &inData, (uint32_t*)&inLength, &validBytes);
+    // pass the MHAS frame to the MPEG-H decoder, spans hold it completely
+    AAC_DECODER_ERROR err;
+    if (spans != NULL) {
+      err = aacDecoder_FillSpans(hCtx->mpeghdec, spans, numSpans);
+      validBytes = 0;
+    } else {
+      err = aacDecoder_Fill(hCtx->mpeghdec, &inData, (uint32_t*)&inLength, &validBytes);
+    }
 
     if (err != AAC_DEC_OK) {
-      deque_pop_back(&hCtx->timestampInQueue);  // remove timestamp as it was not
-                                                // possible to fill in current AU
+      popTimestamp(hCtx, true);  // remove timestamp as it was not
+                                 // possible to fill in current AU
       return MPEGH_DEC_PROCESS_ERROR;
     }
 
     while (!isDone) {
+      if (!hasDecodeSpace(hCtx, 1)) {
+        // the input held more frames than reserved, they stay buffered for the next call
+        hCtx->concealPending = doConceal;
+        return (validBytes == 0) ? MPEGH_DEC_OK : MPEGH_DEC_BUFFER_ERROR;
+      }
       // run FDK decoding process
       UINT flags = 0;
       if (doConceal) {  // force conceal of the decoder
         concealed = true;
         flags |= AACDEC_CONCEAL;
       }
-      err = aacDecoder_DecodeFrame(hCtx->mpeghdec, hCtx->tmpSamples, hCtx->maxDecoderOutputSamples,
-                                   flags);
+      setTargetBuffers(hCtx);
+      err = aacDecoder_DecodeFrame(hCtx->mpeghdec, getDecodeBuffer(hCtx),
+                                   hCtx->maxDecoderOutputSamples, flags);
       doConceal = false;  // do not conceal anymore
+      hCtx->concealPending = false;
 
       switch (err) {
         case AAC_DEC_OK:
@@ -438,7 +1239,9 @@ MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, cons
           if (p_si != NULL) {
             decodingSuccessful = true;
 
-            if (hCtx->sampleRate == -1 && hCtx->numberOfChannels == -1) {
+            if ((hCtx->sampleRate == -1 && hCtx->numberOfChannels == -1) ||
+                hCtx->signalsCallback != NULL) {
+              // exported signals follow the active signal groups of the audio scene
               hCtx->sampleRate = p_si->sampleRate;
               hCtx->numberOfChannels = p_si->numChannels;
             } else if (hCtx->sampleRate != p_si->sampleRate ||
@@ -463,7 +1266,7 @@ MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, cons
             // The decoder has no valid output configuration.
             // Remove the queued presentation timestamp until first frame decoded
             // successfully and sampling rate and number of channels is known.
-            deque_pop_front(&hCtx->timestampInQueue);
+            popTimestamp(hCtx, false);
             isDone = true;
             break;
           }
@@ -482,6 +1285,10 @@ MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, cons
           break;
 
         case AAC_DEC_INTERMEDIATE_OK:
+          if (p_si != NULL && p_si->numPendingFrames > 0) {
+            // the frame is held back by pipelined decoding and output by the next call
+            decodingSuccessful = true;
+          }
           err = AAC_DEC_OK;
           break;
 
@@ -492,19 +1299,24 @@ MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, cons
             concealed = true;
           } else {
             decodingSuccessful = false;
-            deque_pop_front(&hCtx->timestampInQueue);
+            popTimestamp(hCtx, false);
             isDone = true;
           }
           break;
       }  // end of switch(err)
 
       // if the output is valid, add the PCM samples to the sample queue
-      if (IS_OUTPUT_VALID(err)) {
+      if (IS_OUTPUT_VALID(err) && p_si != NULL && hCtx->signalsCallback != NULL) {
+        // hand the signals to the callback instead, the frames of one call follow its timestamp
+        if (p_si->frameSize > 0 && p_si->sampleRate > 0) {
+          outputSignals(hCtx, signalsPts, concealed);
+          signalsPts += (uint64_t)((double)p_si->frameSize * 1e9 / p_si->sampleRate + 0.5);
+        }
+      } else if (IS_OUTPUT_VALID(err)) {
         if (p_si != NULL) {
           // add decoded PCM samples to the sample queue
           if (p_si->frameSize > 0) {
-            deque_bulk_push_back(&hCtx->decodedSamplesQueue, hCtx->tmpSamples,
-                                 p_si->frameSize * p_si->numChannels);
+            pushDecodedSamples(hCtx, p_si->frameSize * p_si->numChannels);
           }
           // add the MPEG-H AU size info received from decoder
           if (p_si->mpeghAUSize > 0) {
@@ -515,10 +1327,22 @@ MPEGH_DECODER_ERROR mpeghdecoder_process(HANDLE_MPEGH_DECODER_CONTEXT hCtx, cons
 
             deque_push_back(&hCtx->auInfoQueue, &auInfo);
           }
+          MPEGH_DECODER_ERROR retval = pushTargetSamples(hCtx, p_si, concealed);
+          if (retval != MPEGH_DEC_OK) {
+            return retval;
+          }
         }
       }
     }  // end of while(!isDone)
   }    // end of while(validBytes != 0)
+
+  // exported signals take their timestamp right away, only keep the newest one for the
+  // discontinuity check
+  if (hCtx->signalsCallback != NULL) {
+    while (deque_size(&hCtx->timestampInQueue) > 1) {
+      popTimestamp(hCtx, false);
+    }
+  }
   return MPEGH_DEC_OK;
 }
 
@@ -529,19 +1353,73 @@ MPEGH_DECODER_ERROR mpeghdecoder_processTimescale(HANDLE_MPEGH_DECODER_CONTEXT h
   return mpeghdecoder_process(hCtx, inData, inLength, timestampNs);
 }
 
-MPEGH_DECODER_ERROR
-mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uint32_t outLength,
-                        MPEGH_DECODER_OUTPUT_INFO* outInfo) {
-  if (hCtx == NULL || outData == NULL || outInfo == NULL) {
-    return MPEGH_DEC_NULLPTR_ERROR;
+void outputSignals(HANDLE_MPEGH_DECODER_CONTEXT hCtx, uint64_t pts, bool concealed) {
+  CStreamInfo* p_si = aacDecoder_GetStreamInfo(hCtx->mpeghdec);
+  AACDEC_SIGNALS coreSignals;
+  MPEGH_DECODER_SIGNALS signals;
+  SignalsInfo* info = hCtx->signalsInfo;
+  int i;
+
+  if (p_si == NULL || aacDecoder_GetSignals(hCtx->mpeghdec, &coreSignals) != AAC_DEC_OK ||
+      coreSignals.numSignals == 0) {
+    return;
   }
-  if (outLength < hCtx->maxDecoderOutputSamples) {
-    return MPEGH_DEC_BUFFER_ERROR;
+
+  signals.pts = pts;
+  signals.sampleRate = p_si->sampleRate;
+  signals.numSamplesPerSignal = p_si->frameSize;
+  signals.delay = coreSignals.delay;
+  signals.headroom = coreSignals.headroom;
+  signals.isConcealed = concealed;
+
+  // the samples are not copied, only their descriptions are converted
+  signals.numSignals = (coreSignals.numSignals < MAX_NUM_SIGNALS) ? coreSignals.numSignals
+                                                                  : MAX_NUM_SIGNALS;
+  for (i = 0; i < signals.numSignals; i++) {
+    info->signal[i].samples = coreSignals.pSignals[i].pSamples;
+    info->signal[i].group = coreSignals.pSignals[i].group;
+    info->signal[i].azimuth = coreSignals.pSignals[i].azimuth;
+    info->signal[i].elevation = coreSignals.pSignals[i].elevation;
+    info->signal[i].isLfe = coreSignals.pSignals[i].isLfe;
+  }
+  signals.signals = info->signal;
+
+  signals.numGroups = (coreSignals.numGroups < MAX_NUM_SIGNAL_GROUPS) ? coreSignals.numGroups
+                                                                      : MAX_NUM_SIGNAL_GROUPS;
+  for (i = 0; i < signals.numGroups; i++) {
+    info->group[i].type = coreSignals.pGroups[i].type;
+    info->group[i].cicpLayout = coreSignals.pGroups[i].layout;
+    info->group[i].firstSignal = coreSignals.pGroups[i].firstSignal;
+    info->group[i].numSignals = coreSignals.pGroups[i].numSignals;
   }
+  signals.groups = info->group;
+
+  signals.numObjectMetadata = (coreSignals.numObjectMetadata < MAX_NUM_OBJECT_METADATA)
+                                  ? coreSignals.numObjectMetadata
+                                  : MAX_NUM_OBJECT_METADATA;
+  for (i = 0; i < signals.numObjectMetadata; i++) {
+    const AACDEC_OBJECT_METADATA* md = &coreSignals.pObjectMetadata[i];
+    info->objectMetadata[i].sampleOffset = md->sampleOffset;
+    info->objectMetadata[i].signal = md->signal;
+    info->objectMetadata[i].azimuth = md->azimuth;
+    info->objectMetadata[i].elevation = md->elevation;
+    info->objectMetadata[i].radius = md->radius;
+    info->objectMetadata[i].gain = md->gain;
+    info->objectMetadata[i].spreadWidth = md->spreadWidth;
+    info->objectMetadata[i].spreadHeight = md->spreadHeight;
+    info->objectMetadata[i].spreadDepth = md->spreadDepth;
+  }
+  signals.objectMetadata = info->objectMetadata;
+
+  hCtx->signalsCallback(hCtx->signalsContext, &signals);
+}
+
+MPEGH_DECODER_ERROR prepareOutputFrame(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
+                                       unsigned int* numOutputSamples,
+                                       MPEGH_DECODER_OUTPUT_INFO* outInfo) {
   int durationSamples;
   int outNumSamples = 0;
   uint64_t duration = 0;
-  MPEGH_DECODER_ERROR retVal = MPEGH_DEC_FEED_DATA;
   int i;
   unsigned int k;
 
@@ -570,7 +1448,7 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
         ((AUInfo*)deque_front(&hCtx->auInfoQueue))->auSize * hCtx->numberOfChannels;
 
     if (numDecodedSamples > 0 &&
-        deque_size(&hCtx->decodedSamplesQueue) >= (unsigned int)numDecodedSamples) {
+        getNumDecodedSamples(hCtx) >= (unsigned int)numDecodedSamples) {
       // enough samples available
       uint64_t pts = *(uint64_t*)deque_pop_front(&hCtx->timestampInQueue);
       AUInfo* info = (AUInfo*)deque_pop_front(&hCtx->auInfoQueue);
@@ -597,7 +1475,7 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
       if (hCtx->zeroSignal && !concealed) {
         // the previous samples were zero and now there is an unconcealed signal
         // available -> fade in set fadein start index
-        unsigned int fadeInLength = deque_size(&hCtx->outputSamplesQueue);
+        unsigned int fadeInLength = getNumOutputSamples(hCtx);
         deque_push_back(&hCtx->fadeinIdxQueue, &fadeInLength);
         hCtx->zeroSignal = false;
       }
@@ -607,7 +1485,7 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
         if (numSamplesToAdd > 0) {
           // we need to add zero samples -> fade out
           // set fadeout start index
-          int idx = (int)deque_size(&hCtx->outputSamplesQueue) + numDecodedSamples - fadelen;
+          int idx = (int)getNumOutputSamples(hCtx) + numDecodedSamples - fadelen;
           hCtx->zeroSignal = true;
           if (idx >= 0) {
             deque_push_back(&hCtx->fadeoutIdxQueue, &idx);
@@ -616,7 +1494,7 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
         if (numSamplesToRemove > 0) {
           // we need to remove samples -> fade out
           // set fadeout start index
-          int idx = (int)deque_size(&hCtx->outputSamplesQueue) - 1 + numDecodedSamples -
+          int idx = (int)getNumOutputSamples(hCtx) - 1 + numDecodedSamples -
                     numSamplesToRemove - fadelen;
           if (idx >= 0) {
             deque_push_back(&hCtx->fadeoutIdxQueue, &idx);
@@ -624,17 +1502,13 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
         }
       }
 
-      // copy from sample queue to outputSamplesQueue
+      // take the samples over into the output frames
       if (numDecodedSamples > 0) {
         unsigned int samplesToCopy = numDecodedSamples - numSamplesToRemove;
-        deque_bulk_pop_front_copy(&hCtx->decodedSamplesQueue, hCtx->tmpSamples, numDecodedSamples);
-        if (concealed && hCtx->zeroSignal) {
-          // the previous samples were zero and the current signal is concealed
-          // -> replace samples with zero samples
-          deque_bulk_push_back_zeros(&hCtx->outputSamplesQueue, samplesToCopy);
-        } else {
-          deque_bulk_push_back(&hCtx->outputSamplesQueue, hCtx->tmpSamples, samplesToCopy);
-        }
+        // if the previous samples were zero and the current signal is concealed
+        // -> replace samples with zero samples
+        consumeDecodedSamples(hCtx, samplesToCopy, concealed && hCtx->zeroSignal);
+        dropDecodedSamples(hCtx, numSamplesToRemove);
       }
 
       // adjust the number of decoded samples after removing samples
@@ -642,7 +1516,7 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
 
       if (numSamplesToAdd > 0) {
         // add zero samples
-        deque_bulk_push_back_zeros(&hCtx->outputSamplesQueue, numSamplesToAdd);
+        addZeroSamples(hCtx, numSamplesToAdd);
         // adjust the number of decoded samples after adding zero samples
         numDecodedSamples += numSamplesToAdd;
       }
@@ -654,14 +1528,14 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
       decInfo.outputLoudness = outputLoudnessTmp;
       deque_push_back(&hCtx->outputInfoQueue, &decInfo);
 
-    }  // end of if (deque_size(&hCtx->decodedSamplesQueue) >= numDecodedSamples)
+    }  // end of if (getNumDecodedSamples(hCtx) >= numDecodedSamples)
   }    // end of if (!deque_empty(&hCtx->auInfoQueue))
 
   // check if enough samples to output are available and apply fadein/fadeout if
   // necessary
   if (!deque_empty(&hCtx->outputInfoQueue)) {
     OutputInfo* info = (OutputInfo*)deque_front(&hCtx->outputInfoQueue);
-    if (info->size > 0 && info->size > (int)deque_size(&hCtx->outputSamplesQueue)) {
+    if (info->size > 0 && info->size > (int)getNumOutputSamples(hCtx)) {
       // not enough samples available to output a frame
       return MPEGH_DEC_FEED_DATA;
     }
@@ -672,7 +1546,7 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
     int numIndexesToRemove = 0;
     for (k = 0; k < deque_size(&hCtx->fadeoutIdxQueue); k++) {
       unsigned int index = *(unsigned int*)deque_front(&hCtx->fadeoutIdxQueue);
-      if (index + fadelen < deque_size(&hCtx->outputSamplesQueue)) {
+      if (index + fadelen < getNumOutputSamples(hCtx)) {
         for (i = 0; i < fadelen; i++) {
           fade((int32_t*)deque_at(&hCtx->outputSamplesQueue, index + i), i, fadelen, false);
         }
@@ -686,7 +1560,7 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
     numIndexesToRemove = 0;
     for (k = 0; k < deque_size(&hCtx->fadeinIdxQueue); k++) {
       unsigned int index = *(unsigned int*)deque_front(&hCtx->fadeinIdxQueue);
-      if (index + fadelen < deque_size(&hCtx->outputSamplesQueue)) {
+      if (index + fadelen < getNumOutputSamples(hCtx)) {
         for (i = 0; i < fadelen; i++) {
           fade((int32_t*)deque_at(&hCtx->outputSamplesQueue, index + i), i, fadelen, true);
         }
@@ -714,89 +1588,196 @@ mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uin
       info = (OutputInfo*)deque_pop_front(&hCtx->outputInfoQueue);
     }
 
-    // copy samples to outData
-    deque_bulk_pop_front_copy(&hCtx->outputSamplesQueue, outData, outNumSamples);
-
-    // adjust fadein indexes
-    int size = deque_size(&hCtx->fadeinIdxQueue);
-    for (i = 0; i < size; i++) {
-      int idx = *(int*)deque_pop_front(&hCtx->fadeinIdxQueue);
-      idx -= outNumSamples;
-      if (idx >= 0) {
-        deque_push_back(&hCtx->fadeinIdxQueue, &idx);
-      }
-    }
-
-    // adjust fadeout indexes
-    size = deque_size(&hCtx->fadeoutIdxQueue);
-    for (i = 0; i < size; i++) {
-      int idx = *(int*)deque_pop_front(&hCtx->fadeoutIdxQueue);
-      idx -= outNumSamples;
-      if (idx >= 0) {
-        deque_push_back(&hCtx->fadeoutIdxQueue, &idx);
-      }
-    }
-
     outInfo->numSamplesPerChannel = outNumSamples / outInfo->numChannels;
     outInfo->pts = pts;
     outInfo->ticks = (uint64_t)((double)pts * outInfo->sampleRate / 1e9 + 0.5);
     outInfo->loudness = info->outputLoudness;
     outInfo->isConcealed = info->concealed;
 
-    retVal = MPEGH_DEC_OK;
+    *numOutputSamples = outNumSamples;
+    return MPEGH_DEC_OK;
   }  // end of if (!deque_empty(&hCtx->outputInfoQueue))
 
+  return MPEGH_DEC_FEED_DATA;
+}
+
+void releaseOutputFrame(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numOutputSamples,
+                        int32_t* outData) {
+  int i;
+  int outNumSamples = (int)numOutputSamples;
+
+  if (outData != NULL) {
+    // copy samples to outData
+    deque_bulk_pop_front_copy(&hCtx->outputSamplesQueue, outData, numOutputSamples);
+  } else {
+    deque_bulk_pop_front(&hCtx->outputSamplesQueue, numOutputSamples);
+  }
+
+  // adjust fadein indexes
+  int size = deque_size(&hCtx->fadeinIdxQueue);
+  for (i = 0; i < size; i++) {
+    int idx = *(int*)deque_pop_front(&hCtx->fadeinIdxQueue);
+    idx -= outNumSamples;
+    if (idx >= 0) {
+      deque_push_back(&hCtx->fadeinIdxQueue, &idx);
+    }
+  }
+
+  // adjust fadeout indexes
+  size = deque_size(&hCtx->fadeoutIdxQueue);
+  for (i = 0; i < size; i++) {
+    int idx = *(int*)deque_pop_front(&hCtx->fadeoutIdxQueue);
+    idx -= outNumSamples;
+    if (idx >= 0) {
+      deque_push_back(&hCtx->fadeoutIdxQueue, &idx);
+    }
+  }
+}
+
+MPEGH_DECODER_ERROR
+mpeghdecoder_getSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, int32_t* outData, uint32_t outLength,
+                        MPEGH_DECODER_OUTPUT_INFO* outInfo) {
+  if (hCtx == NULL || outData == NULL || outInfo == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (outLength < hCtx->maxDecoderOutputSamples) {
+    return MPEGH_DEC_BUFFER_ERROR;
+  }
+  if (hCtx->viewedSamples > 0) {
+    return MPEGH_DEC_BUFFER_ERROR;
+  }
+
+  unsigned int outNumSamples = 0;
+  MPEGH_DECODER_ERROR retVal = prepareOutputFrame(hCtx, &outNumSamples, outInfo);
+  if (retVal == MPEGH_DEC_OK) {
+    releaseOutputFrame(hCtx, outNumSamples, outData);
+  }
+
+  return retVal;
+}
+
+MPEGH_DECODER_ERROR
+mpeghdecoder_getSamplesView(HANDLE_MPEGH_DECODER_CONTEXT hCtx, MPEGH_DECODER_SAMPLES_VIEW* view,
+                            MPEGH_DECODER_OUTPUT_INFO* outInfo) {
+  if (hCtx == NULL || view == NULL || outInfo == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (hCtx->viewedSamples > 0) {
+    return MPEGH_DEC_BUFFER_ERROR;
+  }
+
+  view->data[0] = NULL;
+  view->data[1] = NULL;
+  view->length[0] = 0;
+  view->length[1] = 0;
+
+  unsigned int outNumSamples = 0;
+  MPEGH_DECODER_ERROR retVal = prepareOutputFrame(hCtx, &outNumSamples, outInfo);
+  if (retVal == MPEGH_DEC_OK) {
+    void* data0;
+    void* data1;
+    unsigned int length0, length1;
+    deque_bulk_front_view(&hCtx->outputSamplesQueue, outNumSamples, &data0, &length0, &data1,
+                          &length1);
+    view->data[0] = (const int32_t*)data0;
+    view->data[1] = (const int32_t*)data1;
+    view->length[0] = length0;
+    view->length[1] = length1;
+    hCtx->viewedSamples = outNumSamples;
+  }
+
   return retVal;
 }
 
+MPEGH_DECODER_ERROR mpeghdecoder_releaseSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+  if (hCtx == NULL) {
+    return MPEGH_DEC_NULLPTR_ERROR;
+  }
+  if (hCtx->viewedSamples > 0) {
+    releaseOutputFrame(hCtx, hCtx->viewedSamples, NULL);
+    hCtx->viewedSamples = 0;
+  }
+  return MPEGH_DEC_OK;
+}
+
 MPEGH_DECODER_ERROR
 mpeghdecoder_flushAndGet(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
   if (hCtx == NULL) {
     return MPEGH_DEC_NULLPTR_ERROR;
   }
-  if (deque_full(&hCtx->timestampInQueue)) {
-    return MPEGH_DEC_BUFFER_ERROR;
+  if (hCtx->parent != NULL) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
   }
-  if (deque_space(&hCtx->decodedSamplesQueue) < hCtx->maxDecoderOutputSamples) {
+  CStreamInfo* p_si = aacDecoder_GetStreamInfo(hCtx->mpeghdec);
+  // a frame held back by pipelined decoding is output by the first flush call
+  int numFlushCalls = (p_si != NULL && p_si->numPendingFrames > 0) ? 2 : 1;
+  if (!hasInputSpace(hCtx, numFlushCalls)) {
     return MPEGH_DEC_BUFFER_ERROR;
   }
-  // flush the decoder
-  AAC_DECODER_ERROR err = aacDecoder_DecodeFrame(hCtx->mpeghdec, hCtx->tmpSamples,
-                                                 hCtx->maxDecoderOutputSamples, AACDEC_FLUSH);
-  CStreamInfo* p_si = aacDecoder_GetStreamInfo(hCtx->mpeghdec);
-  if (IS_OUTPUT_VALID(err) && p_si != NULL) {
-    if (hCtx->sampleRate == -1 && hCtx->numberOfChannels == -1) {
-      hCtx->sampleRate = p_si->sampleRate;
-      hCtx->numberOfChannels = p_si->numChannels;
-    } else if (hCtx->sampleRate != p_si->sampleRate ||
-               hCtx->numberOfChannels != p_si->numChannels) {
-      return MPEGH_DEC_NEEDS_RESTART;
-    }
-    // add decoded PCM samples to the sample queue
-    if (p_si->frameSize > 0) {
-      deque_bulk_push_back(&hCtx->decodedSamplesQueue, hCtx->tmpSamples,
-                           p_si->frameSize * p_si->numChannels);
+  AllocatorScope scope(&hCtx->allocator);
+  bool outputValid = false;
+  int last_frame_size = 0;
+
+  for (int i = 0; i < numFlushCalls; i++) {
+    // flush the decoder
+    setTargetBuffers(hCtx);
+    AAC_DECODER_ERROR err = aacDecoder_DecodeFrame(hCtx->mpeghdec, getDecodeBuffer(hCtx),
+                                                   hCtx->maxDecoderOutputSamples, AACDEC_FLUSH);
+    // a held back frame keeps the decoding errors it was concealed for
+    bool concealed = IS_DECODE_ERROR(err) != 0;
+    if (IS_OUTPUT_VALID(err) && p_si != NULL && hCtx->signalsCallback != NULL) {
+      if (p_si->frameSize <= 0 || p_si->sampleRate <= 0) {
+        continue;
+      }
+      // the flushed frame follows the frame of the newest timestamp
+      uint64_t pts = 0;
+      if (!deque_empty(&hCtx->timestampInQueue)) {
+        pts = *(uint64_t*)deque_back(&hCtx->timestampInQueue) +
+              (uint64_t)((double)p_si->frameSize * 1e9 / p_si->sampleRate + 0.5);
+        deque_pop_back(&hCtx->timestampInQueue);
+      }
+      deque_push_back(&hCtx->timestampInQueue, &pts);
+      outputSignals(hCtx, pts, concealed);
+      continue;
     }
-    // add the MPEG-H AU size info received from decoder
-    if (p_si->mpeghAUSize > 0) {
-      AUInfo auInfo;
-      auInfo.auSize = p_si->mpeghAUSize;
-      auInfo.concealed = false;
-      auInfo.outputLoudness = p_si->outputLoudness;
-      deque_push_back(&hCtx->auInfoQueue, &auInfo);
+    if (IS_OUTPUT_VALID(err) && p_si != NULL) {
+      if (hCtx->sampleRate == -1 && hCtx->numberOfChannels == -1) {
+        hCtx->sampleRate = p_si->sampleRate;
+        hCtx->numberOfChannels = p_si->numChannels;
+      } else if (hCtx->sampleRate != p_si->sampleRate ||
+                 hCtx->numberOfChannels != p_si->numChannels) {
+        return MPEGH_DEC_NEEDS_RESTART;
+      }
+      // add decoded PCM samples to the sample queue
+      if (p_si->frameSize > 0) {
+        pushDecodedSamples(hCtx, p_si->frameSize * p_si->numChannels);
+      }
+      // add the MPEG-H AU size info received from decoder
+      if (p_si->mpeghAUSize > 0) {
+        AUInfo auInfo;
+        auInfo.auSize = p_si->mpeghAUSize;
+        auInfo.concealed = concealed;
+        auInfo.outputLoudness = p_si->outputLoudness;
+        deque_push_back(&hCtx->auInfoQueue, &auInfo);
+      }
+      MPEGH_DECODER_ERROR retval = pushTargetSamples(hCtx, p_si, concealed);
+      if (retval != MPEGH_DEC_OK) {
+        return retval;
+      }
+      outputValid = true;
+      last_frame_size = p_si->frameSize;
     }
+  }
 
-    // add the ending pts
-    if (!deque_empty(&hCtx->timestampInQueue)) {
-      uint64_t pts = *(uint64_t*)deque_back(&hCtx->timestampInQueue);
-      int last_frame_size = p_si->frameSize;
-      if (!deque_empty(&hCtx->auInfoQueue)) {
-        AUInfo* auInfo = (AUInfo*)deque_back(&hCtx->auInfoQueue);
-        last_frame_size = auInfo->auSize;
-      }
-      pts += (uint64_t)((double)last_frame_size * 1e9 / p_si->sampleRate + 0.5);
-      deque_push_back(&hCtx->timestampInQueue, &pts);
+  // add the ending pts
+  if (outputValid && !deque_empty(&hCtx->timestampInQueue)) {
+    uint64_t pts = *(uint64_t*)deque_back(&hCtx->timestampInQueue);
+    if (!deque_empty(&hCtx->auInfoQueue)) {
+      AUInfo* auInfo = (AUInfo*)deque_back(&hCtx->auInfoQueue);
+      last_frame_size = auInfo->auSize;
     }
+    pts += (uint64_t)((double)last_frame_size * 1e9 / hCtx->sampleRate + 0.5);
+    pushTimestamp(hCtx, pts);
   }
   return MPEGH_DEC_OK;
 }
@@ -805,6 +1786,10 @@ MPEGH_DECODER_ERROR mpeghdecoder_flush(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
   if (hCtx == NULL) {
     return MPEGH_DEC_NULLPTR_ERROR;
   }
+  if (hCtx->parent != NULL) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+  AllocatorScope scope(&hCtx->allocator);
   return restartDecoder(hCtx);
 }
 
@@ -813,6 +1798,10 @@ MPEGH_DECODER_ERROR mpeghdecoder_setParam(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
   if (hCtx == NULL) {
     return MPEGH_DEC_NULLPTR_ERROR;
   }
+  if (hCtx->parent != NULL) {
+    return MPEGH_DEC_UNSUPPORTED_PARAM;
+  }
+  AllocatorScope scope(&hCtx->allocator);
   MPEGH_DECODER_ERROR result = MPEGH_DEC_OK;
   switch (param) {
     case MPEGH_DEC_PARAM_TARGET_REFERENCE_LEVEL:
@@ -861,6 +1850,209 @@ MPEGH_DECODER_ERROR mpeghdecoder_setParam(HANDLE_MPEGH_DECODER_CONTEXT hCtx,
   return result;
 }
 
+INT_PCM* getDecodeBuffer(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+  if (hCtx->outputPoolSize > 0) {
+    hCtx->decodeBuffer = deque_empty(&hCtx->poolFreeQueue)
+                             ? hCtx->tmpSamples
+                             : hCtx->outputPool[*(unsigned int*)deque_front(&hCtx->poolFreeQueue)];
+    return hCtx->decodeBuffer;
+  }
+  // decode in place unless the frame could wrap around the end of the ring
+  hCtx->decodeBuffer =
+      (INT_PCM*)deque_back_space(&hCtx->outputSamplesQueue, hCtx->maxDecoderOutputSamples);
+  if (hCtx->decodeBuffer == NULL) {
+    hCtx->decodeBuffer = hCtx->tmpSamples;
+  }
+  return hCtx->decodeBuffer;
+}
+
+void pushDecodedSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples) {
+  if (hCtx->outputPoolSize == 0) {
+    if (hCtx->decodeBuffer == hCtx->tmpSamples) {
+      deque_bulk_push_back(&hCtx->outputSamplesQueue, hCtx->tmpSamples, numSamples);
+    } else {
+      deque_bulk_push_back_in_place(&hCtx->outputSamplesQueue, numSamples);
+    }
+    hCtx->numQueuedSamples += numSamples;
+    return;
+  }
+
+  // the frame was decoded directly into the front free slot; only its index is queued. A free
+  // slot was checked by hasDecodeSpace() before decoding.
+  if (deque_empty(&hCtx->poolFreeQueue)) {
+    return;
+  }
+  PoolSlotInfo slotInfo;
+  slotInfo.slot = *(unsigned int*)deque_pop_front(&hCtx->poolFreeQueue);
+  slotInfo.offset = 0;
+  slotInfo.size = numSamples;
+  deque_push_back(&hCtx->poolUsedQueue, &slotInfo);
+  hCtx->numPooledSamples += numSamples;
+}
+
+void consumePooledSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples, deque* dst,
+                          bool zero) {
+  while (numSamples > 0 && !deque_empty(&hCtx->poolUsedQueue)) {
+    PoolSlotInfo* slotInfo = (PoolSlotInfo*)deque_front(&hCtx->poolUsedQueue);
+    unsigned int toMove = slotInfo->size - slotInfo->offset;
+    if (toMove > numSamples) {
+      toMove = numSamples;
+    }
+    if (dst != NULL && zero) {
+      deque_bulk_push_back_zeros(dst, toMove);
+    } else if (dst != NULL) {
+      deque_bulk_push_back(dst, hCtx->outputPool[slotInfo->slot] + slotInfo->offset, toMove);
+    }
+    slotInfo->offset += toMove;
+    numSamples -= toMove;
+    hCtx->numPooledSamples -= toMove;
+    if (slotInfo->offset == slotInfo->size) {
+      // slot completely consumed -> hand it back to the pool
+      unsigned int slot = slotInfo->slot;
+      deque_pop_front(&hCtx->poolUsedQueue);
+      deque_push_back(&hCtx->poolFreeQueue, &slot);
+    }
+  }
+}
+
+void consumeDecodedSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples,
+                           bool zero) {
+  if (hCtx->outputPoolSize > 0) {
+    // the pool slots belong to the caller and are handed back here, so the output frames take a
+    // copy
+    consumePooledSamples(hCtx, numSamples, &hCtx->outputSamplesQueue, zero);
+    return;
+  }
+
+  // the samples are in place already, the output frames only grow over them
+  if (zero) {
+    deque_bulk_set_zeros(&hCtx->outputSamplesQueue, getNumOutputSamples(hCtx), numSamples);
+  }
+  hCtx->numQueuedSamples -= numSamples;
+}
+
+void dropDecodedSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples) {
+  if (hCtx->outputPoolSize > 0) {
+    consumePooledSamples(hCtx, numSamples, NULL, false);
+    return;
+  }
+
+  deque_bulk_erase(&hCtx->outputSamplesQueue, getNumOutputSamples(hCtx), numSamples);
+  hCtx->numQueuedSamples -= numSamples;
+}
+
+void addZeroSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numSamples) {
+  deque_bulk_insert_zeros(&hCtx->outputSamplesQueue, getNumOutputSamples(hCtx), numSamples);
+}
+
+unsigned int getNumOutputSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+  return deque_size(&hCtx->outputSamplesQueue) - hCtx->numQueuedSamples;
+}
+
+unsigned int getNumDecodedSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+  if (hCtx->outputPoolSize > 0) {
+    return hCtx->numPooledSamples;
+  }
+  return hCtx->numQueuedSamples;
+}
+
+bool hasDecodeSpace(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numFrames) {
+  for (int i = -1; i < hCtx->numTargets; i++) {
+    HANDLE_MPEGH_DECODER_CONTEXT inst = (i < 0) ? hCtx : hCtx->targets[i];
+    if (inst->outputPoolSize > 0) {
+      if (deque_size(&inst->poolFreeQueue) < numFrames) {
+        return false;
+      }
+    } else if (deque_space(&inst->outputSamplesQueue) <
+               numFrames * inst->maxDecoderOutputSamples) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool hasInputSpace(HANDLE_MPEGH_DECODER_CONTEXT hCtx, unsigned int numFrames) {
+  if (deque_full(&hCtx->timestampInQueue)) {
+    return false;
+  }
+  for (int i = 0; i < hCtx->numTargets; i++) {
+    if (deque_full(&hCtx->targets[i]->timestampInQueue)) {
+      return false;
+    }
+  }
+  return hasDecodeSpace(hCtx, numFrames);
+}
+
+void pushTimestamp(HANDLE_MPEGH_DECODER_CONTEXT hCtx, uint64_t timestamp) {
+  deque_push_back(&hCtx->timestampInQueue, &timestamp);
+  for (int i = 0; i < hCtx->numTargets; i++) {
+    deque_push_back(&hCtx->targets[i]->timestampInQueue, &timestamp);
+  }
+}
+
+void popTimestamp(HANDLE_MPEGH_DECODER_CONTEXT hCtx, bool newest) {
+  for (int i = -1; i < hCtx->numTargets; i++) {
+    deque* queue = (i < 0) ? &hCtx->timestampInQueue : &hCtx->targets[i]->timestampInQueue;
+    if (deque_empty(queue)) {
+      continue;
+    }
+    if (newest) {
+      deque_pop_back(queue);
+    } else {
+      deque_pop_front(queue);
+    }
+  }
+}
+
+void setTargetBuffers(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+  for (int i = 0; i < hCtx->numTargets; i++) {
+    HANDLE_MPEGH_DECODER_CONTEXT target = hCtx->targets[i];
+    aacDecoder_SetRenderTargetBuffer(hCtx->mpeghdec, i, getDecodeBuffer(target),
+                                     target->maxDecoderOutputSamples);
+  }
+}
+
+MPEGH_DECODER_ERROR pushTargetSamples(HANDLE_MPEGH_DECODER_CONTEXT hCtx, const CStreamInfo* p_si,
+                                      bool concealed) {
+  for (int i = 0; i < hCtx->numTargets; i++) {
+    HANDLE_MPEGH_DECODER_CONTEXT target = hCtx->targets[i];
+    CStreamInfo* t_si = aacDecoder_GetRenderTargetInfo(hCtx->mpeghdec, i);
+    bool targetConcealed = concealed;
+    if (t_si == NULL) {
+      continue;
+    }
+
+    if (p_si->frameSize > 0) {
+      unsigned int numSamples = p_si->frameSize * t_si->numChannels;
+      if (t_si->frameSize != p_si->frameSize) {
+        // the frame could not be rendered to the target layout, keep it in line with silence
+        mpegh_FDKmemclear(getDecodeBuffer(target), numSamples * sizeof(INT_PCM));
+        targetConcealed = true;
+      }
+      if (target->sampleRate == -1 && target->numberOfChannels == -1) {
+        // the output configuration becomes valid together with the one of hCtx
+        if (hCtx->sampleRate != -1) {
+          target->sampleRate = t_si->sampleRate;
+          target->numberOfChannels = t_si->numChannels;
+        }
+      } else if (target->sampleRate != t_si->sampleRate ||
+                 target->numberOfChannels != t_si->numChannels) {
+        return MPEGH_DEC_NEEDS_RESTART;
+      }
+      pushDecodedSamples(target, numSamples);
+    }
+    // the AU sizes and loudness are the same for all target layouts
+    if (p_si->mpeghAUSize > 0) {
+      AUInfo auInfo;
+      auInfo.auSize = p_si->mpeghAUSize;
+      auInfo.concealed = targetConcealed;
+      auInfo.outputLoudness = p_si->outputLoudness;
+      deque_push_back(&target->auInfoQueue, &auInfo);
+    }
+  }
+  return MPEGH_DEC_OK;
+}
+
 void fade(int32_t* sample, int index, int fadelen, bool fadein) {
   float factor = 0;
   if (fadein) {
@@ -872,26 +2064,74 @@ void fade(int32_t* sample, int index, int fadelen, bool fadein) {
   *sample = (int32_t)(*sample * factor);
 }
 
+int allocQueues(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+  if (deque_alloc(&hCtx->timestampInQueue, TIMESTAMP_ARRAY_SIZE, sizeof(uint64_t)) < 0 ||
+      deque_alloc(&hCtx->timestampOutQueue, TIMESTAMP_ARRAY_SIZE, sizeof(uint64_t)) < 0 ||
+      deque_alloc(&hCtx->auInfoQueue, TIMESTAMP_ARRAY_SIZE, sizeof(AUInfo)) < 0 ||
+      deque_alloc(&hCtx->outputInfoQueue, TIMESTAMP_ARRAY_SIZE, sizeof(OutputInfo)) < 0 ||
+      deque_alloc(&hCtx->outputSamplesQueue,
+                  2 * TIMESTAMP_ARRAY_SIZE * hCtx->maxDecoderOutputSamples, sizeof(INT_PCM)) < 0 ||
+      deque_alloc(&hCtx->fadeoutIdxQueue, FADE_ARRAY_SIZE, sizeof(int)) < 0 ||
+      deque_alloc(&hCtx->fadeinIdxQueue, FADE_ARRAY_SIZE, sizeof(int)) < 0) {
+    return -1;
+  }
+  return 0;
+}
+
 void clearQueues(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
   deque_clear(&hCtx->timestampInQueue);
   deque_clear(&hCtx->auInfoQueue);
   deque_clear(&hCtx->timestampOutQueue);
-  deque_clear(&hCtx->decodedSamplesQueue);
   deque_clear(&hCtx->outputSamplesQueue);
+  hCtx->numQueuedSamples = 0;
   deque_clear(&hCtx->outputInfoQueue);
   deque_clear(&hCtx->fadeinIdxQueue);
   deque_clear(&hCtx->fadeoutIdxQueue);
+
+  // return all slots of the output frame pool
+  deque_clear(&hCtx->poolUsedQueue);
+  deque_clear(&hCtx->poolFreeQueue);
+  for (unsigned int slot = 0; slot < hCtx->outputPoolSize; slot++) {
+    deque_push_back(&hCtx->poolFreeQueue, &slot);
+  }
+  hCtx->numPooledSamples = 0;
+}
+
+void resetOutput(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+  clearQueues(hCtx);
+  hCtx->zeroSignal = false;
+  hCtx->viewedSamples = 0;
+
+  hCtx->sampleRate = -1;
+  hCtx->numberOfChannels = -1;
+}
+
+bool hasSamplesView(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
+  if (hCtx->viewedSamples > 0) {
+    return true;
+  }
+  for (int i = 0; i < hCtx->numTargets; i++) {
+    if (hCtx->targets[i]->viewedSamples > 0) {
+      return true;
+    }
+  }
+  return false;
 }
 
 MPEGH_DECODER_ERROR restartDecoder(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
   if (hCtx == NULL) {
     return MPEGH_DEC_NULLPTR_ERROR;
   }
+  // restarting drops all pending samples, including those of a view handed to the caller
+  if (hasSamplesView(hCtx)) {
+    return MPEGH_DEC_BUFFER_ERROR;
+  }
 
   if (hCtx->mpeghdec != NULL) {
     aacDecoder_Close(hCtx->mpeghdec);
     hCtx->mpeghdec = NULL;
   }
+  hCtx->concealPending = false;
 
   if (hCtx->mhaConfigLength > 0 && hCtx->mhaConfig != NULL) {
     hCtx->mpeghdec = aacDecoder_Open(TT_MHA_RAW, 1);
@@ -909,6 +2149,15 @@ MPEGH_DECODER_ERROR restartDecoder(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
     return MPEGH_DEC_UNSUPPORTED_PARAM;
   }
 
+  // render the added target layouts from the same core decoder, in the order they were added
+  for (int i = 0; i < hCtx->numTargets; i++) {
+    INT index;
+    ErrorStatus = aacDecoder_AddRenderTarget(hCtx->mpeghdec, hCtx->targets[i]->cicpIndex, &index);
+    if (ErrorStatus != AAC_DEC_OK) {
+      return MPEGH_DEC_UNSUPPORTED_PARAM;
+    }
+  }
+
   // set an out-of-band config if it was provided
   if (hCtx->mhaConfigLength > 0 && hCtx->mhaConfig != NULL) {
     ErrorStatus = aacDecoder_ConfigRaw(hCtx->mpeghdec, &hCtx->mhaConfig, &hCtx->mhaConfigLength);
@@ -917,11 +2166,29 @@ MPEGH_DECODER_ERROR restartDecoder(HANDLE_MPEGH_DECODER_CONTEXT hCtx) {
     }
   }
 
-  clearQueues(hCtx);
-  hCtx->zeroSignal = false;
+  // keep sharing the work buffers and the executor set with mpeghdecoder_setScratch() and
+  // mpeghdecoder_setTaskExecutor(), and keep pipelined decoding and the signal export
+  if (hCtx->scratch != NULL &&
+      aacDecoder_SetScratch(hCtx->mpeghdec, hCtx->scratch->hCoreScratch) != AAC_DEC_OK) {
+    return MPEGH_DEC_PROCESS_ERROR;
+  }
+  if (hCtx->executor.execute != NULL &&
+      aacDecoder_SetTaskExecutor(hCtx->mpeghdec, &hCtx->executor) != AAC_DEC_OK) {
+    return MPEGH_DEC_OUT_OF_MEMORY;
+  }
+  if (hCtx->pipelinedDecoding &&
+      aacDecoder_SetParam(hCtx->mpeghdec, AAC_PIPELINED_DECODE, 1) != AAC_DEC_OK) {
+    return MPEGH_DEC_OUT_OF_MEMORY;
+  }
+  if (hCtx->signalsCallback != NULL &&
+      aacDecoder_SetParam(hCtx->mpeghdec, AAC_SIGNAL_EXPORT, 1) != AAC_DEC_OK) {
+    return MPEGH_DEC_OUT_OF_MEMORY;
+  }
 
-  hCtx->sampleRate = -1;
-  hCtx->numberOfChannels = -1;
+  resetOutput(hCtx);
+  for (int i = 0; i < hCtx->numTargets; i++) {
+    resetOutput(hCtx->targets[i]);
+  }
 
   // force an update to the last desired DRC values after restarting the decoder
   hCtx->drcUpdate = true;
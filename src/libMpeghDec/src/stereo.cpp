@@ -184,8 +184,6 @@ int CJointStereo_Read(HANDLE_FDK_BITSTREAM bs, CJointStereoData* pJointStereoDat
       if (pJointStereoData->cplx_pred_flag) {
         int delta_code_time = 0;
 
-        /* set pointer to Huffman codebooks */
-        const CodeBookDescription* hcb = &AACcodeBookDescriptionSCL;
         /* set predictors to zero in case of a transition from long to short window sequences and
          * vice versa */
         if (((windowSequence == BLOCK_SHORT) &&
@@ -268,14 +266,14 @@ int CJointStereo_Read(HANDLE_FDK_BITSTREAM bs, CJointStereoData* pJointStereoDat
               if (pJointStereoData->MsUsed[band] & ((UCHAR)1 << group)) {
                 int dpcm_alpha_re, dpcm_alpha_im;
 
-                dpcm_alpha_re = CBlock_DecodeHuffmanWord(bs, hcb);
+                dpcm_alpha_re = FDKhuffDecodeBs(bs, &AAChuffLutSCL);
                 dpcm_alpha_re -= 60;
                 dpcm_alpha_re *= -1;
 
                 cplxPredictionData->alpha_q_re[group][band] = dpcm_alpha_re + last_alpha_q_re;
 
                 if (cplxPredictionData->complex_coef) {
-                  dpcm_alpha_im = CBlock_DecodeHuffmanWord(bs, hcb);
+                  dpcm_alpha_im = FDKhuffDecodeBs(bs, &AAChuffLutSCL);
                   dpcm_alpha_im -= 60;
                   dpcm_alpha_im *= -1;
 
@@ -399,8 +397,6 @@ int CJointStereo_ReadIGF(HANDLE_FDK_BITSTREAM bs, CJointStereoData* pJointStereo
   if (pJointStereoData->igf_cplx_pred_flag) {
     int igf_delta_code_time = 0;
 
-    /* set pointer to Huffman codebooks */
-    const CodeBookDescription* hcb = &AACcodeBookDescriptionSCL;
     /* set predictors to zero in case of a transition from long to short window sequences and vice
      * versa */
     if (((windowSequence == BLOCK_SHORT) &&
@@ -457,7 +453,7 @@ int CJointStereo_ReadIGF(HANDLE_FDK_BITSTREAM bs, CJointStereoData* pJointStereo
         if (pJointStereoData->MsUsed[sfb] & ((UCHAR)1 << group)) {
           int dpcm_alpha_re;
 
-          dpcm_alpha_re = CBlock_DecodeHuffmanWord(bs, hcb);
+          dpcm_alpha_re = FDKhuffDecodeBs(bs, &AAChuffLutSCL);
           dpcm_alpha_re -= 60;
           dpcm_alpha_re *= -1;
 
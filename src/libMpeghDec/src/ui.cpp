@@ -734,6 +734,8 @@ static INT mpegh3daInteractivity(void* user_data, HANDLE_FDK_BITSTREAM hBs,
   HANDLE_AACDECODER self = (HANDLE_AACDECODER)user_data;
   int err;
 
+  aacDecoder_SyncPipeline(self);
+
   switch (pac_type) {
     case MHA_PACTYP_USERINTERACTION:
       err = mpegh3daElementInteraction(self, hBs);
@@ -1057,16 +1059,12 @@ int updateUiStatus(HANDLE_AACDECODER self) {
   return 0;
 }
 
-void updateOnOffFlags(HANDLE_AACDECODER self) {
+static void getOnOffFlags(HANDLE_AACDECODER self, UCHAR* signalSkipped) {
   AUDIO_SCENE_INFO* pASI;
   int grp, asiGrpIdx, sigGrpIdx, sigIdx, maeId, grpMem;
 
-  if (self->pUsacConfig[0] == NULL) {
-    return;
-  }
-
   /* clear skipped signals flags */
-  mpegh_FDKmemclear(self->signalSkipped, TP_MPEGH_MAX_SIGNAL_GROUPS * sizeof(UCHAR));
+  mpegh_FDKmemclear(signalSkipped, TP_MPEGH_MAX_SIGNAL_GROUPS * sizeof(UCHAR));
 
   /* check if element skipping active */
   if (!self->useElementSkipping || !(self->flags[0] & AC_MPEGH3DA) ||
@@ -1111,7 +1109,7 @@ void updateOnOffFlags(HANDLE_AACDECODER self) {
 
           /* set skipped flag */
           if (maeId == 0) {
-            self->signalSkipped[sigIdx] = 1;
+            signalSkipped[sigIdx] = 1;
           }
         }
       }
@@ -1119,12 +1117,30 @@ void updateOnOffFlags(HANDLE_AACDECODER self) {
   }
 }
 
+void updateOnOffFlags(HANDLE_AACDECODER self) {
+  UCHAR signalSkipped[TP_MPEGH_MAX_SIGNAL_GROUPS];
+
+  if (self->pUsacConfig[0] == NULL) {
+    return;
+  }
+
+  getOnOffFlags(self, signalSkipped);
+
+  /* The flags are only written if they change, a frame held back by pipelined decoding may be
+   * rendered meanwhile. */
+  if (mpegh_FDKmemcmp(self->signalSkipped, signalSkipped, sizeof(signalSkipped)) != 0) {
+    aacDecoder_SyncPipeline(self);
+    mpegh_FDKmemcpy(self->signalSkipped, signalSkipped, sizeof(signalSkipped));
+  }
+}
+
 int getOnOffFlag(HANDLE_AACDECODER self, const int signal) {
   return !self->signalSkipped[signal];
 }
 
 /* apply user interactivity */
-AAC_DECODER_ERROR applyUserInteractivity(HANDLE_AACDECODER self, PCM_DEC* pTimeData) {
+AAC_DECODER_ERROR applyUserInteractivity(HANDLE_AACDECODER self, const INT numChannels,
+                                         const INT frameSize, PCM_DEC* pTimeData) {
   UI_DRC_LOUDNESS_STATUS drcStatus;
   HANDLE_SEL_PROC_OUTPUT pUniDrcSelProcOutput =
       FDK_drcDec_GetSelectionProcessOutput(self->hUniDrcDecoder);
@@ -1249,7 +1265,7 @@ AAC_DECODER_ERROR applyUserInteractivity(HANDLE_AACDECODER self, PCM_DEC* pTimeD
     loudnessCompensationGainDb =
         getLoudnessCompensationGainDb(pASI, &self->uiStatus, pUniDrcSelProcOutput);
 
-    for (ch = 0; ch < self->streamInfo.numChannels; ch++) {
+    for (ch = 0; ch < numChannels; ch++) {
       channelGain[ch] = loudnessCompensationGainDb;
     }
 
@@ -1455,9 +1471,8 @@ AAC_DECODER_ERROR applyUserInteractivity(HANDLE_AACDECODER self, PCM_DEC* pTimeD
   }
 
   /* set UI gains (in dB) which will be applied in DRC decoder */
-  FDK_drcDec_SetChannelGains(self->hUniDrcDecoder, 1, self->streamInfo.numChannels,
-                             self->streamInfo.frameSize, channelGain, pTimeData,
-                             self->streamInfo.frameSize + 256);
+  FDK_drcDec_SetChannelGains(self->hUniDrcDecoder, 1, numChannels, frameSize, channelGain,
+                             pTimeData, frameSize + 256);
 
   return AAC_DEC_OK;
 }
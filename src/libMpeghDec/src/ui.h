@@ -96,7 +96,8 @@ amm-info@iis.fraunhofer.de
 
 AAC_DECODER_ERROR FDK_mpeghUiInitialize(HANDLE_AACDECODER self);
 
-AAC_DECODER_ERROR applyUserInteractivity(HANDLE_AACDECODER self, PCM_DEC* pTimeData);
+AAC_DECODER_ERROR applyUserInteractivity(HANDLE_AACDECODER self, const INT numChannels,
+                                         const INT frameSize, PCM_DEC* pTimeData);
 
 int updateUiStatus(HANDLE_AACDECODER self);
 
@@ -108,6 +108,8 @@ struct MPEGH_UI_MANAGER {
   UINT insertOffset;
 };
 
+static HANDLE_MPEGH_UI_MANAGER mpeghUIManagerCreate(void);
+
 static UINT nextPow2(UINT x) {
   UINT y = 1;
   while (y < x) y <<= 1;
@@ -116,6 +118,37 @@ static UINT nextPow2(UINT x) {
 
 /* open */
 LINKSPEC_H HANDLE_MPEGH_UI_MANAGER mpegh_UI_Manager_Open(void) {
+  return mpegh_UI_Manager_OpenWithAllocator(NULL);
+}
+
+/* open with allocator */
+LINKSPEC_H HANDLE_MPEGH_UI_MANAGER
+mpegh_UI_Manager_OpenWithAllocator(const MPEGH_UI_ALLOCATOR* allocator) {
+  HANDLE_MPEGH_UI_MANAGER self;
+  FDK_ALLOCATOR fdkAllocator = {NULL, NULL, NULL, NULL};
+  const FDK_ALLOCATOR* pPrevious;
+
+  if (allocator != NULL) {
+    if ((allocator->mallocFunc == NULL) || (allocator->freeFunc == NULL)) {
+      return NULL;
+    }
+    fdkAllocator.mallocFunc = allocator->mallocFunc;
+    fdkAllocator.alignedAllocFunc = allocator->alignedAllocFunc;
+    fdkAllocator.freeFunc = allocator->freeFunc;
+    fdkAllocator.context = allocator->context;
+  }
+
+  /* All memory of the UI manager is allocated here. Each block remembers its allocator, so no
+     allocator needs to be current in mpegh_UI_Manager_Close(). */
+  pPrevious = mpegh_FDKsetAllocator(&fdkAllocator);
+  self = mpeghUIManagerCreate();
+  mpegh_FDKsetAllocator(pPrevious);
+
+  return self;
+}
+
+/* create instance with the current allocator */
+static HANDLE_MPEGH_UI_MANAGER mpeghUIManagerCreate(void) {
   HANDLE_MPEGH_UI_MANAGER self;
 
   self = (HANDLE_MPEGH_UI_MANAGER)mpegh_FDKcalloc(1, sizeof(MPEGH_UI_MANAGER));
@@ -98,6 +98,8 @@ amm-info@iis.fraunhofer.de
 
 #if defined(__arm__)
 #include "arm/limiter_arm.cpp"
+#elif defined(__x86__)
+#include "x86/limiter_x86.cpp"
 #endif
 
 /* create limiter */
@@ -374,7 +376,7 @@ TDLIMITER_ERROR pcmLimiter_Apply(TDLimiterPtr limiter, PCM_LIM* samplesIn, INT_P
         } else {
           /* the old maximum has left the window, we have to search the complete
              buffer for the new max */
-#if defined(FUNCTION_applyLimiter_func3) && (PCM_OUT_BITS == 32)
+#if defined(FUNCTION_applyLimiter_func3) && (PCM_LIM_BITS == 32)
           max = applyLimiter_func3(maxBuf, attack + 1);
 #else
           max = maxBuf[0];
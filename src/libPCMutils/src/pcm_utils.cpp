@@ -92,6 +92,8 @@ amm-info@iis.fraunhofer.de
 
 #if defined(__arm__)
 #include "arm/pcm_utils_arm.cpp"
+#elif defined(__x86__)
+#include "x86/pcm_utils_x86.cpp"
 #endif
 
 #ifndef FUNCTION_FDK_interleave_DBL_LONG
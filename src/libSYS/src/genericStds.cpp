@@ -184,33 +184,109 @@ char* mpegh_FDKstrncpy(char* dest, const char* src, UINT n) {
  * DYNAMIC MEMORY management (heap)
  *************************************************************************/
 
-void* mpegh_FDKcalloc(const UINT n, const UINT size) {
-  void* ptr;
+/* Every block carries a header in front of the returned address that records how to release
+   it. This keeps blocks valid independent of the allocator current at the time of freeing. */
+typedef struct {
+  void (*freeFunc)(void* context, void* ptr);
+  void* context;
+  void* base; /* Address returned by the allocator. */
+} FDK_ALLOC_HEADER;
 
-  ptr = calloc(n, size);
+#define ALLOC_HEADER_SIZE ((UINT)ALGN_SIZE_EXTRES(sizeof(FDK_ALLOC_HEADER)))
 
-  return ptr;
+static void defaultFree(void* context, void* ptr) {
+  (void)context;
+  free(ptr);
 }
 
-void* mpegh_FDKmalloc(const UINT size) {
-  void* ptr;
+static thread_local const FDK_ALLOCATOR* currentAllocator = NULL;
 
-  ptr = malloc(size);
+const FDK_ALLOCATOR* mpegh_FDKsetAllocator(const FDK_ALLOCATOR* pAllocator) {
+  const FDK_ALLOCATOR* pPrevious = currentAllocator;
 
-  return ptr;
+  currentAllocator = pAllocator;
+
+  return pPrevious;
+}
+
+/* Allocate size bytes from the current allocator and attach the header. */
+static void* allocWithHeader(const UINT size, const UINT alignment, const int clear) {
+  const UINT headerSize = ALLOC_HEADER_SIZE;
+  const FDK_ALLOCATOR* pAllocator = currentAllocator;
+  FDK_ALLOC_HEADER* header;
+  UCHAR *base, *result;
+
+  if ((pAllocator == NULL) || (pAllocator->mallocFunc == NULL)) {
+    UINT rawSize = size + headerSize + alignment;
+
+    if (rawSize < size) return NULL;
+    base = (UCHAR*)(clear ? calloc(1, rawSize) : malloc(rawSize));
+    if (base == NULL) return NULL;
+    result = base + headerSize;
+    if (alignment != 0) {
+      result += (alignment - ((size_t)result & (alignment - 1))) & (alignment - 1);
+    }
+    header = ((FDK_ALLOC_HEADER*)result) - 1;
+    header->freeFunc = defaultFree;
+    header->context = NULL;
+  } else {
+    if ((alignment != 0) && (pAllocator->alignedAllocFunc != NULL)) {
+      /* The header area is a multiple of the alignment, so the result stays aligned. */
+      UINT offset = (headerSize + alignment - 1) & ~(alignment - 1);
+
+      if (size + offset < size) return NULL;
+      base = (UCHAR*)pAllocator->alignedAllocFunc(pAllocator->context, size + offset, alignment);
+      if (base == NULL) return NULL;
+      result = base + offset;
+    } else {
+      UINT rawSize = size + headerSize + alignment;
+
+      if (rawSize < size) return NULL;
+      base = (UCHAR*)pAllocator->mallocFunc(pAllocator->context, rawSize);
+      if (base == NULL) return NULL;
+      result = base + headerSize;
+      if (alignment != 0) {
+        result += (alignment - ((size_t)result & (alignment - 1))) & (alignment - 1);
+      }
+    }
+    if (clear) {
+      memset(result, 0, size);
+    }
+    header = ((FDK_ALLOC_HEADER*)result) - 1;
+    header->freeFunc = pAllocator->freeFunc;
+    header->context = pAllocator->context;
+  }
+  header->base = base;
+
+  return result;
+}
+
+void* mpegh_FDKcalloc(const UINT n, const UINT size) {
+  if ((size != 0) && (n > ((UINT)-1 - ALLOC_HEADER_SIZE) / size)) {
+    return NULL;
+  }
+
+  return allocWithHeader(n * size, 0, 1);
+}
+
+void* mpegh_FDKmalloc(const UINT size) {
+  return allocWithHeader(size, 0, 0);
 }
 
 void mpegh_FDKfree(void* ptr) {
-  free((INT*)ptr);
+  FDK_ALLOC_HEADER* header;
+
+  if (ptr == NULL) return;
+
+  header = ((FDK_ALLOC_HEADER*)ptr) - 1;
+  header->freeFunc(header->context, header->base);
 }
 
 void* mpegh_FDKaalloc(const UINT size, const UINT alignment) {
-  void *addr, *result = NULL;
-  addr = mpegh_FDKcalloc(1, size + alignment + (UINT)sizeof(void*)); /* Malloc and clear memory. */
+  void* result;
 
-  if (addr != NULL) {
-    result = ALIGN_PTR((unsigned char*)addr + sizeof(void*)); /* Get aligned memory base address. */
-    *(((void**)result) - 1) = addr;                           /* Save malloc'ed memory pointer.   */
+  result = allocWithHeader(size, alignment, 1); /* Allocate and clear memory. */
+  if (result != NULL) {
     C_ALLOC_ALIGNED_REGISTER(result, size);
   }
 
@@ -218,12 +294,9 @@ void* mpegh_FDKaalloc(const UINT size, const UINT alignment) {
 }
 
 void mpegh_FDKafree(void* ptr) {
-  void* addr;
-  addr = *(((void**)ptr) - 1); /* Get pointer to malloc'ed memory. */
-
   C_ALLOC_ALIGNED_UNREGISTER(ptr);
 
-  mpegh_FDKfree(addr); /* Free malloc'ed memory area.      */
+  mpegh_FDKfree(ptr); /* Free allocated memory area.      */
 }
 
 /*--------------------------------------------------------------------------*
@@ -234,6 +307,7 @@ void mpegh_FDKafree(void* ptr) {
  * mpegh_FDKcalloc_L
  *--------------------------------------------------------------------------*/
 void* mpegh_FDKcalloc_L(const UINT dim, const UINT size, MEMORY_SECTION s) {
+  (void)s;
   return mpegh_FDKcalloc(dim, size);
 }
 
@@ -242,26 +316,52 @@ void mpegh_FDKfree_L(void* p) {
 }
 
 void* mpegh_FDKaalloc_L(const UINT size, const UINT alignment, MEMORY_SECTION s) {
-  void *addr, *result = NULL;
-  addr = mpegh_FDKcalloc_L(1, size + alignment + (UINT)sizeof(void*), s); /* Malloc and clear memory. */
+  (void)s;
+  return mpegh_FDKaalloc(size, alignment);
+}
 
-  if (addr != NULL) {
-    result = ALIGN_PTR((unsigned char*)addr + sizeof(void*)); /* Get aligned memory base address. */
-    *(((void**)result) - 1) = addr;                           /* Save malloc'ed memory pointer.   */
-    C_ALLOC_ALIGNED_REGISTER(result, size);
+void mpegh_FDKafree_L(void* ptr) {
+  mpegh_FDKafree(ptr);
+}
+
+/*--------------------------------------------------------------------------*
+ * Linear memory arena
+ *--------------------------------------------------------------------------*/
+
+INT mpegh_FDKarenaCreate(FDK_MEM_ARENA* pArena, const UINT size) {
+  FDK_ASSERT(pArena->pBase == NULL);
+  if (pArena->pBase != NULL) {
+    return -1;
   }
 
-  return result; /* Return aligned address.          */
+  pArena->pBase = (UCHAR*)mpegh_FDKaalloc(size, ALIGNMENT_DEFAULT);
+  pArena->size = (pArena->pBase != NULL) ? size : 0;
+  pArena->offset = 0;
+
+  return (pArena->pBase != NULL) ? 0 : -1;
 }
 
-void mpegh_FDKafree_L(void* ptr) {
-  void* addr;
+void* mpegh_FDKarenaAlloc(FDK_MEM_ARENA* pArena, const UINT size) {
+  void* ptr;
+  UINT alignedSize = ARENA_ALGN_SIZE(size);
 
-  addr = *(((void**)ptr) - 1); /* Get pointer to malloc'ed memory. */
+  if ((pArena->pBase == NULL) || (alignedSize > pArena->size - pArena->offset)) {
+    return NULL;
+  }
 
-  C_ALLOC_ALIGNED_UNREGISTER(ptr);
+  ptr = pArena->pBase + pArena->offset;
+  pArena->offset += alignedSize;
 
-  mpegh_FDKfree_L(addr); /* Free malloc'ed memory area.      */
+  return ptr;
+}
+
+void mpegh_FDKarenaDestroy(FDK_MEM_ARENA* pArena) {
+  if (pArena->pBase != NULL) {
+    mpegh_FDKafree(pArena->pBase);
+  }
+  pArena->pBase = NULL;
+  pArena->size = 0;
+  pArena->offset = 0;
 }
 
 /*---------------------------------------------------------------------------------------
@@ -134,6 +134,54 @@ int gVBAPRenderer_RenderFrame_Time(HANDLE_GVBAPRENDERER hgVBAPRenderer, VBAP_PCM
                                    VBAP_PCM* outputBuffer, const INT startSamplePosition,
                                    const int inputBufferChannelOffset);
 
+/*
+ * @brief Get the number of object gain calculations served from and added to the position cache
+ *        since the renderer was opened.
+ * @param phgVBAPRenderer       Pointer to gVBAPRenderer handle
+ * @param hits                  Number of object gains taken from the cache
+ * @param misses                Number of object gains calculated
+ */
+void gVBAPRenderer_GetPositionCacheStats(HANDLE_GVBAPRENDERER hgVBAPRenderer, UINT* hits,
+                                         UINT* misses);
+
+/*
+ * @brief Get the size of the speaker mesh of the output setting. The setup cost of
+ *        gVBAPRenderer_Open() grows with it, and is bounded by GVBAPRENDERER_MAX_CHANNEL_OUT real
+ *        speakers plus at most 6 ghost speakers.
+ * @param phgVBAPRenderer       Pointer to gVBAPRenderer handle
+ * @param numTriangles          Number of speaker triangles
+ * @param numGhosts             Number of ghost speakers added to the output setting
+ * @param meshShared            1 if the mesh was taken from an earlier renderer with the same
+ *                              output setting, 0 if it was built
+ */
+void gVBAPRenderer_GetSetupInfo(HANDLE_GVBAPRENDERER hgVBAPRenderer, UINT* numTriangles,
+                                UINT* numGhosts, UINT* meshShared);
+
+/*
+ * @brief Copy the object metadata of the current frame, including the concealment state, from one
+ *        renderer to another one with the same objects and OAM frames but possibly a different
+ *        output setting. This renders the same scene to several output settings.
+ * @param hgVBAPRendererDst     gVBAPRenderer handle receiving the metadata
+ * @param hgVBAPRendererSrc     gVBAPRenderer handle the metadata was parsed into
+ */
+void gVBAPRenderer_CopyMetadata(HANDLE_GVBAPRENDERER hgVBAPRendererDst,
+                                HANDLE_GVBAPRENDERER hgVBAPRendererSrc);
+
+/*
+ * @brief Get the object metadata of the current frame as gVBAPRenderer_RenderFrame_Time() renders
+ *        it, after concealment of invalid metadata and before the distance to spread mapping. The
+ *        objects reach the metadata of each returned stop at its stop sample, counted from
+ *        startSamplePosition, and are interpolated linearly in between. The last OAM frame
+ *        repeats the latest metadata if it has none of its own.
+ * @param hgVBAPRenderer        gVBAPRenderer handle
+ * @param ppStopSamples         Receives the numObjects OAM samples of each stop, sized for
+ *                              GVBAPRENDERER_MAX_OAM_FRAMES_PER_CORE_FRAME stops
+ * @param pStopSamplePositions  Receives the stop sample position of each stop
+ * @return                      Number of stops
+ */
+int gVBAPRenderer_GetMetadata(HANDLE_GVBAPRENDERER hgVBAPRenderer,
+                              const OAM_SAMPLE** ppStopSamples, INT* pStopSamplePositions);
+
 /*
  * @brief Free memory for gVBAPRenderer Handle.
  * @param phgVBAPRenderer       Pointer to gVBAPRenderer handle
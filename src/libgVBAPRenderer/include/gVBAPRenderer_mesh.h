@@ -0,0 +1,193 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+/******************** MPEG-H 3DA object rendering library **********************
+
+   Author(s):
+
+   Description: Process-wide cache of the speaker triangulation meshes
+
+*******************************************************************************/
+
+#ifndef GVBAPRENDERER_MESH_H
+#define GVBAPRENDERER_MESH_H
+
+#include "FDK_cicp2geometry.h"
+#include "quickHull.h"
+
+/* Number of speaker meshes kept in the process-wide cache */
+#define GVBAP_MESH_CACHE_SIZE (4)
+
+/* Version of the binary form of VBAP_MESH. Increase it whenever the layout of VBAP_MESH or of one
+ * of its members changes. */
+#define GVBAP_MESH_VERSION (1)
+
+/*
+ * @brief Everything a speaker mesh is built from
+ * @param cicpIndex     CICP index passed to qh_sphere_triangulation(), 0 for legacy rendering
+ * @param numSpeakers   number of speakers without LFE
+ * @param azimuth       azimuth of the speakers without LFE in the order of the output setup
+ * @param elevation     elevation of the speakers without LFE in the order of the output setup
+ */
+typedef struct {
+  INT cicpIndex;
+  INT numSpeakers;
+  FIXP_DBL azimuth[GVBAPRENDERER_MAX_CHANNEL_OUT];
+  FIXP_DBL elevation[GVBAPRENDERER_MAX_CHANNEL_OUT];
+} VBAP_MESH_KEY;
+
+/*
+ * @brief Speaker triangles with their inverse matrices and the ghost speaker downmix of one output
+ * setup. The binary form of a mesh is this structure, valid for builds of the same version and
+ * byte order.
+ * @param version           GVBAP_MESH_VERSION
+ * @param size              sizeof(VBAP_MESH)
+ * @param key               output setup of the mesh
+ * @param numVertices       number of real and ghost speakers
+ * @param vertices          real and ghost speakers
+ * @param numTriplets       number of speaker triangles
+ * @param triplets          speaker triangles with inverse matrices
+ * @param greatestInverseMatrixExponent  greatest exponent of the inverse matrices
+ * @param hasDownmixMatrix  1 if the ghost speakers are downmixed
+ * @param downmixMatrixNumRows, downmixMatrixNumCols  size of the ghost speaker downmix matrix
+ * @param downmixMatrix     ghost speaker downmix matrix
+ */
+typedef struct {
+  UINT version;
+  UINT size;
+  VBAP_MESH_KEY key;
+  INT numVertices;
+  vertex vertices[GVBAPRENDERER_VERTEX_LIST_MAX_SIZE];
+  INT numTriplets;
+  SPEAKERTRIPLET triplets[GVBAPRENDERER_TRIANGLE_LIST_MAX_SIZE];
+  INT greatestInverseMatrixExponent;
+  INT hasDownmixMatrix;
+  INT downmixMatrixNumRows;
+  INT downmixMatrixNumCols;
+  FIXP_DBL downmixMatrix[GVBAPRENDERER_MAX_CHANNEL_OUT][GVBAPRENDERER_VERTEX_LIST_MAX_SIZE];
+} VBAP_MESH;
+
+/*
+ * @brief Fills the mesh key of an output setup with the arguments of gVBAPRenderer_Open().
+ * @param key             Output mesh key
+ * @param outGeometryInfo Loudspeaker geometry information for output setting
+ * @param outChannels     Number of real speaker including number of LFE
+ * @param outCICPIndex    CICP index of the output setting
+ * @param renderMode      GVBAP_LEGACY or GVBAP_ENHANCED
+ */
+void gVBAPRenderer_GetMeshKey(VBAP_MESH_KEY* key,
+                              const CICP2GEOMETRY_CHANNEL_GEOMETRY* outGeometryInfo,
+                              int outChannels, int outCICPIndex, int renderMode);
+
+/*
+ * @brief Sets up the speaker triangles, inverse matrices and ghost speaker downmix of a renderer
+ *        from a cached mesh. The vertex list receives the real and ghost speakers.
+ * @return 0 on success, 1 if no mesh is cached for the key, -2 if memory allocation failed
+ */
+int gVBAPRenderer_LoadMesh(const VBAP_MESH_KEY* key, HANDLE_GVBAPRENDERER hgVBAPRenderer,
+                           vertexList* vL);
+
+/*
+ * @brief Stores the mesh of a renderer set up by qh_sphere_triangulation() and
+ *        generateInverseMatrices(), replacing the least recently used mesh.
+ */
+void gVBAPRenderer_StoreMesh(const VBAP_MESH_KEY* key, HANDLE_GVBAPRENDERER hgVBAPRenderer,
+                             const vertexList* vL);
+
+/*
+ * @brief Copies the binary form of a cached mesh, e.g. to generate a compile-time table of it.
+ * @param key   Mesh key from gVBAPRenderer_GetMeshKey()
+ * @param data  Output buffer
+ * @param size  Size of data, at least sizeof(VBAP_MESH)
+ * @return number of bytes written, 0 if no mesh is cached for the key or data is too small
+ */
+UINT gVBAPRenderer_ExportMesh(const VBAP_MESH_KEY* key, void* data, UINT size);
+
+/*
+ * @brief Adds a mesh in binary form to the cache, so that renderers for its output setup skip the
+ *        triangulation, e.g. from a compile-time table loaded at startup.
+ * @param data  Mesh returned by gVBAPRenderer_ExportMesh()
+ * @param size  Size of data
+ * @return 0 on success, -1 if data is no valid mesh of this version. The cache is unchanged then.
+ */
+int gVBAPRenderer_ImportMesh(const void* data, UINT size);
+
+#endif /* GVBAPRENDERER_MESH_H */
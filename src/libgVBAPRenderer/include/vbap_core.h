@@ -92,6 +92,7 @@ amm-info@iis.fraunhofer.de
 #define VBAP_CORE_H
 
 #include "cartesianMath.h"
+#include "FDK_dsp.h"
 
 #define VBAP_PCM FIXP_DBL
 
@@ -208,6 +209,36 @@ typedef struct _SPEAKERSETUP {
 
 } SPEAKERSETUP;
 
+/* Number of object positions whose gains are kept by the renderer */
+#define GVBAP_POSITION_CACHE_SIZE (64)
+
+/*
+ * @brief Gains of one object position, independent of the OAM gain factor. Entries are keyed by
+ * the position and spread after the distance to spread mapping and replaced least recently used.
+ * @param azi, ele          object position
+ * @param spreadAngle, spreadHeight, spreadDepth  object spread
+ * @param hasUniformSpread  uniform spread flag of the metadata
+ * @param isSpread          unit gains are the normalized spread gains, else the gains of
+ * calculateVbapUnitGains()
+ * @param numGains          number of unit gains
+ * @param gainNormInv       inverse gain norm returned by calculateVbapUnitGains()
+ * @param gainNormInvExp    exponent of gainNormInv
+ * @param lastUse           renderer position cache clock of the last lookup, 0 for unused entries
+ */
+typedef struct {
+  FIXP_DBL azi;
+  FIXP_DBL ele;
+  FIXP_DBL spreadAngle;
+  FIXP_DBL spreadHeight;
+  FIXP_DBL spreadDepth;
+  UCHAR hasUniformSpread;
+  UCHAR isSpread;
+  SCHAR numGains;
+  FIXP_DBL gainNormInv;
+  INT gainNormInvExp;
+  UINT lastUse;
+} VBAP_POSITION_CACHE_ENTRY;
+
 /*
  * @brief gVBAP Handler. Holds all information about the speaker setup, the calculated start and end
  * gains, information about the output channels and number of objects. Additional it holds some
@@ -256,11 +287,20 @@ typedef struct _GVBAPRENDERER {
   FIXP_DBL** stepState;  /* Dim: [objects][real channels without LFE] */
   FIXP_DBL** scaleState; /* Dim: [objects][real channels without LFE] */
 
+  FDK_GAIN_RAMP** gainRamps; /* Dim: [objects][2 x real channels without LFE] */
+
   FIXP_DBL* gainCache; /* Dim: [real channels without LFE but with ghost speakers] */
 
+  VBAP_POSITION_CACHE_ENTRY positionCache[GVBAP_POSITION_CACHE_SIZE];
+  FIXP_DBL** positionCacheGains; /* Dim: [GVBAP_POSITION_CACHE_SIZE][real channels + ghosts] */
+  UINT positionCacheClock;
+  UINT positionCacheHits;
+  UINT positionCacheMisses;
+
   FIXP_DBL** downmixMatrix; /* Dim: [real speakers without LFE][real speaker without LFE + ghost
                                speaker] */
   int downmixMatrixNumRows, downmixMatrixNumCols;
+  UCHAR meshShared; /* speaker triangles and downmix were taken from the mesh cache */
 
   SCHAR numChannels;
   SCHAR numLFE;
@@ -304,6 +344,33 @@ int generateInverseMatrices(HANDLE_GVBAPRENDERER hgVBAPRenderer);
 void calculateVbap(HANDLE_GVBAPRENDERER hgVBAPRenderer, OAM_SAMPLE source, FIXP_DBL* final_gains,
                    int noDownmix);
 
+/*
+ * @brief calculateVbap without the OAM gain factor: stores the gains before the power
+ *        normalization in final_gains and returns their number. applyVbapGain() completes them.
+ * @param hgVBAPRenderer  gVBAPRenderer Handle
+ * @param source          Cartesian coordinates of object position
+ * @param final_gains     Array of gains where the unnormalized gains will be stored
+ * @param noDownmix       Do not downmix the ghost speakers
+ * @param gainNormInv     Inverse of the gain norm
+ * @param gainNormInvExp  Exponent of gainNormInv
+ */
+int calculateVbapUnitGains(HANDLE_GVBAPRENDERER hgVBAPRenderer, OAM_SAMPLE source,
+                           FIXP_DBL* final_gains, int noDownmix, FIXP_DBL* gainNormInv,
+                           INT* gainNormInvExp);
+
+/*
+ * @brief Normalizes the gains of calculateVbapUnitGains() and applies the OAM gain factor.
+ *        unitGains and final_gains may be the same array.
+ * @param unitGains       Gains returned by calculateVbapUnitGains()
+ * @param final_gains     Array of gains where the result will be stored
+ * @param numGains        Number of gains returned by calculateVbapUnitGains()
+ * @param gainNormInv     Inverse of the gain norm returned by calculateVbapUnitGains()
+ * @param gainNormInvExp  Exponent of gainNormInv
+ * @param gain            Is a gain factor from the OAM sample
+ */
+void applyVbapGain(const FIXP_DBL* unitGains, FIXP_DBL* final_gains, int numGains,
+                   FIXP_DBL gainNormInv, INT gainNormInvExp, FIXP_DBL gain);
+
 /*
  * @brief Calculates gain factors for given object position.
  *         Includes OAM gain factor and OAM spread angle in calculation
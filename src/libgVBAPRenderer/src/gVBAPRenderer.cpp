@@ -89,6 +89,7 @@ amm-info@iis.fraunhofer.de
 *******************************************************************************/
 
 #include "gVBAPRenderer.h"
+#include "gVBAPRenderer_mesh.h"
 
 /* FDK VBAP library info */
 #define FDK_VBAP_LIB_VL0 1
@@ -103,14 +104,34 @@ amm-info@iis.fraunhofer.de
 #define FDK_VBAP_LIB_BUILD_TIME __TIME__
 #endif
 
-/* #include "coresup.h" --- needed for FDKclock in DEBUG_gVBAPRenderer_RenderFrame_Time_func1,2 */
-
 #if defined(__arm__)
 #include "arm/gVBAPRenderer_arm.cpp"
+#elif defined(__x86__)
+#include "x86/gVBAPRenderer_x86.cpp"
 #endif
 
 #define OBEJCT 0
 
+/* Number of samples of all output channels accumulated at once by gVBAPRenderer_RenderFrame_Time */
+#define GVBAP_RENDER_BLOCK_SIZE (128)
+
+/* gVBAPRenderer_RenderFrame_Time_func1 of every ramp, or the addGainRampMulti DSP kernel */
+static void gVBAPRenderer_addGainRamps(FIXP_DBL* RESTRICT pOut, VBAP_PCM* RESTRICT pIn,
+                                       INT length, FDK_GAIN_RAMP* RESTRICT ramps, INT numRamps) {
+#if defined(FUNCTION_gVBAPRenderer_RenderFrame_Time_func1)
+  for (int n = 0; n < numRamps; n++) {
+    INT s = (ramps[n].shr == 0) ? -1 : 0;
+    INT s1 = (ramps[n].shr == 0) ? ramps[n].shl + 1 : ramps[n].shr - 1;
+
+    gVBAPRenderer_RenderFrame_Time_func1(&pOut[ramps[n].offset], pIn, length, 0, ramps[n].gain,
+                                         ramps[n].step, ramps[n].gain, ramps[n].step, s, s1);
+    ramps[n].gain = (FIXP_DBL)((ULONG)ramps[n].gain + (ULONG)ramps[n].step * length);
+  }
+#else
+  FDK_dspFuncs.addGainRampMulti(pOut, pIn, length, ramps, numRamps);
+#endif
+}
+
 #if (GVBAPRENDERER_MAX_FRAMELENGTH > 1024)
 #define VBAP_SCALE_GAINS (4)
 #else
@@ -973,10 +994,10 @@ static void gVBAPRenderer_Spread_internal_calculateGains(HANDLE_GVBAPRENDERER ph
   gVBAPRenderer_Spread_internal_normalizeVector(gainArray, phgVBAPRenderer->gainCacheLength);
 }
 
+/* Renders the normalized spread gains, without the OAM gain factor */
 static void gVBAPRenderer_Spread_renderSpread(HANDLE_GVBAPRENDERER phgVBAPRenderer,
                                               FIXP_DBL* outputGainArray, OAM_SAMPLE oamSample) {
   FIXP_DBL spread[3] = {oamSample.spreadAngle, oamSample.spreadHeight, oamSample.spreadDepth};
-  FIXP_DBL gain = oamSample.gain;
 
   oamSample.spreadAngle = oamSample.spreadHeight = oamSample.spreadDepth = (FIXP_DBL)0;
   oamSample.gain = FL2FXCONST_DBL(1.0 / 8);
@@ -1004,13 +1025,132 @@ static void gVBAPRenderer_Spread_renderSpread(HANDLE_GVBAPRENDERER phgVBAPRender
 
   /* gain normalization */
   gVBAPRenderer_Spread_internal_normalizeVector(outputGainArray, phgVBAPRenderer->numChannels);
+}
+
+/* Calculates the gains of one object, taking the gains of known positions from the position
+ * cache. Only the OAM gain factor is applied to cached gains. */
+static void gVBAPRenderer_calculateObjectGains(HANDLE_GVBAPRENDERER hgVBAPRenderer,
+                                               OAM_SAMPLE oamSample, FIXP_DBL* gains) {
+  VBAP_POSITION_CACHE_ENTRY* entry = NULL;
+  FIXP_DBL* unitGains;
+  int i;
+
+  for (i = 0; i < GVBAP_POSITION_CACHE_SIZE; i++) {
+    VBAP_POSITION_CACHE_ENTRY* e = &hgVBAPRenderer->positionCache[i];
+    if ((e->lastUse != 0) && (e->azi == oamSample.sph.azi) && (e->ele == oamSample.sph.ele) &&
+        (e->spreadAngle == oamSample.spreadAngle) && (e->spreadHeight == oamSample.spreadHeight) &&
+        (e->spreadDepth == oamSample.spreadDepth) &&
+        (e->hasUniformSpread == hgVBAPRenderer->hasUniformSpread)) {
+      entry = e;
+      break;
+    }
+  }
+
+  if (entry != NULL) {
+    hgVBAPRenderer->positionCacheHits++;
+    unitGains = hgVBAPRenderer->positionCacheGains[entry - hgVBAPRenderer->positionCache];
+  } else {
+    /* replace an unused or else the least recently used entry */
+    entry = &hgVBAPRenderer->positionCache[0];
+    for (i = 1; i < GVBAP_POSITION_CACHE_SIZE; i++) {
+      if (hgVBAPRenderer->positionCache[i].lastUse < entry->lastUse) {
+        entry = &hgVBAPRenderer->positionCache[i];
+      }
+    }
+    hgVBAPRenderer->positionCacheMisses++;
+    unitGains = hgVBAPRenderer->positionCacheGains[entry - hgVBAPRenderer->positionCache];
+
+    entry->azi = oamSample.sph.azi;
+    entry->ele = oamSample.sph.ele;
+    entry->spreadAngle = oamSample.spreadAngle;
+    entry->spreadHeight = oamSample.spreadHeight;
+    entry->spreadDepth = oamSample.spreadDepth;
+    entry->hasUniformSpread = hgVBAPRenderer->hasUniformSpread;
+
+    oamSample.sph.rad = FL2FXCONST_DBL(1.0 / 16);
+    oamSample.cart = sphericalToCartesian(oamSample.sph);
+
+    if ((hgVBAPRenderer->renderMode != GVBAP_LEGACY) &&
+        ((oamSample.spreadAngle != (FIXP_DBL)0) ||
+         (!hgVBAPRenderer->hasUniformSpread && oamSample.spreadHeight != (FIXP_DBL)0))) {
+      gVBAPRenderer_Spread_renderSpread(hgVBAPRenderer, unitGains, oamSample);
+      entry->isSpread = 1;
+      entry->numGains = hgVBAPRenderer->numChannels;
+    } else {
+      entry->isSpread = 0;
+      entry->numGains = calculateVbapUnitGains(hgVBAPRenderer, oamSample, unitGains, 0,
+                                               &entry->gainNormInv, &entry->gainNormInvExp);
+    }
+  }
+  entry->lastUse = ++hgVBAPRenderer->positionCacheClock;
 
   /* Apply gain factor */
-  for (int i = 0; i < phgVBAPRenderer->numChannels; i++) {
-    outputGainArray[i] = fMult(outputGainArray[i], gain) << 3;
+  if (entry->isSpread) {
+    for (i = 0; i < entry->numGains; i++) {
+      gains[i] = fMult(unitGains[i], oamSample.gain) << 3;
+    }
+  } else {
+    applyVbapGain(unitGains, gains, entry->numGains, entry->gainNormInv, entry->gainNormInvExp,
+                  oamSample.gain);
   }
 }
 
+void gVBAPRenderer_GetPositionCacheStats(HANDLE_GVBAPRENDERER hgVBAPRenderer, UINT* hits,
+                                         UINT* misses) {
+  *hits = hgVBAPRenderer->positionCacheHits;
+  *misses = hgVBAPRenderer->positionCacheMisses;
+}
+
+void gVBAPRenderer_GetSetupInfo(HANDLE_GVBAPRENDERER hgVBAPRenderer, UINT* numTriangles,
+                                UINT* numGhosts, UINT* meshShared) {
+  *numTriangles = (UINT)hgVBAPRenderer->speakerSetup.speakerTripletSize;
+  *numGhosts = (UINT)hgVBAPRenderer->numGhosts;
+  *meshShared = (UINT)hgVBAPRenderer->meshShared;
+}
+
+void gVBAPRenderer_CopyMetadata(HANDLE_GVBAPRENDERER hgVBAPRendererDst,
+                                HANDLE_GVBAPRENDERER hgVBAPRendererSrc) {
+  int size;
+
+  FDK_ASSERT(hgVBAPRendererDst->numObjects == hgVBAPRendererSrc->numObjects);
+  FDK_ASSERT(hgVBAPRendererDst->numOamFrames == hgVBAPRendererSrc->numOamFrames);
+
+  /* The OAM samples of all OAM frames are allocated in one block */
+  size = hgVBAPRendererSrc->numOamFrames * hgVBAPRendererSrc->numObjects * sizeof(OAM_SAMPLE);
+  mpegh_FDKmemcpy(hgVBAPRendererDst->oamSamples[0], hgVBAPRendererSrc->oamSamples[0], size);
+  mpegh_FDKmemcpy(hgVBAPRendererDst->oamSamplesValid[0], hgVBAPRendererSrc->oamSamplesValid[0],
+                  size);
+  mpegh_FDKmemcpy(hgVBAPRendererDst->metadataPresent, hgVBAPRendererSrc->metadataPresent,
+                  sizeof(hgVBAPRendererSrc->metadataPresent));
+  mpegh_FDKmemcpy(hgVBAPRendererDst->metadataPresentValid, hgVBAPRendererSrc->metadataPresentValid,
+                  sizeof(hgVBAPRendererSrc->metadataPresentValid));
+  hgVBAPRendererDst->hasUniformSpread = hgVBAPRendererSrc->hasUniformSpread;
+  hgVBAPRendererDst->oamDataValid = hgVBAPRendererSrc->oamDataValid;
+}
+
+int gVBAPRenderer_GetMetadata(HANDLE_GVBAPRENDERER hgVBAPRenderer,
+                              const OAM_SAMPLE** ppStopSamples, INT* pStopSamplePositions) {
+  int oamFrame, oamFrameWithMetaData = -1, numStops = 0;
+
+  if (!hgVBAPRenderer->oamDataValid) {
+    oam_concealment(hgVBAPRenderer);
+  }
+
+  /* Same stops as in gVBAPRenderer_RenderFrame_Time() */
+  for (oamFrame = 0; oamFrame < hgVBAPRenderer->numOamFrames; oamFrame++) {
+    if (hgVBAPRenderer->metadataPresent[oamFrame]) {
+      oamFrameWithMetaData = oamFrame;
+    } else if ((oamFrame != (hgVBAPRenderer->numOamFrames - 1)) || (oamFrameWithMetaData < 0)) {
+      continue;
+    }
+    ppStopSamples[numStops] = hgVBAPRenderer->oamSamples[oamFrameWithMetaData];
+    pStopSamplePositions[numStops] = (oamFrame + 1) * hgVBAPRenderer->oamFrameLength;
+    numStops++;
+  }
+
+  return numStops;
+}
+
 static FIXP_DBL gVBAPRenderer_Spread_distanceToSpreadIndividual(FIXP_DBL d, FIXP_DBL sIn) {
   /* sNorm = (((float)atan(0.1f / d)) * 0.31830988f * 2.0f - 0.0636f) * 1.0679f; */
   /* sTmp = 0.5f * ((1.0f - d) + sNorm); */
@@ -1179,6 +1319,8 @@ int gVBAPRenderer_Open(HANDLE_GVBAPRENDERER* phgVBAPRenderer, int numObjects, in
   vertexList* vL = &vList;
   triangleList tList;
   triangleList* tL = &tList;
+  VBAP_MESH_KEY meshKey;
+  int meshLoaded;
   /* Save azimuth an elevation temporarily for vertex, triangle-List and downmixMatrix generation */
   /* In this way the same order as speakerList is guaranteed for the vertex list and the saved
    * mapping will fit to it */
@@ -1269,61 +1411,80 @@ int gVBAPRenderer_Open(HANDLE_GVBAPRENDERER* phgVBAPRenderer, int numObjects, in
   }
   (*phgVBAPRenderer)->speakerSetup.speakerListSize = cnt;
 
-  /* Generate vertexList and add Ghost speakers if necessary */
-  // vL = newVertexList(outChannels - numLFE + 6);    /* Add 6 because a maximum of 6 ghost speakers
-  // could be added */
-  resetVertexList(vL);
-
-  qh_gen_VertexList(outChannels - numLFE, &azimuth[0], &elevation[0], vL);
-
-  // tL = newTriangleList((2*(outChannels - numLFE))+5);  /* The length of triangle List is a
-  // estimated value */
-  resetTriangleList(tL);
+  /* Custom loudspeaker layouts have no imaginary speaker tables and are triangulated like an
+   * unknown output setting */
+  if (cicp2geometry_is_custom_layout(outCICPIndex)) {
+    outCICPIndex = 0;
+  }
 
-  /* Generate triangle List for speaker triangles and a downmixMatrix if Ghostspeaker where added */
-  if (qh_sphere_triangulation((renderMode == GVBAP_ENHANCED) ? outCICPIndex : 0, vL, tL,
-                              &(*phgVBAPRenderer)->downmixMatrix,
-                              &(*phgVBAPRenderer)->downmixMatrixNumRows,
-                              &(*phgVBAPRenderer)->downmixMatrixNumCols) != 0) {
+  /* Take the speaker triangles, their inverse matrices and the ghost speaker downmix from the
+   * mesh cache, or build them and add them to the cache */
+  gVBAPRenderer_GetMeshKey(&meshKey, outGeometryInfo, outChannels, outCICPIndex, renderMode);
+  meshLoaded = gVBAPRenderer_LoadMesh(&meshKey, *phgVBAPRenderer, vL);
+  if (meshLoaded < 0) {
     return -2; /* could not allocate memory */
   }
+  (*phgVBAPRenderer)->meshShared = (meshLoaded == 0);
+  if (meshLoaded != 0) {
+    /* Generate vertexList and add Ghost speakers if necessary */
+    // vL = newVertexList(outChannels - numLFE + 6);    /* Add 6 because a maximum of 6 ghost
+    // speakers could be added */
+    resetVertexList(vL);
+
+    qh_gen_VertexList(outChannels - numLFE, &azimuth[0], &elevation[0], vL);
+
+    // tL = newTriangleList((2*(outChannels - numLFE))+5);  /* The length of triangle List is a
+    // estimated value */
+    resetTriangleList(tL);
+
+    /* Generate triangle List for speaker triangles and a downmixMatrix if Ghostspeaker where
+     * added */
+    if (qh_sphere_triangulation((renderMode == GVBAP_ENHANCED) ? outCICPIndex : 0, vL, tL,
+                                &(*phgVBAPRenderer)->downmixMatrix,
+                                &(*phgVBAPRenderer)->downmixMatrixNumRows,
+                                &(*phgVBAPRenderer)->downmixMatrixNumCols) != 0) {
+      return -2; /* could not allocate memory */
+    }
 
-  if (vL->size ==
-      (outChannels -
-       numLFE)) /* if no downmixMatrix exists then free memory and set pointer to NULL */
-  {
-    if ((*phgVBAPRenderer)->downmixMatrix != NULL) {
-      mpegh_fdkFreeMatrix2D((void**)(*phgVBAPRenderer)->downmixMatrix);
-      (*phgVBAPRenderer)->downmixMatrix = NULL;
+    if (vL->size ==
+        (outChannels -
+         numLFE)) /* if no downmixMatrix exists then free memory and set pointer to NULL */
+    {
+      if ((*phgVBAPRenderer)->downmixMatrix != NULL) {
+        mpegh_fdkFreeMatrix2D((void**)(*phgVBAPRenderer)->downmixMatrix);
+        (*phgVBAPRenderer)->downmixMatrix = NULL;
+      }
     }
-  }
 
-  /* allocate memory for speakerTriplet and fill it with values */
-  if (((*phgVBAPRenderer)->speakerSetup.speakerTriplet =
-           (SPEAKERTRIPLET*)mpegh_FDKmalloc(tL->size * sizeof(SPEAKERTRIPLET))) == NULL) {
-    return -2; /* could not allocate memory */
-  }
+    /* allocate memory for speakerTriplet and fill it with values */
+    if (((*phgVBAPRenderer)->speakerSetup.speakerTriplet =
+             (SPEAKERTRIPLET*)mpegh_FDKmalloc(tL->size * sizeof(SPEAKERTRIPLET))) == NULL) {
+      return -2; /* could not allocate memory */
+    }
+
+    /* copy triangle list and fill matrices */
+    for (i = 0; i < tL->size; i++) {
+      (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].triangle[0] = tL->element[i].index[0];
+      (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].triangle[1] = tL->element[i].index[1];
+      (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].triangle[2] = tL->element[i].index[2];
+
+      (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].matrix[0] =
+          vL->element[tL->element[i].index[0]].xyz;
+      (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].matrix[1] =
+          vL->element[tL->element[i].index[1]].xyz;
+      (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].matrix[2] =
+          vL->element[tL->element[i].index[2]].xyz;
+    }
+    (*phgVBAPRenderer)->speakerSetup.speakerTripletSize = tL->size;
 
-  /* copy triangle list and fill matrices */
-  for (i = 0; i < tL->size; i++) {
-    (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].triangle[0] = tL->element[i].index[0];
-    (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].triangle[1] = tL->element[i].index[1];
-    (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].triangle[2] = tL->element[i].index[2];
-
-    (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].matrix[0] =
-        vL->element[tL->element[i].index[0]].xyz;
-    (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].matrix[1] =
-        vL->element[tL->element[i].index[1]].xyz;
-    (*phgVBAPRenderer)->speakerSetup.speakerTriplet[i].matrix[2] =
-        vL->element[tL->element[i].index[2]].xyz;
+    /* Calculate inverse matrices */
+    generateInverseMatrices(*phgVBAPRenderer);
+
+    gVBAPRenderer_StoreMesh(&meshKey, *phgVBAPRenderer, vL);
   }
-  (*phgVBAPRenderer)->speakerSetup.speakerTripletSize = tL->size;
 
   numGhosts = vL->size - (outChannels - numLFE); /* Number of Ghostspeakers */
 
-  /* Calculate inverse matrices */
-  generateInverseMatrices(*phgVBAPRenderer);
-
   /* Set parameters */
   (*phgVBAPRenderer)->numLFE = numLFE;           /* Number of LFE speakers */
   (*phgVBAPRenderer)->numChannels = outChannels; /* Number of real speakers including LFE */
@@ -1343,6 +1504,11 @@ int gVBAPRenderer_Open(HANDLE_GVBAPRENDERER* phgVBAPRenderer, int numObjects, in
   (*phgVBAPRenderer)->gainCache =
       (FIXP_DBL*)mpegh_FDKmalloc((outChannels + numGhosts - numLFE) * sizeof(FIXP_DBL));
 
+  /* Alocate memory for the gains of the position cache. Length is number of real speakers
+   * including LFE + number of ghosts */
+  (*phgVBAPRenderer)->positionCacheGains = (FIXP_DBL**)mpegh_fdkCallocMatrix2D(
+      GVBAP_POSITION_CACHE_SIZE, outChannels + numGhosts, sizeof(FIXP_DBL));
+
   /* Alocate memory for start and end gains. Length is number of real speakers including LFE */
   (*phgVBAPRenderer)->startGains = (FIXP_DBL**)mpegh_fdkCallocMatrix2D(
       numObjects, (*phgVBAPRenderer)->numChannels,
@@ -1357,6 +1523,9 @@ int gVBAPRenderer_Open(HANDLE_GVBAPRENDERER* phgVBAPRenderer, int numObjects, in
   (*phgVBAPRenderer)->scaleState = (FIXP_DBL**)mpegh_fdkCallocMatrix2D(
       numObjects, (*phgVBAPRenderer)->numChannels,
       sizeof(FIXP_DBL)); /* Dim: objects x (number of output channels) */
+  (*phgVBAPRenderer)->gainRamps = (FDK_GAIN_RAMP**)mpegh_fdkCallocMatrix2D(
+      numObjects, 2 * (*phgVBAPRenderer)->numChannels,
+      sizeof(FDK_GAIN_RAMP)); /* Dim: objects x (2 x number of output channels) */
 
   (*phgVBAPRenderer)->startGainsMax =
       (FIXP_DBL*)mpegh_FDKmalloc((*phgVBAPRenderer)->numChannels * sizeof(FIXP_DBL));
@@ -1364,9 +1533,11 @@ int gVBAPRenderer_Open(HANDLE_GVBAPRENDERER* phgVBAPRenderer, int numObjects, in
       (FIXP_DBL*)mpegh_FDKmalloc((*phgVBAPRenderer)->numChannels * sizeof(FIXP_DBL));
   (*phgVBAPRenderer)->OAM_parsed_data =
       (INT*)mpegh_FDKcalloc((*phgVBAPRenderer)->numObjects * OAM_NUMBER_MAX_COMPONENTS, sizeof(INT));
-  if (((*phgVBAPRenderer)->gainCache == NULL) || ((*phgVBAPRenderer)->startGains == NULL) ||
-      ((*phgVBAPRenderer)->endGains == NULL) || ((*phgVBAPRenderer)->stepState == NULL) ||
-      ((*phgVBAPRenderer)->scaleState == NULL) || ((*phgVBAPRenderer)->startGainsMax == NULL) ||
+  if (((*phgVBAPRenderer)->gainCache == NULL) ||
+      ((*phgVBAPRenderer)->positionCacheGains == NULL) ||
+      ((*phgVBAPRenderer)->startGains == NULL) || ((*phgVBAPRenderer)->endGains == NULL) ||
+      ((*phgVBAPRenderer)->stepState == NULL) || ((*phgVBAPRenderer)->scaleState == NULL) ||
+      ((*phgVBAPRenderer)->gainRamps == NULL) || ((*phgVBAPRenderer)->startGainsMax == NULL) ||
       ((*phgVBAPRenderer)->prevGainsMax == NULL) || ((*phgVBAPRenderer)->OAM_parsed_data == NULL)) {
     return -2; /* could not allocate memory */
   }
@@ -1592,6 +1763,10 @@ int gVBAPRenderer_RenderFrame_Time(HANDLE_GVBAPRENDERER RESTRICT hgVBAPRenderer,
                     << (DFRACT_BITS - 1 - VBAP_MAX_SCALE_OBJECTS);
 
   FIXP_DBL endGainsMax[GVBAPRENDERER_MAX_CHANNEL_OUT];
+  INT channelShl[GVBAPRENDERER_MAX_CHANNEL_OUT], channelShr[GVBAPRENDERER_MAX_CHANNEL_OUT];
+  INT channelShift[GVBAPRENDERER_MAX_CHANNEL_OUT];
+  UCHAR channelActive[GVBAPRENDERER_MAX_CHANNEL_OUT];
+  UCHAR numRampsBefore[GVBAPRENDERER_MAX_OBJECTS], numRampsAfter[GVBAPRENDERER_MAX_OBJECTS];
 
   while (oamFrame < numOamFrames) {
     OAM_SAMPLE *oamStopSamples, oamStopSample;
@@ -1627,28 +1802,15 @@ int gVBAPRenderer_RenderFrame_Time(HANDLE_GVBAPRENDERER RESTRICT hgVBAPRenderer,
 
     /* First calculate gains for all objects */
     for (object = 0; object < hgVBAPRenderer->numObjects; object++) {
-      /* create local copy of sample, as radius is modified */
+      /* create local copy of sample, as spread is modified */
       oamStopSample = oamStopSamples[object];
 
-      if (hgVBAPRenderer->renderMode == GVBAP_LEGACY) {
-        oamStopSample.sph.rad = FL2FXCONST_DBL(1.0 / 16);
-        oamStopSample.cart = sphericalToCartesian(oamStopSample.sph);
-        calculateVbap(hgVBAPRenderer, oamStopSample, hgVBAPRenderer->endGains[object], 0);
-      } else {
+      if (hgVBAPRenderer->renderMode != GVBAP_LEGACY) {
         /* distance to spread mapping */
         gVBAPRenderer_Spread_distanceToSpread(&oamStopSample, hgVBAPRenderer->hasUniformSpread);
-
-        oamStopSample.sph.rad = FL2FXCONST_DBL(1.0 / 16);
-        oamStopSample.cart = sphericalToCartesian(oamStopSample.sph);
-
-        if ((oamStopSample.spreadAngle != (FIXP_DBL)0) ||
-            (!hgVBAPRenderer->hasUniformSpread && oamStopSample.spreadHeight != (FIXP_DBL)0)) {
-          gVBAPRenderer_Spread_renderSpread(hgVBAPRenderer, hgVBAPRenderer->endGains[object],
-                                            oamStopSample);
-        } else {
-          calculateVbap(hgVBAPRenderer, oamStopSample, hgVBAPRenderer->endGains[object], 0);
-        }
       }
+      gVBAPRenderer_calculateObjectGains(hgVBAPRenderer, oamStopSample,
+                                         hgVBAPRenderer->endGains[object]);
 
       for (channel = 0; channel < hgVBAPRenderer->numChannels; channel++) {
         endGainsMax[channel] =
@@ -1670,15 +1832,11 @@ int gVBAPRenderer_RenderFrame_Time(HANDLE_GVBAPRENDERER RESTRICT hgVBAPRenderer,
     }
     hgVBAPRenderer->startGainsFilled = 1;
 
-    /* Add object channels multiplied by gain to output buffer */
+    /* Derive the headroom of every output channel from its accumulated maximum gain */
     for (channel = 0; channel < hgVBAPRenderer->numChannels; channel++) {
-      int s, s1, s2;
+      int s, s1;
       FIXP_DBL tmp, maxGain;
 
-      mappedChannel = hgVBAPRenderer->speakerSetup.mapping[channel];
-      C_AALLOC_SCRATCH_START(outputCache, FIXP_DBL, GVBAPRENDERER_MAX_FRAMELENGTH)
-      mpegh_FDKmemclear(outputCache, length * sizeof(FIXP_DBL));
-
       tmp = fMax(hgVBAPRenderer->startGainsMax[channel], endGainsMax[channel]);
       maxGain = fMax(tmp, hgVBAPRenderer->prevGainsMax[channel]);
 
@@ -1694,7 +1852,7 @@ int gVBAPRenderer_RenderFrame_Time(HANDLE_GVBAPRENDERER RESTRICT hgVBAPRenderer,
       s = fMax(-VBAP_SCALE_GAINS, (VBAP_MAX_SCALE_OBJECTS - s));
 
       /* scalefactor s2 can be in the range of 1 to VBAP_MAX_SCALE_SAMPLES+1 */
-      s2 = VBAP_MAX_SCALE_SAMPLES - VBAP_MAX_SCALE_OBJECTS + s + 1;
+      channelShift[channel] = VBAP_MAX_SCALE_SAMPLES - VBAP_MAX_SCALE_OBJECTS + s + 1;
 
       /* consider fMultDiv2() */
       s = s - 1;
@@ -1703,8 +1861,22 @@ int gVBAPRenderer_RenderFrame_Time(HANDLE_GVBAPRENDERER RESTRICT hgVBAPRenderer,
       if (s < 0) {
         s1 = -s;
       }
+      channelShl[channel] = (s < 0) ? s1 - 1 : 0;
+      channelShr[channel] = (s < 0) ? 0 : s1 + 1;
+      channelActive[channel] = 0;
+    }
 
-      for (object = 0; object < hgVBAPRenderer->numObjects; object++) {
+    /* Classify the gains of all object and channel pairs: zero gains are skipped, static gains
+     * are a plain scale-add and only the remaining ones are ramped. The ramp of the previous frame
+     * covers the samples before startSamplePosition, the new ramp all remaining samples. */
+    for (object = 0; object < hgVBAPRenderer->numObjects; object++) {
+      FDK_GAIN_RAMP* rampsBefore = hgVBAPRenderer->gainRamps[object];
+      FDK_GAIN_RAMP* rampsAfter = &rampsBefore[hgVBAPRenderer->numChannels];
+
+      numRampsBefore[object] = 0;
+      numRampsAfter[object] = 0;
+
+      for (channel = 0; channel < hgVBAPRenderer->numChannels; channel++) {
         /* load States */
         FIXP_DBL scaleState = hgVBAPRenderer->scaleState[object][channel];
         FIXP_DBL stepState = hgVBAPRenderer->stepState[object][channel];
@@ -1724,114 +1896,102 @@ int gVBAPRenderer_RenderFrame_Time(HANDLE_GVBAPRENDERER RESTRICT hgVBAPRenderer,
             stepState == (FIXP_DBL)0) {
           continue;
         }
-        VBAP_PCM* pIn = &inputBuffer[(object * inputBufferChannelOffset) + startSample];
-        FDK_ASSERT((startSamplePosition & (INT)7) ==
-                   0); /* due to arm (divisible by 8) and xtensa (divisible by 4) restriction in
-                          implementation */
-        FDK_ASSERT((length & (INT)7) == 0); /* due to arm (divisible by 8) and xtensa (divisible by
-                                               4) restriction in implementation */
-
-/* #define DEBUG_gVBAPRenderer_RenderFrame_Time_func1 */
-#ifdef DEBUG_gVBAPRenderer_RenderFrame_Time_func1
-        INT start_clock = FDKclock();
-#endif
-#if defined(FUNCTION_gVBAPRenderer_RenderFrame_Time_func1)
+
         /* save states */
-        hgVBAPRenderer->scaleState[object][channel] = scale + step * (length - startSamplePosition);
+        hgVBAPRenderer->scaleState[object][channel] =
+            (FIXP_DBL)((ULONG)scale + (ULONG)step * (length - startSamplePosition));
         hgVBAPRenderer->stepState[object][channel] = step;
-        gVBAPRenderer_RenderFrame_Time_func1(outputCache, pIn, length, startSamplePosition, scale,
-                                             step, scaleState, stepState, s, s1);
-#else
-        int sample;
-
-        if (s < 0) {
-          FDK_ASSERT(scale <= maxGain);
-          FDK_ASSERT(scaleState <= maxGain);
-          for (sample = 0; sample < startSamplePosition;
-               sample++) /* process first startSamplePosition samples */
-          {
-            scaleState = scaleState + stepState;
-            outputCache[sample] += fMult((FIXP_DBL)pIn[sample], scaleState) << (s1 - 1);
-          }
-          for (; sample < length; sample++) /* process remaining samples */
-          {
-            scale = scale + step;
-            outputCache[sample] += fMult((FIXP_DBL)pIn[sample], scale) << (s1 - 1);
-          }
-          FDK_ASSERT(scale <= maxGain);
-          FDK_ASSERT(scaleState <= maxGain);
-        } else {
-          FDK_ASSERT(scale <= maxGain);
-          FDK_ASSERT(scaleState <= maxGain);
-          for (sample = 0; sample < startSamplePosition;
-               sample++) /* process first startSamplePosition samples */
-          {
-            scaleState = scaleState + stepState;
-            outputCache[sample] += fMult((FIXP_DBL)pIn[sample], scaleState) >> (s1 + 1);
-          }
-          for (; sample < length; sample++) /* process remaining samples */
-          {
-            scale = scale + step;
-            outputCache[sample] += fMult((FIXP_DBL)pIn[sample], scale) >> (s1 + 1);
-          }
-          FDK_ASSERT(scale <= maxGain);
-          FDK_ASSERT(scaleState <= maxGain);
+
+        if ((startSamplePosition > 0) &&
+            ((scaleState != (FIXP_DBL)0) || (stepState != (FIXP_DBL)0))) {
+          FDK_GAIN_RAMP* ramp = &rampsBefore[numRampsBefore[object]++];
+          ramp->offset = channel * GVBAP_RENDER_BLOCK_SIZE;
+          ramp->gain = scaleState;
+          ramp->step = stepState;
+          ramp->shl = channelShl[channel];
+          ramp->shr = channelShr[channel];
         }
-        /* save states */
-        hgVBAPRenderer->scaleState[object][channel] = scale;
-        hgVBAPRenderer->stepState[object][channel] = step;
-#endif
-#ifdef DEBUG_gVBAPRenderer_RenderFrame_Time_func1
-        INT stop_clock = FDKclock();
-        mpegh_FDKprintf("gVBAPRenderer_RenderFrame_Time_func1: %d  length=%d  s=%d  s1=%d\n",
-                  stop_clock - start_clock, length, s, s1);
-        for (int sample = 0; sample < length; sample += 4) {
-          mpegh_FDKprintf("0x%08X 0x%08X 0x%08X 0x%08X smp=%d 0x%08X 0x%08X 0x%08X 0x%08X\n",
-                    outputCache[sample + 0], outputCache[sample + 1], outputCache[sample + 2],
-                    outputCache[sample + 3], sample, pIn[sample + 0], pIn[sample + 1],
-                    pIn[sample + 2], pIn[sample + 3]);
+        if ((scale != (FIXP_DBL)0) || (step != (FIXP_DBL)0)) {
+          FDK_GAIN_RAMP* ramp = &rampsAfter[numRampsAfter[object]++];
+          ramp->offset = channel * GVBAP_RENDER_BLOCK_SIZE;
+          ramp->gain = scale;
+          ramp->step = step;
+          ramp->shl = channelShl[channel];
+          ramp->shr = channelShr[channel];
         }
-        mpegh_FDKprintf("scale: 0x%08X\n", hgVBAPRenderer->scaleState[object][channel]);
-        mpegh_FDKprintf("step:  0x%08X\n", hgVBAPRenderer->stepState[object][channel]);
-        ;
-#endif
+        channelActive[channel] = 1;
       }
+    }
 
-      VBAP_PCM* pOut = &outputBuffer[(mappedChannel * hgVBAPRenderer->frameLength) + startSample];
+    FDK_ASSERT((startSamplePosition & (INT)7) ==
+               0); /* due to arm (divisible by 8) and xtensa (divisible by 4) restriction in
+                      implementation */
+    FDK_ASSERT((length & (INT)7) == 0); /* due to arm (divisible by 8) and xtensa (divisible by
+                                           4) restriction in implementation */
 
-/* #define DEBUG_gVBAPRenderer_RenderFrame_Time_func2 */
-#ifdef DEBUG_gVBAPRenderer_RenderFrame_Time_func2
-      INT start_clock = FDKclock();
-#endif
+    /* Add object channels multiplied by gain to output buffer, one block of samples of all
+     * channels at a time to keep the channel caches and the object inputs in the data cache */
+    C_AALLOC_SCRATCH_START(outputCache, FIXP_DBL,
+                           GVBAPRENDERER_MAX_CHANNEL_OUT * GVBAP_RENDER_BLOCK_SIZE)
+    for (int block = 0; block < length; block += GVBAP_RENDER_BLOCK_SIZE) {
+      int blockLength = fMin(length - block, GVBAP_RENDER_BLOCK_SIZE);
+      int split = fMax(fMin(startSamplePosition - block, blockLength), 0);
 
-#if defined(FUNCTION_gVBAPRenderer_RenderFrame_Time_func2)
-      gVBAPRenderer_RenderFrame_Time_func2(pOut, outputCache, length, s2 - 1);
-#else
+      for (channel = 0; channel < hgVBAPRenderer->numChannels; channel++) {
+        if (channelActive[channel]) {
+          mpegh_FDKmemclear(&outputCache[channel * GVBAP_RENDER_BLOCK_SIZE],
+                            blockLength * sizeof(FIXP_DBL));
+        }
+      }
+
+      for (object = 0; object < hgVBAPRenderer->numObjects; object++) {
+        VBAP_PCM* pIn = &inputBuffer[(object * inputBufferChannelOffset) + startSample + block];
 
-      /* copy left shifted and saturated samples to output buffer */
-      if (s2 > 1) {
-        for (int sample = 0; sample < length; sample++) {
-          pOut[sample] = fAddSaturate(
-              pOut[sample], SATURATE_LEFT_SHIFT(outputCache[sample], s2 - 1, DFRACT_BITS));
+        if (split > 0 && numRampsBefore[object] > 0) {
+          gVBAPRenderer_addGainRamps(outputCache, pIn, split, hgVBAPRenderer->gainRamps[object],
+                                     numRampsBefore[object]);
         }
-      } else {
-        for (int sample = 0; sample < length; sample++) {
-          pOut[sample] = fAddSaturate(pOut[sample], outputCache[sample]);
+        if (split < blockLength && numRampsAfter[object] > 0) {
+          gVBAPRenderer_addGainRamps(
+              &outputCache[split], &pIn[split], blockLength - split,
+              &hgVBAPRenderer->gainRamps[object][hgVBAPRenderer->numChannels],
+              numRampsAfter[object]);
         }
       }
+
+      for (channel = 0; channel < hgVBAPRenderer->numChannels; channel++) {
+        int s2 = channelShift[channel];
+        FIXP_DBL* pCache = &outputCache[channel * GVBAP_RENDER_BLOCK_SIZE];
+
+        /* silent channels leave the output buffer untouched */
+        if (!channelActive[channel]) {
+          continue;
+        }
+
+        mappedChannel = hgVBAPRenderer->speakerSetup.mapping[channel];
+        VBAP_PCM* pOut =
+            &outputBuffer[(mappedChannel * hgVBAPRenderer->frameLength) + startSample + block];
+
+#if defined(FUNCTION_gVBAPRenderer_RenderFrame_Time_func2)
+        gVBAPRenderer_RenderFrame_Time_func2(pOut, pCache, blockLength, s2 - 1);
+#else
+
+        /* copy left shifted and saturated samples to output buffer */
+        if (s2 > 1) {
+          for (int sample = 0; sample < blockLength; sample++) {
+            pOut[sample] = fAddSaturate(
+                pOut[sample], SATURATE_LEFT_SHIFT(pCache[sample], s2 - 1, DFRACT_BITS));
+          }
+        } else {
+          for (int sample = 0; sample < blockLength; sample++) {
+            pOut[sample] = fAddSaturate(pOut[sample], pCache[sample]);
+          }
+        }
 #endif
-#ifdef DEBUG_gVBAPRenderer_RenderFrame_Time_func2
-      INT stop_clock = FDKclock();
-      mpegh_FDKprintf("gVBAPRenderer_RenderFrame_Time_func2: %d  s2=%d\n", stop_clock - start_clock, s2);
-      for (int sample = 0; sample < length; sample += 4) {
-        mpegh_FDKprintf("0x%08X 0x%08X 0x%08X 0x%08X smp=%d 0x%08X 0x%08X 0x%08X 0x%08X\n",
-                  pOut[sample + 0], pOut[sample + 1], pOut[sample + 2], pOut[sample + 3], sample,
-                  outputCache[sample + 0], outputCache[sample + 1], outputCache[sample + 2],
-                  outputCache[sample + 3]);
       }
-#endif
-      C_AALLOC_SCRATCH_END(outputCache, FIXP_DBL, GVBAPRENDERER_MAX_FRAMELENGTH)
     }
+    C_AALLOC_SCRATCH_END(outputCache, FIXP_DBL,
+                         GVBAPRENDERER_MAX_CHANNEL_OUT * GVBAP_RENDER_BLOCK_SIZE)
 
     oamFrame++;
     startSample = stopSample;
@@ -1847,6 +2007,7 @@ int gVBAPRenderer_Close(HANDLE_GVBAPRENDERER hgVBAPRenderer) {
 
   mpegh_fdkFreeMatrix2D((void**)hgVBAPRenderer->stepState);
   mpegh_fdkFreeMatrix2D((void**)hgVBAPRenderer->scaleState);
+  mpegh_fdkFreeMatrix2D((void**)hgVBAPRenderer->gainRamps);
 
   /* free maximum start gain memory */
   mpegh_FDKfree(hgVBAPRenderer->startGainsMax);
@@ -1859,6 +2020,7 @@ int gVBAPRenderer_Close(HANDLE_GVBAPRENDERER hgVBAPRenderer) {
 
   /* free gain cache */
   mpegh_FDKfree(hgVBAPRenderer->gainCache);
+  mpegh_fdkFreeMatrix2D((void**)hgVBAPRenderer->positionCacheGains);
 
   /* free speaker triplet */
   mpegh_FDKfree(hgVBAPRenderer->speakerSetup.speakerTriplet);
@@ -0,0 +1,303 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+/******************** MPEG-H 3DA object rendering library **********************
+
+   Author(s):
+
+   Description: Process-wide cache of the speaker triangulation meshes
+
+*******************************************************************************/
+
+#include <mutex>
+
+#include "gVBAPRenderer_mesh.h"
+
+/* The cache is shared by all renderer instances of the process. It lives in static storage, so
+ * that no instance allocator ever owns memory another instance releases. */
+static std::mutex vbapMeshCacheLock;
+static VBAP_MESH vbapMeshCache[GVBAP_MESH_CACHE_SIZE];
+static UINT vbapMeshCacheLastUse[GVBAP_MESH_CACHE_SIZE]; /* 0: slot empty */
+static UINT vbapMeshCacheClock;
+
+/* Returns the slot of key, or -1. Call with vbapMeshCacheLock held. */
+static int findMesh(const VBAP_MESH_KEY* key) {
+  for (int i = 0; i < GVBAP_MESH_CACHE_SIZE; i++) {
+    if ((vbapMeshCacheLastUse[i] != 0) &&
+        (mpegh_FDKmemcmp(&vbapMeshCache[i].key, key, sizeof(*key)) == 0)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/* Returns the slot of key if cached, otherwise an empty or the least recently used slot, and marks
+ * it used. Call with vbapMeshCacheLock held. */
+static VBAP_MESH* allocMesh(const VBAP_MESH_KEY* key) {
+  int slot = findMesh(key);
+
+  if (slot < 0) {
+    slot = 0;
+    for (int i = 1; i < GVBAP_MESH_CACHE_SIZE; i++) {
+      if (vbapMeshCacheLastUse[i] < vbapMeshCacheLastUse[slot]) {
+        slot = i;
+      }
+    }
+  }
+  vbapMeshCacheLastUse[slot] = ++vbapMeshCacheClock;
+
+  return &vbapMeshCache[slot];
+}
+
+/* Checks the sizes and indices of an imported mesh */
+static int isValidMesh(const VBAP_MESH* mesh) {
+  if ((mesh->key.numSpeakers < 0) || (mesh->key.numSpeakers > GVBAPRENDERER_MAX_CHANNEL_OUT) ||
+      (mesh->numVertices < mesh->key.numSpeakers) ||
+      (mesh->numVertices > GVBAPRENDERER_VERTEX_LIST_MAX_SIZE) || (mesh->numTriplets < 0) ||
+      (mesh->numTriplets > GVBAPRENDERER_TRIANGLE_LIST_MAX_SIZE)) {
+    return 0;
+  }
+  /* the renderer downmixes all vertices to the real speakers if there are ghost speakers */
+  if (mesh->hasDownmixMatrix != (mesh->numVertices > mesh->key.numSpeakers)) {
+    return 0;
+  }
+  if (mesh->hasDownmixMatrix &&
+      ((mesh->downmixMatrixNumRows != mesh->key.numSpeakers) ||
+       (mesh->downmixMatrixNumCols != mesh->numVertices) ||
+       (mesh->downmixMatrixNumRows > GVBAPRENDERER_MAX_CHANNEL_OUT) ||
+       (mesh->downmixMatrixNumCols > GVBAPRENDERER_VERTEX_LIST_MAX_SIZE))) {
+    return 0;
+  }
+  for (int i = 0; i < mesh->numTriplets; i++) {
+    for (int j = 0; j < 3; j++) {
+      if ((mesh->triplets[i].triangle[j] < 0) ||
+          (mesh->triplets[i].triangle[j] >= mesh->numVertices)) {
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+void gVBAPRenderer_GetMeshKey(VBAP_MESH_KEY* key,
+                              const CICP2GEOMETRY_CHANNEL_GEOMETRY* outGeometryInfo,
+                              int outChannels, int outCICPIndex, int renderMode) {
+  /* Clear unused speaker entries so that keys can be compared as a whole. */
+  mpegh_FDKmemclear(key, sizeof(*key));
+
+  /* custom layouts are triangulated like an unknown output setting, see gVBAPRenderer_Open() */
+  key->cicpIndex = ((renderMode == GVBAP_ENHANCED) && !cicp2geometry_is_custom_layout(outCICPIndex))
+                       ? outCICPIndex
+                       : 0;
+  for (int i = 0; i < outChannels; i++) {
+    if (outGeometryInfo[i].LFE <= 0) {
+      /* same conversion as the speaker list of gVBAPRenderer_Open() */
+      key->azimuth[key->numSpeakers] = FIXP_DBL((INT)(outGeometryInfo[i].Az) * (INT)11930464);
+      key->elevation[key->numSpeakers] = FIXP_DBL((INT)(outGeometryInfo[i].El) * (INT)11930464);
+      key->numSpeakers++;
+    }
+  }
+}
+
+int gVBAPRenderer_LoadMesh(const VBAP_MESH_KEY* key, HANDLE_GVBAPRENDERER hgVBAPRenderer,
+                           vertexList* vL) {
+  SPEAKERSETUP* speakerSetup = &hgVBAPRenderer->speakerSetup;
+  const VBAP_MESH* mesh;
+  int slot;
+
+  std::lock_guard<std::mutex> lock(vbapMeshCacheLock);
+
+  slot = findMesh(key);
+  if (slot < 0) {
+    return 1;
+  }
+  vbapMeshCacheLastUse[slot] = ++vbapMeshCacheClock;
+  mesh = &vbapMeshCache[slot];
+
+  if ((speakerSetup->speakerTriplet =
+           (SPEAKERTRIPLET*)mpegh_FDKmalloc(mesh->numTriplets * sizeof(SPEAKERTRIPLET))) == NULL) {
+    return -2; /* could not allocate memory */
+  }
+  mpegh_FDKmemcpy(speakerSetup->speakerTriplet, mesh->triplets,
+                  mesh->numTriplets * sizeof(SPEAKERTRIPLET));
+  speakerSetup->speakerTripletSize = mesh->numTriplets;
+  speakerSetup->greatestInverseMatrixExponent = mesh->greatestInverseMatrixExponent;
+
+  hgVBAPRenderer->downmixMatrixNumRows = mesh->downmixMatrixNumRows;
+  hgVBAPRenderer->downmixMatrixNumCols = mesh->downmixMatrixNumCols;
+  if (mesh->hasDownmixMatrix) {
+    hgVBAPRenderer->downmixMatrix = (FIXP_DBL**)mpegh_fdkCallocMatrix2D(
+        mesh->downmixMatrixNumRows, mesh->downmixMatrixNumCols, sizeof(FIXP_DBL));
+    if (hgVBAPRenderer->downmixMatrix == NULL) {
+      return -2; /* could not allocate memory */
+    }
+    for (int row = 0; row < mesh->downmixMatrixNumRows; row++) {
+      mpegh_FDKmemcpy(hgVBAPRenderer->downmixMatrix[row], mesh->downmixMatrix[row],
+                      mesh->downmixMatrixNumCols * sizeof(FIXP_DBL));
+    }
+  }
+
+  vL->size = mesh->numVertices;
+  mpegh_FDKmemcpy(vL->element, mesh->vertices, mesh->numVertices * sizeof(vertex));
+
+  return 0;
+}
+
+void gVBAPRenderer_StoreMesh(const VBAP_MESH_KEY* key, HANDLE_GVBAPRENDERER hgVBAPRenderer,
+                             const vertexList* vL) {
+  const SPEAKERSETUP* speakerSetup = &hgVBAPRenderer->speakerSetup;
+  VBAP_MESH* mesh;
+
+  /* skip setups exceeding the fixed size of a mesh */
+  if ((vL->size > GVBAPRENDERER_VERTEX_LIST_MAX_SIZE) ||
+      (speakerSetup->speakerTripletSize > GVBAPRENDERER_TRIANGLE_LIST_MAX_SIZE) ||
+      ((hgVBAPRenderer->downmixMatrix != NULL) &&
+       ((hgVBAPRenderer->downmixMatrixNumRows > GVBAPRENDERER_MAX_CHANNEL_OUT) ||
+        (hgVBAPRenderer->downmixMatrixNumCols > GVBAPRENDERER_VERTEX_LIST_MAX_SIZE)))) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(vbapMeshCacheLock);
+
+  mesh = allocMesh(key);
+  mpegh_FDKmemclear(mesh, sizeof(*mesh));
+
+  mesh->version = GVBAP_MESH_VERSION;
+  mesh->size = sizeof(VBAP_MESH);
+  mpegh_FDKmemcpy(&mesh->key, key, sizeof(*key));
+
+  mesh->numVertices = vL->size;
+  mpegh_FDKmemcpy(mesh->vertices, vL->element, vL->size * sizeof(vertex));
+
+  mesh->numTriplets = speakerSetup->speakerTripletSize;
+  mpegh_FDKmemcpy(mesh->triplets, speakerSetup->speakerTriplet,
+                  speakerSetup->speakerTripletSize * sizeof(SPEAKERTRIPLET));
+  mesh->greatestInverseMatrixExponent = speakerSetup->greatestInverseMatrixExponent;
+
+  mesh->downmixMatrixNumRows = hgVBAPRenderer->downmixMatrixNumRows;
+  mesh->downmixMatrixNumCols = hgVBAPRenderer->downmixMatrixNumCols;
+  if (hgVBAPRenderer->downmixMatrix != NULL) {
+    mesh->hasDownmixMatrix = 1;
+    for (int row = 0; row < mesh->downmixMatrixNumRows; row++) {
+      mpegh_FDKmemcpy(mesh->downmixMatrix[row], hgVBAPRenderer->downmixMatrix[row],
+                      mesh->downmixMatrixNumCols * sizeof(FIXP_DBL));
+    }
+  }
+}
+
+UINT gVBAPRenderer_ExportMesh(const VBAP_MESH_KEY* key, void* data, UINT size) {
+  int slot;
+
+  if (size < sizeof(VBAP_MESH)) {
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> lock(vbapMeshCacheLock);
+
+  slot = findMesh(key);
+  if (slot < 0) {
+    return 0;
+  }
+  mpegh_FDKmemcpy(data, &vbapMeshCache[slot], sizeof(VBAP_MESH));
+
+  return sizeof(VBAP_MESH);
+}
+
+int gVBAPRenderer_ImportMesh(const void* data, UINT size) {
+  VBAP_MESH mesh;
+
+  if (size != sizeof(VBAP_MESH)) {
+    return -1;
+  }
+  /* Validate a copy, so that a rejected mesh does not evict a cached one. The copy also serves data
+   * of a compile-time table that is not aligned for VBAP_MESH. */
+  mpegh_FDKmemcpy(&mesh, data, sizeof(VBAP_MESH));
+  if ((mesh.version != GVBAP_MESH_VERSION) || (mesh.size != sizeof(VBAP_MESH)) ||
+      !isValidMesh(&mesh)) {
+    return -1;
+  }
+
+  std::lock_guard<std::mutex> lock(vbapMeshCacheLock);
+
+  mpegh_FDKmemcpy(allocMesh(&mesh.key), &mesh, sizeof(VBAP_MESH));
+
+  return 0;
+}
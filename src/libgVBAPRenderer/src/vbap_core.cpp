@@ -191,10 +191,22 @@ int generateInverseMatrices(HANDLE_GVBAPRENDERER hgVBAPRenderer) {
 
 void calculateVbap(HANDLE_GVBAPRENDERER hgVBAPRenderer, OAM_SAMPLE source, FIXP_DBL* final_gains,
                    int noDownmix) {
+  FIXP_DBL gain_norm_inv;
+  INT gain_norm_inv_exp;
+  int numSpeaker;
+
+  numSpeaker = calculateVbapUnitGains(hgVBAPRenderer, source, final_gains, noDownmix,
+                                      &gain_norm_inv, &gain_norm_inv_exp);
+  applyVbapGain(final_gains, final_gains, numSpeaker, gain_norm_inv, gain_norm_inv_exp,
+                source.gain);
+}
+
+int calculateVbapUnitGains(HANDLE_GVBAPRENDERER hgVBAPRenderer, OAM_SAMPLE source,
+                           FIXP_DBL* final_gains, int noDownmix, FIXP_DBL* gainNormInv,
+                           INT* gainNormInvExp) {
   int row, col;
   int i;
-  FIXP_DBL gain_norm = 0, gain_norm_inv = 0;
-  INT gain_norm_inv_exp = 0;
+  FIXP_DBL gain_norm = 0;
   int numSpeaker;
 
   numSpeaker = hgVBAPRenderer->numChannels - hgVBAPRenderer->numLFE;
@@ -232,17 +244,25 @@ void calculateVbap(HANDLE_GVBAPRENDERER hgVBAPRenderer, OAM_SAMPLE source, FIXP_
         fPow2Add(gain_norm, final_gains[i] >> 2); /* this will limit the number of speakers to 64 */
   }
 
-  gain_norm_inv = invSqrtNorm2(gain_norm, &gain_norm_inv_exp);
-  gain_norm_inv = fMult(gain_norm_inv, source.gain); /* Incorporate gainFactor */
+  *gainNormInv = invSqrtNorm2(gain_norm, gainNormInvExp);
+
+  return numSpeaker;
+}
+
+void applyVbapGain(const FIXP_DBL* unitGains, FIXP_DBL* final_gains, int numGains,
+                   FIXP_DBL gainNormInv, INT gainNormInvExp, FIXP_DBL gain) {
+  int i;
+
+  gainNormInv = fMult(gainNormInv, gain); /* Incorporate gainFactor */
 
   /* gain_norm should always be greater than each final_gains[i]
    * but if there is only one gain value in final_gains vector different from 0
    * it could be happen that gain_norm is a little smaller than final_gain[i] because of arithmetic
    * inaccuracy
    */
-  for (i = 0; i < numSpeaker; i++) {
-    FIXP_DBL tmp = fMult(final_gains[i] >> 2, gain_norm_inv);
-    final_gains[i] = scaleValueSaturate(tmp, gain_norm_inv_exp);
+  for (i = 0; i < numGains; i++) {
+    FIXP_DBL tmp = fMult(unitGains[i] >> 2, gainNormInv);
+    final_gains[i] = scaleValueSaturate(tmp, gainNormInvExp);
   }
 }
 
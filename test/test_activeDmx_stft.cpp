@@ -0,0 +1,354 @@
+/*-----------------------------------------------------------------------------
+Software License for The Fraunhofer FDK MPEG-H Software
+
+Copyright (c) 2018 - 2023 Fraunhofer-Gesellschaft zur Förderung der angewandten
+Forschung e.V. and Contributors
+All rights reserved.
+
+1. INTRODUCTION
+
+The "Fraunhofer FDK MPEG-H Software" is software that implements the ISO/MPEG
+MPEG-H 3D Audio standard for digital audio or related system features. Patent
+licenses for necessary patent claims for the Fraunhofer FDK MPEG-H Software
+(including those of Fraunhofer), for the use in commercial products and
+services, may be obtained from the respective patent owners individually and/or
+from Via LA (www.via-la.com).
+
+Fraunhofer supports the development of MPEG-H products and services by offering
+additional software, documentation, and technical advice. In addition, it
+operates the MPEG-H Trademark Program to ease interoperability testing of end-
+products. Please visit www.mpegh.com for more information.
+
+2. COPYRIGHT LICENSE
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted without payment of copyright license fees provided that you
+satisfy the following conditions:
+
+* You must retain the complete text of this software license in redistributions
+of the Fraunhofer FDK MPEG-H Software or your modifications thereto in source
+code form.
+
+* You must retain the complete text of this software license in the
+documentation and/or other materials provided with redistributions of
+the Fraunhofer FDK MPEG-H Software or your modifications thereto in binary form.
+You must make available free of charge copies of the complete source code of
+the Fraunhofer FDK MPEG-H Software and your modifications thereto to recipients
+of copies in binary form.
+
+* The name of Fraunhofer may not be used to endorse or promote products derived
+from the Fraunhofer FDK MPEG-H Software without prior written permission.
+
+* You may not charge copyright license fees for anyone to use, copy or
+distribute the Fraunhofer FDK MPEG-H Software or your modifications thereto.
+
+* Your modified versions of the Fraunhofer FDK MPEG-H Software must carry
+prominent notices stating that you changed the software and the date of any
+change. For modified versions of the Fraunhofer FDK MPEG-H Software, the term
+"Fraunhofer FDK MPEG-H Software" must be replaced by the term "Third-Party
+Modified Version of the Fraunhofer FDK MPEG-H Software".
+
+3. No PATENT LICENSE
+
+NO EXPRESS OR IMPLIED LICENSES TO ANY PATENT CLAIMS, including without
+limitation the patents of Fraunhofer, ARE GRANTED BY THIS SOFTWARE LICENSE.
+Fraunhofer provides no warranty of patent non-infringement with respect to this
+software. You may use this Fraunhofer FDK MPEG-H Software or modifications
+thereto only for purposes that are authorized by appropriate patent licenses.
+
+4. DISCLAIMER
+
+This Fraunhofer FDK MPEG-H Software is provided by Fraunhofer on behalf of the
+copyright holders and contributors "AS IS" and WITHOUT ANY EXPRESS OR IMPLIED
+WARRANTIES, including but not limited to the implied warranties of
+merchantability and fitness for a particular purpose. IN NO EVENT SHALL THE
+COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE for any direct, indirect,
+incidental, special, exemplary, or consequential damages, including but not
+limited to procurement of substitute goods or services; loss of use, data, or
+profits, or business interruption, however caused and on any theory of
+liability, whether in contract, strict liability, or tort (including
+negligence), arising in any way out of the use of this software, even if
+advised of the possibility of such damage.
+
+5. CONTACT INFORMATION
+
+Fraunhofer Institute for Integrated Circuits IIS
+Attention: Division Audio and Media Technologies - MPEG-H FDK
+Am Wolfsmantel 33
+91058 Erlangen, Germany
+www.iis.fraunhofer.de/amm
+amm-info@iis.fraunhofer.de
+-----------------------------------------------------------------------------*/
+
+/******************** MPEG-H 3DA channel rendering library *********************
+
+   Author(s):
+
+   Description: Bit-exactness test of the STFT active downmix kernels: the generic
+                and the run-time selected stftDmxBands() and stftDmxEq() kernels of
+                FDK_dspFuncs, and the platform versions of
+                activeDmxProcess_STFT_func1() and activeDmxProcess_STFT_func3()
+                against the generic loops of activeDmxProcess_STFT()
+
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* The static functions of the active downmix are tested directly */
+#include "FDK_formatConverter_activeDmx_stft.cpp"
+
+#define NUM_ITERATIONS 20000
+#define STFT_BINS 256
+
+static UINT testRandom(void) {
+  static UINT seed = 12345;
+  seed = seed * 1664525 + 1013904223;
+  return seed >> 8;
+}
+
+/* Random fixed point value, a saturation value in 1 of 8 cases if satur is set */
+static FIXP_DBL testValue(INT satur) {
+  UINT r = testRandom();
+  if (satur && ((r & 15) == 0)) return (FIXP_DBL)MINVAL_DBL;
+  if (satur && ((r & 15) == 1)) return (FIXP_DBL)MAXVAL_DBL;
+  return (FIXP_DBL)((INT)((testRandom() << 8) ^ testRandom()) >> (r % 12));
+}
+
+/* Random energy, including 0, 1 and the maximum */
+static FIXP_DBL testEnergy(void) {
+  UINT r = testRandom();
+  if ((r & 15) == 0) return (FIXP_DBL)0;
+  if ((r & 15) == 1) return (FIXP_DBL)1;
+  if ((r & 15) == 2) return (FIXP_DBL)MAXVAL_DBL;
+  return (FIXP_DBL)((testRandom() << 8 ^ testRandom()) & 0x7FFFFFFF) >> (r % 31);
+}
+
+static INT testCompare(const char* name, INT iter, const void* a, const void* b, UINT size) {
+  if (mpegh_FDKmemcmp(a, b, size) != 0) {
+    printf("%s: mismatch in iteration %d\n", name, iter);
+    return 1;
+  }
+  return 0;
+}
+
+/* stftDmxBands() and stftDmxEq() of the generic table against the run-time selected kernels */
+static INT testDspKernels(const FDK_DSP_FUNCS* generic) {
+  RAM_ALIGN FIXP_DBL in[2 * STFT_BINS], out0[2 * STFT_BINS], out1[2 * STFT_BINS];
+  RAM_ALIGN FIXP_DBL ene0[STFT_ERB_BANDS], ene1[STFT_ERB_BANDS], coeff[STFT_ERB_BANDS];
+  RAM_ALIGN FIXP_DBL targetEne[STFT_ERB_BANDS], realizedEne[STFT_ERB_BANDS];
+  RAM_ALIGN FIXP_DBL eq0[STFT_ERB_BANDS], eq1[STFT_ERB_BANDS];
+  INT hdr[STFT_ERB_BANDS], shr[STFT_ERB_BANDS];
+  SCHAR targetHdr[STFT_ERB_BANDS], realizedHdr[STFT_ERB_BANDS];
+  SCHAR eqExp0[STFT_ERB_BANDS], eqExp1[STFT_ERB_BANDS];
+  INT err = 0;
+
+  for (INT iter = 0; (iter < NUM_ITERATIONS) && !err; iter++) {
+    INT satur = iter & 1;
+    UINT numBands = 1 + testRandom() % STFT_ERB_BANDS;
+    INT eqExpOffset = testRandom() % 4;
+
+    for (INT i = 0; i < 2 * STFT_BINS; i++) {
+      in[i] = testValue(satur);
+      out0[i] = out1[i] = testValue(satur);
+    }
+    for (INT b = 0; b < STFT_ERB_BANDS; b++) {
+      ene0[b] = ene1[b] = testValue(0) & 0x0FFFFFFF;
+      coeff[b] = testValue(satur);
+      hdr[b] = testRandom() % 8;
+      shr[b] = 6 + testRandom() % 6;
+      targetEne[b] = testEnergy();
+      realizedEne[b] = testEnergy();
+      targetHdr[b] = (SCHAR)(testRandom() % 32);
+      realizedHdr[b] = (SCHAR)(testRandom() % 32);
+    }
+
+    generic->stftDmxBands(out0, in, ene0, erb_freq_idx_256_58, coeff, hdr, shr, numBands);
+    FDK_dspFuncs.stftDmxBands(out1, in, ene1, erb_freq_idx_256_58, coeff, hdr, shr, numBands);
+    err |= testCompare("stftDmxBands", iter, out0, out1, sizeof(out0));
+    err |= testCompare("stftDmxBands energy", iter, ene0, ene1, sizeof(ene0));
+
+    generic->stftDmxBands(out0, in, NULL, erb_freq_idx_256_58, coeff, NULL, NULL, numBands);
+    FDK_dspFuncs.stftDmxBands(out1, in, NULL, erb_freq_idx_256_58, coeff, NULL, NULL, numBands);
+    err |= testCompare("stftDmxBands without energy", iter, out0, out1, sizeof(out0));
+
+    generic->stftDmxEq(eq0, eqExp0, targetEne, realizedEne, targetHdr, realizedHdr, eqExpOffset,
+                       numBands);
+    FDK_dspFuncs.stftDmxEq(eq1, eqExp1, targetEne, realizedEne, targetHdr, realizedHdr,
+                           eqExpOffset, numBands);
+    err |= testCompare("stftDmxEq", iter, eq0, eq1, numBands * sizeof(FIXP_DBL));
+    err |= testCompare("stftDmxEq exponent", iter, eqExp0, eqExp1, numBands * sizeof(SCHAR));
+
+    /* The generic kernel against computeEQAndClip() of the format converter */
+    for (UINT b = 0; b < numBands; b++) {
+      INT exp;
+      FIXP_DBL eq = computeEQAndClip(targetEne[b], realizedEne[b], realizedHdr[b] - targetHdr[b],
+                                     eqExpOffset, &exp);
+      if ((eq != eq0[b]) || (exp != eqExp0[b])) {
+        printf("stftDmxEq: differs from computeEQAndClip() in iteration %d\n", iter);
+        err = 1;
+      }
+    }
+  }
+
+  return err;
+}
+
+#if defined(FUNCTION_activeDmxProcess_STFT_func1) && !defined(__arm__)
+/* The generic target energy and realized signal loop of activeDmxProcess_STFT() */
+static void testFunc1Generic(FIXP_DBL* inputBuffer, FIXP_DBL* realizedSig_chOut,
+                             FIXP_DBL* targetEnergy, const FIXP_DBL* eq_ptr,
+                             FIXP_DMX_H dmxMatrixL_FDK, FIXP_DMX_H dmxMatrixH_FDK,
+                             UINT erb_is4GVH_L, UINT erb_is4GVH_H, INT chOut_exp,
+                             INT dmx_iterations, const INT* inBufStftHeadroom) {
+  FIXP_DBL savIm0 = inputBuffer[1];
+  inputBuffer[1] = FIXP_DBL(0);
+
+  FIXP_DBL targetEne;
+  INT target_exp = 0;
+  FIXP_DBL tmpRe, tmpIm;
+  FIXP_DBL dmx_coeff = (FIXP_DBL)0;
+  FIXP_DMX_H dmx_coeff_mtx = dmxMatrixL_FDK;
+  UINT fftBand = 0, erb = 0;
+  UINT max_erb = erb_is4GVH_L;
+
+  for (INT it = 0; it < dmx_iterations; it++) {
+    for (; erb < max_erb; erb++) {
+      target_exp = erb_freq_idx_256_58_exp[erb] + chOut_exp;
+      UINT maxfftBand = erb_freq_idx_256_58[erb];
+
+      dmx_coeff = fMult(dmx_coeff_mtx, eq_ptr[erb]);
+      targetEne = targetEnergy[erb];
+      for (; fftBand < maxfftBand; fftBand++) {
+        tmpRe = fMult(dmx_coeff, inputBuffer[fftBand * 2 + 0] << inBufStftHeadroom[erb]);
+        tmpIm = fMult(dmx_coeff, inputBuffer[fftBand * 2 + 1] << inBufStftHeadroom[erb]);
+        realizedSig_chOut[fftBand * 2 + 0] =
+            fAddSaturate(realizedSig_chOut[fftBand * 2 + 0], tmpRe >> inBufStftHeadroom[erb]);
+        realizedSig_chOut[fftBand * 2 + 1] =
+            fAddSaturate(realizedSig_chOut[fftBand * 2 + 1], tmpIm >> inBufStftHeadroom[erb]);
+        targetEne += (fPow2Div2(tmpIm) + fPow2Div2(tmpRe)) >> target_exp;
+      }
+      targetEnergy[erb] = targetEne;
+    }
+    if (it == 0) {
+      max_erb = erb_is4GVH_H;
+      dmx_coeff_mtx = dmxMatrixH_FDK;
+    } else if (it == 1) {
+      max_erb = 58;
+      dmx_coeff_mtx = dmxMatrixL_FDK;
+    }
+  }
+  erb--;
+  inputBuffer[1] = savIm0;
+  tmpIm = fMult(dmx_coeff, savIm0 << inBufStftHeadroom[erb]);
+  realizedSig_chOut[1] = fAddSaturate(realizedSig_chOut[1], (tmpIm >> inBufStftHeadroom[erb]));
+  targetEnergy[erb] += (fPow2Div2(tmpIm) >> target_exp);
+}
+
+static INT testFunc1(void) {
+  RAM_ALIGN FIXP_DBL in[2 * STFT_BINS], out0[2 * STFT_BINS], out1[2 * STFT_BINS];
+  RAM_ALIGN FIXP_DBL ene0[STFT_ERB_BANDS], ene1[STFT_ERB_BANDS], eq[STFT_ERB_BANDS];
+  INT hdr[STFT_ERB_BANDS];
+  INT err = 0;
+
+  for (INT iter = 0; (iter < NUM_ITERATIONS) && !err; iter++) {
+    INT satur = iter & 1;
+    INT dmx_iterations = (iter & 2) ? 3 : 1;
+    UINT erb_is4GVH_L = (dmx_iterations == 3) ? testRandom() % STFT_ERB_BANDS : STFT_ERB_BANDS;
+    UINT erb_is4GVH_H = erb_is4GVH_L + testRandom() % (STFT_ERB_BANDS + 1 - erb_is4GVH_L);
+    FIXP_DMX_H dmxL = FX_DBL2FX_SGL(testValue(satur));
+    FIXP_DMX_H dmxH = FX_DBL2FX_SGL(testValue(satur));
+    INT chOut_exp = 2 + testRandom() % 3;
+
+    for (INT i = 0; i < 2 * STFT_BINS; i++) {
+      in[i] = testValue(satur);
+      out0[i] = out1[i] = testValue(satur);
+    }
+    for (INT b = 0; b < STFT_ERB_BANDS; b++) {
+      ene0[b] = ene1[b] = testValue(0) & 0x07FFFFFF;
+      eq[b] = testValue(satur);
+      hdr[b] = testRandom() % 32;
+    }
+
+    testFunc1Generic(in, out0, ene0, eq, dmxL, dmxH, erb_is4GVH_L, erb_is4GVH_H, chOut_exp,
+                     dmx_iterations, hdr);
+    activeDmxProcess_STFT_func1(in, out1, ene1, erb_freq_idx_256_58, eq, dmxL, dmxH, erb_is4GVH_L,
+                                erb_is4GVH_H, chOut_exp, dmx_iterations, hdr);
+    err |= testCompare("activeDmxProcess_STFT_func1", iter, out0, out1, sizeof(out0));
+    err |= testCompare("activeDmxProcess_STFT_func1 energy", iter, ene0, ene1, sizeof(ene0));
+  }
+
+  return err;
+}
+#endif /* FUNCTION_activeDmxProcess_STFT_func1 */
+
+#if defined(FUNCTION_activeDmxProcess_STFT_func3) && !defined(__arm__)
+/* The generic EQ loop of activeDmxProcess_STFT() */
+static void testFunc3Generic(const FIXP_DBL* targetEne_ChOut, FIXP_DBL* realizedSig_ChOut,
+                             const FIXP_DBL* realizedEne_ChOut, const SCHAR* inBufStftHeadroomPrev,
+                             const SCHAR* realizedSigHeadroomPrev, INT eq_e) {
+  INT EQ_exp = 0;
+  FIXP_DBL EQ = (FIXP_DBL)0;
+  UINT fftBand = 0;
+
+  for (UINT erb = 0; erb < STFT_ERB_BANDS; erb++) {
+    INT diffExp = realizedSigHeadroomPrev[erb] - inBufStftHeadroomPrev[erb];
+    EQ = computeEQAndClip(targetEne_ChOut[erb], realizedEne_ChOut[erb], diffExp, eq_e, &EQ_exp);
+    for (; fftBand < erb_freq_idx_256_58[erb]; fftBand++) {
+      realizedSig_ChOut[fftBand * 2 + 0] = fMult(EQ, realizedSig_ChOut[fftBand * 2 + 0]) << EQ_exp;
+      if (fftBand != 0) {
+        realizedSig_ChOut[fftBand * 2 + 1] = fMult(EQ, realizedSig_ChOut[fftBand * 2 + 1])
+                                             << EQ_exp;
+      }
+    }
+  }
+  realizedSig_ChOut[1] = fMult(EQ, realizedSig_ChOut[1]) << EQ_exp;
+}
+
+static INT testFunc3(void) {
+  RAM_ALIGN FIXP_DBL sig0[2 * STFT_BINS], sig1[2 * STFT_BINS], eq[STFT_ERB_BANDS];
+  RAM_ALIGN FIXP_DBL targetEne[STFT_ERB_BANDS], realizedEne[STFT_ERB_BANDS];
+  SCHAR targetHdr[STFT_ERB_BANDS], realizedHdr[STFT_ERB_BANDS];
+  INT err = 0;
+
+  for (INT iter = 0; (iter < NUM_ITERATIONS) && !err; iter++) {
+    INT eq_e = (iter & 1) ? EQ_BITSTREAM_H_EXP : EQ_H_EXP;
+
+    for (INT i = 0; i < 2 * STFT_BINS; i++) {
+      sig0[i] = sig1[i] = testValue(1);
+    }
+    for (INT b = 0; b < STFT_ERB_BANDS; b++) {
+      targetEne[b] = testEnergy();
+      realizedEne[b] = testEnergy();
+      targetHdr[b] = (SCHAR)(testRandom() % 32);
+      realizedHdr[b] = (SCHAR)(testRandom() % 32);
+    }
+
+    testFunc3Generic(targetEne, sig0, realizedEne, targetHdr, realizedHdr, eq_e);
+    activeDmxProcess_STFT_func3(targetEne, sig1, realizedEne, eq, erb_freq_idx_256_58,
+                                STFT_ERB_BANDS, targetHdr, realizedHdr, eq_e);
+    err |= testCompare("activeDmxProcess_STFT_func3", iter, sig0, sig1, sizeof(sig0));
+  }
+
+  return err;
+}
+#endif /* FUNCTION_activeDmxProcess_STFT_func3 */
+
+int main(void) {
+  /* The table holds the generic kernels until FDK_dspInit() */
+  const FDK_DSP_FUNCS generic = FDK_dspFuncs;
+  INT err = 0;
+
+  FDK_dspInit();
+
+  err |= testDspKernels(&generic);
+#if defined(FUNCTION_activeDmxProcess_STFT_func1) && !defined(__arm__)
+  err |= testFunc1();
+#endif
+#if defined(FUNCTION_activeDmxProcess_STFT_func3) && !defined(__arm__)
+  err |= testFunc3();
+#endif
+
+  printf("%s\n", err ? "FAILED" : "OK");
+  return err;
+}